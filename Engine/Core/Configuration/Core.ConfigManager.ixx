@@ -5,11 +5,14 @@
 module;
 
 #include "JsonWrapper.hpp"
+#include "JsonView.hpp"
+#include <functional>
 #include <unordered_map>
 
 export module Akhanda.Core.Configuration.Manager;
 
 import Akhanda.Core.Configuration;
+import Akhanda.Core.Configuration.Publisher;
 
 export namespace Akhanda::Configuration {
 
@@ -22,6 +25,7 @@ export namespace Akhanda::Configuration {
         struct InitializationOptions {
             std::filesystem::path configDirectory = "Config";
             std::string mainConfigFile = "engine.json";
+            std::string snapshotFile = "engine.snapshot";   // Binary copy of the main config; empty disables it
             bool createMissingFiles = true;
         };
 
@@ -80,13 +84,61 @@ export namespace Akhanda::Configuration {
             return Instance().SaveAllSectionsImpl();
         }
 
+        // Re-reads the main config file and reloads only the sections whose
+        // values changed since it was last loaded or saved
         static ConfigResult_t<bool> LoadAllSections() {
             return Instance().LoadAllSectionsImpl();
         }
 
+        // Called once per reload that changed anything, with every changed path
+        using ReloadCallback = std::function<void(const ConfigChangeSet& changes)>;
+        static void OnReload(ReloadCallback callback) {
+            Instance().reloadCallbacks_.push_back(std::move(callback));
+        }
+
+        // ========================================================================
+        // Lock-Free Reads
+        // ========================================================================
+
+        // A copy of the section as last loaded or updated. Safe to call from
+        // any thread without locking while the section reloads; sections
+        // read through GetOrCreateSection must not be used that way.
+        template<typename T>
+        static ConfigSnapshot<T> Read() noexcept {
+            static_assert(is_config_section_v<T>, "T must be a configuration section");
+            return Publisher<T>().Read();
+        }
+
+        // Changes the section and publishes the result to readers. The edit
+        // runs under the publisher's write lock, so concurrent updates apply
+        // one after another and none is lost.
+        template<typename T, typename Edit>
+        static void Update(Edit&& edit) {
+            static_assert(is_config_section_v<T>, "T must be a configuration section");
+            auto section = GetOrCreateSection<T>();
+            Publisher<T>().Update([&](T& value) {
+                std::forward<Edit>(edit)(*section);
+                value = *section;
+            });
+        }
+
     private:
         ConfigManager() = default;
 
+        // One per section type, alive for the whole program so readers never
+        // need the section map
+        template<typename T>
+        static ConfigPublisher<T>& Publisher() {
+            static ConfigPublisher<T> publisher;
+            return publisher;
+        }
+
+        template<typename T>
+        void AddSection(const std::string& sectionName, const std::shared_ptr<T>& section) {
+            configSections_[sectionName] = section;
+            sectionPublishers_[sectionName] = [section] { Publisher<T>().Publish(*section); };
+        }
+
         bool InitializeImpl(const InitializationOptions& options) {
             if (isInitialized_) {
                 return true;
@@ -108,15 +160,15 @@ export namespace Akhanda::Configuration {
             auto configPath = options_.configDirectory / options_.mainConfigFile;
             if (std::filesystem::exists(configPath)) {
                 try {
-                    mainConfig_ = JsonValue::FromFile(configPath);
+                    mainConfig_ = LoadMainConfig(configPath);
                 }
                 catch (...) {
                     // If loading fails, start with empty config
-                    mainConfig_ = ConfigJson::CreateObject();
+                    mainConfig_ = JsonDocument::FromValue(ConfigJson::CreateObject());
                 }
             }
             else {
-                mainConfig_ = ConfigJson::CreateObject();
+                mainConfig_ = JsonDocument::FromValue(ConfigJson::CreateObject());
             }
 
             isInitialized_ = true;
@@ -132,6 +184,8 @@ export namespace Akhanda::Configuration {
             SaveAllSectionsImpl();
 
             configSections_.clear();
+            sectionPublishers_.clear();
+            reloadCallbacks_.clear();
             isInitialized_ = false;
         }
 
@@ -148,14 +202,14 @@ export namespace Akhanda::Configuration {
 
             // Create new section
             auto section = std::make_shared<T>();
-            configSections_[sectionName] = section;
+            AddSection(sectionName, section);
 
             // Load from JSON if available
-            if (mainConfig_.Contains(sectionName)) {
-                auto sectionJson = mainConfig_[sectionName];
+            if (const JsonView sectionJson = mainConfig_.Root()[sectionName]; sectionJson.Exists()) {
                 section->LoadFromJson(sectionJson);
             }
 
+            Publisher<T>().Publish(*section);
             return section;
         }
 
@@ -176,11 +230,10 @@ export namespace Akhanda::Configuration {
 
             // Create and register section
             auto section = std::make_shared<T>();
-            configSections_[sectionName] = section;
+            AddSection(sectionName, section);
 
             // Load from JSON if available
-            if (mainConfig_.Contains(sectionName)) {
-                auto sectionJson = mainConfig_[sectionName];
+            if (const JsonView sectionJson = mainConfig_.Root()[sectionName]; sectionJson.Exists()) {
                 auto loadResult = section->LoadFromJson(sectionJson);
                 if (!loadResult) {
                     return ConfigError(loadResult.Error().result,
@@ -188,6 +241,7 @@ export namespace Akhanda::Configuration {
                 }
             }
 
+            Publisher<T>().Publish(*section);
             return section;
         }
 
@@ -197,19 +251,22 @@ export namespace Akhanda::Configuration {
             }
 
             try {
-                // Update main config with all sections
+                // Update a mutable copy of the main config with all sections
+                JsonValue config = mainConfig_.Root().IsObject() ? mainConfig_.Root().ToValue() : ConfigJson::CreateObject();
                 for (const auto& [sectionName, section] : configSections_) {
                     auto sectionJson = section->SaveToJson();
-                    ConfigJson::SetSection(mainConfig_, sectionName, sectionJson);
+                    ConfigJson::SetSection(config, sectionName, sectionJson);
                 }
 
                 // Save to file
                 auto configPath = options_.configDirectory / options_.mainConfigFile;
-                if (!mainConfig_.ToFile(configPath)) {
+                if (!config.ToFile(configPath)) {
                     return ConfigError(ConfigResult::FileNotFound,
                         std::format("Failed to save configuration to: {}", configPath.string()));
                 }
 
+                mainConfig_ = JsonDocument::FromValue(config);
+
                 return true;
             }
             catch (const std::exception& e) {
@@ -226,26 +283,79 @@ export namespace Akhanda::Configuration {
             try {
                 // Reload main config file
                 auto configPath = options_.configDirectory / options_.mainConfigFile;
+                JsonDocument previous = mainConfig_;
                 if (std::filesystem::exists(configPath)) {
-                    mainConfig_ = JsonValue::FromFile(configPath);
+                    mainConfig_ = LoadMainConfig(configPath);
                 }
                 else {
                     return ConfigError(ConfigResult::FileNotFound,
                         std::format("Configuration file not found: {}", configPath.string()));
                 }
 
-                // Reload all sections
-                for (const auto& [sectionName, section] : configSections_) {
-                    if (mainConfig_.Contains(sectionName)) {
-                        auto sectionJson = mainConfig_[sectionName];
-                        auto loadResult = section->LoadFromJson(sectionJson);
-                        if (!loadResult) {
-                            return ConfigError(loadResult.Error().result,
-                                std::format("Failed to reload section '{}': {}", sectionName, loadResult.Error().message));
+                const ConfigChangeSet changes(DiffJson(previous.Root(), mainConfig_.Root()));
+                if (changes.IsEmpty()) {
+                    return true;
+                }
+
+                // Reload only the sections the edit touched. Value callbacks
+                // run when the transaction ends, after every section loaded.
+                struct ReloadedSection {
+                    const std::string* name;
+                    IConfigSection* section;
+                    JsonValue saved;
+                    ConfigChangeSet changes;
+                };
+                std::vector<ReloadedSection> reloaded;
+                {
+                    ConfigTransaction transaction;
+                    const size_t deferred = ConfigTransaction::GetDeferredCount();
+
+                    // A section that fails puts back every section this reload
+                    // changed, itself included, and the previous document, so
+                    // nothing is half applied and the next reload diffs against it
+                    const auto rollBack = [&] {
+                        for (const ReloadedSection& entry : reloaded) {
+                            entry.section->LoadFromJson(JsonDocument::FromValue(entry.saved).Root());
+                        }
+                        ConfigTransaction::DiscardDeferred(deferred);
+                        mainConfig_ = std::move(previous);
+                    };
+
+                    for (const auto& [sectionName, section] : configSections_) {
+                        if (!changes.Affects(sectionName)) {
+                            continue;
                         }
+                        if (const JsonView sectionJson = mainConfig_.Root()[sectionName]; sectionJson.Exists()) {
+                            reloaded.push_back({ &sectionName, section.get(), section->SaveToJson(), changes.Under(sectionName) });
+                            ConfigResult_t<bool> loadResult = false;
+                            try {
+                                loadResult = section->LoadFromJson(sectionJson);
+                            }
+                            catch (...) {
+                                rollBack();
+                                throw;
+                            }
+                            if (!loadResult) {
+                                rollBack();
+                                return ConfigError(loadResult.Error().result,
+                                    std::format("Failed to reload section '{}': {}", sectionName, loadResult.Error().message));
+                            }
+                        }
+                    }
+
+                    // Readers see the reloaded sections only once all of them loaded
+                    for (const ReloadedSection& entry : reloaded) {
+                        sectionPublishers_.at(*entry.name)();
                     }
                 }
 
+                for (const ReloadedSection& entry : reloaded) {
+                    entry.section->OnReloaded(entry.changes);
+                }
+                for (const auto& callback : reloadCallbacks_) {
+                    callback(changes);
+                }
+
                 return true;
             }
             catch (const std::exception& e) {
@@ -254,14 +364,25 @@ export namespace Akhanda::Configuration {
             }
         }
 
+        // The snapshot is only a cache: it is used while it matches the JSON
+        // text and rebuilt from the text whenever it does not
+        JsonDocument LoadMainConfig(const std::filesystem::path& configPath) const {
+            if (options_.snapshotFile.empty()) {
+                return JsonDocument::FromFile(configPath);
+            }
+            return JsonDocument::FromFileWithSnapshot(configPath, options_.configDirectory / options_.snapshotFile);
+        }
+
         // ========================================================================
         // Private Members
         // ========================================================================
 
         bool isInitialized_ = false;
         InitializationOptions options_;
-        JsonValue mainConfig_;
+        JsonDocument mainConfig_;      // Read-only; saving builds a JsonValue and replaces it
         std::unordered_map<std::string, std::shared_ptr<IConfigSection>> configSections_;
+        std::unordered_map<std::string, std::function<void()>> sectionPublishers_;
+        std::vector<ReloadCallback> reloadCallbacks_;
     };
 
     // ============================================================================
@@ -0,0 +1,167 @@
+// Core.ConfigPublisher.cpp
+// Akhanda Game Engine - Epoch reclamation for published configuration
+// Copyright (c) 2025 Aditya Vennelakanti. All rights reserved.
+
+module;
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+module Akhanda.Core.Configuration.Publisher;
+
+using namespace Akhanda::Configuration;
+
+// =============================================================================
+// Overview
+// =============================================================================
+//
+//   Reader: epoch = globalEpoch (acquire); slot = epoch; pointer load
+//   Writer: pointer store; E = globalEpoch++; retire old with E; scan slots
+//
+//   All three of the slot store, pointer load and pointer store are
+//   sequentially consistent, so a reader that still loaded the old pointer
+//   announced its epoch before the writer scanned, and that epoch is at most
+//   E. A reader that announced a later epoch read it after the increment and
+//   so loads the new pointer. Slots are never freed, only reused, so the
+//   scan needs no lock against readers.
+//
+
+namespace {
+
+    struct alignas(64) ReaderSlot {
+        std::atomic<std::uint64_t> epoch{ 0 };  // 0 while the owner holds no snapshot
+        std::atomic<bool> owned{ false };
+        ReaderSlot* next = nullptr;
+    };
+
+    struct RetiredObject {
+        const void* object;
+        EpochReclaimer::Deleter deleter;
+        std::uint64_t epoch;
+    };
+
+    constinit std::atomic<std::uint64_t> g_globalEpoch{ 1 };
+    constinit std::atomic<ReaderSlot*> g_slots{ nullptr };
+    constinit std::atomic<size_t> g_slotCount{ 0 };
+
+    // Never destroyed, so publishers destroyed during static destruction
+    // can still retire into it
+    struct RetiredList {
+        std::mutex mutex;
+        std::vector<RetiredObject> objects;
+    };
+
+    RetiredList& Retired() {
+        static RetiredList* list = new RetiredList();
+        return *list;
+    }
+
+    ReaderSlot* ClaimSlot() {
+        for (ReaderSlot* slot = g_slots.load(std::memory_order_acquire); slot; slot = slot->next) {
+            bool expected = false;
+            if (!slot->owned.load(std::memory_order_relaxed) &&
+                slot->owned.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return slot;
+            }
+        }
+
+        ReaderSlot* slot = new ReaderSlot();
+        slot->owned.store(true, std::memory_order_relaxed);
+        slot->next = g_slots.load(std::memory_order_relaxed);
+        while (!g_slots.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        g_slotCount.fetch_add(1, std::memory_order_relaxed);
+        return slot;
+    }
+
+    struct ThreadReader {
+        ReaderSlot* slot = nullptr;
+        std::uint32_t depth = 0;
+
+        ~ThreadReader() {
+            if (slot) {
+                slot->epoch.store(0, std::memory_order_release);
+                slot->owned.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    thread_local ThreadReader t_reader;
+
+} // namespace
+
+// =============================================================================
+// EpochReclaimer Implementation
+// =============================================================================
+
+void EpochReclaimer::Enter() noexcept {
+    ThreadReader& reader = t_reader;
+    if (reader.depth++ > 0) {
+        return;     // The outer read's older epoch already protects this one
+    }
+    if (!reader.slot) {
+        reader.slot = ClaimSlot();
+    }
+    reader.slot->epoch.store(g_globalEpoch.load(std::memory_order_acquire), std::memory_order_seq_cst);
+}
+
+void EpochReclaimer::Leave() noexcept {
+    ThreadReader& reader = t_reader;
+    if (--reader.depth == 0) {
+        reader.slot->epoch.store(0, std::memory_order_release);
+    }
+}
+
+std::uint64_t EpochReclaimer::Advance() noexcept {
+    return g_globalEpoch.fetch_add(1, std::memory_order_seq_cst);
+}
+
+void EpochReclaimer::Retire(const void* object, Deleter deleter, std::uint64_t epoch) {
+    RetiredList& retired = Retired();
+    std::lock_guard<std::mutex> lock(retired.mutex);
+    retired.objects.push_back({ object, deleter, epoch });
+}
+
+size_t EpochReclaimer::Reclaim() {
+    std::vector<RetiredObject> ready;
+    {
+        RetiredList& retired = Retired();
+        std::lock_guard<std::mutex> lock(retired.mutex);
+        if (retired.objects.empty()) {
+            return 0;
+        }
+
+        std::uint64_t oldestActive = std::numeric_limits<std::uint64_t>::max();
+        for (ReaderSlot* slot = g_slots.load(std::memory_order_acquire); slot; slot = slot->next) {
+            const std::uint64_t epoch = slot->epoch.load(std::memory_order_seq_cst);
+            if (epoch != 0) {
+                oldestActive = std::min(oldestActive, epoch);
+            }
+        }
+
+        const auto firstKept = std::stable_partition(retired.objects.begin(), retired.objects.end(),
+            [oldestActive](const RetiredObject& object) { return object.epoch < oldestActive; });
+        ready.assign(retired.objects.begin(), firstKept);
+        retired.objects.erase(retired.objects.begin(), firstKept);
+    }
+
+    // Deleters run without the lock; they may destroy publishers that retire
+    for (const RetiredObject& object : ready) {
+        object.deleter(object.object);
+    }
+    return ready.size();
+}
+
+size_t EpochReclaimer::GetPendingCount() {
+    RetiredList& retired = Retired();
+    std::lock_guard<std::mutex> lock(retired.mutex);
+    return retired.objects.size();
+}
+
+size_t EpochReclaimer::GetSlotCount() noexcept {
+    return g_slotCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,163 @@
+// Core.ConfigPublisher.ixx
+// Akhanda Game Engine - Lock-Free Configuration Publication
+// Copyright (c) 2025 Aditya Vennelakanti. All rights reserved.
+
+module;
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+export module Akhanda.Core.Configuration.Publisher;
+
+export namespace Akhanda::Configuration {
+
+    // ============================================================================
+    // Epoch Reclamation
+    // ============================================================================
+
+    // Decides when a retired object can no longer be seen by any reader.
+    // A reading thread announces the global epoch in its own slot for as
+    // long as it holds a snapshot; an object retired in epoch E is freed once
+    // every announced epoch is later than E. Reads may nest on one thread.
+    // Threads get a slot on their first read and give it back when they exit.
+    class EpochReclaimer {
+    public:
+        using Deleter = void(*)(const void*);
+
+        static void Enter() noexcept;
+        static void Leave() noexcept;
+
+        // Ends the current epoch and returns it, after the caller has made
+        // an object unreachable. Retire the object with that epoch.
+        static std::uint64_t Advance() noexcept;
+        static void Retire(const void* object, Deleter deleter, std::uint64_t epoch);
+
+        // Frees every retired object no reader can still hold; returns how many
+        static size_t Reclaim();
+
+        static size_t GetPendingCount();
+        static size_t GetSlotCount() noexcept;
+    };
+
+    // ============================================================================
+    // Configuration Snapshot
+    // ============================================================================
+
+    // A read of one published version. The value never changes and stays
+    // alive while the snapshot does, so hold snapshots briefly: the versions
+    // replaced in the meantime are only freed after it is released.
+    // The read is announced in the reading thread's slot, so a snapshot
+    // cannot be moved or copied and must be released on that thread.
+    template<typename T>
+    class ConfigSnapshot {
+    public:
+        ~ConfigSnapshot() { Release(); }
+
+        ConfigSnapshot(const ConfigSnapshot&) = delete;
+        ConfigSnapshot& operator=(const ConfigSnapshot&) = delete;
+
+        // Ends the read before the snapshot goes out of scope
+        void Reset() noexcept { Release(); }
+
+        const T& operator*() const noexcept { return *value_; }
+        const T* operator->() const noexcept { return value_; }
+        const T* Get() const noexcept { return value_; }
+
+        // Starts at 1 and increases with every publish
+        std::uint64_t GetVersion() const noexcept { return version_; }
+
+        explicit operator bool() const noexcept { return value_ != nullptr; }
+
+    private:
+        template<typename> friend class ConfigPublisher;
+
+        ConfigSnapshot(const T* value, std::uint64_t version) noexcept : value_(value), version_(version) {}
+
+        void Release() noexcept {
+            if (value_) {
+                value_ = nullptr;
+                EpochReclaimer::Leave();
+            }
+        }
+
+        const T* value_ = nullptr;
+        std::uint64_t version_ = 0;
+    };
+
+    // ============================================================================
+    // Configuration Publisher
+    // ============================================================================
+
+    // Holds the current version of a value behind an atomic pointer. Readers
+    // never block and always see one complete version; writers copy, change
+    // and swap in a new version, and are serialized among themselves.
+    template<typename T>
+    class ConfigPublisher {
+    public:
+        ConfigPublisher() : ConfigPublisher(T{}) {}
+        explicit ConfigPublisher(T initial) : current_(new Version{ std::move(initial), 1 }) {}
+
+        // Must not be destroyed while a snapshot of it is held
+        ~ConfigPublisher() {
+            RetireVersion(current_.load(std::memory_order_relaxed));
+            EpochReclaimer::Reclaim();
+        }
+
+        ConfigPublisher(const ConfigPublisher&) = delete;
+        ConfigPublisher& operator=(const ConfigPublisher&) = delete;
+
+        // One load after announcing the epoch; a sequentially consistent
+        // load compiles to a plain acquire load on x64 and ARM64
+        ConfigSnapshot<T> Read() const noexcept {
+            EpochReclaimer::Enter();
+            const Version* version = current_.load(std::memory_order_seq_cst);
+            return ConfigSnapshot<T>(&version->value, version->number);
+        }
+
+        // Returns the new version number
+        std::uint64_t Publish(T value) {
+            std::lock_guard<std::mutex> lock(writeMutex_);
+            return Swap(std::move(value));
+        }
+
+        // Publishes a copy of the current version changed by edit(T&)
+        template<typename Edit>
+        std::uint64_t Update(Edit&& edit) {
+            std::lock_guard<std::mutex> lock(writeMutex_);
+            T value = current_.load(std::memory_order_relaxed)->value;
+            std::forward<Edit>(edit)(value);
+            return Swap(std::move(value));
+        }
+
+        std::uint64_t GetVersion() const noexcept {
+            return current_.load(std::memory_order_acquire)->number;
+        }
+
+    private:
+        struct Version {
+            T value;
+            std::uint64_t number;
+        };
+
+        std::uint64_t Swap(T value) {
+            const Version* previous = current_.load(std::memory_order_relaxed);
+            const std::uint64_t number = previous->number + 1;
+            current_.store(new Version{ std::move(value), number }, std::memory_order_seq_cst);
+            RetireVersion(previous);
+            EpochReclaimer::Reclaim();
+            return number;
+        }
+
+        static void RetireVersion(const Version* version) {
+            EpochReclaimer::Retire(version, [](const void* object) { delete static_cast<const Version*>(object); },
+                EpochReclaimer::Advance());
+        }
+
+        std::atomic<const Version*> current_;
+        std::mutex writeMutex_;
+    };
+
+} // namespace Akhanda::Configuration
@@ -5,7 +5,11 @@
 module;
 
 #include "JsonWrapper.hpp"
+#include "JsonView.hpp"
+#include <concepts>
 #include <functional>
+#include <string_view>
+#include <vector>
 
 export module Akhanda.Core.Configuration;
 
@@ -74,6 +78,57 @@ export namespace Akhanda::Configuration {
         ConfigError error_;
     };
 
+    // ============================================================================
+    // Configuration Transactions
+    // ============================================================================
+
+    // Holds back ConfigValue change callbacks made on this thread until the
+    // outermost transaction ends, so a reload that changes several values
+    // notifies only after all of them are applied. Values still change at
+    // once; callbacks then run in the order the changes were made.
+    class ConfigTransaction {
+    public:
+        ConfigTransaction() noexcept { ++State().depth; }
+
+        ~ConfigTransaction() {
+            ThreadState& state = State();
+            if (--state.depth > 0) {
+                return;
+            }
+            // Callbacks may change values again, which notifies them directly
+            std::vector<std::function<void()>> pending = std::move(state.pending);
+            state.pending.clear();
+            for (const auto& notify : pending) {
+                notify();
+            }
+        }
+
+        ConfigTransaction(const ConfigTransaction&) = delete;
+        ConfigTransaction& operator=(const ConfigTransaction&) = delete;
+
+        static bool IsActive() noexcept { return State().depth > 0; }
+
+        static void Defer(std::function<void()> notify) {
+            State().pending.push_back(std::move(notify));
+        }
+
+        // Drops the callbacks deferred after GetDeferredCount returned mark,
+        // once the changes they report have been undone
+        static size_t GetDeferredCount() noexcept { return State().pending.size(); }
+        static void DiscardDeferred(size_t mark) { State().pending.resize(mark); }
+
+    private:
+        struct ThreadState {
+            std::uint32_t depth = 0;
+            std::vector<std::function<void()>> pending;
+        };
+
+        static ThreadState& State() noexcept {
+            thread_local ThreadState state;
+            return state;
+        }
+    };
+
     // ============================================================================
     // Configuration Value Template
     // ============================================================================
@@ -114,18 +169,27 @@ export namespace Akhanda::Configuration {
                 return ConfigError(ConfigResult::ValidationError, "Custom validation failed");
             }
 
-            T oldValue = value_;
-            value_ = newValue;
+            // Reloads set every value they read; only real changes notify
+            if constexpr (std::equality_comparable<T>) {
+                if (hasValue_ && value_ == newValue) {
+                    return true;
+                }
+            }
+
+            T oldValue = std::move(value_);
+            value_ = std::move(newValue);
             hasValue_ = true;
 
-            // Notify change callbacks
-            for (const auto& callback : changeCallbacks_) {
-                try {
-                    callback(oldValue, newValue);
-                }
-                catch (...) {
-                    // Log error but don't fail the operation
-                }
+            if (changeCallbacks_.empty()) {
+                return true;
+            }
+            if (ConfigTransaction::IsActive()) {
+                ConfigTransaction::Defer([this, oldValue = std::move(oldValue), newValue = value_] {
+                    NotifyChange(oldValue, newValue);
+                });
+            }
+            else {
+                NotifyChange(oldValue, value_);
             }
 
             return true;
@@ -171,7 +235,7 @@ export namespace Akhanda::Configuration {
             return j;
         }
 
-        ConfigResult_t<bool> FromJson(const JsonValue& j) {
+        ConfigResult_t<bool> FromJson(const JsonView& j) {
             try {
                 if (!j.Contains("value")) {
                     return ConfigError(ConfigResult::KeyNotFound, "Missing 'value' field");
@@ -187,6 +251,17 @@ export namespace Akhanda::Configuration {
         }
 
     private:
+        void NotifyChange(const T& oldValue, const T& newValue) const {
+            for (const auto& callback : changeCallbacks_) {
+                try {
+                    callback(oldValue, newValue);
+                }
+                catch (...) {
+                    // Log error but don't fail the operation
+                }
+            }
+        }
+
         T value_{};
         T defaultValue_{};
         T minValue_{};  // Only used for arithmetic types
@@ -227,7 +302,7 @@ export namespace Akhanda::Configuration {
             return j;
         }
 
-        static ConfigResult_t<Resolution> FromJson(const JsonValue& j) {
+        static ConfigResult_t<Resolution> FromJson(const JsonView& j) {
             try {
                 Resolution res;
                 res.width = GetConfigValue<std::uint32_t>(j, "width", 1920);
@@ -246,6 +321,56 @@ export namespace Akhanda::Configuration {
         }
     };
 
+    // ============================================================================
+    // Configuration Changes
+    // ============================================================================
+
+    // Key paths, in JsonView::AtPath form, whose values differ between two
+    // loads of a configuration. An empty path means everything changed.
+    class ConfigChangeSet {
+    public:
+        ConfigChangeSet() = default;
+        explicit ConfigChangeSet(std::vector<std::string> paths) : paths_(std::move(paths)) {}
+
+        const std::vector<std::string>& GetPaths() const noexcept { return paths_; }
+        bool IsEmpty() const noexcept { return paths_.empty(); }
+
+        // Whether path, anything inside it, or anything containing it changed
+        bool Affects(std::string_view path) const noexcept {
+            for (const std::string& changed : paths_) {
+                if (IsWithin(changed, path) || IsWithin(path, changed)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // The changes that affect prefix, relative to it
+        ConfigChangeSet Under(std::string_view prefix) const {
+            std::vector<std::string> paths;
+            for (const std::string& changed : paths_) {
+                if (IsWithin(changed, prefix) && changed.size() > prefix.size()) {
+                    paths.push_back(changed.substr(prefix.empty() ? 0 : prefix.size() + 1));
+                }
+                else if (IsWithin(prefix, changed)) {
+                    paths.clear();
+                    paths.emplace_back();
+                    break;
+                }
+            }
+            return ConfigChangeSet(std::move(paths));
+        }
+
+    private:
+        // Whether path names outer itself or something inside it
+        static bool IsWithin(std::string_view path, std::string_view outer) noexcept {
+            return outer.empty() || path == outer ||
+                (path.size() > outer.size() && path.starts_with(outer) && path[outer.size()] == '.');
+        }
+
+        std::vector<std::string> paths_;
+    };
+
     // ============================================================================
     // Configuration Section Interface
     // ============================================================================
@@ -254,9 +379,10 @@ export namespace Akhanda::Configuration {
     public:
         virtual ~IConfigSection() = default;
 
-        // Core interface
+        // Core interface. Sections read from a view into the loaded document
+        // and write a new value when saved.
         virtual const char* GetSectionName() const noexcept = 0;
-        virtual ConfigResult_t<bool> LoadFromJson(const JsonValue& sectionJson) = 0;
+        virtual ConfigResult_t<bool> LoadFromJson(const JsonView& sectionJson) = 0;
         virtual JsonValue SaveToJson() const = 0;
         virtual ConfigResult_t<bool> Validate() const = 0;
         virtual std::vector<std::string> GetValidationErrors() const = 0;
@@ -266,6 +392,10 @@ export namespace Akhanda::Configuration {
         virtual std::string GetDescription() const { return ""; }
         virtual std::string GetVersion() const { return "1.0"; }
         virtual bool RequiresRestart() const { return false; }
+
+        // Called after a reload applied changes to this section, once its
+        // values' callbacks have run; paths are relative to the section
+        virtual void OnReloaded(const ConfigChangeSet& changes) { (void)changes; }
     };
 
     // Type trait for configuration sections (Traditional approach)
@@ -0,0 +1,673 @@
+// Core.FileHandler.cpp
+// Akhanda Game Engine - Shared configuration watch service
+// Copyright (c) 2025 Aditya Vennelakanti. All rights reserved.
+
+module;
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#undef min
+#undef max
+#elif defined(__linux__)
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+module Akhanda.Core.Configuration.FileHandler;
+
+import Akhanda.Core.JobSystem;
+
+using namespace Akhanda::Configuration;
+
+// =============================================================================
+// Overview
+// =============================================================================
+//
+//   Watch() and Unwatch() edit the file lists under the mutex and wake the
+//   watch thread, which owns every OS handle: it opens and closes directory
+//   watches to match the lists before waiting again, and Watch/Unwatch wait
+//   for that pass. The thread then waits for directory events, the wake
+//   signal, the earliest debounce deadline or the next poll, whichever comes
+//   first. An event for a watched name (re)arms that file's deadline; files
+//   whose deadline has passed are dispatched.
+//
+//   Every callback runs through the CallbackGate, which jobs keep alive past
+//   the service. It skips the callback once its watch is gone, and Unwatch
+//   waits there until no callback of the watch is running.
+//
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+#ifdef _WIN32
+    // Leave one wait slot for the wake event; further directories are polled
+    constexpr size_t MAX_EVENT_DIRECTORIES = MAXIMUM_WAIT_OBJECTS - 1;
+    constexpr DWORD NOTIFY_FILTER = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE;
+#endif
+
+    struct WatchedFile {
+        std::filesystem::path path;
+        std::filesystem::path name;
+        std::vector<std::pair<ConfigWatchService::WatchId, ConfigWatchService::ChangeCallback>> callbacks;
+        FileInfo lastInfo;                  // For polling
+        bool pending = false;
+        Clock::time_point deadline;
+    };
+
+    struct WatchedDirectory {
+        std::filesystem::path path;
+        std::vector<WatchedFile> files;
+        bool polled = false;                // No event watch is open for it
+
+#ifdef _WIN32
+        HANDLE handle = INVALID_HANDLE_VALUE;
+        OVERLAPPED overlapped{};
+        alignas(DWORD) std::array<std::byte, 16 * 1024> buffer{};
+#elif defined(__linux__)
+        int descriptor = -1;
+#endif
+
+        bool IsOpen() const noexcept {
+#ifdef _WIN32
+            return handle != INVALID_HANDLE_VALUE;
+#elif defined(__linux__)
+            return descriptor >= 0;
+#else
+            return false;
+#endif
+        }
+    };
+
+    // Watches whose callback this thread is inside, so a callback can unwatch
+    // its own watch without waiting for itself
+    thread_local std::vector<ConfigWatchService::WatchId> t_runningWatches;
+
+    struct CallbackGate {
+        std::mutex mutex;
+        std::condition_variable idle;
+        std::unordered_map<ConfigWatchService::WatchId, uint32_t> running;  // Registered watches
+
+        void Register(ConfigWatchService::WatchId id) {
+            std::lock_guard<std::mutex> lock(mutex);
+            running.emplace(id, 0);
+        }
+
+        void Unregister(ConfigWatchService::WatchId id) {
+            const auto own = static_cast<uint32_t>(std::count(t_runningWatches.begin(), t_runningWatches.end(), id));
+            std::unique_lock<std::mutex> lock(mutex);
+            idle.wait(lock, [&] {
+                const auto it = running.find(id);
+                return it == running.end() || it->second <= own;
+            });
+            running.erase(id);
+        }
+
+        void Run(ConfigWatchService::WatchId id, const std::filesystem::path& path, const ConfigWatchService::ChangeCallback& callback) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                const auto it = running.find(id);
+                if (it == running.end()) return;
+                ++it->second;
+            }
+
+            t_runningWatches.push_back(id);
+            struct Finish {
+                CallbackGate& gate;
+                ConfigWatchService::WatchId id;
+                ~Finish() {
+                    t_runningWatches.pop_back();
+                    std::lock_guard<std::mutex> lock(gate.mutex);
+                    if (const auto it = gate.running.find(id); it != gate.running.end()) {
+                        --it->second;
+                    }
+                    gate.idle.notify_all();
+                }
+            } finish{ *this, id };
+            callback(path);
+        }
+    };
+
+}
+
+// =============================================================================
+// ConfigWatchService::Impl
+// =============================================================================
+
+class ConfigWatchService::Impl {
+public:
+    explicit Impl(const Options& options) : options_(options) {
+#ifdef _WIN32
+        wakeEvent_ = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        eventDriven_ = !options_.forcePolling;
+#elif defined(__linux__)
+        wakeFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (!options_.forcePolling) {
+            inotifyFd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        }
+        eventDriven_ = inotifyFd_ >= 0;
+#endif
+        thread_ = std::jthread([this](std::stop_token stopToken) { Run(stopToken); });
+    }
+
+    ~Impl() {
+        thread_.request_stop();
+        Wake();
+        thread_.join();
+
+        for (auto& directory : directories_) {
+            CloseDirectory(*directory);
+        }
+#ifdef _WIN32
+        CloseHandle(wakeEvent_);
+#elif defined(__linux__)
+        if (inotifyFd_ >= 0) close(inotifyFd_);
+        if (wakeFd_ >= 0) close(wakeFd_);
+#endif
+    }
+
+    WatchId Watch(const std::filesystem::path& filePath, ChangeCallback callback) {
+        std::error_code ec;
+        const std::filesystem::path path = std::filesystem::absolute(filePath, ec).lexically_normal();
+        if (ec || !path.has_filename() || !std::filesystem::is_directory(path.parent_path(), ec)) {
+            return INVALID_WATCH_ID;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        const WatchId id = nextId_++;
+
+        WatchedDirectory& directory = FindOrAddDirectory(path.parent_path());
+        auto file = std::find_if(directory.files.begin(), directory.files.end(),
+            [&](const WatchedFile& f) { return f.name == path.filename(); });
+        if (file == directory.files.end()) {
+            WatchedFile& added = directory.files.emplace_back();
+            added.path = path;
+            added.name = path.filename();
+            added.lastInfo = FileInfo(path);
+            file = directory.files.end() - 1;
+        }
+        file->callbacks.emplace_back(id, std::move(callback));
+        gate_->Register(id);
+
+        WaitForSync(lock);
+        return id;
+    }
+
+    void Unwatch(WatchId id) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (auto& directory : directories_) {
+            for (auto& file : directory->files) {
+                std::erase_if(file.callbacks, [id](const auto& entry) { return entry.first == id; });
+            }
+            std::erase_if(directory->files, [](const WatchedFile& file) { return file.callbacks.empty(); });
+        }
+        WaitForSync(lock);
+
+        // A running callback may call Watch or Unwatch itself
+        lock.unlock();
+        gate_->Unregister(id);
+    }
+
+    bool IsEventDriven() const noexcept {
+        return eventDriven_;
+    }
+
+    size_t GetWatchedFileCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t count = 0;
+        for (const auto& directory : directories_) {
+            count += directory->files.size();
+        }
+        return count;
+    }
+
+    size_t GetWatchedDirectoryCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return static_cast<size_t>(std::count_if(directories_.begin(), directories_.end(),
+            [](const auto& directory) { return !directory->files.empty(); }));
+    }
+
+private:
+    // ========================================================================
+    // Requests
+    // ========================================================================
+
+    WatchedDirectory& FindOrAddDirectory(const std::filesystem::path& path) {
+        for (auto& directory : directories_) {
+            if (directory->path == path) {
+                return *directory;
+            }
+        }
+        auto& directory = directories_.emplace_back(std::make_unique<WatchedDirectory>());
+        directory->path = path;
+        return *directory;
+    }
+
+    // Has the watch thread bring the OS watches in line with the lists. On the
+    // watch thread itself (a callback calling Watch or Unwatch) that happens
+    // before its next wait anyway.
+    void WaitForSync(std::unique_lock<std::mutex>& lock) {
+        const uint64_t request = ++syncRequested_;
+        if (std::this_thread::get_id() == thread_.get_id()) {
+            return;
+        }
+        Wake();
+        synced_.wait(lock, [&] { return syncCompleted_ >= request; });
+    }
+
+    void Wake() {
+#ifdef _WIN32
+        SetEvent(wakeEvent_);
+#elif defined(__linux__)
+        const uint64_t one = 1;
+        [[maybe_unused]] const auto written = write(wakeFd_, &one, sizeof(one));
+#else
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        woken_ = true;
+        wakeCondition_.notify_one();
+#endif
+    }
+
+    // ========================================================================
+    // Watch Thread
+    // ========================================================================
+
+    void Run(std::stop_token stopToken) {
+        Clock::time_point nextPoll = Clock::now() + options_.pollInterval;
+
+        while (!stopToken.stop_requested()) {
+            bool anyPolled = false;
+            Clock::time_point wakeTime = Clock::time_point::max();
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                SyncDirectories();
+                syncCompleted_ = syncRequested_;
+                synced_.notify_all();
+
+                for (const auto& directory : directories_) {
+                    anyPolled = anyPolled || directory->polled;
+                    for (const auto& file : directory->files) {
+                        if (file.pending) {
+                            wakeTime = std::min(wakeTime, file.deadline);
+                        }
+                    }
+                }
+            }
+            if (anyPolled) {
+                wakeTime = std::min(wakeTime, nextPoll);
+            }
+
+            WaitForEvents(wakeTime);
+
+            const Clock::time_point now = Clock::now();
+            if (anyPolled && now >= nextPoll) {
+                PollDirectories(now);
+                nextPoll = now + options_.pollInterval;
+            }
+            DispatchDueFiles(Clock::now());
+        }
+    }
+
+    // Called with the mutex held. Closes the watches of directories without
+    // files and opens watches for new directories.
+    void SyncDirectories() {
+        for (auto& directory : directories_) {
+            if (directory->files.empty()) {
+                CloseDirectory(*directory);
+            }
+        }
+        std::erase_if(directories_, [](const auto& directory) { return directory->files.empty(); });
+
+        for (auto& directory : directories_) {
+            if (!directory->IsOpen() && !directory->polled) {
+                directory->polled = !OpenDirectory(*directory);
+            }
+        }
+    }
+
+    // Called with the mutex held
+    void MarkChanged(WatchedFile& file, Clock::time_point now) {
+        file.pending = true;
+        file.deadline = now + options_.debounce;
+    }
+
+    void MarkChanged(WatchedDirectory& directory, const std::filesystem::path& name, Clock::time_point now) {
+        for (auto& file : directory.files) {
+            if (file.name == name) {
+                MarkChanged(file, now);
+            }
+        }
+    }
+
+    void MarkAllChanged(WatchedDirectory& directory, Clock::time_point now) {
+        for (auto& file : directory.files) {
+            MarkChanged(file, now);
+        }
+    }
+
+    void PollDirectories(Clock::time_point now) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& directory : directories_) {
+            if (!directory->polled) continue;
+
+            for (auto& file : directory->files) {
+                const FileInfo current(file.path);
+                if (current.exists != file.lastInfo.exists || current.HasChanged(file.lastInfo)) {
+                    file.lastInfo = current;
+                    MarkChanged(file, now);
+                }
+            }
+        }
+    }
+
+    void DispatchDueFiles(Clock::time_point now) {
+        struct Due {
+            WatchId id;
+            std::filesystem::path path;
+            ChangeCallback callback;
+        };
+        std::vector<Due> due;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto& directory : directories_) {
+                for (auto& file : directory->files) {
+                    if (!file.pending || file.deadline > now) continue;
+
+                    file.pending = false;
+                    std::error_code ec;
+                    if (!std::filesystem::exists(file.path, ec)) continue;
+
+                    for (const auto& [id, callback] : file.callbacks) {
+                        due.push_back({ id, file.path, callback });
+                    }
+                }
+            }
+        }
+
+        const bool useJobs = options_.useJobSystem && Akhanda::JobSystem::JobScheduler::IsInitialized();
+        for (Due& entry : due) {
+            if (useJobs) {
+                Akhanda::JobSystem::SubmitJob([gate = gate_, entry = std::move(entry)]() {
+                    gate->Run(entry.id, entry.path, entry.callback);
+                }, "ConfigFileChanged");
+            }
+            else {
+                gate_->Run(entry.id, entry.path, entry.callback);
+            }
+        }
+    }
+
+    // ========================================================================
+    // Platform Backends
+    // ========================================================================
+
+    static int TimeoutMs(Clock::time_point wakeTime) {
+        if (wakeTime == Clock::time_point::max()) {
+            return -1;
+        }
+        const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(wakeTime - Clock::now()).count();
+        return static_cast<int>(std::clamp<long long>(remaining, 0, 60 * 60 * 1000));
+    }
+
+#ifdef _WIN32
+
+    bool Rearm(WatchedDirectory& directory) {
+        return ReadDirectoryChangesW(directory.handle, directory.buffer.data(), static_cast<DWORD>(directory.buffer.size()),
+            FALSE, NOTIFY_FILTER, nullptr, &directory.overlapped, nullptr) != FALSE;
+    }
+
+    bool OpenDirectory(WatchedDirectory& directory) {
+        if (!eventDriven_ || OpenDirectoryCount() >= MAX_EVENT_DIRECTORIES) {
+            return false;
+        }
+
+        directory.handle = CreateFileW(directory.path.c_str(), FILE_LIST_DIRECTORY,
+            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+            FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+        if (directory.handle == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+
+        directory.overlapped = {};
+        directory.overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        if (!directory.overlapped.hEvent || !Rearm(directory)) {
+            CloseDirectory(directory);
+            return false;
+        }
+        return true;
+    }
+
+    void CloseDirectory(WatchedDirectory& directory) {
+        if (directory.handle != INVALID_HANDLE_VALUE) {
+            DWORD bytes = 0;
+            if (CancelIoEx(directory.handle, &directory.overlapped)) {
+                GetOverlappedResult(directory.handle, &directory.overlapped, &bytes, TRUE);
+            }
+            CloseHandle(directory.handle);
+            directory.handle = INVALID_HANDLE_VALUE;
+        }
+        if (directory.overlapped.hEvent) {
+            CloseHandle(directory.overlapped.hEvent);
+            directory.overlapped.hEvent = nullptr;
+        }
+    }
+
+    size_t OpenDirectoryCount() const {
+        return static_cast<size_t>(std::count_if(directories_.begin(), directories_.end(),
+            [](const auto& directory) { return directory->IsOpen(); }));
+    }
+
+    void WaitForEvents(Clock::time_point wakeTime) {
+        std::array<HANDLE, MAXIMUM_WAIT_OBJECTS> handles{};
+        std::array<WatchedDirectory*, MAXIMUM_WAIT_OBJECTS> owners{};
+        DWORD count = 0;
+        handles[count++] = wakeEvent_;
+        {
+            // Only the watch thread opens, closes or erases directories
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto& directory : directories_) {
+                if (directory->IsOpen()) {
+                    owners[count] = directory.get();
+                    handles[count++] = directory->overlapped.hEvent;
+                }
+            }
+        }
+
+        const int timeout = TimeoutMs(wakeTime);
+        const DWORD result = WaitForMultipleObjects(count, handles.data(), FALSE, timeout < 0 ? INFINITE : static_cast<DWORD>(timeout));
+        if (result <= WAIT_OBJECT_0 || result >= WAIT_OBJECT_0 + count) {
+            return;
+        }
+
+        WatchedDirectory& directory = *owners[result - WAIT_OBJECT_0];
+        DWORD bytes = 0;
+        const bool completed = GetOverlappedResult(directory.handle, &directory.overlapped, &bytes, FALSE) != FALSE;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        const Clock::time_point now = Clock::now();
+        if (!completed || bytes == 0) {
+            // The buffer overflowed; report every watched file
+            MarkAllChanged(directory, now);
+        }
+        else {
+            size_t offset = 0;
+            for (;;) {
+                const auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(directory.buffer.data() + offset);
+                MarkChanged(directory, std::filesystem::path(std::wstring(info->FileName, info->FileNameLength / sizeof(WCHAR))), now);
+                if (info->NextEntryOffset == 0) break;
+                offset += info->NextEntryOffset;
+            }
+        }
+
+        if (!Rearm(directory)) {
+            CloseDirectory(directory);
+            directory.polled = true;
+        }
+    }
+
+#elif defined(__linux__)
+
+    bool OpenDirectory(WatchedDirectory& directory) {
+        if (inotifyFd_ < 0) {
+            return false;
+        }
+        directory.descriptor = inotify_add_watch(inotifyFd_, directory.path.c_str(),
+            IN_CLOSE_WRITE | IN_MODIFY | IN_CREATE | IN_DELETE | IN_MOVED_TO | IN_MOVED_FROM | IN_ONLYDIR);
+        return directory.descriptor >= 0;
+    }
+
+    void CloseDirectory(WatchedDirectory& directory) {
+        if (directory.descriptor >= 0) {
+            inotify_rm_watch(inotifyFd_, directory.descriptor);
+            directory.descriptor = -1;
+        }
+    }
+
+    void WaitForEvents(Clock::time_point wakeTime) {
+        std::array<pollfd, 2> fds{ { { wakeFd_, POLLIN, 0 }, { inotifyFd_, POLLIN, 0 } } };
+        const nfds_t count = inotifyFd_ >= 0 ? 2 : 1;
+        if (poll(fds.data(), count, TimeoutMs(wakeTime)) <= 0) {
+            return;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            uint64_t value = 0;
+            [[maybe_unused]] const auto bytesRead = read(wakeFd_, &value, sizeof(value));
+        }
+        if (count > 1 && (fds[1].revents & POLLIN)) {
+            ReadInotifyEvents();
+        }
+    }
+
+    void ReadInotifyEvents() {
+        alignas(inotify_event) std::array<char, 16 * 1024> buffer;
+        for (;;) {
+            const ssize_t length = read(inotifyFd_, buffer.data(), buffer.size());
+            if (length <= 0) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            const Clock::time_point now = Clock::now();
+            for (ssize_t offset = 0; offset < length;) {
+                const auto* event = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+                for (auto& directory : directories_) {
+                    if (event->mask & IN_Q_OVERFLOW) {
+                        MarkAllChanged(*directory, now);
+                    }
+                    else if (directory->descriptor == event->wd) {
+                        if (event->mask & IN_IGNORED) {
+                            // The directory itself went away; keep its files polled
+                            directory->descriptor = -1;
+                            directory->polled = true;
+                        }
+                        else if (event->len > 0) {
+                            MarkChanged(*directory, std::filesystem::path(event->name), now);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+#else
+
+    bool OpenDirectory(WatchedDirectory&) { return false; }
+    void CloseDirectory(WatchedDirectory&) {}
+
+    void WaitForEvents(Clock::time_point wakeTime) {
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        if (wakeTime == Clock::time_point::max()) {
+            wakeCondition_.wait(lock, [this] { return woken_; });
+        }
+        else {
+            wakeCondition_.wait_until(lock, wakeTime, [this] { return woken_; });
+        }
+        woken_ = false;
+    }
+
+#endif
+
+    // ========================================================================
+    // Members
+    // ========================================================================
+
+    const Options options_;
+    bool eventDriven_ = false;
+
+    mutable std::mutex mutex_;
+    std::condition_variable synced_;
+    std::vector<std::unique_ptr<WatchedDirectory>> directories_;
+    WatchId nextId_ = 1;
+    uint64_t syncRequested_ = 0;
+    uint64_t syncCompleted_ = 0;
+    const std::shared_ptr<CallbackGate> gate_ = std::make_shared<CallbackGate>();
+
+#ifdef _WIN32
+    HANDLE wakeEvent_ = nullptr;
+#elif defined(__linux__)
+    int wakeFd_ = -1;
+    int inotifyFd_ = -1;
+#else
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCondition_;
+    bool woken_ = false;
+#endif
+
+    // Joined in the destructor before the handles above are closed
+    std::jthread thread_;
+};
+
+// =============================================================================
+// ConfigWatchService
+// =============================================================================
+
+ConfigWatchService::ConfigWatchService(const Options& options)
+    : impl_(std::make_unique<Impl>(options)) {
+}
+
+ConfigWatchService::~ConfigWatchService() = default;
+
+std::shared_ptr<ConfigWatchService> ConfigWatchService::Shared() {
+    static const std::shared_ptr<ConfigWatchService> shared = std::make_shared<ConfigWatchService>();
+    return shared;
+}
+
+ConfigWatchService::WatchId ConfigWatchService::Watch(const std::filesystem::path& filePath, ChangeCallback callback) {
+    return impl_->Watch(filePath, std::move(callback));
+}
+
+void ConfigWatchService::Unwatch(WatchId id) {
+    impl_->Unwatch(id);
+}
+
+bool ConfigWatchService::IsEventDriven() const noexcept {
+    return impl_->IsEventDriven();
+}
+
+size_t ConfigWatchService::GetWatchedFileCount() const {
+    return impl_->GetWatchedFileCount();
+}
+
+size_t ConfigWatchService::GetWatchedDirectoryCount() const {
+    return impl_->GetWatchedDirectoryCount();
+}
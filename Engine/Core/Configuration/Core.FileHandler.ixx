@@ -11,8 +11,7 @@ module;
 #include <iomanip>
 #include <sstream>
 #include <functional>
-#include <stop_token>
-#include <thread>
+#include <memory>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -55,13 +54,73 @@ export namespace Akhanda::Configuration {
         }
     };
 
+    // ============================================================================
+    // Shared Watch Service for Hot-Reload Support
+    // ============================================================================
+
+    // One thread watches the directories that contain watched files, using
+    // inotify on Linux and ReadDirectoryChangesW on Windows, or polling the
+    // watched files' timestamps where neither is available. Events for a file
+    // are debounced: its callbacks run once, after no event has arrived for the
+    // debounce interval, so a burst of writes or a save through a temporary file
+    // and a rename is reported once. Callbacks run on the job system when it is
+    // initialized, otherwise on the watch thread. A file that does not exist
+    // when its debounce ends is not reported; a later save will be.
+    class ConfigWatchService {
+    public:
+        using ChangeCallback = std::function<void(const std::filesystem::path&)>;
+        using WatchId = std::uint64_t;
+
+        static constexpr WatchId INVALID_WATCH_ID = 0;
+
+        struct Options {
+            std::chrono::milliseconds debounce{ 50 };
+            std::chrono::milliseconds pollInterval{ 500 };  // Only when polling
+            bool forcePolling = false;
+            bool useJobSystem = true;
+        };
+
+        ConfigWatchService() : ConfigWatchService(Options{}) {}
+        explicit ConfigWatchService(const Options& options);
+        ~ConfigWatchService();
+
+        // Non-copyable, non-movable
+        ConfigWatchService(const ConfigWatchService&) = delete;
+        ConfigWatchService& operator=(const ConfigWatchService&) = delete;
+        ConfigWatchService(ConfigWatchService&&) = delete;
+        ConfigWatchService& operator=(ConfigWatchService&&) = delete;
+
+        // The service shared by every ConfigFileWatcher. Holders keep it alive,
+        // so watchers destroyed during static destruction stay safe.
+        static std::shared_ptr<ConfigWatchService> Shared();
+
+        // The file need not exist yet, but its directory must. Returns
+        // INVALID_WATCH_ID when the directory does not exist. The watch is
+        // active when this returns.
+        WatchId Watch(const std::filesystem::path& filePath, ChangeCallback callback);
+
+        // When this returns, the callback is not running and will not start
+        // again, including runs already submitted to the job system. A
+        // callback may unwatch its own watch.
+        void Unwatch(WatchId id);
+
+        bool IsEventDriven() const noexcept;
+        size_t GetWatchedFileCount() const;
+        size_t GetWatchedDirectoryCount() const;
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl_;
+    };
+
     // ============================================================================
     // File Watcher for Hot-Reload Support
     // ============================================================================
 
+    // Watches one file through the shared ConfigWatchService
     class ConfigFileWatcher {
     public:
-        using ChangeCallback = std::function<void(const std::filesystem::path&)>;
+        using ChangeCallback = ConfigWatchService::ChangeCallback;
 
         ConfigFileWatcher() = default;
         ~ConfigFileWatcher() { Stop(); }
@@ -73,68 +132,31 @@ export namespace Akhanda::Configuration {
         ConfigFileWatcher& operator=(ConfigFileWatcher&&) = delete;
 
         bool Start(const std::filesystem::path& watchPath, ChangeCallback callback) {
-            if (isWatching_) {
-                Stop();
-            }
+            Stop();
 
-            watchPath_ = watchPath;
-            callback_ = std::move(callback);
-
-            if (!std::filesystem::exists(watchPath_)) {
+            service_ = ConfigWatchService::Shared();
+            watchId_ = service_->Watch(watchPath, std::move(callback));
+            if (watchId_ == ConfigWatchService::INVALID_WATCH_ID) {
+                service_.reset();
                 return false;
             }
-
-            lastFileInfo_ = FileInfo(watchPath_);
-            shouldStop_ = false;
-
-            // Start watching thread
-            watchThread_ = std::jthread([this](std::stop_token stop_token) {
-                WatchLoop(stop_token);
-                });
-
-            isWatching_ = true;
             return true;
         }
 
+        // Once this returns, the callback is not running and will not run again
         void Stop() {
-            if (isWatching_) {
-                shouldStop_ = true;
-                if (watchThread_.joinable()) {
-                    watchThread_.request_stop();
-                    watchThread_.join();
-                }
-                isWatching_ = false;
+            if (watchId_ != ConfigWatchService::INVALID_WATCH_ID) {
+                service_->Unwatch(watchId_);
+                watchId_ = ConfigWatchService::INVALID_WATCH_ID;
+                service_.reset();
             }
         }
 
-        bool IsWatching() const noexcept { return isWatching_; }
+        bool IsWatching() const noexcept { return watchId_ != ConfigWatchService::INVALID_WATCH_ID; }
 
     private:
-        void WatchLoop(std::stop_token stop_token) {
-            while (!stop_token.stop_requested() && !shouldStop_) {
-                if (!std::filesystem::exists(watchPath_)) {
-                    break;
-                }
-
-                FileInfo currentInfo(watchPath_);
-                if (currentInfo.isValid && currentInfo.HasChanged(lastFileInfo_)) {
-                    if (callback_) {
-                        callback_(watchPath_);
-                    }
-                    lastFileInfo_ = currentInfo;
-                }
-
-                // Check every 500ms
-                std::this_thread::sleep_for(std::chrono::milliseconds(500));
-            }
-        }
-
-        std::filesystem::path watchPath_;
-        ChangeCallback callback_;
-        FileInfo lastFileInfo_;
-        std::jthread watchThread_;
-        std::atomic<bool> shouldStop_{ false };
-        bool isWatching_ = false;
+        std::shared_ptr<ConfigWatchService> service_;
+        ConfigWatchService::WatchId watchId_ = ConfigWatchService::INVALID_WATCH_ID;
     };
 
     // ============================================================================
@@ -5,6 +5,7 @@
 module;
 
 #include "JsonWrapper.hpp"
+#include "JsonView.hpp"
 
 export module Akhanda.Core.Configuration.Rendering;
 
@@ -325,7 +326,7 @@ export namespace Akhanda::Configuration {
             return j;
         }
 
-        ConfigResult_t<bool> LoadFromJson(const JsonValue& json) override {
+        ConfigResult_t<bool> LoadFromJson(const JsonView& json) override {
             try {
                 // Parse compilation settings
                 if (json.Contains("compilationMode")) {
@@ -491,7 +492,7 @@ export namespace Akhanda::Configuration {
             return "rendering";
         }
 
-        ConfigResult_t<bool> LoadFromJson(const JsonValue& sectionJson) override {
+        ConfigResult_t<bool> LoadFromJson(const JsonView& sectionJson) override {
             try {
                 // Load each configuration value
                 if (sectionJson.Contains("renderingAPI")) {
@@ -0,0 +1,36 @@
+// JsonImpl.hpp
+// Akhanda Game Engine - JsonValue storage, shared by the JSON implementation files
+// Copyright (c) 2025 Aditya Vennelakanti. All rights reserved.
+
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+namespace Akhanda::Configuration::detail {
+
+    class JsonImpl {
+    public:
+        nlohmann::json data;
+
+        JsonImpl() = default;
+        JsonImpl(const nlohmann::json& json) : data(json) {}
+        JsonImpl(nlohmann::json&& json) : data(std::move(json)) {}
+        JsonImpl(const JsonImpl& other) : data(other.data) {}
+        JsonImpl(JsonImpl&& other) noexcept : data(std::move(other.data)) {}
+
+        JsonImpl& operator=(const JsonImpl& other) {
+            if (this != &other) {
+                data = other.data;
+            }
+            return *this;
+        }
+
+        JsonImpl& operator=(JsonImpl&& other) noexcept {
+            if (this != &other) {
+                data = std::move(other.data);
+            }
+            return *this;
+        }
+    };
+
+} // namespace Akhanda::Configuration::detail
@@ -0,0 +1,555 @@
+// JsonReader.cpp
+// Akhanda Game Engine - Streaming JSON Reader Implementation
+// Copyright (c) 2025 Aditya Vennelakanti. All rights reserved.
+
+#include "JsonReader.hpp"
+
+#include <immintrin.h>
+
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+import Akhanda.Core.MappedFile;
+
+namespace Akhanda::Configuration {
+
+    namespace {
+
+        // ========================================================================
+        // Scanning
+        // ========================================================================
+
+        bool IsSpace(char c) noexcept {
+            return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+        }
+
+        bool IsStringSpecial(char c) noexcept {
+            return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20;
+        }
+
+        // First byte at or after p that ends or escapes a string, or that is
+        // a control character and so is not allowed in one
+        const char* FindStringSpecial(const char* p, const char* end) noexcept {
+#if defined(__AVX2__)
+            const __m256i quote32 = _mm256_set1_epi8('"');
+            const __m256i backslash32 = _mm256_set1_epi8('\\');
+            const __m256i control32 = _mm256_set1_epi8(0x1F);
+            while (end - p >= 32) {
+                const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+                const __m256i special = _mm256_or_si256(
+                    _mm256_or_si256(_mm256_cmpeq_epi8(bytes, quote32), _mm256_cmpeq_epi8(bytes, backslash32)),
+                    _mm256_cmpeq_epi8(_mm256_max_epu8(bytes, control32), control32));
+                const std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(special));
+                if (mask != 0) {
+                    return p + std::countr_zero(mask);
+                }
+                p += 32;
+            }
+#endif
+            const __m128i quote = _mm_set1_epi8('"');
+            const __m128i backslash = _mm_set1_epi8('\\');
+            const __m128i control = _mm_set1_epi8(0x1F);
+            while (end - p >= 16) {
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+                const __m128i special = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(bytes, quote), _mm_cmpeq_epi8(bytes, backslash)),
+                    _mm_cmpeq_epi8(_mm_max_epu8(bytes, control), control));
+                const std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(special));
+                if (mask != 0) {
+                    return p + std::countr_zero(mask);
+                }
+                p += 16;
+            }
+            while (p < end && !IsStringSpecial(*p)) {
+                ++p;
+            }
+            return p;
+        }
+
+        // Most values are separated by a single space or none, so runs of
+        // indentation are the only ones worth scanning a block at a time
+        const char* SkipSpace(const char* p, const char* end) noexcept {
+            if (p == end || !IsSpace(*p)) {
+                return p;
+            }
+            const __m128i space = _mm_set1_epi8(' ');
+            const __m128i newline = _mm_set1_epi8('\n');
+            const __m128i carriageReturn = _mm_set1_epi8('\r');
+            const __m128i tab = _mm_set1_epi8('\t');
+            while (end - p >= 16) {
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+                const __m128i whitespace = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(bytes, space), _mm_cmpeq_epi8(bytes, newline)),
+                    _mm_or_si128(_mm_cmpeq_epi8(bytes, carriageReturn), _mm_cmpeq_epi8(bytes, tab)));
+                const std::uint32_t mask = ~static_cast<std::uint32_t>(_mm_movemask_epi8(whitespace)) & 0xFFFFu;
+                if (mask != 0) {
+                    return p + std::countr_zero(mask);
+                }
+                p += 16;
+            }
+            while (p < end && IsSpace(*p)) {
+                ++p;
+            }
+            return p;
+        }
+
+        bool IsDigit(char c) noexcept {
+            return c >= '0' && c <= '9';
+        }
+
+        bool IsNumberChar(char c) noexcept {
+            return IsDigit(c) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+        }
+
+        int HexValue(char c) noexcept {
+            if (c >= '0' && c <= '9') return c - '0';
+            if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+            return -1;
+        }
+
+        void AppendUtf8(std::string& out, std::uint32_t codePoint) {
+            if (codePoint < 0x80) {
+                out.push_back(static_cast<char>(codePoint));
+            }
+            else if (codePoint < 0x800) {
+                out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+                out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            else if (codePoint < 0x10000) {
+                out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+                out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            else {
+                out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+                out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+        }
+
+        // ========================================================================
+        // Parser
+        // ========================================================================
+
+        // Walks the input with an explicit container stack, so nesting depth
+        // is not limited by the call stack. Reading from a file keeps a token
+        // whole: when one runs off the end of the buffer, the unread bytes
+        // move to the front and the token is scanned again after the refill.
+        class JsonParser {
+        public:
+            JsonParser(JsonHandler& handler, std::string_view text)
+                : handler_(handler), data_(text.data()), pos_(text.data()), end_(text.data() + text.size()) {}
+
+            JsonParser(JsonHandler& handler, std::ifstream& file, const std::filesystem::path& path, size_t bufferSize)
+                : handler_(handler), file_(&file), path_(&path), buffer_(std::max<size_t>(bufferSize, 1)) {
+                data_ = pos_ = end_ = buffer_.data();
+            }
+
+            bool Run() {
+                Expect expect = Expect::Value;
+                for (;;) {
+                    switch (expect) {
+                    case Expect::Value:
+                        if (!ParseValue(expect)) return false;
+                        break;
+
+                    case Expect::Key:
+                        if (Peek("expected a member name") != '"') {
+                            Fail(pos_, "expected a member name");
+                        }
+                        if (!ParseString(true)) return false;
+                        if (Peek("expected ':'") != ':') {
+                            Fail(pos_, "expected ':'");
+                        }
+                        ++pos_;
+                        expect = Expect::Value;
+                        break;
+
+                    case Expect::AfterValue: {
+                        if (stack_.empty()) {
+                            if (Peek(nullptr) != '\0' || pos_ != end_) {
+                                Fail(pos_, "unexpected data after the root value");
+                            }
+                            return true;
+                        }
+
+                        const bool inObject = stack_.back() == Container::Object;
+                        const char* message = inObject ? "expected ',' or '}'" : "expected ',' or ']'";
+                        const char c = Peek(message);
+                        if (c == ',') {
+                            ++pos_;
+                            expect = inObject ? Expect::Key : Expect::Value;
+                        }
+                        else if (c == (inObject ? '}' : ']')) {
+                            ++pos_;
+                            stack_.pop_back();
+                            if (!(inObject ? handler_.EndObject() : handler_.EndArray())) return false;
+                        }
+                        else {
+                            Fail(pos_, message);
+                        }
+                        break;
+                    }
+                    }
+                }
+            }
+
+        private:
+            enum class Expect : std::uint8_t { Value, Key, AfterValue };
+            enum class Container : std::uint8_t { Object, Array };
+
+            [[noreturn]] void Fail(const char* at, std::string_view message) const {
+                const size_t offset = base_ + static_cast<size_t>(at - data_);
+                throw std::runtime_error("JSON parse error at byte " + std::to_string(offset) + ": " + std::string(message));
+            }
+
+            // Keeps the bytes from pos_ on and reads more after them. Returns
+            // false at the end of the input, when nothing was added.
+            bool Refill() {
+                if (!file_ || atEnd_) {
+                    return false;
+                }
+
+                const size_t kept = static_cast<size_t>(end_ - pos_);
+                base_ += static_cast<size_t>(pos_ - data_);
+                if (kept == buffer_.size()) {
+                    // A single token fills the buffer
+                    buffer_.resize(buffer_.size() * 2);
+                }
+                else if (kept != 0) {
+                    std::memmove(buffer_.data(), pos_, kept);
+                }
+
+                file_->read(buffer_.data() + kept, static_cast<std::streamsize>(buffer_.size() - kept));
+                const size_t read = static_cast<size_t>(file_->gcount());
+                if (file_->bad()) {
+                    throw std::runtime_error("Failed to read file: " + path_->string());
+                }
+
+                data_ = pos_ = buffer_.data();
+                end_ = data_ + kept + read;
+                if (read == 0) {
+                    atEnd_ = true;
+                    return false;
+                }
+                return true;
+            }
+
+            // Skips whitespace and returns the next byte, or fails with
+            // message at the end of the input. A null message returns '\0'.
+            char Peek(const char* message) {
+                for (;;) {
+                    pos_ = SkipSpace(pos_, end_);
+                    if (pos_ != end_) {
+                        return *pos_;
+                    }
+                    if (!Refill()) {
+                        if (!message) return '\0';
+                        Fail(pos_, message);
+                    }
+                }
+            }
+
+            bool ParseValue(Expect& expect) {
+                const char c = Peek("expected a value");
+                switch (c) {
+                case '{':
+                    ++pos_;
+                    if (!handler_.StartObject()) return false;
+                    if (Peek("expected a member name or '}'") == '}') {
+                        ++pos_;
+                        if (!handler_.EndObject()) return false;
+                        expect = Expect::AfterValue;
+                        return true;
+                    }
+                    stack_.push_back(Container::Object);
+                    expect = Expect::Key;
+                    return true;
+
+                case '[':
+                    ++pos_;
+                    if (!handler_.StartArray()) return false;
+                    if (Peek("expected a value or ']'") == ']') {
+                        ++pos_;
+                        if (!handler_.EndArray()) return false;
+                        expect = Expect::AfterValue;
+                        return true;
+                    }
+                    stack_.push_back(Container::Array);
+                    expect = Expect::Value;
+                    return true;
+
+                case '"':
+                    expect = Expect::AfterValue;
+                    return ParseString(false);
+
+                case 't':
+                    expect = Expect::AfterValue;
+                    return ParseLiteral("true") && handler_.Bool(true);
+
+                case 'f':
+                    expect = Expect::AfterValue;
+                    return ParseLiteral("false") && handler_.Bool(false);
+
+                case 'n':
+                    expect = Expect::AfterValue;
+                    return ParseLiteral("null") && handler_.Null();
+
+                default:
+                    if (c == '-' || IsDigit(c)) {
+                        expect = Expect::AfterValue;
+                        return ParseNumber();
+                    }
+                    Fail(pos_, "expected a value");
+                }
+            }
+
+            // The closing quote of the string opening at pos_, or null when
+            // the buffer ends first
+            const char* FindStringEnd(bool& escaped) const {
+                const char* p = pos_ + 1;
+                for (;;) {
+                    p = FindStringSpecial(p, end_);
+                    if (p == end_) {
+                        return nullptr;
+                    }
+                    if (*p == '"') {
+                        return p;
+                    }
+                    if (*p != '\\') {
+                        Fail(p, "control character in string");
+                    }
+                    escaped = true;
+                    if (end_ - p < 2) {
+                        return nullptr;
+                    }
+                    p += 2;
+                }
+            }
+
+            bool ParseString(bool isKey) {
+                bool escaped = false;
+                const char* close = FindStringEnd(escaped);
+                while (!close) {
+                    if (!Refill()) {
+                        Fail(pos_, "unterminated string");
+                    }
+                    escaped = false;
+                    close = FindStringEnd(escaped);
+                }
+
+                std::string_view value(pos_ + 1, static_cast<size_t>(close - pos_ - 1));
+                if (escaped) {
+                    value = Unescape(value);
+                }
+                pos_ = close + 1;
+                return isKey ? handler_.Key(value) : handler_.String(value);
+            }
+
+            // Reads the four hex digits after "\u" at p
+            std::uint32_t ParseHex4(const char* p, const char* end) const {
+                if (end - p < 6) {
+                    Fail(p, "invalid unicode escape");
+                }
+                std::uint32_t value = 0;
+                for (int i = 2; i < 6; ++i) {
+                    const int digit = HexValue(p[i]);
+                    if (digit < 0) {
+                        Fail(p, "invalid unicode escape");
+                    }
+                    value = (value << 4) | static_cast<std::uint32_t>(digit);
+                }
+                return value;
+            }
+
+            std::string_view Unescape(std::string_view raw) {
+                scratch_.clear();
+                const char* p = raw.data();
+                const char* const end = raw.data() + raw.size();
+                while (p < end) {
+                    const char* special = p;
+                    while (special < end && *special != '\\') {
+                        ++special;
+                    }
+                    scratch_.append(p, special);
+                    if (special == end) {
+                        break;
+                    }
+
+                    p = special;
+                    switch (p[1]) {
+                    case '"':  scratch_.push_back('"'); break;
+                    case '\\': scratch_.push_back('\\'); break;
+                    case '/':  scratch_.push_back('/'); break;
+                    case 'b':  scratch_.push_back('\b'); break;
+                    case 'f':  scratch_.push_back('\f'); break;
+                    case 'n':  scratch_.push_back('\n'); break;
+                    case 'r':  scratch_.push_back('\r'); break;
+                    case 't':  scratch_.push_back('\t'); break;
+                    case 'u': {
+                        std::uint32_t codePoint = ParseHex4(p, end);
+                        if (codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+                            // A high surrogate must pair with a following low one
+                            const char* low = p + 6;
+                            if (end - low < 2 || low[0] != '\\' || low[1] != 'u') {
+                                Fail(p, "invalid unicode escape");
+                            }
+                            const std::uint32_t lowSurrogate = ParseHex4(low, end);
+                            if (lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF) {
+                                Fail(p, "invalid unicode escape");
+                            }
+                            codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+                            p += 6;
+                        }
+                        else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF) {
+                            Fail(p, "invalid unicode escape");
+                        }
+                        AppendUtf8(scratch_, codePoint);
+                        p += 4;
+                        break;
+                    }
+                    default:
+                        Fail(p, "invalid escape");
+                    }
+                    p += 2;
+                }
+                return scratch_;
+            }
+
+            bool ParseLiteral(std::string_view literal) {
+                while (static_cast<size_t>(end_ - pos_) < literal.size() && Refill()) {}
+                if (static_cast<size_t>(end_ - pos_) < literal.size() ||
+                    std::string_view(pos_, literal.size()) != literal) {
+                    Fail(pos_, "invalid literal");
+                }
+                pos_ += literal.size();
+                return true;
+            }
+
+            bool ParseNumber() {
+                // A number may continue past the end of the buffer
+                const char* p = pos_;
+                for (;;) {
+                    while (p < end_ && IsNumberChar(*p)) {
+                        ++p;
+                    }
+                    if (p != end_) {
+                        break;
+                    }
+                    // The buffer can move even when the refill adds nothing
+                    const size_t scanned = static_cast<size_t>(p - pos_);
+                    const bool more = Refill();
+                    p = pos_ + scanned;
+                    if (!more) {
+                        break;
+                    }
+                }
+
+                const char* const start = pos_;
+                const char* const end = p;
+
+                // Grammar: -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+                const char* q = start;
+                const bool negative = *q == '-';
+                if (negative) ++q;
+                if (q == end || !IsDigit(*q)) Fail(q, "invalid number");
+                if (*q == '0') {
+                    ++q;
+                }
+                else {
+                    while (q < end && IsDigit(*q)) ++q;
+                }
+                bool integer = true;
+                if (q < end && *q == '.') {
+                    integer = false;
+                    ++q;
+                    if (q == end || !IsDigit(*q)) Fail(q, "invalid number");
+                    while (q < end && IsDigit(*q)) ++q;
+                }
+                if (q < end && (*q == 'e' || *q == 'E')) {
+                    integer = false;
+                    ++q;
+                    if (q < end && (*q == '+' || *q == '-')) ++q;
+                    if (q == end || !IsDigit(*q)) Fail(q, "invalid number");
+                    while (q < end && IsDigit(*q)) ++q;
+                }
+                if (q != end) Fail(q, "invalid number");
+
+                pos_ = end;
+                if (integer) {
+                    if (negative) {
+                        std::int64_t value = 0;
+                        if (std::from_chars(start, end, value).ec == std::errc()) {
+                            return handler_.Int(value);
+                        }
+                    }
+                    else {
+                        std::uint64_t value = 0;
+                        if (std::from_chars(start, end, value).ec == std::errc()) {
+                            return handler_.UInt(value);
+                        }
+                    }
+                    // Integers too large for 64 bits read as doubles
+                }
+
+                double value = 0.0;
+                if (std::from_chars(start, end, value).ec != std::errc()) {
+                    // Underflow rounds to zero, but overflow has no value to give
+                    value = std::strtod(std::string(start, end).c_str(), nullptr);
+                    if (!std::isfinite(value)) {
+                        Fail(start, "number out of range");
+                    }
+                }
+                return handler_.Float(value);
+            }
+
+            JsonHandler& handler_;
+            std::ifstream* file_ = nullptr;
+            const std::filesystem::path* path_ = nullptr;
+            std::vector<char> buffer_;
+            bool atEnd_ = false;
+
+            const char* data_ = nullptr;    // Start of the bytes in memory
+            const char* pos_ = nullptr;
+            const char* end_ = nullptr;
+            size_t base_ = 0;               // Input offset of data_
+
+            std::vector<Container> stack_;
+            std::string scratch_;
+        };
+
+    } // namespace
+
+    // ============================================================================
+    // JsonReader Implementation
+    // ============================================================================
+
+    bool JsonReader::Parse(std::string_view jsonString, JsonHandler& handler) {
+        return JsonParser(handler, jsonString).Run();
+    }
+
+    bool JsonReader::ParseFile(const std::filesystem::path& filePath, JsonHandler& handler, size_t bufferSize) {
+        std::ifstream file(filePath, std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open file: " + filePath.string());
+        }
+        return JsonParser(handler, file, filePath, bufferSize).Run();
+    }
+
+    bool JsonReader::ParseMappedFile(const std::filesystem::path& filePath, JsonHandler& handler) {
+        const auto mapping = Akhanda::Core::MappedFile::Open(filePath);
+        if (!mapping) {
+            // Empty files cannot be mapped; reading reports them and missing ones
+            return ParseFile(filePath, handler);
+        }
+        return Parse(std::string_view(reinterpret_cast<const char*>(mapping->Data()), mapping->Size()), handler);
+    }
+
+} // namespace Akhanda::Configuration
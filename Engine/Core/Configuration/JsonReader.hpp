@@ -0,0 +1,320 @@
+// JsonReader.hpp
+// Akhanda Game Engine - Streaming JSON Reader
+// Copyright (c) 2025 Aditya Vennelakanti. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Akhanda::Configuration {
+
+    // ============================================================================
+    // JSON Handler - Receives parse events
+    // ============================================================================
+
+    // Events arrive in document order, and a member's Key comes right before
+    // its value. Negative integers arrive as Int, other integers as UInt and
+    // anything with a fraction or exponent as Float. Strings are only valid
+    // during the call. Returning false from any event stops reading.
+    class JsonHandler {
+    public:
+        virtual ~JsonHandler() = default;
+
+        virtual bool Null() { return true; }
+        virtual bool Bool(bool value) { (void)value; return true; }
+        virtual bool Int(std::int64_t value) { (void)value; return true; }
+        virtual bool UInt(std::uint64_t value) { (void)value; return true; }
+        virtual bool Float(double value) { (void)value; return true; }
+        virtual bool String(std::string_view value) { (void)value; return true; }
+        virtual bool Key(std::string_view key) { (void)key; return true; }
+        virtual bool StartObject() { return true; }
+        virtual bool EndObject() { return true; }
+        virtual bool StartArray() { return true; }
+        virtual bool EndArray() { return true; }
+    };
+
+    // ============================================================================
+    // JSON Reader - Streaming parser
+    // ============================================================================
+
+    // Parses without building a document, so memory does not grow with the
+    // input. Files are either read through a buffer that only grows to hold
+    // the longest single token, or mapped whole. Each function returns false
+    // when the handler stopped reading, and throws std::runtime_error with
+    // the byte offset on invalid JSON or when the file cannot be read.
+    class JsonReader {
+    public:
+        static constexpr size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+        static bool Parse(std::string_view jsonString, JsonHandler& handler);
+        static bool ParseFile(const std::filesystem::path& filePath, JsonHandler& handler,
+            size_t bufferSize = DEFAULT_BUFFER_SIZE);
+        static bool ParseMappedFile(const std::filesystem::path& filePath, JsonHandler& handler);
+    };
+
+    // ============================================================================
+    // Typed Binding - Reading known structs from events
+    // ============================================================================
+
+    namespace detail {
+
+        struct JsonScalarEvent {
+            enum class Kind : std::uint8_t { Null, Bool, Int, UInt, Float, String };
+
+            Kind kind = Kind::Null;
+            bool boolean = false;
+            std::int64_t integer = 0;
+            std::uint64_t unsignedInteger = 0;
+            double number = 0.0;
+            std::string_view string;
+        };
+
+        template<typename T>
+        inline constexpr bool IS_JSON_VECTOR = false;
+        template<typename T, typename A>
+        inline constexpr bool IS_JSON_VECTOR<std::vector<T, A>> = true;
+
+        template<typename T>
+        inline constexpr bool IS_JSON_SCALAR = std::is_arithmetic_v<T> || std::is_same_v<T, std::string>;
+
+        // Leaves target unchanged and returns false when the kinds differ
+        template<typename T>
+        bool AssignScalar(T& target, const JsonScalarEvent& event) {
+            using Kind = JsonScalarEvent::Kind;
+            if constexpr (std::is_same_v<T, bool>) {
+                if (event.kind != Kind::Bool) return false;
+                target = event.boolean;
+            }
+            else if constexpr (std::is_arithmetic_v<T>) {
+                switch (event.kind) {
+                case Kind::Int:   target = static_cast<T>(event.integer); break;
+                case Kind::UInt:  target = static_cast<T>(event.unsignedInteger); break;
+                case Kind::Float: target = static_cast<T>(event.number); break;
+                default: return false;
+                }
+            }
+            else {
+                if (event.kind != Kind::String) return false;
+                target.assign(event.string);
+            }
+            return true;
+        }
+
+    } // namespace detail
+
+    // Maps member names of a JSON object to members of T, which may be bool,
+    // numbers, std::string or a std::vector of those. Unknown members and
+    // values of another kind are skipped and leave the member as it was.
+    template<typename T>
+    class JsonBinding {
+    public:
+        template<typename M>
+        JsonBinding& Field(std::string key, M T::* member) {
+            FieldBinder field;
+            field.key = std::move(key);
+            if constexpr (detail::IS_JSON_VECTOR<M>) {
+                static_assert(detail::IS_JSON_SCALAR<typename M::value_type>, "Vector elements must be bool, numbers or strings");
+                field.isArray = true;
+                field.clear = [member](T& object) { (object.*member).clear(); };
+                field.assign = [member](T& object, const detail::JsonScalarEvent& event) {
+                    typename M::value_type element{};
+                    if (detail::AssignScalar(element, event)) {
+                        (object.*member).push_back(std::move(element));
+                    }
+                };
+            }
+            else {
+                static_assert(detail::IS_JSON_SCALAR<M>, "Bound members must be bool, numbers, strings or vectors of those");
+                field.assign = [member](T& object, const detail::JsonScalarEvent& event) {
+                    detail::AssignScalar(object.*member, event);
+                };
+            }
+            fields_.push_back(std::move(field));
+            return *this;
+        }
+
+    private:
+        template<typename> friend class JsonElementReader;
+
+        struct FieldBinder {
+            std::string key;
+            bool isArray = false;
+            std::function<void(T&)> clear;
+            std::function<void(T&, const detail::JsonScalarEvent&)> assign;
+        };
+
+        const FieldBinder* Find(std::string_view key) const noexcept {
+            for (const FieldBinder& field : fields_) {
+                if (field.key == key) return &field;
+            }
+            return nullptr;
+        }
+
+        std::vector<FieldBinder> fields_;
+    };
+
+    // Streams each object in the array at arrayPath into a T and hands it to
+    // onElement, so a large array is never held in memory. The path names
+    // object members separated by dots, or is empty for an array at the
+    // root. Elements that are not objects are skipped; onElement returns
+    // false to stop reading. The binding must outlive the reader.
+    template<typename T>
+    class JsonElementReader : public JsonHandler {
+    public:
+        using ElementCallback = std::function<bool(T&& element)>;
+
+        JsonElementReader(const JsonBinding<T>& binding, std::string_view arrayPath, ElementCallback onElement)
+            : binding_(binding), onElement_(std::move(onElement)) {
+            while (!arrayPath.empty()) {
+                const size_t dot = arrayPath.find('.');
+                path_.emplace_back(arrayPath.substr(0, dot));
+                arrayPath = dot == std::string_view::npos ? std::string_view() : arrayPath.substr(dot + 1);
+            }
+        }
+
+        size_t GetElementCount() const noexcept { return elementCount_; }
+
+        bool Null() override { return Scalar({}); }
+        bool Bool(bool value) override {
+            detail::JsonScalarEvent event;
+            event.kind = detail::JsonScalarEvent::Kind::Bool;
+            event.boolean = value;
+            return Scalar(event);
+        }
+        bool Int(std::int64_t value) override {
+            detail::JsonScalarEvent event;
+            event.kind = detail::JsonScalarEvent::Kind::Int;
+            event.integer = value;
+            return Scalar(event);
+        }
+        bool UInt(std::uint64_t value) override {
+            detail::JsonScalarEvent event;
+            event.kind = detail::JsonScalarEvent::Kind::UInt;
+            event.unsignedInteger = value;
+            return Scalar(event);
+        }
+        bool Float(double value) override {
+            detail::JsonScalarEvent event;
+            event.kind = detail::JsonScalarEvent::Kind::Float;
+            event.number = value;
+            return Scalar(event);
+        }
+        bool String(std::string_view value) override {
+            detail::JsonScalarEvent event;
+            event.kind = detail::JsonScalarEvent::Kind::String;
+            event.string = value;
+            return Scalar(event);
+        }
+
+        bool Key(std::string_view key) override {
+            if (arrayDepth_ != 0) {
+                if (inElement_ && depth_ == arrayDepth_ + 1) {
+                    field_ = binding_.Find(key);
+                }
+            }
+            else if (depth_ == matched_ + 1 && matched_ < path_.size()) {
+                keyMatches_ = key == path_[matched_];
+            }
+            return true;
+        }
+
+        bool StartObject() override {
+            const size_t parentDepth = depth_++;
+            if (arrayDepth_ != 0) {
+                if (parentDepth == arrayDepth_) {
+                    inElement_ = true;
+                    element_ = T{};
+                    field_ = nullptr;
+                }
+                return true;
+            }
+            if (parentDepth != 0 && parentDepth == matched_ + 1 && keyMatches_ && matched_ + 1 < path_.size()) {
+                ++matched_;
+            }
+            keyMatches_ = false;
+            return true;
+        }
+
+        bool EndObject() override {
+            if (arrayDepth_ != 0) {
+                if (inElement_ && depth_ == arrayDepth_ + 1) {
+                    inElement_ = false;
+                    --depth_;
+                    ++elementCount_;
+                    return onElement_(std::move(element_));
+                }
+            }
+            else if (depth_ == matched_ + 1 && matched_ > 0) {
+                --matched_;
+            }
+            --depth_;
+            return true;
+        }
+
+        bool StartArray() override {
+            const size_t parentDepth = depth_++;
+            if (arrayDepth_ != 0) {
+                if (inElement_ && parentDepth == arrayDepth_ + 1 && field_ && field_->isArray) {
+                    field_->clear(element_);
+                    fieldArrayDepth_ = depth_;
+                }
+                return true;
+            }
+            if ((path_.empty() && parentDepth == 0) ||
+                (parentDepth == matched_ + 1 && keyMatches_ && matched_ + 1 == path_.size())) {
+                arrayDepth_ = depth_;
+            }
+            keyMatches_ = false;
+            return true;
+        }
+
+        bool EndArray() override {
+            if (depth_ == fieldArrayDepth_) {
+                fieldArrayDepth_ = 0;
+            }
+            if (depth_ == arrayDepth_) {
+                arrayDepth_ = 0;
+            }
+            --depth_;
+            return true;
+        }
+
+    private:
+        using FieldBinder = typename JsonBinding<T>::FieldBinder;
+
+        bool Scalar(const detail::JsonScalarEvent& event) {
+            if (inElement_ && field_) {
+                if (depth_ == arrayDepth_ + 1 && !field_->isArray) {
+                    field_->assign(element_, event);
+                }
+                else if (depth_ == fieldArrayDepth_) {
+                    field_->assign(element_, event);
+                }
+            }
+            keyMatches_ = false;
+            return true;
+        }
+
+        const JsonBinding<T>& binding_;
+        ElementCallback onElement_;
+        std::vector<std::string> path_;
+
+        size_t depth_ = 0;              // Containers open
+        size_t matched_ = 0;            // Leading path members whose objects are open
+        bool keyMatches_ = false;       // The last key on the path names the next member
+        size_t arrayDepth_ = 0;         // Depth inside the bound array, or 0
+        size_t fieldArrayDepth_ = 0;    // Depth inside a bound vector member, or 0
+        bool inElement_ = false;
+        const FieldBinder* field_ = nullptr;
+        T element_{};
+        size_t elementCount_ = 0;
+    };
+
+} // namespace Akhanda::Configuration
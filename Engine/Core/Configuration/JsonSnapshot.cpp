@@ -0,0 +1,219 @@
+// JsonSnapshot.cpp
+// Akhanda Game Engine - Binary JSON Document Snapshots
+// Copyright (c) 2025 Aditya Vennelakanti. All rights reserved.
+
+#include "JsonView.hpp"
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <system_error>
+
+import Akhanda.Core.Hash;
+import Akhanda.Core.MappedFile;
+
+// =============================================================================
+// File Layout
+// =============================================================================
+//
+//   SnapshotHeader, then nodeCount JsonNodes, sortedMemberCount uint32_t
+//   member indices and stringSize bytes of key and string data, with no
+//   padding between them. Nodes are stored exactly as in memory, so a
+//   snapshot only loads into a build with the same JsonNode layout and byte
+//   order; nodeSize and version reject the rest.
+//
+
+namespace Akhanda::Configuration {
+
+    namespace {
+
+        using detail::JsonNode;
+        using detail::JsonNodeType;
+        using detail::JsonStorage;
+        using Akhanda::Core::MappedFile;
+
+        constexpr std::array<char, 8> SNAPSHOT_MAGIC = { 'A', 'K', 'H', 'C', 'F', 'G', 'S', 0 };
+        constexpr std::uint32_t SNAPSHOT_VERSION = 1;
+
+        struct SnapshotHeader {
+            std::array<char, 8> magic;
+            std::uint32_t version;
+            std::uint32_t nodeSize;
+            std::uint64_t sourceHash;
+            std::uint64_t fileSize;
+            std::uint32_t nodeCount;
+            std::uint32_t sortedMemberCount;
+            std::uint32_t stringSize;
+            std::uint32_t root;
+        };
+        static_assert(sizeof(SnapshotHeader) % alignof(JsonNode) == 0, "Nodes must follow the header aligned");
+
+        bool InRange(std::uint64_t offset, std::uint64_t length, std::uint64_t size) noexcept {
+            return offset <= size && length <= size - offset;
+        }
+
+        // Checks every index and range a view could follow, so a damaged
+        // snapshot is rejected instead of read out of bounds. Children always
+        // precede their container, which also rules out cycles.
+        bool ValidateNodes(const JsonStorage& storage) noexcept {
+            if (storage.root >= storage.nodeCount) {
+                return false;
+            }
+
+            for (std::uint32_t i = 0; i < storage.nodeCount; ++i) {
+                const JsonNode& node = storage.nodes[i];
+                if (!InRange(node.keyOffset, node.keyLength, storage.stringSize)) {
+                    return false;
+                }
+
+                switch (node.type) {
+                case JsonNodeType::Null:
+                case JsonNodeType::Int:
+                case JsonNodeType::UInt:
+                case JsonNodeType::Float:
+                    break;
+                case JsonNodeType::Bool: {
+                    unsigned char value = 0;
+                    std::memcpy(&value, &node.boolean, 1);
+                    if (value > 1) return false;
+                    break;
+                }
+                case JsonNodeType::String:
+                    if (!InRange(node.string.offset, node.string.length, storage.stringSize)) return false;
+                    break;
+                case JsonNodeType::Array:
+                case JsonNodeType::Object:
+                    if (!InRange(node.children.first, node.children.count, i)) return false;
+                    break;
+                default:
+                    return false;
+                }
+
+                if (node.sortedMembers != JsonNode::NO_INDEX) {
+                    if (node.type != JsonNodeType::Object ||
+                        !InRange(node.sortedMembers, node.children.count, storage.sortedMemberCount)) {
+                        return false;
+                    }
+                    for (std::uint32_t m = 0; m < node.children.count; ++m) {
+                        const std::uint32_t member = storage.sortedMembers[node.sortedMembers + m];
+                        if (member < node.children.first || member - node.children.first >= node.children.count) {
+                            return false;
+                        }
+                    }
+                }
+            }
+            return true;
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // JsonDocument Snapshots
+    // ============================================================================
+
+    std::uint64_t JsonDocument::HashSource(std::string_view jsonString) noexcept {
+        return Core::HashString64(jsonString);
+    }
+
+    std::optional<JsonDocument> JsonDocument::FromSnapshot(const std::filesystem::path& snapshotPath, std::uint64_t sourceHash) {
+        std::shared_ptr<const MappedFile> file = MappedFile::Open(snapshotPath);
+        if (!file || file->Size() < sizeof(SnapshotHeader)) {
+            return std::nullopt;
+        }
+
+        SnapshotHeader header;
+        std::memcpy(&header, file->Data(), sizeof(header));
+        if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION || header.nodeSize != sizeof(JsonNode) ||
+            header.sourceHash != sourceHash || header.fileSize != file->Size()) {
+            return std::nullopt;
+        }
+
+        const std::uint64_t nodeBytes = std::uint64_t(header.nodeCount) * sizeof(JsonNode);
+        const std::uint64_t sortedBytes = std::uint64_t(header.sortedMemberCount) * sizeof(std::uint32_t);
+        if (sizeof(SnapshotHeader) + nodeBytes + sortedBytes + header.stringSize != file->Size()) {
+            return std::nullopt;
+        }
+
+        auto storage = std::make_shared<JsonStorage>();
+        const std::byte* data = file->Data() + sizeof(SnapshotHeader);
+        storage->nodes = reinterpret_cast<const JsonNode*>(data);
+        storage->sortedMembers = reinterpret_cast<const std::uint32_t*>(data + nodeBytes);
+        storage->strings = reinterpret_cast<const char*>(data + nodeBytes + sortedBytes);
+        storage->nodeCount = header.nodeCount;
+        storage->sortedMemberCount = header.sortedMemberCount;
+        storage->stringSize = header.stringSize;
+        storage->root = header.root;
+        storage->mappedSize = file->Size();
+        storage->mapping = std::move(file);
+
+        if (!ValidateNodes(*storage)) {
+            return std::nullopt;
+        }
+        return JsonDocument(std::move(storage));
+    }
+
+    bool JsonDocument::WriteSnapshot(const std::filesystem::path& snapshotPath, std::uint64_t sourceHash) const {
+        const JsonStorage& storage = *storage_;
+        const std::uint64_t nodeBytes = std::uint64_t(storage.nodeCount) * sizeof(JsonNode);
+        const std::uint64_t sortedBytes = std::uint64_t(storage.sortedMemberCount) * sizeof(std::uint32_t);
+
+        SnapshotHeader header{};
+        header.magic = SNAPSHOT_MAGIC;
+        header.version = SNAPSHOT_VERSION;
+        header.nodeSize = sizeof(JsonNode);
+        header.sourceHash = sourceHash;
+        header.fileSize = sizeof(SnapshotHeader) + nodeBytes + sortedBytes + storage.stringSize;
+        header.nodeCount = storage.nodeCount;
+        header.sortedMemberCount = storage.sortedMemberCount;
+        header.stringSize = storage.stringSize;
+        header.root = storage.root;
+
+        auto tempPath = snapshotPath;
+        tempPath += ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                return false;
+            }
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(storage.nodes), static_cast<std::streamsize>(nodeBytes));
+            file.write(reinterpret_cast<const char*>(storage.sortedMembers), static_cast<std::streamsize>(sortedBytes));
+            file.write(storage.strings, static_cast<std::streamsize>(storage.stringSize));
+            if (!file.flush()) {
+                file.close();
+                std::error_code ec;
+                std::filesystem::remove(tempPath, ec);
+                return false;
+            }
+        }
+
+        // Fails on Windows while another document still maps the old file
+        std::error_code ec;
+        std::filesystem::rename(tempPath, snapshotPath, ec);
+        if (ec) {
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+        return true;
+    }
+
+    JsonDocument JsonDocument::FromFileWithSnapshot(const std::filesystem::path& filePath,
+        const std::filesystem::path& snapshotPath) {
+        std::ifstream file(filePath, std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open file: " + filePath.string());
+        }
+        const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        const std::uint64_t sourceHash = HashSource(content);
+        if (std::optional<JsonDocument> snapshot = FromSnapshot(snapshotPath, sourceHash)) {
+            return std::move(*snapshot);
+        }
+
+        // Only text that parsed gets a snapshot
+        JsonDocument document = Parse(content);
+        document.WriteSnapshot(snapshotPath, sourceHash);
+        return document;
+    }
+
+} // namespace Akhanda::Configuration
@@ -0,0 +1,464 @@
+// JsonView.cpp
+// Akhanda Game Engine - Read-Only JSON Document and Views Implementation
+// Copyright (c) 2025 Aditya Vennelakanti. All rights reserved.
+
+#include "JsonView.hpp"
+#include "JsonImpl.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+
+namespace Akhanda::Configuration {
+
+    namespace {
+
+        using detail::JsonNode;
+        using detail::JsonNodeType;
+        using detail::JsonStorage;
+
+        // Objects with fewer members are searched linearly
+        constexpr std::uint32_t SORTED_MEMBERS_MIN = 8;
+
+        // Receives nlohmann's SAX events and lays the document out flat. The
+        // values of each open container collect in pending_; closing the
+        // container moves them into the node table as one contiguous block.
+        class JsonDocumentBuilder {
+        public:
+            using number_integer_t = nlohmann::json::number_integer_t;
+            using number_unsigned_t = nlohmann::json::number_unsigned_t;
+            using number_float_t = nlohmann::json::number_float_t;
+            using string_t = nlohmann::json::string_t;
+            using binary_t = nlohmann::json::binary_t;
+
+            JsonDocumentBuilder() : storage_(std::make_shared<JsonStorage>()) {}
+
+            bool null() {
+                Push(JsonNodeType::Null);
+                return true;
+            }
+
+            bool boolean(bool value) {
+                Push(JsonNodeType::Bool).boolean = value;
+                return true;
+            }
+
+            bool number_integer(number_integer_t value) {
+                Push(JsonNodeType::Int).integer = value;
+                return true;
+            }
+
+            bool number_unsigned(number_unsigned_t value) {
+                Push(JsonNodeType::UInt).unsignedInteger = value;
+                return true;
+            }
+
+            bool number_float(number_float_t value, const string_t&) {
+                Push(JsonNodeType::Float).number = value;
+                return true;
+            }
+
+            bool string(string_t& value) {
+                const std::uint32_t offset = AddString(value);
+                JsonNode& node = Push(JsonNodeType::String);
+                node.string.offset = offset;
+                node.string.length = static_cast<std::uint32_t>(value.size());
+                return true;
+            }
+
+            // Only produced by binary formats
+            bool binary(binary_t&) {
+                return false;
+            }
+
+            bool start_object(std::size_t) {
+                Open(JsonNodeType::Object);
+                return true;
+            }
+
+            bool key(string_t& name) {
+                keyOffset_ = AddString(name);
+                keyLength_ = static_cast<std::uint32_t>(name.size());
+                return true;
+            }
+
+            bool end_object() {
+                Close();
+                return true;
+            }
+
+            bool start_array(std::size_t) {
+                Open(JsonNodeType::Array);
+                return true;
+            }
+
+            bool end_array() {
+                Close();
+                return true;
+            }
+
+            bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& e) {
+                error_ = e.what();
+                return false;
+            }
+
+            const std::string& GetError() const noexcept { return error_; }
+
+            std::shared_ptr<const JsonStorage> Finish() {
+                JsonStorage& storage = *storage_;
+                storage.root = static_cast<std::uint32_t>(storage.nodeData.size());
+                storage.nodeData.push_back(pending_.empty() ? JsonNode() : pending_.back());
+                storage.nodeData.shrink_to_fit();
+                storage.stringData.shrink_to_fit();
+                storage.sortedMemberData.shrink_to_fit();
+
+                storage.nodes = storage.nodeData.data();
+                storage.strings = storage.stringData.data();
+                storage.sortedMembers = storage.sortedMemberData.data();
+                storage.nodeCount = static_cast<std::uint32_t>(storage.nodeData.size());
+                storage.stringSize = static_cast<std::uint32_t>(storage.stringData.size());
+                storage.sortedMemberCount = static_cast<std::uint32_t>(storage.sortedMemberData.size());
+                return std::move(storage_);
+            }
+
+        private:
+            struct Frame {
+                std::size_t firstPending;
+                std::uint32_t keyOffset;
+                std::uint32_t keyLength;
+                JsonNodeType type;
+            };
+
+            std::uint32_t AddString(std::string_view text) {
+                const std::uint32_t offset = static_cast<std::uint32_t>(storage_->stringData.size());
+                storage_->stringData.insert(storage_->stringData.end(), text.begin(), text.end());
+                return offset;
+            }
+
+            // The member name, if any, belongs to the value that follows it
+            JsonNode& Push(JsonNodeType type) {
+                JsonNode& node = pending_.emplace_back();
+                node.type = type;
+                node.keyOffset = keyOffset_;
+                node.keyLength = keyLength_;
+                keyOffset_ = 0;
+                keyLength_ = 0;
+                return node;
+            }
+
+            void Open(JsonNodeType type) {
+                frames_.push_back({ pending_.size(), keyOffset_, keyLength_, type });
+                keyOffset_ = 0;
+                keyLength_ = 0;
+            }
+
+            void Close() {
+                const Frame frame = frames_.back();
+                frames_.pop_back();
+
+                std::vector<JsonNode>& nodes = storage_->nodeData;
+                const std::uint32_t first = static_cast<std::uint32_t>(nodes.size());
+                const std::uint32_t count = static_cast<std::uint32_t>(pending_.size() - frame.firstPending);
+                nodes.insert(nodes.end(), pending_.begin() + frame.firstPending, pending_.end());
+                pending_.resize(frame.firstPending);
+
+                keyOffset_ = frame.keyOffset;
+                keyLength_ = frame.keyLength;
+                JsonNode& container = Push(frame.type);
+                container.children.first = first;
+                container.children.count = count;
+
+                if (frame.type == JsonNodeType::Object && count >= SORTED_MEMBERS_MIN) {
+                    std::vector<std::uint32_t>& sorted = storage_->sortedMemberData;
+                    container.sortedMembers = static_cast<std::uint32_t>(sorted.size());
+                    for (std::uint32_t i = 0; i < count; ++i) {
+                        sorted.push_back(first + i);
+                    }
+                    // Stable, so the last of several equal keys stays last
+                    const char* strings = storage_->stringData.data();
+                    std::stable_sort(sorted.end() - count, sorted.end(), [&nodes, strings](std::uint32_t a, std::uint32_t b) {
+                        return std::string_view(strings + nodes[a].keyOffset, nodes[a].keyLength) <
+                            std::string_view(strings + nodes[b].keyOffset, nodes[b].keyLength);
+                    });
+                }
+            }
+
+            std::shared_ptr<JsonStorage> storage_;
+            std::vector<JsonNode> pending_;
+            std::vector<Frame> frames_;
+            std::uint32_t keyOffset_ = 0;
+            std::uint32_t keyLength_ = 0;
+            std::string error_;
+        };
+
+        // Replays a JsonValue tree as SAX events
+        void EmitValue(JsonDocumentBuilder& builder, const nlohmann::json& json) {
+            switch (json.type()) {
+            case nlohmann::json::value_t::boolean:         builder.boolean(json.get<bool>()); break;
+            case nlohmann::json::value_t::number_integer:  builder.number_integer(json.get<std::int64_t>()); break;
+            case nlohmann::json::value_t::number_unsigned: builder.number_unsigned(json.get<std::uint64_t>()); break;
+            case nlohmann::json::value_t::number_float:    builder.number_float(json.get<double>(), {}); break;
+            case nlohmann::json::value_t::string: {
+                std::string text = json.get<std::string>();
+                builder.string(text);
+                break;
+            }
+            case nlohmann::json::value_t::array:
+                builder.start_array(json.size());
+                for (const nlohmann::json& element : json) {
+                    EmitValue(builder, element);
+                }
+                builder.end_array();
+                break;
+            case nlohmann::json::value_t::object:
+                builder.start_object(json.size());
+                for (auto it = json.begin(); it != json.end(); ++it) {
+                    std::string name = it.key();
+                    builder.key(name);
+                    EmitValue(builder, it.value());
+                }
+                builder.end_object();
+                break;
+            default:
+                builder.null();
+                break;
+            }
+        }
+
+        nlohmann::json ToJson(const JsonView& view) {
+            if (view.IsObject()) {
+                nlohmann::json object = nlohmann::json::object();
+                for (const JsonView member : view) {
+                    object[std::string(member.Key())] = ToJson(member);
+                }
+                return object;
+            }
+            if (view.IsArray()) {
+                nlohmann::json array = nlohmann::json::array();
+                for (const JsonView element : view) {
+                    array.push_back(ToJson(element));
+                }
+                return array;
+            }
+            if (view.IsString()) return std::string(view.GetString());
+            if (view.IsBool()) return view.GetValue<bool>();
+            if (view.IsInteger()) {
+                // The sign decides, as unsigned values above INT64_MAX read negative as int64
+                return view.GetValue<double>() < 0.0
+                    ? nlohmann::json(view.GetValue<std::int64_t>()) : nlohmann::json(view.GetValue<std::uint64_t>());
+            }
+            if (view.IsNumber()) return view.GetValue<double>();
+            return nullptr;
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // JsonDocument Implementation
+    // ============================================================================
+
+    JsonDocument::JsonDocument() : storage_(JsonDocumentBuilder().Finish()) {}
+
+    JsonDocument JsonDocument::Parse(std::string_view jsonString) {
+        JsonDocumentBuilder builder;
+        if (!nlohmann::json::sax_parse(jsonString.begin(), jsonString.end(), &builder)) {
+            throw std::runtime_error(builder.GetError().empty() ? "JSON parse error" : builder.GetError());
+        }
+        return JsonDocument(builder.Finish());
+    }
+
+    JsonDocument JsonDocument::FromFile(const std::filesystem::path& filePath) {
+        std::ifstream file(filePath, std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open file: " + filePath.string());
+        }
+
+        const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        return Parse(content);
+    }
+
+    JsonDocument JsonDocument::FromValue(const JsonValue& value) {
+        JsonDocumentBuilder builder;
+        EmitValue(builder, value.GetImpl()->data);
+        return JsonDocument(builder.Finish());
+    }
+
+    JsonView JsonDocument::Root() const noexcept {
+        return JsonView(storage_.get(), &storage_->nodes[storage_->root]);
+    }
+
+    size_t JsonDocument::GetMemoryUsage() const noexcept {
+        if (storage_->mapping) {
+            return storage_->mappedSize;
+        }
+        return storage_->nodeData.capacity() * sizeof(detail::JsonNode) + storage_->stringData.capacity() +
+            storage_->sortedMemberData.capacity() * sizeof(std::uint32_t);
+    }
+
+    // ============================================================================
+    // JsonView Implementation
+    // ============================================================================
+
+    JsonView JsonView::Find(std::string_view key) const noexcept {
+        if (!IsObject()) {
+            return {};
+        }
+
+        const JsonNode* nodes = storage_->nodes;
+        const auto keyOf = [this, nodes](std::uint32_t index) {
+            return StringAt(nodes[index].keyOffset, nodes[index].keyLength);
+        };
+
+        // Duplicate keys resolve to the last one, as in JsonValue
+        const std::uint32_t first = node_->children.first;
+        const std::uint32_t count = node_->children.count;
+        if (node_->sortedMembers != JsonNode::NO_INDEX) {
+            const std::uint32_t* sorted = storage_->sortedMembers + node_->sortedMembers;
+            const std::uint32_t* after = std::upper_bound(sorted, sorted + count, key,
+                [&keyOf](std::string_view name, std::uint32_t index) { return name < keyOf(index); });
+            if (after != sorted && keyOf(after[-1]) == key) {
+                return JsonView(storage_, &nodes[after[-1]]);
+            }
+            return {};
+        }
+
+        for (std::uint32_t i = count; i > 0; --i) {
+            if (keyOf(first + i - 1) == key) {
+                return JsonView(storage_, &nodes[first + i - 1]);
+            }
+        }
+        return {};
+    }
+
+    JsonView JsonView::AtPath(std::string_view path) const noexcept {
+        JsonView current = *this;
+        while (!path.empty() && current.Exists()) {
+            const size_t dot = path.find('.');
+            const std::string_view segment = path.substr(0, dot);
+            path = dot == std::string_view::npos ? std::string_view() : path.substr(dot + 1);
+
+            size_t index = 0;
+            const auto [end, error] = std::from_chars(segment.data(), segment.data() + segment.size(), index);
+            if (current.IsArray() && error == std::errc() && end == segment.data() + segment.size()) {
+                current = current.At(index);
+            }
+            else {
+                current = current.Find(segment);
+            }
+        }
+        return current;
+    }
+
+    JsonValue JsonView::ToValue() const {
+        JsonValue result;
+        result.GetImpl()->data = ToJson(*this);
+        return result;
+    }
+
+    bool JsonView::operator==(const JsonView& other) const noexcept {
+        if (IsNumber() && other.IsNumber()) {
+            if (node_->type == JsonNodeType::Float || other.node_->type == JsonNodeType::Float) {
+                return GetValueOr(0.0) == other.GetValueOr(0.0);
+            }
+            // Integers of either signedness compare by value
+            if ((node_->type == JsonNodeType::Int && node_->integer < 0) != (other.node_->type == JsonNodeType::Int && other.node_->integer < 0)) {
+                return false;
+            }
+            return GetValueOr<std::uint64_t>(0) == other.GetValueOr<std::uint64_t>(0);
+        }
+
+        const JsonNodeType type = node_ ? node_->type : JsonNodeType::Null;
+        const JsonNodeType otherType = other.node_ ? other.node_->type : JsonNodeType::Null;
+        if (type != otherType) {
+            return false;
+        }
+
+        switch (type) {
+        case JsonNodeType::Null:   return true;
+        case JsonNodeType::Bool:   return node_->boolean == other.node_->boolean;
+        case JsonNodeType::String: return GetString() == other.GetString();
+        case JsonNodeType::Array:
+            if (Size() != other.Size()) return false;
+            for (size_t i = 0; i < Size(); ++i) {
+                if (At(i) != other.At(i)) return false;
+            }
+            return true;
+        case JsonNodeType::Object:
+            if (Size() != other.Size()) return false;
+            // A missing member is not an explicit null
+            for (const JsonView member : *this) {
+                const JsonView match = other.Find(member.Key());
+                if (!match.Exists() || member != match) return false;
+            }
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // ============================================================================
+    // Structural Diff
+    // ============================================================================
+
+    namespace {
+
+        void AppendPath(std::string& path, std::string_view segment) {
+            if (!path.empty()) {
+                path += '.';
+            }
+            path += segment;
+        }
+
+        void Diff(const JsonView& before, const JsonView& after, std::string& path, std::vector<std::string>& changes) {
+            if (before.IsObject() && after.IsObject()) {
+                const size_t length = path.size();
+                // Find, not the member itself, so duplicate keys compare their last value
+                for (const JsonView member : before) {
+                    AppendPath(path, member.Key());
+                    const JsonView other = after.Find(member.Key());
+                    if (other.Exists()) {
+                        Diff(before.Find(member.Key()), other, path, changes);
+                    }
+                    else {
+                        changes.push_back(path);
+                    }
+                    path.resize(length);
+                }
+                for (const JsonView member : after) {
+                    if (!before.Contains(member.Key())) {
+                        AppendPath(path, member.Key());
+                        changes.push_back(path);
+                        path.resize(length);
+                    }
+                }
+                return;
+            }
+
+            if (before.IsArray() && after.IsArray() && before.Size() == after.Size()) {
+                const size_t length = path.size();
+                for (size_t i = 0; i < before.Size(); ++i) {
+                    AppendPath(path, std::to_string(i));
+                    Diff(before.At(i), after.At(i), path, changes);
+                    path.resize(length);
+                }
+                return;
+            }
+
+            if (before != after) {
+                changes.push_back(path);
+            }
+        }
+
+    } // namespace
+
+    std::vector<std::string> DiffJson(const JsonView& before, const JsonView& after) {
+        std::vector<std::string> changes;
+        std::string path;
+        Diff(before, after, path, changes);
+
+        std::sort(changes.begin(), changes.end());
+        changes.erase(std::unique(changes.begin(), changes.end()), changes.end());
+        return changes;
+    }
+
+} // namespace Akhanda::Configuration
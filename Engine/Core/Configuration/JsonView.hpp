@@ -0,0 +1,323 @@
+// JsonView.hpp
+// Akhanda Game Engine - Read-Only JSON Document and Views
+// Copyright (c) 2025 Aditya Vennelakanti. All rights reserved.
+
+#pragma once
+
+#include "JsonWrapper.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Akhanda::Configuration {
+
+    class JsonView;
+
+    namespace detail {
+
+        enum class JsonNodeType : std::uint8_t {
+            Null,
+            Bool,
+            Int,
+            UInt,
+            Float,
+            String,
+            Array,
+            Object
+        };
+
+        // One value of a flattened document. The children of an array or
+        // object are contiguous and in document order; objects with many
+        // members also have a key-sorted list of child indices.
+        struct JsonNode {
+            static constexpr std::uint32_t NO_INDEX = 0xFFFFFFFFu;
+
+            JsonNodeType type = JsonNodeType::Null;
+            std::uint32_t keyOffset = 0;        // Member name in JsonStorage::strings, if inside an object
+            std::uint32_t keyLength = 0;
+            std::uint32_t sortedMembers = NO_INDEX;     // Objects: offset into JsonStorage::sortedMembers
+
+            union {
+                bool boolean;
+                std::int64_t integer;
+                std::uint64_t unsignedInteger;
+                double number;
+                struct { std::uint32_t offset, length; } string;
+                struct { std::uint32_t first, count; } children;
+            };
+
+            JsonNode() : integer(0) {}
+        };
+
+        // What views read. A parsed document points into its own arrays; one
+        // loaded from a snapshot points into the mapped file.
+        struct JsonStorage {
+            const JsonNode* nodes = nullptr;
+            const char* strings = nullptr;              // Keys and string values, not terminated
+            const std::uint32_t* sortedMembers = nullptr;
+            std::uint32_t nodeCount = 0;
+            std::uint32_t stringSize = 0;
+            std::uint32_t sortedMemberCount = 0;
+            std::uint32_t root = 0;
+
+            std::vector<JsonNode> nodeData;
+            std::vector<char> stringData;
+            std::vector<std::uint32_t> sortedMemberData;
+
+            std::shared_ptr<const void> mapping;        // Keeps a mapped snapshot alive
+            size_t mappedSize = 0;
+        };
+
+    } // namespace detail
+
+    // ============================================================================
+    // JSON Document - Immutable, flattened parse result
+    // ============================================================================
+
+    // Parsing builds the flat node table directly, without a JsonValue tree.
+    // Copies share the same storage, which never changes after parsing, so
+    // a document and its views can be read from any number of threads.
+    class JsonDocument {
+    public:
+        JsonDocument();
+
+        // Throw std::runtime_error with the parser's message on invalid input
+        static JsonDocument Parse(std::string_view jsonString);
+        static JsonDocument FromFile(const std::filesystem::path& filePath);
+
+        static JsonDocument FromValue(const JsonValue& value);
+
+        // Binary snapshots hold the node table as it is laid out in memory,
+        // tagged with a hash of the JSON text it was parsed from, and load by
+        // mapping the file. FromSnapshot returns nothing when the file is
+        // missing, invalid, or was built from other text. WriteSnapshot writes
+        // a temporary file and renames it over the old snapshot.
+        static std::uint64_t HashSource(std::string_view jsonString) noexcept;
+        static std::optional<JsonDocument> FromSnapshot(const std::filesystem::path& snapshotPath, std::uint64_t sourceHash);
+        bool WriteSnapshot(const std::filesystem::path& snapshotPath, std::uint64_t sourceHash) const;
+
+        // Reads the JSON file and maps the snapshot when it matches the text;
+        // otherwise parses the text and rewrites the snapshot. Throws like FromFile.
+        static JsonDocument FromFileWithSnapshot(const std::filesystem::path& filePath,
+            const std::filesystem::path& snapshotPath);
+
+        bool IsMapped() const noexcept { return storage_->mapping != nullptr; }
+
+        JsonView Root() const noexcept;
+
+        // Bytes held by the node table and string data, or mapped from a snapshot
+        size_t GetMemoryUsage() const noexcept;
+
+    private:
+        explicit JsonDocument(std::shared_ptr<const detail::JsonStorage> storage) : storage_(std::move(storage)) {}
+
+        std::shared_ptr<const detail::JsonStorage> storage_;
+    };
+
+    // ============================================================================
+    // JSON View - Non-owning reference into a JsonDocument
+    // ============================================================================
+
+    // Lookups return views and strings are returned as string_views into the
+    // document, so reading never copies a subtree. A view is valid as long as
+    // some copy of its document is alive. Looking up a missing key or index
+    // gives an empty view, which is null and returns defaults from GetValueOr.
+    class JsonView {
+    public:
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = JsonView;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = JsonView;
+
+            Iterator() = default;
+
+            JsonView operator*() const noexcept { return JsonView(storage_, node_); }
+            Iterator& operator++() noexcept { ++node_; return *this; }
+            Iterator operator++(int) noexcept { Iterator previous = *this; ++node_; return previous; }
+            bool operator==(const Iterator& other) const noexcept { return node_ == other.node_; }
+
+        private:
+            friend class JsonView;
+            Iterator(const detail::JsonStorage* storage, const detail::JsonNode* node) : storage_(storage), node_(node) {}
+
+            const detail::JsonStorage* storage_ = nullptr;
+            const detail::JsonNode* node_ = nullptr;
+        };
+
+        JsonView() = default;
+
+        // Type checking
+        bool Exists() const noexcept { return node_ != nullptr; }
+        bool IsNull() const noexcept { return !node_ || node_->type == detail::JsonNodeType::Null; }
+        bool IsObject() const noexcept { return Is(detail::JsonNodeType::Object); }
+        bool IsArray() const noexcept { return Is(detail::JsonNodeType::Array); }
+        bool IsString() const noexcept { return Is(detail::JsonNodeType::String); }
+        bool IsBool() const noexcept { return Is(detail::JsonNodeType::Bool); }
+        bool IsNumber() const noexcept {
+            return node_ && (node_->type == detail::JsonNodeType::Int || node_->type == detail::JsonNodeType::UInt ||
+                node_->type == detail::JsonNodeType::Float);
+        }
+        bool IsInteger() const noexcept {
+            return node_ && (node_->type == detail::JsonNodeType::Int || node_->type == detail::JsonNodeType::UInt);
+        }
+
+        // Object operations
+        bool Contains(std::string_view key) const noexcept { return Find(key).Exists(); }
+        JsonView operator[](std::string_view key) const noexcept { return Find(key); }
+        JsonView Find(std::string_view key) const noexcept;
+
+        // Member name, when this view is a member of an object
+        std::string_view Key() const noexcept {
+            return node_ ? std::string_view(storage_->strings + node_->keyOffset, node_->keyLength) : std::string_view();
+        }
+
+        // Array operations; Size is also the member count of an object
+        size_t Size() const noexcept {
+            return IsArray() || IsObject() ? node_->children.count : 0;
+        }
+        JsonView At(size_t index) const noexcept {
+            return index < Size() ? JsonView(storage_, &storage_->nodes[node_->children.first + index]) : JsonView();
+        }
+
+        // Children of an array or object, in document order
+        Iterator begin() const noexcept {
+            return Size() > 0 ? Iterator(storage_, &storage_->nodes[node_->children.first]) : Iterator();
+        }
+        Iterator end() const noexcept {
+            return Size() > 0 ? Iterator(storage_, &storage_->nodes[node_->children.first] + node_->children.count) : Iterator();
+        }
+
+        // Dot-separated member names, with array indices as numbers:
+        // "rendering.shaders.includePaths.0". An empty path is this view.
+        JsonView AtPath(std::string_view path) const noexcept;
+
+        // Value access. GetValue throws std::runtime_error when the value has
+        // another type; GetValueOr returns the default instead. Numbers convert
+        // between integer and floating point types.
+        template<typename T>
+        T GetValue() const {
+            T value{};
+            if (!TryGetValue(value)) {
+                throw std::runtime_error(std::string("JSON value is not a ") + TypeName<T>() +
+                    (Key().empty() ? std::string() : " at '" + std::string(Key()) + "'"));
+            }
+            return value;
+        }
+
+        template<typename T>
+        T GetValueOr(const T& defaultValue) const {
+            T value{};
+            return TryGetValue(value) ? value : defaultValue;
+        }
+
+        std::string_view GetString() const noexcept { return GetValueOr<std::string_view>({}); }
+
+        // Copies the subtree into a mutable value
+        JsonValue ToValue() const;
+
+        // Same kind and value, with object members compared by name
+        bool operator==(const JsonView& other) const noexcept;
+        bool operator!=(const JsonView& other) const noexcept { return !(*this == other); }
+
+    private:
+        friend class JsonDocument;
+
+        JsonView(const detail::JsonStorage* storage, const detail::JsonNode* node) noexcept
+            : storage_(storage), node_(node) {
+        }
+
+        bool Is(detail::JsonNodeType type) const noexcept { return node_ && node_->type == type; }
+
+        std::string_view StringAt(std::uint32_t offset, std::uint32_t length) const noexcept {
+            return std::string_view(storage_->strings + offset, length);
+        }
+
+        template<typename T>
+        bool TryGetNumber(T& value) const noexcept {
+            switch (node_ ? node_->type : detail::JsonNodeType::Null) {
+            case detail::JsonNodeType::Int:   value = static_cast<T>(node_->integer); return true;
+            case detail::JsonNodeType::UInt:  value = static_cast<T>(node_->unsignedInteger); return true;
+            case detail::JsonNodeType::Float: value = static_cast<T>(node_->number); return true;
+            default: return false;
+            }
+        }
+
+        bool TryGetValue(bool& value) const noexcept {
+            if (!IsBool()) return false;
+            value = node_->boolean;
+            return true;
+        }
+        bool TryGetValue(int& value) const noexcept { return TryGetNumber(value); }
+        bool TryGetValue(std::uint32_t& value) const noexcept { return TryGetNumber(value); }
+        bool TryGetValue(std::int64_t& value) const noexcept { return TryGetNumber(value); }
+        bool TryGetValue(std::uint64_t& value) const noexcept { return TryGetNumber(value); }
+        bool TryGetValue(float& value) const noexcept { return TryGetNumber(value); }
+        bool TryGetValue(double& value) const noexcept { return TryGetNumber(value); }
+        bool TryGetValue(std::string_view& value) const noexcept {
+            if (!IsString()) return false;
+            value = StringAt(node_->string.offset, node_->string.length);
+            return true;
+        }
+        bool TryGetValue(std::string& value) const {
+            std::string_view text;
+            if (!TryGetValue(text)) return false;
+            value.assign(text);
+            return true;
+        }
+        // Like JsonValue, non-string elements are skipped
+        bool TryGetValue(std::vector<std::string>& value) const {
+            if (!IsArray()) return false;
+            value.clear();
+            for (const JsonView element : *this) {
+                if (element.IsString()) {
+                    value.emplace_back(element.GetString());
+                }
+            }
+            return true;
+        }
+
+        template<typename T>
+        static const char* TypeName() noexcept {
+            if constexpr (std::is_same_v<T, bool>) return "boolean";
+            else if constexpr (std::is_arithmetic_v<T>) return "number";
+            else if constexpr (std::is_same_v<T, std::vector<std::string>>) return "array";
+            else return "string";
+        }
+
+        const detail::JsonStorage* storage_ = nullptr;
+        const detail::JsonNode* node_ = nullptr;
+    };
+
+    // ============================================================================
+    // Structural Diff
+    // ============================================================================
+
+    // Sorted paths, in AtPath form, where after differs from before. Objects
+    // are compared member by member and arrays of equal length element by
+    // element, so only the innermost differing values are listed; an added
+    // or removed member, an array that changed length and a value that
+    // changed kind are listed whole. Differing scalar roots give one empty
+    // path.
+    std::vector<std::string> DiffJson(const JsonView& before, const JsonView& after);
+
+    // ============================================================================
+    // Template helpers for reading configuration from views
+    // ============================================================================
+
+    template<typename T>
+    T GetConfigValue(const JsonView& json, std::string_view key, const T& defaultValue = T{}) {
+        return json[key].GetValueOr<T>(defaultValue);
+    }
+
+} // namespace Akhanda::Configuration
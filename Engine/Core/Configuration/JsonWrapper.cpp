@@ -3,38 +3,9 @@
 // Copyright (c) 2025 Aditya Vennelakanti. All rights reserved.
 
 #include "JsonWrapper.hpp"
-#include <nlohmann/json.hpp>
+#include "JsonImpl.hpp"
 #include <fstream>
 
-namespace Akhanda::Configuration::detail {
-
-    class JsonImpl {
-    public:
-        nlohmann::json data;
-
-        JsonImpl() = default;
-        JsonImpl(const nlohmann::json& json) : data(json) {}
-        JsonImpl(nlohmann::json&& json) : data(std::move(json)) {}
-        JsonImpl(const JsonImpl& other) : data(other.data) {}
-        JsonImpl(JsonImpl&& other) noexcept : data(std::move(other.data)) {}
-
-        JsonImpl& operator=(const JsonImpl& other) {
-            if (this != &other) {
-                data = other.data;
-            }
-            return *this;
-        }
-
-        JsonImpl& operator=(JsonImpl&& other) noexcept {
-            if (this != &other) {
-                data = std::move(other.data);
-            }
-            return *this;
-        }
-    };
-
-} // namespace Akhanda::Configuration::detail
-
 namespace Akhanda::Configuration {
 
     // ============================================================================
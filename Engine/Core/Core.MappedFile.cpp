@@ -0,0 +1,71 @@
+// Core.MappedFile.cpp
+// Akhanda Game Engine - Read-Only File Mapping
+// Copyright (c) 2025 Aditya Vennelakanti. All rights reserved.
+
+module;
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+module Akhanda.Core.MappedFile;
+
+namespace Akhanda::Core {
+
+    std::shared_ptr<const MappedFile> MappedFile::Open(const std::filesystem::path& path) {
+        auto file = std::shared_ptr<MappedFile>(new MappedFile());
+#ifdef _WIN32
+        const HANDLE handle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (handle == INVALID_HANDLE_VALUE) {
+            return nullptr;
+        }
+
+        LARGE_INTEGER size{};
+        if (GetFileSizeEx(handle, &size) && size.QuadPart > 0) {
+            const HANDLE mapping = CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping) {
+                file->data_ = static_cast<const std::byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                file->size_ = static_cast<size_t>(size.QuadPart);
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(handle);
+#else
+        const int descriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (descriptor < 0) {
+            return nullptr;
+        }
+
+        struct stat status{};
+        if (fstat(descriptor, &status) == 0 && status.st_size > 0) {
+            void* address = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (address != MAP_FAILED) {
+                file->data_ = static_cast<const std::byte*>(address);
+                file->size_ = static_cast<size_t>(status.st_size);
+            }
+        }
+        close(descriptor);
+#endif
+        return file->data_ ? file : nullptr;
+    }
+
+    MappedFile::~MappedFile() {
+        if (!data_) return;
+#ifdef _WIN32
+        UnmapViewOfFile(data_);
+#else
+        munmap(const_cast<std::byte*>(data_), size_);
+#endif
+    }
+
+} // namespace Akhanda::Core
@@ -0,0 +1,36 @@
+// Core.MappedFile.ixx
+// Akhanda Game Engine - Read-Only File Mapping
+// Copyright (c) 2025 Aditya Vennelakanti. All rights reserved.
+
+module;
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+
+export module Akhanda.Core.MappedFile;
+
+export namespace Akhanda::Core {
+
+    // A read-only view of a whole file, unmapped when the last reference
+    // goes away. Open returns null for a missing, unreadable or empty file.
+    class MappedFile {
+    public:
+        static std::shared_ptr<const MappedFile> Open(const std::filesystem::path& path);
+
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        const std::byte* Data() const noexcept { return data_; }
+        size_t Size() const noexcept { return size_; }
+
+    private:
+        MappedFile() = default;
+
+        const std::byte* data_ = nullptr;
+        size_t size_ = 0;
+    };
+
+} // namespace Akhanda::Core
@@ -492,4 +492,25 @@ export namespace Akhanda::JobSystem {
     inline void WaitForAll() noexcept {
         GetJobScheduler().WaitForAll();
     }
+
+    // Runs task(i) for every i in [0, taskCount) on the workers and the calling
+    // thread and returns once all have finished. Usable as the parallelFor
+    // argument of the Math spatial index rebuilds.
+    template<typename F>
+    inline void ParallelFor(uint32_t taskCount, F&& task, const char* name = "ParallelFor") noexcept {
+        if (taskCount <= 1 || !JobScheduler::IsInitialized()) {
+            for (uint32_t i = 0; i < taskCount; ++i) {
+                task(i);
+            }
+            return;
+        }
+
+        std::vector<JobHandle> handles;
+        handles.reserve(taskCount - 1);
+        for (uint32_t i = 1; i < taskCount; ++i) {
+            handles.push_back(GetJobScheduler().SubmitJob([&task, i]() { task(i); }, name));
+        }
+        task(0);
+        GetJobScheduler().WaitForJobs(handles);
+    }
 } // namespace Akhanda::JobSystem
\ No newline at end of file
@@ -0,0 +1,887 @@
+// Core.Logging.Binary.cpp - Binary log files: writer, reader and block compression
+module;
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+module Akhanda.Core.Logging;
+
+using namespace Akhanda::Logging;
+
+// =============================================================================
+// File Layout
+// =============================================================================
+//
+//   File:    FileHeader, then blocks until the end of the file
+//   Block:   uint32 rawSize, uint32 storedSize, payload. The payload is an
+//            LZ4 block when storedSize < rawSize and stored as is otherwise.
+//   Payload: entries, each starting with a varint tag. Entries never span
+//            blocks, and every definition precedes its first use.
+//
+//     0   String  id, length, bytes
+//     1   Thread  index, native thread id
+//     2   Site    id, channel string, level, file string, line, format string,
+//                 argument count, one LogArgumentKind byte per argument
+//     3+  Record  site id + 3, zigzag timestamp delta (ns), thread index, arguments
+//
+//   Arguments: 8-bit values, bool and char as one byte; wider signed integers
+//   as zigzag varints; unsigned integers, pointers and string lengths as
+//   varints; floats and doubles as their raw bytes.
+
+namespace {
+    constexpr std::array<char, 8> FILE_MAGIC = { 'A', 'K', 'H', 'B', 'L', 'O', 'G', '\0' };
+    constexpr uint32_t FILE_VERSION = 1;
+
+    struct FileHeader {
+        std::array<char, 8> magic;
+        uint32_t version;
+        uint32_t flags;
+        int64_t startTime;          // Nanoseconds since the system clock epoch
+    };
+
+    struct BlockHeader {
+        uint32_t rawSize;
+        uint32_t storedSize;
+    };
+
+    constexpr uint64_t TAG_STRING = 0;
+    constexpr uint64_t TAG_THREAD = 1;
+    constexpr uint64_t TAG_SITE = 2;
+    constexpr uint64_t TAG_FIRST_RECORD = 3;
+
+    // A reader refuses blocks larger than this rather than trusting the size
+    constexpr uint32_t MAX_BLOCK_SIZE = 64 * 1024 * 1024;
+
+    int64_t ToNanoseconds(std::chrono::system_clock::time_point time) noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+    }
+
+    std::chrono::system_clock::time_point FromNanoseconds(int64_t nanoseconds) noexcept {
+        return std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(nanoseconds)));
+    }
+
+    constexpr uint64_t ZigZag(int64_t value) noexcept {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    constexpr int64_t UnZigZag(uint64_t value) noexcept {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    void PutVarint(std::vector<std::byte>& output, uint64_t value) {
+        while (value >= 0x80) {
+            output.push_back(static_cast<std::byte>(value | 0x80));
+            value >>= 7;
+        }
+        output.push_back(static_cast<std::byte>(value));
+    }
+
+    void PutBytes(std::vector<std::byte>& output, const void* data, size_t size) {
+        const auto* bytes = static_cast<const std::byte*>(data);
+        output.insert(output.end(), bytes, bytes + size);
+    }
+
+    void PutString(std::vector<std::byte>& output, std::string_view text) {
+        PutVarint(output, text.size());
+        PutBytes(output, text.data(), text.size());
+    }
+
+    // Bounds-checked cursor over a block; any overrun clears ok
+    struct ByteReader {
+        const std::byte* position;
+        const std::byte* end;
+        bool ok = true;
+
+        uint64_t Varint() noexcept {
+            uint64_t value = 0;
+            for (uint32_t shift = 0; shift < 64; shift += 7) {
+                if (position == end) break;
+                const uint8_t byte = static_cast<uint8_t>(*position++);
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) return value;
+            }
+            ok = false;
+            return 0;
+        }
+
+        const std::byte* Bytes(size_t size) noexcept {
+            if (static_cast<size_t>(end - position) < size) {
+                ok = false;
+                return nullptr;
+            }
+            const std::byte* bytes = position;
+            position += size;
+            return bytes;
+        }
+
+        template<typename T>
+        T Raw() noexcept {
+            T value{};
+            if (const std::byte* bytes = Bytes(sizeof(T))) {
+                std::memcpy(&value, bytes, sizeof(T));
+            }
+            return value;
+        }
+
+        std::string_view String() noexcept {
+            const uint64_t size = Varint();
+            const std::byte* bytes = ok ? Bytes(size) : nullptr;
+            return bytes ? std::string_view(reinterpret_cast<const char*>(bytes), size) : std::string_view();
+        }
+    };
+
+    template<typename T>
+    T LoadRaw(const std::byte*& input) noexcept {
+        T value;
+        std::memcpy(&value, input, sizeof(T));
+        input += sizeof(T);
+        return value;
+    }
+
+    // Rewrites one record's arguments from the ring layout (see EncodeLogArguments)
+    void TranscodeArguments(std::span<const LogArgumentKind> kinds, const std::byte* input, std::vector<std::byte>& output) {
+        for (const LogArgumentKind kind : kinds) {
+            switch (kind) {
+            case LogArgumentKind::Bool:
+            case LogArgumentKind::Char:
+            case LogArgumentKind::Int8:
+            case LogArgumentKind::UInt8:
+                output.push_back(*input++);
+                break;
+            case LogArgumentKind::Int16:  PutVarint(output, ZigZag(LoadRaw<int16_t>(input))); break;
+            case LogArgumentKind::Int32:  PutVarint(output, ZigZag(LoadRaw<int32_t>(input))); break;
+            case LogArgumentKind::Int64:  PutVarint(output, ZigZag(LoadRaw<int64_t>(input))); break;
+            case LogArgumentKind::UInt16: PutVarint(output, LoadRaw<uint16_t>(input)); break;
+            case LogArgumentKind::UInt32: PutVarint(output, LoadRaw<uint32_t>(input)); break;
+            case LogArgumentKind::UInt64: PutVarint(output, LoadRaw<uint64_t>(input)); break;
+            case LogArgumentKind::Float:
+                PutBytes(output, input, sizeof(float));
+                input += sizeof(float);
+                break;
+            case LogArgumentKind::Double:
+                PutBytes(output, input, sizeof(double));
+                input += sizeof(double);
+                break;
+            case LogArgumentKind::Pointer:
+                PutVarint(output, reinterpret_cast<uintptr_t>(LoadRaw<const void*>(input)));
+                break;
+            case LogArgumentKind::String: {
+                const uint32_t size = LoadRaw<uint32_t>(input);
+                PutString(output, std::string_view(reinterpret_cast<const char*>(input), size));
+                input += size;
+                break;
+            }
+            case LogArgumentKind::Opaque:
+                break;
+            }
+        }
+    }
+
+    // What an argument decodes to; integers are widened, which formats the same
+    using LogValue = std::variant<bool, char, int64_t, uint64_t, float, double, std::string_view, const void*>;
+
+    LogValue ReadArgument(ByteReader& input, LogArgumentKind kind) noexcept {
+        switch (kind) {
+        case LogArgumentKind::Bool:    return input.Raw<uint8_t>() != 0;
+        case LogArgumentKind::Char:    return input.Raw<char>();
+        case LogArgumentKind::Int8:    return int64_t(input.Raw<int8_t>());
+        case LogArgumentKind::UInt8:   return uint64_t(input.Raw<uint8_t>());
+        case LogArgumentKind::Int16:
+        case LogArgumentKind::Int32:
+        case LogArgumentKind::Int64:   return UnZigZag(input.Varint());
+        case LogArgumentKind::UInt16:
+        case LogArgumentKind::UInt32:
+        case LogArgumentKind::UInt64:  return input.Varint();
+        case LogArgumentKind::Float:   return input.Raw<float>();
+        case LogArgumentKind::Double:  return input.Raw<double>();
+        case LogArgumentKind::String:  return input.String();
+        case LogArgumentKind::Pointer: return reinterpret_cast<const void*>(static_cast<uintptr_t>(input.Varint()));
+        default:
+            input.ok = false;
+            return false;
+        }
+    }
+
+    // Closing brace of the replacement field opened at `open`, allowing
+    // nested fields such as {:{}}
+    size_t FindFieldEnd(std::string_view format, size_t open) noexcept {
+        int depth = 0;
+        for (size_t i = open; i < format.size(); ++i) {
+            if (format[i] == '{') ++depth;
+            else if (format[i] == '}' && --depth == 0) return i;
+        }
+        return std::string_view::npos;
+    }
+
+    // std::vformat over a runtime list of values. Each replacement field is
+    // formatted on its own with its own spec; nested (dynamic) width and
+    // precision are not supported and render with the default spec.
+    void RenderFormat(std::string_view format, std::span<const LogValue> values, std::string& output) {
+        size_t nextIndex = 0;
+        for (size_t i = 0; i < format.size(); ++i) {
+            const char c = format[i];
+            if ((c == '{' || c == '}') && i + 1 < format.size() && format[i + 1] == c) {
+                output += c;
+                ++i;
+                continue;
+            }
+            if (c != '{') {
+                output += c;
+                continue;
+            }
+
+            const size_t close = FindFieldEnd(format, i);
+            if (close == std::string_view::npos) {
+                output.append(format.substr(i));
+                return;
+            }
+
+            const std::string_view field = format.substr(i + 1, close - i - 1);
+            const size_t colon = field.find(':');
+            const std::string_view id = field.substr(0, colon);
+            std::string_view spec = colon == std::string_view::npos ? std::string_view() : field.substr(colon);
+            if (spec.find('{') != std::string_view::npos) {
+                spec = {};
+            }
+
+            size_t index = nextIndex++;
+            if (!id.empty()) {
+                index = 0;
+                for (const char digit : id) {
+                    index = index * 10 + static_cast<size_t>(digit - '0');
+                }
+            }
+
+            if (index < values.size()) {
+                const std::string fieldFormat = std::string("{") + std::string(spec) + "}";
+                std::visit([&](auto value) {
+                    try {
+                        std::vformat_to(std::back_inserter(output), fieldFormat, std::make_format_args(value));
+                    }
+                    catch (const std::exception&) {
+                        output += "{?}";
+                    }
+                    }, values[index]);
+            }
+            else {
+                output += "{?}";
+            }
+            i = close;
+        }
+    }
+
+    // Format string that renders a structured record's key/value arguments
+    // the way FormatLogFields does
+    void BuildFieldFormat(std::string_view event, std::span<const LogArgumentKind> kinds, std::string& output) {
+        output.clear();
+        for (const char c : event) {
+            output += c;
+            if (c == '{' || c == '}') output += c;
+        }
+        for (size_t i = 1; i < kinds.size(); i += 2) {
+            output += kinds[i] == LogArgumentKind::String ? " {}=\"{}\"" : " {}={}";
+        }
+    }
+}
+
+// =============================================================================
+// Block Compression (LZ4 block format)
+// =============================================================================
+
+namespace {
+    constexpr size_t MIN_MATCH = 4;
+    constexpr size_t LAST_LITERALS = 5;         // The last bytes are always literals
+    constexpr size_t MATCH_START_LIMIT = 12;    // No match starts this close to the end
+    constexpr size_t MAX_OFFSET = 65535;
+    constexpr uint32_t HASH_BITS = 12;
+
+    uint32_t Read32(const std::byte* bytes) noexcept {
+        uint32_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+
+    constexpr uint32_t HashSequence(uint32_t sequence) noexcept {
+        return (sequence * 2654435761u) >> (32 - HASH_BITS);
+    }
+
+    void PutLength(std::vector<std::byte>& output, size_t length) {
+        for (length -= 15; length >= 255; length -= 255) {
+            output.push_back(std::byte{ 255 });
+        }
+        output.push_back(static_cast<std::byte>(length));
+    }
+
+    void PutSequence(std::vector<std::byte>& output, const std::byte* literals, size_t literalLength, size_t offset, size_t matchLength) {
+        const size_t matchCode = matchLength - MIN_MATCH;
+        output.push_back(static_cast<std::byte>((std::min<size_t>(literalLength, 15) << 4) | std::min<size_t>(matchCode, 15)));
+        if (literalLength >= 15) PutLength(output, literalLength);
+        PutBytes(output, literals, literalLength);
+        output.push_back(static_cast<std::byte>(offset & 0xFF));
+        output.push_back(static_cast<std::byte>(offset >> 8));
+        if (matchCode >= 15) PutLength(output, matchCode);
+    }
+
+    void PutLastLiterals(std::vector<std::byte>& output, const std::byte* literals, size_t literalLength) {
+        output.push_back(static_cast<std::byte>(std::min<size_t>(literalLength, 15) << 4));
+        if (literalLength >= 15) PutLength(output, literalLength);
+        PutBytes(output, literals, literalLength);
+    }
+
+    bool ReadLength(ByteReader& input, size_t& length) noexcept {
+        uint8_t byte = 0;
+        do {
+            const std::byte* next = input.Bytes(1);
+            if (!next) return false;
+            byte = static_cast<uint8_t>(*next);
+            length += byte;
+        } while (byte == 255);
+        return true;
+    }
+}
+
+size_t Akhanda::Logging::Detail::CompressLogBlock(std::span<const std::byte> input, std::vector<std::byte>& output) {
+    output.clear();
+    const std::byte* source = input.data();
+    const size_t size = input.size();
+    size_t anchor = 0;
+
+    if (size > MATCH_START_LIMIT) {
+        // Positions are stored plus one so zero means empty
+        std::vector<uint32_t> table(size_t(1) << HASH_BITS, 0);
+        const size_t matchEnd = size - LAST_LITERALS;
+        const size_t searchEnd = size - MATCH_START_LIMIT;
+
+        size_t position = 0;
+        while (position < searchEnd) {
+            const uint32_t sequence = Read32(source + position);
+            uint32_t& slot = table[HashSequence(sequence)];
+            size_t candidate = slot;
+            slot = static_cast<uint32_t>(position + 1);
+
+            if (candidate == 0 || position - (candidate - 1) > MAX_OFFSET || Read32(source + candidate - 1) != sequence) {
+                ++position;
+                continue;
+            }
+            --candidate;
+
+            while (position > anchor && candidate > 0 && source[position - 1] == source[candidate - 1]) {
+                --position;
+                --candidate;
+            }
+            size_t length = MIN_MATCH;
+            while (position + length < matchEnd && source[candidate + length] == source[position + length]) {
+                ++length;
+            }
+
+            PutSequence(output, source + anchor, position - anchor, position - candidate, length);
+            position += length;
+            anchor = position;
+        }
+    }
+
+    PutLastLiterals(output, source + anchor, size - anchor);
+    return output.size() < size ? output.size() : 0;
+}
+
+bool Akhanda::Logging::Detail::DecompressLogBlock(std::span<const std::byte> input, size_t rawSize, std::vector<std::byte>& output) {
+    output.resize(rawSize);
+    ByteReader reader{ input.data(), input.data() + input.size() };
+    size_t written = 0;
+
+    while (reader.position != reader.end) {
+        const uint8_t token = static_cast<uint8_t>(*reader.position++);
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !ReadLength(reader, literalLength)) return false;
+        const std::byte* literals = reader.Bytes(literalLength);
+        if (!literals || rawSize - written < literalLength) return false;
+        std::memcpy(output.data() + written, literals, literalLength);
+        written += literalLength;
+
+        // The last sequence has no match
+        if (reader.position == reader.end) break;
+
+        const std::byte* offsetBytes = reader.Bytes(2);
+        if (!offsetBytes) return false;
+        const size_t offset = static_cast<size_t>(offsetBytes[0]) | (static_cast<size_t>(offsetBytes[1]) << 8);
+        size_t matchLength = token & 0x0F;
+        if (matchLength == 15 && !ReadLength(reader, matchLength)) return false;
+        matchLength += MIN_MATCH;
+        if (offset == 0 || offset > written || rawSize - written < matchLength) return false;
+
+        // Matches may overlap their own output, so copy forward byte by byte
+        std::byte* destination = output.data() + written;
+        const std::byte* match = destination - offset;
+        for (size_t i = 0; i < matchLength; ++i) {
+            destination[i] = match[i];
+        }
+        written += matchLength;
+    }
+    return written == rawSize;
+}
+
+// =============================================================================
+// BinaryLogSink
+// =============================================================================
+
+class BinaryLogSink::Impl {
+public:
+    Impl(const std::filesystem::path& path, const BinaryLogOptions& options)
+        : options_(options)
+        , file_(path, std::ios::binary | std::ios::trunc) {
+        if (!file_) return;
+
+        FileHeader header{ FILE_MAGIC, FILE_VERSION, 0, ToNanoseconds(std::chrono::system_clock::now()) };
+        file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        lastTimestamp_ = header.startTime;
+        bytesWritten_.store(sizeof(header), std::memory_order_relaxed);
+        block_.reserve(options_.blockSize + 256);
+    }
+
+    ~Impl() {
+        Flush();
+    }
+
+    bool IsOpen() const noexcept {
+        return static_cast<bool>(file_);
+    }
+
+    void Write(const LogRecordHeader& header, const std::byte* arguments) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!file_) return;
+
+        // Arguments the reader could not rebuild are formatted now
+        const bool text = (header.argumentKinds.empty() && header.argumentBytes != 0) ||
+            std::ranges::find(header.argumentKinds, LogArgumentKind::Opaque) != header.argumentKinds.end();
+
+        const uint32_t site = SiteFor(header, text);
+        const uint32_t thread = ThreadFor(header.nativeThreadId);
+        const int64_t timestamp = ToNanoseconds(header.timestamp);
+
+        PutVarint(block_, TAG_FIRST_RECORD + site);
+        PutVarint(block_, ZigZag(timestamp - lastTimestamp_));
+        PutVarint(block_, thread);
+        lastTimestamp_ = timestamp;
+
+        if (text) {
+            scratch_.clear();
+            try {
+                header.formatter(std::string_view(header.format, header.formatSize), arguments, scratch_);
+            }
+            catch (const std::exception&) {
+                scratch_ = "LOG FORMAT ERROR: Invalid format string";
+            }
+            PutString(block_, scratch_);
+        }
+        else {
+            TranscodeArguments(header.argumentKinds, arguments, block_);
+        }
+
+        if (block_.size() >= options_.blockSize) {
+            WriteBlock();
+        }
+    }
+
+    void Flush() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!file_) return;
+        WriteBlock();
+        file_.flush();
+    }
+
+    uint64_t GetBytesWritten() const noexcept {
+        return bytesWritten_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct SiteKey {
+        const char* format;
+        const char* file;
+        const LogChannel* channel;
+        const LogArgumentKind* kinds;
+        uint32_t line;
+        LogLevel level;
+        bool text;
+
+        bool operator==(const SiteKey&) const = default;
+    };
+
+    struct SiteKeyHash {
+        size_t operator()(const SiteKey& key) const noexcept {
+            size_t hash = std::hash<const void*>{}(key.format);
+            const auto combine = [&hash](size_t value) { hash ^= value + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2); };
+            combine(std::hash<const void*>{}(key.file));
+            combine(std::hash<const void*>{}(key.channel));
+            combine(std::hash<const void*>{}(key.kinds));
+            combine((size_t(key.line) << 9) | (size_t(key.level) << 1) | size_t(key.text));
+            return hash;
+        }
+    };
+
+    uint32_t StringFor(std::string_view text) {
+        auto [it, inserted] = strings_.try_emplace(std::string(text), static_cast<uint32_t>(strings_.size()));
+        if (inserted) {
+            PutVarint(block_, TAG_STRING);
+            PutVarint(block_, it->second);
+            PutString(block_, text);
+        }
+        return it->second;
+    }
+
+    uint32_t SiteFor(const LogRecordHeader& header, bool text) {
+        const SiteKey key{ header.format, header.location.file_name(), header.channel, header.argumentKinds.data(),
+            header.location.line(), header.level, text };
+        if (auto it = sites_.find(key); it != sites_.end()) {
+            return it->second;
+        }
+
+        static constexpr LogArgumentKind TEXT_KINDS[] = { LogArgumentKind::String };
+        const std::span<const LogArgumentKind> kinds = text ? std::span<const LogArgumentKind>(TEXT_KINDS) : header.argumentKinds;
+        const uint32_t channel = StringFor(header.channel ? header.channel->GetName() : std::string_view());
+        const uint32_t file = StringFor(header.location.file_name());
+        std::string_view formatText(header.format, header.formatSize);
+        if (text) {
+            formatText = "{}";
+        }
+        else if (header.structured) {
+            BuildFieldFormat(formatText, header.argumentKinds, scratch_);
+            formatText = scratch_;
+        }
+        const uint32_t format = StringFor(formatText);
+
+        const uint32_t site = static_cast<uint32_t>(sites_.size());
+        sites_.emplace(key, site);
+        PutVarint(block_, TAG_SITE);
+        PutVarint(block_, site);
+        PutVarint(block_, channel);
+        block_.push_back(static_cast<std::byte>(header.level));
+        PutVarint(block_, file);
+        PutVarint(block_, header.location.line());
+        PutVarint(block_, format);
+        PutVarint(block_, kinds.size());
+        for (const LogArgumentKind kind : kinds) {
+            block_.push_back(static_cast<std::byte>(kind));
+        }
+        return site;
+    }
+
+    uint32_t ThreadFor(size_t nativeThreadId) {
+        auto [it, inserted] = threads_.try_emplace(nativeThreadId, static_cast<uint32_t>(threads_.size()));
+        if (inserted) {
+            PutVarint(block_, TAG_THREAD);
+            PutVarint(block_, it->second);
+            PutVarint(block_, nativeThreadId);
+        }
+        return it->second;
+    }
+
+    void WriteBlock() {
+        if (block_.empty()) return;
+
+        const std::byte* payload = block_.data();
+        BlockHeader header{ static_cast<uint32_t>(block_.size()), static_cast<uint32_t>(block_.size()) };
+        if (options_.compress) {
+            if (const size_t compressed = Detail::CompressLogBlock(block_, compressed_)) {
+                payload = compressed_.data();
+                header.storedSize = static_cast<uint32_t>(compressed);
+            }
+        }
+
+        file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file_.write(reinterpret_cast<const char*>(payload), header.storedSize);
+        bytesWritten_.fetch_add(sizeof(header) + header.storedSize, std::memory_order_relaxed);
+        block_.clear();
+    }
+
+    BinaryLogOptions options_;
+    std::mutex mutex_;
+    std::ofstream file_;
+    std::atomic<uint64_t> bytesWritten_{ 0 };
+    int64_t lastTimestamp_ = 0;
+
+    std::unordered_map<std::string, uint32_t> strings_;
+    std::unordered_map<SiteKey, uint32_t, SiteKeyHash> sites_;
+    std::unordered_map<size_t, uint32_t> threads_;
+
+    std::vector<std::byte> block_;
+    std::vector<std::byte> compressed_;
+    std::string scratch_;
+};
+
+BinaryLogSink::BinaryLogSink(const std::filesystem::path& path, const BinaryLogOptions& options)
+    : impl_(std::make_unique<Impl>(path, options)) {
+}
+
+BinaryLogSink::~BinaryLogSink() = default;
+
+bool BinaryLogSink::IsOpen() const noexcept {
+    return impl_->IsOpen();
+}
+
+void BinaryLogSink::WriteRecord(const LogRecordHeader& header, const std::byte* arguments) {
+    impl_->Write(header, arguments);
+}
+
+void BinaryLogSink::Flush() {
+    impl_->Flush();
+}
+
+uint64_t BinaryLogSink::GetBytesWritten() const noexcept {
+    return impl_->GetBytesWritten();
+}
+
+// =============================================================================
+// BinaryLogReader
+// =============================================================================
+
+class BinaryLogReader::Impl {
+public:
+    Impl(const std::filesystem::path& path, BinaryLogFilter filter)
+        : filter_(std::move(filter))
+        , file_(path, std::ios::binary) {
+        if (!file_) {
+            error_ = "Cannot open file";
+            return;
+        }
+
+        FileHeader header{};
+        file_.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (file_.gcount() != sizeof(header) || header.magic != FILE_MAGIC) {
+            error_ = "Not a binary log file";
+            return;
+        }
+        if (header.version != FILE_VERSION) {
+            error_ = "Unsupported binary log version";
+            return;
+        }
+
+        startTime_ = header.startTime;
+        lastTimestamp_ = header.startTime;
+        open_ = true;
+    }
+
+    bool IsOpen() const noexcept { return open_; }
+    std::string_view GetError() const noexcept { return error_; }
+    std::chrono::system_clock::time_point GetStartTime() const noexcept { return FromNanoseconds(startTime_); }
+
+    bool Next(BinaryLogRecord& record) {
+        while (open_) {
+            if (cursor_ == block_.size()) {
+                if (!ReadBlock()) return false;
+                continue;
+            }
+
+            ByteReader input{ block_.data() + cursor_, block_.data() + block_.size() };
+            const uint64_t tag = input.Varint();
+            const bool isRecord = input.ok && tag >= TAG_FIRST_RECORD;
+            if (input.ok && !isRecord) {
+                ReadDefinition(input, tag);
+            }
+
+            const Site* site = nullptr;
+            int64_t timestamp = 0;
+            uint64_t thread = 0;
+            if (isRecord) {
+                const uint64_t siteIndex = tag - TAG_FIRST_RECORD;
+                timestamp = lastTimestamp_ + UnZigZag(input.Varint());
+                thread = input.Varint();
+                if (siteIndex >= sites_.size() || thread >= threads_.size()) {
+                    input.ok = false;
+                }
+                else {
+                    site = &sites_[siteIndex];
+                    values_.clear();
+                    for (const LogArgumentKind kind : site->kinds) {
+                        values_.push_back(ReadArgument(input, kind));
+                    }
+                }
+            }
+
+            if (!input.ok) {
+                return Fail("Corrupt block");
+            }
+            cursor_ = static_cast<size_t>(input.position - block_.data());
+            if (!isRecord) continue;
+
+            lastTimestamp_ = timestamp;
+            const auto time = FromNanoseconds(timestamp);
+            if (!site->channelMatches || site->level < filter_.minimumLevel || time < filter_.from || time > filter_.to) {
+                continue;
+            }
+
+            message_.clear();
+            RenderFormat(strings_[site->format], values_, message_);
+
+            record.timestamp = time;
+            record.level = site->level;
+            record.channel = strings_[site->channel];
+            record.file = strings_[site->file];
+            record.line = site->line;
+            record.threadIndex = static_cast<uint32_t>(thread);
+            record.nativeThreadId = threads_[thread];
+            record.message = message_;
+            return true;
+        }
+        return false;
+    }
+
+private:
+    struct Site {
+        uint32_t channel = 0;
+        uint32_t file = 0;
+        uint32_t format = 0;
+        uint32_t line = 0;
+        LogLevel level = LogLevel::Info;
+        bool channelMatches = true;
+        std::vector<LogArgumentKind> kinds;
+    };
+
+    bool Fail(std::string_view error) {
+        error_ = error;
+        open_ = false;
+        return false;
+    }
+
+    bool ReadBlock() {
+        BlockHeader header{};
+        file_.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (file_.gcount() == 0) {
+            open_ = false;
+            return false;
+        }
+        if (file_.gcount() != sizeof(header) || header.rawSize > MAX_BLOCK_SIZE || header.storedSize > header.rawSize) {
+            return Fail("Truncated or corrupt block header");
+        }
+
+        std::vector<std::byte>& target = header.storedSize == header.rawSize ? block_ : stored_;
+        target.resize(header.storedSize);
+        file_.read(reinterpret_cast<char*>(target.data()), header.storedSize);
+        if (static_cast<uint32_t>(file_.gcount()) != header.storedSize) {
+            return Fail("Truncated block");
+        }
+        if (&target == &stored_ && !Detail::DecompressLogBlock(stored_, header.rawSize, block_)) {
+            return Fail("Corrupt compressed block");
+        }
+
+        cursor_ = 0;
+        return true;
+    }
+
+    void ReadDefinition(ByteReader& input, uint64_t tag) {
+        if (tag == TAG_STRING) {
+            const uint64_t id = input.Varint();
+            const std::string_view text = input.String();
+            if (id != strings_.size()) input.ok = false;
+            if (input.ok) strings_.emplace_back(text);
+        }
+        else if (tag == TAG_THREAD) {
+            const uint64_t index = input.Varint();
+            const uint64_t nativeId = input.Varint();
+            if (index != threads_.size()) input.ok = false;
+            if (input.ok) threads_.push_back(nativeId);
+        }
+        else if (tag == TAG_SITE) {
+            Site site;
+            const uint64_t id = input.Varint();
+            site.channel = static_cast<uint32_t>(input.Varint());
+            site.level = static_cast<LogLevel>(input.Raw<uint8_t>());
+            site.file = static_cast<uint32_t>(input.Varint());
+            site.line = static_cast<uint32_t>(input.Varint());
+            site.format = static_cast<uint32_t>(input.Varint());
+            const uint64_t count = input.Varint();
+            const std::byte* kinds = input.ok ? input.Bytes(count) : nullptr;
+            if (!input.ok || id != sites_.size() || !IsValidLevel(site.level) ||
+                site.channel >= strings_.size() || site.file >= strings_.size() || site.format >= strings_.size()) {
+                input.ok = false;
+                return;
+            }
+            for (uint64_t i = 0; i < count; ++i) {
+                const auto kind = static_cast<LogArgumentKind>(kinds[i]);
+                if (kind >= LogArgumentKind::Opaque) {
+                    input.ok = false;
+                    return;
+                }
+                site.kinds.push_back(kind);
+            }
+            site.channelMatches = filter_.channels.empty() ||
+                std::ranges::find(filter_.channels, strings_[site.channel]) != filter_.channels.end();
+            sites_.push_back(std::move(site));
+        }
+        else {
+            input.ok = false;
+        }
+    }
+
+    BinaryLogFilter filter_;
+    std::ifstream file_;
+    std::string error_;
+    bool open_ = false;
+    int64_t startTime_ = 0;
+    int64_t lastTimestamp_ = 0;
+
+    std::vector<std::string> strings_;
+    std::vector<Site> sites_;
+    std::vector<uint64_t> threads_;
+
+    std::vector<std::byte> stored_;
+    std::vector<std::byte> block_;
+    size_t cursor_ = 0;
+
+    std::vector<LogValue> values_;
+    std::string message_;
+};
+
+BinaryLogReader::BinaryLogReader(const std::filesystem::path& path, BinaryLogFilter filter)
+    : impl_(std::make_unique<Impl>(path, std::move(filter))) {
+}
+
+BinaryLogReader::~BinaryLogReader() = default;
+
+bool BinaryLogReader::IsOpen() const noexcept {
+    return impl_->IsOpen();
+}
+
+bool BinaryLogReader::Next(BinaryLogRecord& record) {
+    return impl_->Next(record);
+}
+
+std::chrono::system_clock::time_point BinaryLogReader::GetStartTime() const noexcept {
+    return impl_->GetStartTime();
+}
+
+std::string_view BinaryLogReader::GetError() const noexcept {
+    return impl_->GetError();
+}
+
+// =============================================================================
+// Text Rendering
+// =============================================================================
+
+std::string Akhanda::Logging::FormatBinaryLogRecord(const BinaryLogRecord& record) {
+    using namespace std::chrono;
+    const auto day = floor<days>(record.timestamp);
+    const year_month_day date{ day };
+    const hh_mm_ss time{ floor<microseconds>(record.timestamp - day) };
+
+    const size_t slash = record.file.find_last_of("/\\");
+    const std::string_view file = slash == std::string_view::npos ? record.file : record.file.substr(slash + 1);
+
+    return std::format("[{:04}-{:02}-{:02} {:02}:{:02}:{:02}.{:06}] [{}] [{}] [{}:{}] {}",
+        static_cast<int>(date.year()), static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day()),
+        time.hours().count(), time.minutes().count(), time.seconds().count(), time.subseconds().count(),
+        record.channel, ToString(record.level), file, record.line, record.message);
+}
@@ -0,0 +1,192 @@
+// Core.Logging.Json.cpp - JSON Lines record sink
+module;
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string>
+
+module Akhanda.Core.Logging;
+
+using namespace Akhanda::Logging;
+
+namespace {
+    template<typename T>
+    T LoadRaw(const std::byte*& input) noexcept {
+        T value;
+        std::memcpy(&value, input, sizeof(T));
+        input += sizeof(T);
+        return value;
+    }
+
+    std::string_view LoadString(const std::byte*& input) noexcept {
+        const uint32_t size = LoadRaw<uint32_t>(input);
+        const std::string_view text(reinterpret_cast<const char*>(input), size);
+        input += size;
+        return text;
+    }
+
+    void AppendJsonString(std::string& output, std::string_view text) {
+        static constexpr char HEX[] = "0123456789abcdef";
+        output += '"';
+        for (const char c : text) {
+            switch (c) {
+            case '"':  output += "\\\""; break;
+            case '\\': output += "\\\\"; break;
+            case '\n': output += "\\n"; break;
+            case '\r': output += "\\r"; break;
+            case '\t': output += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    output += "\\u00";
+                    output += HEX[(c >> 4) & 0xF];
+                    output += HEX[c & 0xF];
+                }
+                else {
+                    output += c;
+                }
+            }
+        }
+        output += '"';
+    }
+
+    template<typename T>
+    void AppendJsonNumber(std::string& output, T value) {
+        if constexpr (std::is_floating_point_v<T>) {
+            // JSON has no infinities or NaN
+            if (!std::isfinite(value)) {
+                output += "null";
+                return;
+            }
+        }
+        std::format_to(std::back_inserter(output), "{}", value);
+    }
+
+    // Appends one encoded argument as a JSON value and moves past it
+    void AppendJsonValue(std::string& output, LogArgumentKind kind, const std::byte*& input) {
+        switch (kind) {
+        case LogArgumentKind::Bool:   output += LoadRaw<bool>(input) ? "true" : "false"; break;
+        case LogArgumentKind::Char: {
+            const char c = LoadRaw<char>(input);
+            AppendJsonString(output, std::string_view(&c, 1));
+            break;
+        }
+        case LogArgumentKind::Int8:   AppendJsonNumber(output, int32_t(LoadRaw<int8_t>(input))); break;
+        case LogArgumentKind::Int16:  AppendJsonNumber(output, LoadRaw<int16_t>(input)); break;
+        case LogArgumentKind::Int32:  AppendJsonNumber(output, LoadRaw<int32_t>(input)); break;
+        case LogArgumentKind::Int64:  AppendJsonNumber(output, LoadRaw<int64_t>(input)); break;
+        case LogArgumentKind::UInt8:  AppendJsonNumber(output, uint32_t(LoadRaw<uint8_t>(input))); break;
+        case LogArgumentKind::UInt16: AppendJsonNumber(output, LoadRaw<uint16_t>(input)); break;
+        case LogArgumentKind::UInt32: AppendJsonNumber(output, LoadRaw<uint32_t>(input)); break;
+        case LogArgumentKind::UInt64: AppendJsonNumber(output, LoadRaw<uint64_t>(input)); break;
+        case LogArgumentKind::Float:  AppendJsonNumber(output, LoadRaw<float>(input)); break;
+        case LogArgumentKind::Double: AppendJsonNumber(output, LoadRaw<double>(input)); break;
+        case LogArgumentKind::String: AppendJsonString(output, LoadString(input)); break;
+        case LogArgumentKind::Pointer:
+            std::format_to(std::back_inserter(output), "\"{}\"", LoadRaw<const void*>(input));
+            break;
+        case LogArgumentKind::Opaque:
+            // Never in structured records; Field() rejects such types
+            output += "null";
+            break;
+        }
+    }
+}
+
+// =============================================================================
+// JsonLogSink
+// =============================================================================
+
+class JsonLogSink::Impl {
+public:
+    explicit Impl(const std::filesystem::path& path)
+        : file_(path, std::ios::binary | std::ios::trunc) {
+    }
+
+    ~Impl() {
+        Flush();
+    }
+
+    bool IsOpen() const noexcept {
+        return static_cast<bool>(file_);
+    }
+
+    void Write(const LogRecordHeader& header, const std::byte* arguments) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!file_) return;
+
+        line_.clear();
+        line_ += "{\"time\":";
+        AppendJsonNumber(line_, std::chrono::duration_cast<std::chrono::nanoseconds>(header.timestamp.time_since_epoch()).count());
+        line_ += ",\"level\":";
+        AppendJsonString(line_, ToString(header.level));
+        line_ += ",\"channel\":";
+        AppendJsonString(line_, header.channel ? header.channel->GetName() : std::string_view());
+        line_ += ",\"file\":";
+        AppendJsonString(line_, header.location.file_name());
+        line_ += ",\"line\":";
+        AppendJsonNumber(line_, header.location.line());
+        line_ += ",\"thread\":";
+        AppendJsonNumber(line_, header.nativeThreadId);
+
+        if (header.structured) {
+            line_ += ",\"event\":";
+            AppendJsonString(line_, std::string_view(header.format, header.formatSize));
+            for (size_t i = 0; i + 1 < header.argumentKinds.size(); i += 2) {
+                line_ += ',';
+                AppendJsonString(line_, LoadString(arguments));
+                line_ += ':';
+                AppendJsonValue(line_, header.argumentKinds[i + 1], arguments);
+            }
+        }
+        else {
+            message_.clear();
+            try {
+                header.formatter(std::string_view(header.format, header.formatSize), arguments, message_);
+            }
+            catch (const std::exception&) {
+                message_ = "LOG FORMAT ERROR: Invalid format string";
+            }
+            line_ += ",\"message\":";
+            AppendJsonString(line_, message_);
+        }
+        line_ += "}\n";
+
+        file_.write(line_.data(), static_cast<std::streamsize>(line_.size()));
+    }
+
+    void Flush() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (file_) {
+            file_.flush();
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::ofstream file_;
+    std::string line_;
+    std::string message_;
+};
+
+JsonLogSink::JsonLogSink(const std::filesystem::path& path)
+    : impl_(std::make_unique<Impl>(path)) {
+}
+
+JsonLogSink::~JsonLogSink() = default;
+
+bool JsonLogSink::IsOpen() const noexcept {
+    return impl_->IsOpen();
+}
+
+void JsonLogSink::WriteRecord(const LogRecordHeader& header, const std::byte* arguments) {
+    impl_->Write(header, arguments);
+}
+
+void JsonLogSink::Flush() {
+    impl_->Flush();
+}
@@ -0,0 +1,510 @@
+// Core.Logging.MappedRing.cpp - Crash-safe log ring in a memory-mapped file
+module;
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#undef min
+#undef max
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+module Akhanda.Core.Logging;
+
+using namespace Akhanda::Logging;
+
+// =============================================================================
+// File Layout
+// =============================================================================
+//
+//   File:   RingHeader padded to HEADER_SIZE, then `capacity` bytes of ring.
+//   Ring:   frames at 8-byte aligned positions. Positions are logical byte
+//           offsets that only grow; a frame lives at position % capacity.
+//   Frame:  FrameHeader, payload, padding to 8 bytes. A frame never wraps:
+//           when it does not fit before the end of the ring, a skip frame
+//           fills the rest (or, with less room than a FrameHeader, the
+//           position simply moves to the start of the next lap).
+//
+//   The writer stores the payload, then the frame header, publishing its
+//   position last. A frame is valid only when its stored position matches
+//   where it was found and its checksum holds, so frames of earlier laps
+//   and frames torn by the process dying are both rejected.
+//
+//   The header carries a checkpoint: the position and sequence of the next
+//   frame as of the last update. It is refreshed every few entries, on
+//   Flush, on close and from the crash handlers. Recovery trusts it as a
+//   starting point and walks forward to the real tail, then walks the
+//   ring from one capacity before the tail to collect the surviving entries.
+
+namespace {
+    constexpr std::array<char, 8> RING_MAGIC = { 'A', 'K', 'H', 'R', 'I', 'N', 'G', '\0' };
+    constexpr uint32_t RING_VERSION = 1;
+    constexpr uint64_t HEADER_SIZE = 4096;
+    constexpr uint64_t SKIP_SEQUENCE = ~uint64_t(0);
+
+    struct RingHeader {
+        std::array<char, 8> magic;
+        uint32_t version;
+        uint32_t state;                 // MappedLogState
+        uint64_t capacity;
+        int64_t startTime;              // Nanoseconds since the system clock epoch
+        uint64_t checkpointPosition;
+        uint64_t checkpointSequence;
+        int32_t crashCode;              // Signal number or exception code
+        uint32_t reserved;
+    };
+    static_assert(sizeof(RingHeader) <= HEADER_SIZE);
+
+    struct FrameHeader {
+        uint64_t position;
+        uint64_t sequence;
+        uint32_t size;
+        uint32_t checksum;
+    };
+    static_assert(sizeof(FrameHeader) % 8 == 0);
+
+    constexpr uint64_t AlignFrame(uint64_t size) noexcept {
+        return (size + 7) & ~uint64_t(7);
+    }
+
+    // FNV-1a over the frame fields and payload
+    uint32_t FrameChecksum(uint64_t position, uint64_t sequence, const char* payload, uint32_t size) noexcept {
+        uint32_t hash = 2166136261u;
+        const auto mix = [&hash](const void* data, size_t length) {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < length; ++i) {
+                hash = (hash ^ bytes[i]) * 16777619u;
+            }
+        };
+        mix(&position, sizeof(position));
+        mix(&sequence, sizeof(sequence));
+        mix(&size, sizeof(size));
+        mix(payload, size);
+        return hash;
+    }
+
+    // Where a frame starting at or after `position` really begins
+    uint64_t NextFrameStart(uint64_t position, uint64_t capacity) noexcept {
+        const uint64_t remaining = capacity - position % capacity;
+        return remaining < sizeof(FrameHeader) ? position + remaining : position;
+    }
+
+    template<typename T>
+    void StoreRelease(T& field, T value) noexcept {
+        std::atomic_ref<T>(field).store(value, std::memory_order_release);
+    }
+}
+
+// =============================================================================
+// Crash Handlers
+// =============================================================================
+//
+// Installed once, with the first sink that asks for them. The handlers walk a
+// fixed table of open sinks, finalize each header and hand the fault on to
+// whatever handler was installed before. Nothing here allocates or locks.
+
+namespace {
+    class CrashTarget {
+    public:
+        virtual void FinalizeAfterCrash(int code) noexcept = 0;
+
+    protected:
+        ~CrashTarget() = default;
+    };
+
+    constexpr size_t MAX_CRASH_TARGETS = 8;
+    std::array<std::atomic<CrashTarget*>, MAX_CRASH_TARGETS> g_crashTargets{};
+    std::once_flag g_crashHandlersInstalled;
+
+    void FinalizeCrashTargets(int code) noexcept;
+
+#ifdef _WIN32
+    LPTOP_LEVEL_EXCEPTION_FILTER g_previousExceptionFilter = nullptr;
+    void(__cdecl* g_previousAbortHandler)(int) = nullptr;
+
+    LONG WINAPI OnUnhandledException(EXCEPTION_POINTERS* exception) {
+        FinalizeCrashTargets(static_cast<int>(exception->ExceptionRecord->ExceptionCode));
+        return g_previousExceptionFilter ? g_previousExceptionFilter(exception) : EXCEPTION_CONTINUE_SEARCH;
+    }
+
+    void __cdecl OnAbort(int signal) {
+        FinalizeCrashTargets(signal);
+        if (g_previousAbortHandler && g_previousAbortHandler != SIG_DFL && g_previousAbortHandler != SIG_IGN) {
+            g_previousAbortHandler(signal);
+        }
+    }
+
+    void InstallCrashHandlers() {
+        g_previousExceptionFilter = SetUnhandledExceptionFilter(OnUnhandledException);
+        g_previousAbortHandler = std::signal(SIGABRT, OnAbort);
+    }
+#else
+    constexpr std::array<int, 5> FATAL_SIGNALS = { SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT };
+    std::array<struct sigaction, FATAL_SIGNALS.size()> g_previousActions{};
+
+    void OnFatalSignal(int signal) {
+        FinalizeCrashTargets(signal);
+
+        // Put the previous disposition back and deliver the signal again
+        for (size_t i = 0; i < FATAL_SIGNALS.size(); ++i) {
+            if (FATAL_SIGNALS[i] == signal) {
+                sigaction(signal, &g_previousActions[i], nullptr);
+            }
+        }
+        raise(signal);
+    }
+
+    void InstallCrashHandlers() {
+        struct sigaction action {};
+        action.sa_handler = OnFatalSignal;
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = SA_ONSTACK;
+        for (size_t i = 0; i < FATAL_SIGNALS.size(); ++i) {
+            sigaction(FATAL_SIGNALS[i], &action, &g_previousActions[i]);
+        }
+    }
+#endif
+
+    void FinalizeCrashTargets(int code) noexcept {
+        for (auto& target : g_crashTargets) {
+            if (CrashTarget* crashTarget = target.load(std::memory_order_acquire)) {
+                crashTarget->FinalizeAfterCrash(code);
+            }
+        }
+    }
+
+    // Sinks beyond the table still recover, only without a finalized header
+    void RegisterCrashTarget(CrashTarget* crashTarget) {
+        std::call_once(g_crashHandlersInstalled, InstallCrashHandlers);
+        for (auto& target : g_crashTargets) {
+            CrashTarget* expected = nullptr;
+            if (target.compare_exchange_strong(expected, crashTarget, std::memory_order_acq_rel)) {
+                return;
+            }
+        }
+    }
+
+    void UnregisterCrashTarget(CrashTarget* crashTarget) noexcept {
+        for (auto& target : g_crashTargets) {
+            CrashTarget* expected = crashTarget;
+            target.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+        }
+    }
+}
+
+// =============================================================================
+// MappedLogSink::Impl
+// =============================================================================
+
+class MappedLogSink::Impl : public CrashTarget {
+public:
+    Impl(const std::filesystem::path& path, const MappedLogOptions& options)
+        : options_(options) {
+        capacity_ = AlignFrame(std::max<uint64_t>(options.capacity, 4 * sizeof(FrameHeader) + 1024));
+        maxPayload_ = static_cast<uint32_t>(std::min<uint64_t>(capacity_ / 8, UINT32_MAX));
+        if (!Map(path, HEADER_SIZE + capacity_)) {
+            Unmap();
+            return;
+        }
+
+        header_ = reinterpret_cast<RingHeader*>(view_);
+        ring_ = view_ + HEADER_SIZE;
+        std::memset(view_, 0, HEADER_SIZE);
+        header_->magic = RING_MAGIC;
+        header_->version = RING_VERSION;
+        header_->capacity = capacity_;
+        header_->startTime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        StoreRelease(header_->state, static_cast<uint32_t>(MappedLogState::Open));
+
+        if (options.installCrashHandlers) {
+            RegisterCrashTarget(this);
+        }
+    }
+
+    ~Impl() {
+        if (!view_) return;
+        UnregisterCrashTarget(this);
+        Checkpoint();
+        StoreRelease(header_->state, static_cast<uint32_t>(MappedLogState::Closed));
+        Unmap();
+    }
+
+    bool IsOpen() const noexcept { return view_ != nullptr; }
+
+    void Write(std::string_view text) {
+        if (!view_) return;
+
+        // Sinks store lines; the pattern's line ending is added back by readers
+        while (!text.empty() && (text.back() == '\n' || text.back() == '\r')) {
+            text.remove_suffix(1);
+        }
+        const uint32_t size = static_cast<uint32_t>(std::min<size_t>(text.size(), maxPayload_));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        uint64_t position = NextFrameStart(position_.load(std::memory_order_relaxed), capacity_);
+        const uint64_t frameSize = AlignFrame(sizeof(FrameHeader) + size);
+        const uint64_t remaining = capacity_ - position % capacity_;
+        if (frameSize > remaining) {
+            WriteFrame(position, SKIP_SEQUENCE, nullptr, static_cast<uint32_t>(remaining - sizeof(FrameHeader)));
+            position += remaining;
+        }
+
+        const uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+        WriteFrame(position, sequence, text.data(), size);
+        position_.store(position + frameSize, std::memory_order_release);
+        sequence_.store(sequence + 1, std::memory_order_release);
+
+        // Recovery needs the checkpointed frame to survive until the next checkpoint
+        if (++entriesSinceCheckpoint_ >= options_.checkpointInterval || position + frameSize - checkpointPosition_ >= capacity_ / 4) {
+            Checkpoint();
+        }
+    }
+
+    void Flush() {
+        if (!view_) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            Checkpoint();
+        }
+        // Start writeback without waiting; the kernel already owns the pages
+#ifdef _WIN32
+        FlushViewOfFile(view_, 0);
+#else
+        msync(view_, static_cast<size_t>(HEADER_SIZE + capacity_), MS_ASYNC);
+#endif
+    }
+
+    uint64_t GetSequence() const noexcept { return sequence_.load(std::memory_order_acquire); }
+
+    // Called from fatal-signal handlers: plain stores into the mapping only
+    void FinalizeAfterCrash(int code) noexcept override {
+        header_->crashCode = code;
+        StoreRelease(header_->checkpointSequence, sequence_.load(std::memory_order_acquire));
+        StoreRelease(header_->checkpointPosition, position_.load(std::memory_order_acquire));
+        StoreRelease(header_->state, static_cast<uint32_t>(MappedLogState::Crashed));
+    }
+
+    LogLevel level = LogLevel::Trace;
+
+private:
+    void WriteFrame(uint64_t position, uint64_t sequence, const char* payload, uint32_t size) noexcept {
+        std::byte* frame = ring_ + position % capacity_;
+        FrameHeader* frameHeader = reinterpret_cast<FrameHeader*>(frame);
+        if (payload) {
+            std::memcpy(frame + sizeof(FrameHeader), payload, size);
+        }
+        frameHeader->sequence = sequence;
+        frameHeader->size = size;
+        frameHeader->checksum = FrameChecksum(position, sequence, payload, payload ? size : 0);
+        StoreRelease(frameHeader->position, position);
+    }
+
+    void Checkpoint() noexcept {
+        checkpointPosition_ = position_.load(std::memory_order_relaxed);
+        StoreRelease(header_->checkpointSequence, sequence_.load(std::memory_order_relaxed));
+        StoreRelease(header_->checkpointPosition, checkpointPosition_);
+        entriesSinceCheckpoint_ = 0;
+    }
+
+    bool Map(const std::filesystem::path& path, uint64_t size) {
+#ifdef _WIN32
+        file_ = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+            CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            file_ = nullptr;
+            return false;
+        }
+        mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READWRITE,
+            static_cast<DWORD>(size >> 32), static_cast<DWORD>(size & 0xFFFFFFFFu), nullptr);
+        if (!mapping_) return false;
+        view_ = static_cast<std::byte*>(MapViewOfFile(mapping_, FILE_MAP_ALL_ACCESS, 0, 0, static_cast<SIZE_T>(size)));
+        return view_ != nullptr;
+#else
+        file_ = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (file_ < 0) return false;
+        if (ftruncate(file_, static_cast<off_t>(size)) != 0) return false;
+        void* view = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_SHARED, file_, 0);
+        if (view == MAP_FAILED) return false;
+        view_ = static_cast<std::byte*>(view);
+        return true;
+#endif
+    }
+
+    void Unmap() noexcept {
+#ifdef _WIN32
+        if (view_) UnmapViewOfFile(view_);
+        if (mapping_) CloseHandle(mapping_);
+        if (file_) CloseHandle(file_);
+        mapping_ = nullptr;
+        file_ = nullptr;
+#else
+        if (view_) munmap(view_, static_cast<size_t>(HEADER_SIZE + capacity_));
+        if (file_ >= 0) close(file_);
+        file_ = -1;
+#endif
+        view_ = nullptr;
+    }
+
+    MappedLogOptions options_;
+    uint64_t capacity_ = 0;
+    uint32_t maxPayload_ = 0;
+
+#ifdef _WIN32
+    HANDLE file_ = nullptr;
+    HANDLE mapping_ = nullptr;
+#else
+    int file_ = -1;
+#endif
+    std::byte* view_ = nullptr;
+    RingHeader* header_ = nullptr;
+    std::byte* ring_ = nullptr;
+
+    std::mutex mutex_;
+    std::atomic<uint64_t> position_{ 0 };
+    std::atomic<uint64_t> sequence_{ 0 };
+    uint64_t checkpointPosition_ = 0;
+    uint32_t entriesSinceCheckpoint_ = 0;
+};
+
+// =============================================================================
+// MappedLogSink
+// =============================================================================
+
+MappedLogSink::MappedLogSink(const std::filesystem::path& path, const MappedLogOptions& options)
+    : impl_(std::make_unique<Impl>(path, options)) {
+}
+
+MappedLogSink::~MappedLogSink() = default;
+
+bool MappedLogSink::IsOpen() const noexcept {
+    return impl_->IsOpen();
+}
+
+void MappedLogSink::Write(const LogEntry& entry) {
+    if (entry.level < impl_->level) return;
+    impl_->Write(entry.message);
+}
+
+void MappedLogSink::Flush() {
+    impl_->Flush();
+}
+
+void MappedLogSink::SetLevel(LogLevel level) {
+    impl_->level = level;
+}
+
+LogLevel MappedLogSink::GetLevel() const {
+    return impl_->level;
+}
+
+std::string_view MappedLogSink::GetName() const {
+    return "MappedRing";
+}
+
+uint64_t MappedLogSink::GetSequence() const noexcept {
+    return impl_->GetSequence();
+}
+
+// =============================================================================
+// Recovery
+// =============================================================================
+
+MappedLogRecovery Akhanda::Logging::RecoverMappedLog(const std::filesystem::path& path) {
+    MappedLogRecovery recovery;
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        recovery.error = "cannot open file";
+        return recovery;
+    }
+
+    RingHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != RING_MAGIC) {
+        recovery.error = "not a mapped log ring";
+        return recovery;
+    }
+    if (header.version != RING_VERSION) {
+        recovery.error = "unsupported version";
+        return recovery;
+    }
+
+    // The header's capacity is untrusted until it fits the file behind it
+    const uint64_t capacity = header.capacity;
+    std::error_code sizeError;
+    const uint64_t fileSize = std::filesystem::file_size(path, sizeError);
+    if (sizeError || capacity == 0 || capacity % 8 != 0 || fileSize < HEADER_SIZE || capacity > fileSize - HEADER_SIZE) {
+        recovery.error = "truncated ring";
+        return recovery;
+    }
+    std::vector<char> ring(static_cast<size_t>(capacity));
+    if (!file.seekg(static_cast<std::streamoff>(HEADER_SIZE)) || !file.read(ring.data(), static_cast<std::streamsize>(capacity))) {
+        recovery.error = "truncated ring";
+        return recovery;
+    }
+
+    recovery.state = static_cast<MappedLogState>(header.state);
+    recovery.crashCode = header.crashCode;
+    recovery.startTime = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(header.startTime)));
+
+    // The frame at `position`, if it was written there and is intact
+    const auto frameAt = [&](uint64_t position, FrameHeader& frame) {
+        const uint64_t offset = position % capacity;
+        if (capacity - offset < sizeof(FrameHeader)) return false;
+        std::memcpy(&frame, ring.data() + offset, sizeof(frame));
+        if (frame.position != position || sizeof(FrameHeader) + uint64_t(frame.size) > capacity - offset) return false;
+        return frame.checksum == FrameChecksum(position, frame.sequence, ring.data() + offset + sizeof(FrameHeader), frame.sequence == SKIP_SEQUENCE ? 0 : frame.size);
+    };
+
+    // Walk from the checkpoint to the last complete frame
+    uint64_t tail = header.checkpointPosition;
+    uint64_t nextSequence = header.checkpointSequence;
+    for (FrameHeader frame; ; ) {
+        tail = NextFrameStart(tail, capacity);
+        if (!frameAt(tail, frame)) break;
+        if (frame.sequence != SKIP_SEQUENCE) {
+            if (frame.sequence != nextSequence) break;
+            ++nextSequence;
+        }
+        tail += AlignFrame(sizeof(FrameHeader) + frame.size);
+    }
+
+    // Everything in the last capacity bytes before the tail is current; find
+    // the first frame that starts inside that window, then walk to the tail
+    uint64_t position = tail > capacity ? tail - capacity : 0;
+    FrameHeader frame{};
+    while (position < tail && !frameAt(position, frame)) {
+        position += 8;
+    }
+
+    bool first = true;
+    while (position < tail && frameAt(position, frame)) {
+        if (frame.sequence != SKIP_SEQUENCE) {
+            if (first) {
+                recovery.firstSequence = frame.sequence;
+                first = false;
+            }
+            recovery.entries.emplace_back(ring.data() + position % capacity + sizeof(FrameHeader), frame.size);
+        }
+        position = NextFrameStart(position + AlignFrame(sizeof(FrameHeader) + frame.size), capacity);
+    }
+
+    if (position != tail) {
+        recovery.error = "ring is inconsistent";
+    }
+    return recovery;
+}
@@ -19,6 +19,10 @@ module;
 #include <atomic>
 #include <functional>
 #include <cstdio>
+#include <algorithm>
+#include <bit>
+#include <thread>
+#include <vector>
 
 module Akhanda.Core.Logging;
 
@@ -38,6 +42,7 @@ namespace {
     // Convert our LogLevel to spdlog level
     constexpr spdlog::level::level_enum ToSpdlogLevel(LogLevel level) noexcept {
         switch (level) {
+        case LogLevel::Trace:   return spdlog::level::trace;
         case LogLevel::Debug:   return spdlog::level::debug;
         case LogLevel::Info:    return spdlog::level::info;
         case LogLevel::Warning: return spdlog::level::warn;
@@ -50,6 +55,7 @@ namespace {
     // Convert spdlog level to our LogLevel
     constexpr LogLevel FromSpdlogLevel(spdlog::level::level_enum level) noexcept {
         switch (level) {
+        case spdlog::level::trace:    return LogLevel::Trace;
         case spdlog::level::debug:    return LogLevel::Debug;
         case spdlog::level::info:     return LogLevel::Info;
         case spdlog::level::warn:     return LogLevel::Warning;
@@ -198,6 +204,673 @@ private:
     std::string messageBuffer_;
 };
 
+// =============================================================================
+// Record Sinks - Receive records before formatting
+// =============================================================================
+
+namespace {
+    class LogRecordSinkList {
+    public:
+        void Add(std::unique_ptr<ILogRecordSink> sink) {
+            if (!sink) return;
+            std::lock_guard<std::shared_mutex> lock(mutex_);
+            sinks_.push_back(std::move(sink));
+            active_.store(true, std::memory_order_release);
+        }
+
+        void Remove(ILogRecordSink* sink) {
+            std::lock_guard<std::shared_mutex> lock(mutex_);
+            std::erase_if(sinks_, [sink](const std::unique_ptr<ILogRecordSink>& owned) { return owned.get() == sink; });
+            active_.store(!sinks_.empty(), std::memory_order_release);
+        }
+
+        bool IsActive() const noexcept {
+            return active_.load(std::memory_order_acquire);
+        }
+
+        void Write(const LogRecordHeader& header, const std::byte* arguments) {
+            if (!IsActive()) return;
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            for (const auto& sink : sinks_) {
+                try {
+                    sink->WriteRecord(header, arguments);
+                }
+                catch (const std::exception&) {
+                    // A failing sink must not take the backend thread down
+                }
+            }
+        }
+
+        void Flush() {
+            if (!IsActive()) return;
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            for (const auto& sink : sinks_) {
+                sink->Flush();
+            }
+        }
+
+    private:
+        std::shared_mutex mutex_;
+        std::vector<std::unique_ptr<ILogRecordSink>> sinks_;
+        std::atomic<bool> active_{ false };
+    };
+
+    LogRecordSinkList g_recordSinks;
+
+    // Scratch space messages formatted on the calling thread are encoded into
+    // before they go to the record sinks
+    thread_local std::vector<std::byte> t_textRecord;
+
+    // Record sinks also get what bypasses the rings, as a single string argument
+    void WriteTextRecord(const LogChannel& channel, LogLevel level, std::string_view message, const std::source_location& location) {
+        LogRecordHeader header;
+        header.channel = &channel;
+        header.formatter = &FormatLogRecord<std::string_view>;
+        header.format = "{}";
+        header.formatSize = 2;
+        header.argumentBytes = static_cast<uint32_t>(EncodedLogArgumentsSize(message));
+        header.argumentKinds = LogArgumentKinds<std::string_view>;
+        header.location = location;
+        header.timestamp = spdlog::log_clock::now();
+        header.threadId = std::this_thread::get_id();
+        header.nativeThreadId = spdlog::details::os::thread_id();
+        header.level = level;
+
+        t_textRecord.resize(header.argumentBytes);
+        EncodeLogArguments(t_textRecord.data(), message);
+        g_recordSinks.Write(header, t_textRecord.data());
+    }
+}
+
+// =============================================================================
+// Log Record Rings - One single-producer/single-consumer byte ring per logging thread
+// =============================================================================
+
+namespace {
+    constexpr size_t MIN_RING_CAPACITY = 4 * 1024;
+    constexpr size_t RECORD_ALIGNMENT = alignof(LogRecordHeader);
+
+    // Prefix of every record in a ring. A zero size marks the unused end of
+    // the buffer that the producer skipped to keep the next record contiguous.
+    struct RingFrame {
+        uint32_t size;
+        uint32_t reserved;
+    };
+
+    constexpr size_t FrameSize(size_t payload) noexcept {
+        return (sizeof(RingFrame) + payload + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+    }
+
+    // Set on the backend thread; sinks that log from there never wait on a ring
+    thread_local bool t_isLogBackend = false;
+
+    // Scratch space dropped records are encoded into
+    thread_local std::vector<std::byte> t_recordStaging;
+
+    // Set by the first message a rate limit drops; the backend then logs the
+    // summaries once they are an interval old, so a site that went quiet
+    // still reports what it dropped. An interval of 0 leaves them to the
+    // site's next message or Flush.
+    std::atomic<bool> g_suppressionPending{ false };
+    std::atomic<int64_t> g_suppressionReportIntervalNs{
+        std::chrono::nanoseconds(DEFAULT_SUPPRESSION_REPORT_INTERVAL).count() };
+
+    int64_t SteadyNowNs() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+// Positions only ever grow; the producer publishes writtenPosition_ and the
+// consumer publishes readPosition_, each on its own cache line.
+class LogRecordRing {
+public:
+    explicit LogRecordRing(size_t capacity)
+        : capacity_(std::bit_ceil(std::max(capacity, MIN_RING_CAPACITY)))
+        , buffer_(std::make_unique<std::byte[]>(capacity_)) {
+    }
+
+    ~LogRecordRing() {
+        delete next_.load(std::memory_order_relaxed);
+    }
+
+    size_t Capacity() const noexcept { return capacity_; }
+    bool Fits(size_t payload) const noexcept { return FrameSize(payload) <= capacity_; }
+
+    // Producer: room for a payload, or nullptr while the ring is full
+    std::byte* Reserve(size_t payload) noexcept {
+        const size_t frame = FrameSize(payload);
+        const size_t offset = writePosition_ & (capacity_ - 1);
+        const size_t contiguous = capacity_ - offset;
+        const size_t required = frame + (contiguous < frame ? contiguous : 0);
+
+        if (writePosition_ + required - cachedReadPosition_ > capacity_) {
+            cachedReadPosition_ = readPosition_.load(std::memory_order_acquire);
+            if (writePosition_ + required - cachedReadPosition_ > capacity_) {
+                return nullptr;
+            }
+        }
+
+        if (contiguous < frame) {
+            WriteFrame(offset, 0);
+            writePosition_ += contiguous;
+        }
+        pendingFrame_ = frame;
+        return buffer_.get() + (writePosition_ & (capacity_ - 1)) + sizeof(RingFrame);
+    }
+
+    void Commit() noexcept {
+        WriteFrame(writePosition_ & (capacity_ - 1), static_cast<uint32_t>(pendingFrame_));
+        writePosition_ += pendingFrame_;
+        writtenPosition_.store(writePosition_, std::memory_order_release);
+    }
+
+    // Producer: the ring that replaces this one once it is drained
+    void Link(LogRecordRing* next) noexcept {
+        next_.store(next, std::memory_order_release);
+    }
+
+    // Consumer: the oldest committed payload, or nullptr when the ring is empty
+    const std::byte* Front() noexcept {
+        for (;;) {
+            if (consumePosition_ == cachedWrittenPosition_) {
+                cachedWrittenPosition_ = writtenPosition_.load(std::memory_order_acquire);
+                if (consumePosition_ == cachedWrittenPosition_) {
+                    return nullptr;
+                }
+            }
+
+            const size_t offset = consumePosition_ & (capacity_ - 1);
+            RingFrame frame;
+            std::memcpy(&frame, buffer_.get() + offset, sizeof(frame));
+            if (frame.size != 0) {
+                frontSize_ = frame.size;
+                return buffer_.get() + offset + sizeof(RingFrame);
+            }
+            consumePosition_ += capacity_ - offset;
+        }
+    }
+
+    void Pop() noexcept {
+        consumePosition_ += frontSize_;
+        readPosition_.store(consumePosition_, std::memory_order_release);
+    }
+
+    LogRecordRing* Next() const noexcept {
+        return next_.load(std::memory_order_acquire);
+    }
+
+    LogRecordRing* DetachNext() noexcept {
+        return next_.exchange(nullptr, std::memory_order_acquire);
+    }
+
+private:
+    void WriteFrame(size_t offset, uint32_t size) noexcept {
+        const RingFrame frame{ size, 0 };
+        std::memcpy(buffer_.get() + offset, &frame, sizeof(frame));
+    }
+
+    const size_t capacity_;
+    const std::unique_ptr<std::byte[]> buffer_;
+    std::atomic<LogRecordRing*> next_{ nullptr };
+
+    // Producer side
+    alignas(64) std::atomic<size_t> writtenPosition_{ 0 };
+    size_t writePosition_ = 0;
+    size_t cachedReadPosition_ = 0;
+    size_t pendingFrame_ = 0;
+
+    // Consumer side
+    alignas(64) std::atomic<size_t> readPosition_{ 0 };
+    size_t consumePosition_ = 0;
+    size_t cachedWrittenPosition_ = 0;
+    size_t frontSize_ = 0;
+};
+
+// One per logging thread, shared by the thread and the backend
+struct LogProducer {
+    explicit LogProducer(size_t capacity)
+        : producerRing(new LogRecordRing(capacity))
+        , consumerRing(producerRing) {
+    }
+
+    ~LogProducer() {
+        delete consumerRing;    // Owns any rings linked after it
+    }
+
+    LogProducer(const LogProducer&) = delete;
+    LogProducer& operator=(const LogProducer&) = delete;
+
+    // Producer thread
+    LogRecordRing* producerRing;
+    bool discarding = false;
+    alignas(64) std::atomic<uint64_t> committed{ 0 };
+    std::atomic<bool> inRecord{ false };
+    std::atomic<bool> abandoned{ false };
+
+    // Backend thread
+    LogRecordRing* consumerRing;
+    uint64_t consumedLocal = 0;
+    uint64_t passLimit = 0;
+    alignas(64) std::atomic<uint64_t> consumed{ 0 };
+};
+
+namespace {
+    // Marks the thread's producer abandoned on thread exit; the backend frees
+    // it once its ring is empty
+    struct LogProducerSlot {
+        std::shared_ptr<LogProducer> producer;
+
+        ~LogProducerSlot() {
+            if (producer) {
+                producer->abandoned.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    thread_local LogProducerSlot t_producerSlot;
+}
+
+// =============================================================================
+// Deferred Record Queue - Per-thread rings merged and formatted on one backend thread
+// =============================================================================
+
+// There is a single queue per process (LogManager's), which is what lets
+// each thread keep its producer in a thread_local.
+class DeferredRecordQueue {
+public:
+    explicit DeferredRecordQueue(std::atomic<uint64_t>& droppedCounter)
+        : droppedCounter_(droppedCounter) {
+        s_instance.store(this, std::memory_order_release);
+    }
+
+    ~DeferredRecordQueue() {
+        Stop();
+        s_instance.store(nullptr, std::memory_order_release);
+    }
+
+    // Called for every message a rate limit drops; only the first since the
+    // last report wakes the backend
+    static void NotifySuppressed() noexcept {
+        if (g_suppressionPending.load(std::memory_order_relaxed) ||
+            g_suppressionPending.exchange(true, std::memory_order_acq_rel)) {
+            return;
+        }
+        if (DeferredRecordQueue* queue = s_instance.load(std::memory_order_acquire)) {
+            queue->Wake();
+        }
+    }
+
+    void Start() {
+        std::lock_guard<std::mutex> lock(controlMutex_);
+        if (running_.load(std::memory_order_relaxed)) return;
+
+        stopping_.store(false, std::memory_order_relaxed);
+        thread_ = std::thread([this] { Run(); });
+        running_.store(true, std::memory_order_seq_cst);
+    }
+
+    // Formats everything still queued, then joins the backend thread
+    void Stop() {
+        std::lock_guard<std::mutex> lock(controlMutex_);
+        if (!running_.load(std::memory_order_relaxed)) return;
+        running_.store(false, std::memory_order_seq_cst);
+
+        // Producers that saw running_ before the store finish their record
+        // first; the backend keeps consuming, so a blocked one gets room
+        for (const std::shared_ptr<LogProducer>& producer : SnapshotProducers()) {
+            while (producer->inRecord.load(std::memory_order_seq_cst)) {
+                std::this_thread::yield();
+            }
+        }
+
+        stopping_.store(true, std::memory_order_release);
+        Wake();
+        thread_.join();
+
+        passes_.fetch_add(1, std::memory_order_release);
+        passes_.notify_all();
+    }
+
+    bool IsRunning() const noexcept {
+        return running_.load(std::memory_order_acquire);
+    }
+
+    void SetPolicy(LogRingPolicy policy) noexcept { policy_.store(policy, std::memory_order_relaxed); }
+    LogRingPolicy GetPolicy() const noexcept { return policy_.load(std::memory_order_relaxed); }
+    void SetCapacity(size_t bytes) noexcept { capacity_.store(std::bit_ceil(std::max(bytes, MIN_RING_CAPACITY)), std::memory_order_relaxed); }
+    size_t GetCapacity() const noexcept { return capacity_.load(std::memory_order_relaxed); }
+
+    // Reserves a record in the calling thread's ring and copies the header in.
+    // Returns where the arguments go, or nullptr to have the caller format itself.
+    std::byte* Begin(const LogRecordHeader& header) {
+        if (t_isLogBackend) return nullptr;
+
+        LogProducer& producer = CurrentProducer();
+        producer.inRecord.store(true, std::memory_order_seq_cst);
+        if (!running_.load(std::memory_order_seq_cst)) {
+            producer.inRecord.store(false, std::memory_order_release);
+            return nullptr;
+        }
+
+        const size_t payload = sizeof(LogRecordHeader) + header.argumentBytes;
+        std::byte* record = Reserve(producer, payload);
+        if (record == nullptr) {
+            producer.inRecord.store(false, std::memory_order_release);
+            return nullptr;
+        }
+
+        std::memcpy(record, &header, sizeof(header));
+        return record + sizeof(LogRecordHeader);
+    }
+
+    void End() {
+        LogProducer& producer = *t_producerSlot.producer;
+        if (producer.discarding) {
+            producer.discarding = false;
+        }
+        else {
+            producer.producerRing->Commit();
+            producer.committed.store(producer.committed.load(std::memory_order_relaxed) + 1, std::memory_order_seq_cst);
+        }
+        producer.inRecord.store(false, std::memory_order_release);
+
+        if (backendIdle_.load(std::memory_order_seq_cst)) {
+            Wake();
+        }
+    }
+
+    // Blocks until every record committed before the call has been written
+    void Drain() {
+        if (t_isLogBackend || !IsRunning()) return;
+
+        std::vector<std::pair<std::shared_ptr<LogProducer>, uint64_t>> targets;
+        for (std::shared_ptr<LogProducer>& producer : SnapshotProducers()) {
+            const uint64_t committed = producer->committed.load(std::memory_order_acquire);
+            targets.emplace_back(std::move(producer), committed);
+        }
+
+        for (;;) {
+            const uint64_t pass = passes_.load(std::memory_order_acquire);
+            const bool drained = std::all_of(targets.begin(), targets.end(), [](const auto& target) {
+                return target.first->consumed.load(std::memory_order_acquire) >= target.second;
+            });
+            if (drained || !IsRunning()) return;
+
+            Wake();
+            passes_.wait(pass, std::memory_order_acquire);
+        }
+    }
+
+private:
+    struct MergeEntry {
+        std::chrono::system_clock::time_point timestamp;
+        size_t producer;
+
+        bool operator>(const MergeEntry& other) const noexcept {
+            return timestamp > other.timestamp;
+        }
+    };
+
+    LogProducer& CurrentProducer() {
+        std::shared_ptr<LogProducer>& producer = t_producerSlot.producer;
+        if (!producer) {
+            producer = std::make_shared<LogProducer>(capacity_.load(std::memory_order_relaxed));
+
+            std::lock_guard<std::mutex> lock(producersMutex_);
+            producers_.push_back(producer);
+            producersVersion_.fetch_add(1, std::memory_order_release);
+        }
+        return *producer;
+    }
+
+    std::byte* Reserve(LogProducer& producer, size_t payload) {
+        LogRecordRing* ring = producer.producerRing;
+        if (std::byte* record = ring->Reserve(payload)) {
+            return record;
+        }
+
+        switch (policy_.load(std::memory_order_relaxed)) {
+        case LogRingPolicy::Grow: {
+            // The backend finishes the old ring before it follows the link
+            auto* grown = new LogRecordRing(std::max(ring->Capacity() * 2, FrameSize(payload)));
+            ring->Link(grown);
+            producer.producerRing = grown;
+            return grown->Reserve(payload);
+        }
+
+        case LogRingPolicy::DropAndCount:
+            droppedCounter_.fetch_add(1, std::memory_order_relaxed);
+            producer.discarding = true;
+            t_recordStaging.resize(payload);
+            return t_recordStaging.data();
+
+        case LogRingPolicy::Block:
+        default:
+            if (!ring->Fits(payload)) {
+                return nullptr;     // Could never fit; format on the caller instead
+            }
+            for (;;) {
+                if (backendIdle_.load(std::memory_order_seq_cst)) {
+                    Wake();
+                }
+                std::this_thread::yield();
+                if (std::byte* record = ring->Reserve(payload)) {
+                    return record;
+                }
+            }
+        }
+    }
+
+    void Wake() noexcept {
+        wakeEpoch_.fetch_add(1, std::memory_order_seq_cst);
+        wakeEpoch_.notify_one();
+    }
+
+    std::vector<std::shared_ptr<LogProducer>> SnapshotProducers() {
+        std::lock_guard<std::mutex> lock(producersMutex_);
+        return producers_;
+    }
+
+    void Run() {
+        t_isLogBackend = true;
+
+        std::vector<std::shared_ptr<LogProducer>> producers;
+        uint64_t producersVersion = ~uint64_t(0);
+        int64_t summaryDueNs = 0;
+
+        for (;;) {
+            const uint64_t version = producersVersion_.load(std::memory_order_acquire);
+            if (version != producersVersion) {
+                producers = SnapshotProducers();
+                producersVersion = version;
+            }
+
+            const bool stopping = stopping_.load(std::memory_order_acquire);
+            const bool processed = ProcessPass(producers);
+
+            passes_.fetch_add(1, std::memory_order_release);
+            passes_.notify_all();
+            PruneAbandoned(producers);
+            ReportSuppressedIfDue(summaryDueNs);
+
+            if (processed) continue;
+            if (stopping) break;
+
+            // Producers wake the backend only while it advertises being idle
+            backendIdle_.store(true, std::memory_order_seq_cst);
+            const uint32_t epoch = wakeEpoch_.load(std::memory_order_seq_cst);
+            if (!HasPending(producers) && !stopping_.load(std::memory_order_acquire) &&
+                producersVersion_.load(std::memory_order_acquire) == producersVersion) {
+                if (summaryDueNs != 0) {
+                    WaitUntil(epoch, summaryDueNs);
+                }
+                else {
+                    wakeEpoch_.wait(epoch, std::memory_order_seq_cst);
+                }
+            }
+            backendIdle_.store(false, std::memory_order_relaxed);
+        }
+
+        t_isLogBackend = false;
+    }
+
+    // Starts the interval at the first pass that sees a drop and logs every
+    // pending summary when it ends
+    static void ReportSuppressedIfDue(int64_t& dueNs) {
+        const int64_t interval = g_suppressionReportIntervalNs.load(std::memory_order_relaxed);
+        if (interval <= 0 || !g_suppressionPending.load(std::memory_order_acquire)) {
+            dueNs = 0;
+            return;
+        }
+
+        const int64_t now = SteadyNowNs();
+        if (dueNs == 0) {
+            dueNs = now + interval;
+            return;
+        }
+        if (now < dueNs) return;
+
+        dueNs = 0;
+        g_suppressionPending.store(false, std::memory_order_relaxed);
+        LogManager::Instance().ReportSuppressedMessages();
+    }
+
+    // std::atomic::wait has no timeout. This polls instead, and only while a
+    // summary is due, so an idle backend normally sleeps until woken.
+    void WaitUntil(uint32_t epoch, int64_t dueNs) const {
+        while (wakeEpoch_.load(std::memory_order_seq_cst) == epoch && SteadyNowNs() < dueNs) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    // Writes the records committed before the pass began, oldest first across all threads
+    bool ProcessPass(std::vector<std::shared_ptr<LogProducer>>& producers) {
+        merge_.clear();
+        for (size_t i = 0; i < producers.size(); ++i) {
+            LogProducer& producer = *producers[i];
+            producer.passLimit = producer.committed.load(std::memory_order_acquire);
+            if (producer.consumedLocal < producer.passLimit) {
+                merge_.push_back({ FrontTimestamp(producer), i });
+            }
+        }
+        if (merge_.empty()) return false;
+
+        std::make_heap(merge_.begin(), merge_.end(), std::greater<>());
+        while (!merge_.empty()) {
+            std::pop_heap(merge_.begin(), merge_.end(), std::greater<>());
+            LogProducer& producer = *producers[merge_.back().producer];
+
+            Process(Front(producer), message_);
+            producer.consumerRing->Pop();
+
+            if (++producer.consumedLocal < producer.passLimit) {
+                merge_.back().timestamp = FrontTimestamp(producer);
+                std::push_heap(merge_.begin(), merge_.end(), std::greater<>());
+            }
+            else {
+                merge_.pop_back();
+            }
+        }
+
+        for (const std::shared_ptr<LogProducer>& producer : producers) {
+            producer->consumed.store(producer->consumedLocal, std::memory_order_release);
+        }
+        return true;
+    }
+
+    // Only called for producers with committed records left in this pass
+    static const std::byte* Front(LogProducer& producer) {
+        for (;;) {
+            if (const std::byte* record = producer.consumerRing->Front()) {
+                return record;
+            }
+
+            // The producer moved to a grown ring; everything it committed to
+            // the old one is visible once the link is
+            LogRecordRing* next = producer.consumerRing->Next();
+            if (const std::byte* record = producer.consumerRing->Front()) {
+                return record;
+            }
+            if (next == nullptr) {
+                return nullptr;
+            }
+
+            LogRecordRing* drained = producer.consumerRing;
+            producer.consumerRing = drained->DetachNext();
+            delete drained;
+        }
+    }
+
+    static std::chrono::system_clock::time_point FrontTimestamp(LogProducer& producer) {
+        LogRecordHeader header;
+        std::memcpy(&header, Front(producer), sizeof(header));
+        return header.timestamp;
+    }
+
+    static bool HasPending(const std::vector<std::shared_ptr<LogProducer>>& producers) {
+        return std::any_of(producers.begin(), producers.end(), [](const std::shared_ptr<LogProducer>& producer) {
+            return producer->committed.load(std::memory_order_seq_cst) != producer->consumedLocal;
+        });
+    }
+
+    // Producers of exited threads are released once their rings are empty
+    void PruneAbandoned(std::vector<std::shared_ptr<LogProducer>>& producers) {
+        const auto finished = [](const std::shared_ptr<LogProducer>& producer) {
+            return producer->abandoned.load(std::memory_order_acquire) &&
+                producer->committed.load(std::memory_order_acquire) == producer->consumedLocal;
+        };
+        if (std::none_of(producers.begin(), producers.end(), finished)) return;
+
+        std::lock_guard<std::mutex> lock(producersMutex_);
+        std::erase_if(producers_, finished);
+        producersVersion_.fetch_add(1, std::memory_order_release);
+        std::erase_if(producers, finished);
+    }
+
+    static void Process(const std::byte* record, std::string& message) {
+        LogRecordHeader header;
+        std::memcpy(&header, record, sizeof(header));
+        const std::byte* arguments = record + sizeof(header);
+
+        g_recordSinks.Write(header, arguments);
+        if (!header.channel->HasSinks(header.level)) {
+            return;
+        }
+
+        message.clear();
+        try {
+            header.formatter(std::string_view(header.format, header.formatSize), arguments, message);
+        }
+        catch (const std::exception&) {
+            message = "LOG FORMAT ERROR: Invalid format string";
+        }
+        header.channel->WriteRecord(header, message);
+    }
+
+    std::atomic<uint64_t>& droppedCounter_;
+    std::atomic<LogRingPolicy> policy_{ LogRingPolicy::Block };
+    std::atomic<size_t> capacity_{ DEFAULT_LOG_RING_CAPACITY };
+
+    std::mutex controlMutex_;
+    std::atomic<bool> running_{ false };
+    std::atomic<bool> stopping_{ false };
+    std::thread thread_;
+
+    std::mutex producersMutex_;
+    std::vector<std::shared_ptr<LogProducer>> producers_;
+    std::atomic<uint64_t> producersVersion_{ 0 };
+
+    std::atomic<bool> backendIdle_{ false };
+    std::atomic<uint32_t> wakeEpoch_{ 0 };
+    std::atomic<uint64_t> passes_{ 0 };
+
+    std::vector<MergeEntry> merge_;     // Backend thread only
+    std::string message_;
+
+    static inline std::atomic<DeferredRecordQueue*> s_instance{ nullptr };
+};
+
 // =============================================================================
 // LogChannel Implementation
 // =============================================================================
@@ -274,6 +947,13 @@ public:
         LogManager::Instance().UpdateStatistics(message.length());
     }
 
+    bool HasSinks(LogLevel level) const {
+        if (!spdlogLogger_) return true;
+        const auto spdLevel = ToSpdlogLevel(level);
+        const auto& sinks = spdlogLogger_->sinks();
+        return std::any_of(sinks.begin(), sinks.end(), [spdLevel](const auto& sink) { return sink->should_log(spdLevel); });
+    }
+
     void Log(LogLevel level, std::wstring_view message, const std::source_location& location) {
         if (!spdlogLogger_) {
             return;
@@ -289,6 +969,39 @@ public:
         LogManager::Instance().UpdateStatistics(message.length());
     }
 
+    // Hands a backend-formatted message straight to the sinks, keeping the
+    // producer's timestamp and thread id (the record already left the caller)
+    void Write(const LogRecordHeader& header, std::string_view message) {
+        if (!spdlogLogger_) {
+            std::printf("[%s] %.*s\n", ToString(header.level).data(), static_cast<int>(message.size()), message.data());
+            return;
+        }
+
+        spdlog::details::log_msg msg(header.timestamp,
+            spdlog::source_loc{ header.location.file_name(), static_cast<int>(header.location.line()), header.location.function_name() },
+            spdlogLogger_->name(), ToSpdlogLevel(header.level),
+            spdlog::string_view_t(message.data(), message.size()));
+        msg.thread_id = header.nativeThreadId;
+
+        try {
+            for (const auto& sink : spdlogLogger_->sinks()) {
+                if (sink->should_log(msg.level)) {
+                    sink->log(msg);
+                }
+            }
+            if (msg.level >= spdlogLogger_->flush_level()) {
+                for (const auto& sink : spdlogLogger_->sinks()) {
+                    sink->flush();
+                }
+            }
+        }
+        catch (const std::exception&) {
+            // A failing sink must not take the backend thread down
+        }
+
+        LogManager::Instance().UpdateStatistics(message.length());
+    }
+
     void SetLevel(LogLevel level) {
         if (spdlogLogger_) {
             spdlogLogger_->set_level(ToSpdlogLevel(level));
@@ -300,11 +1013,6 @@ public:
         return FromSpdlogLevel(spdlogLogger_->level());
     }
 
-    bool ShouldLog(LogLevel level) const {
-        if (!spdlogLogger_) return false;
-        return spdlogLogger_->should_log(ToSpdlogLevel(level));
-    }
-
     void AddSink(std::shared_ptr<spdlog::sinks::sink> sink) {
         if (spdlogLogger_ && sink) {
             spdlogLogger_->sinks().push_back(sink);
@@ -367,6 +1075,10 @@ public:
         // Create default sinks
         CreateDefaultSinks();
 
+        if (deferredFormatting_.load(std::memory_order_relaxed)) {
+            deferredQueue_.Start();
+        }
+
         initialized_ = true;
     }
 
@@ -374,9 +1086,15 @@ public:
         std::lock_guard<std::mutex> lock(initMutex_);
         if (!initialized_) return;
 
+        // Format and write whatever is still queued while channels and sinks exist
+        deferredQueue_.Stop();
+
         // Clear all channels
         {
             std::lock_guard<std::shared_mutex> channelLock(channelsMutex_);
+            for (const auto& [name, channel] : channels_) {
+                UnpublishChannel(*channel);
+            }
             channels_.clear();
         }
 
@@ -415,6 +1133,9 @@ public:
         }
 
         auto channel = std::make_unique<LogChannel>(name);
+        for (size_t level = 0; level < defaultRateLimits_.size(); ++level) {
+            channel->SetRateLimit(static_cast<LogLevel>(level), LogRateLimit::Unpack(defaultRateLimits_[level]));
+        }
 
         // Add existing sinks to new channel
         {
@@ -442,12 +1163,33 @@ public:
 
         auto& channelRef = *channel;
         channels_[std::string(name)] = std::move(channel);
+        PublishChannel(channelRef);
         return channelRef;
     }
 
+    ChannelHandle RegisterChannel(std::string_view name) {
+        return ChannelHandle{ GetChannel(name).index_ };
+    }
+
+    void SetRateLimit(LogLevel level, LogRateLimit limit) {
+        std::lock_guard<std::shared_mutex> lock(channelsMutex_);
+        defaultRateLimits_[static_cast<size_t>(level)] = limit.Pack();
+        for (const auto& [name, channel] : channels_) {
+            channel->SetRateLimit(level, limit);
+        }
+    }
+
     void RemoveChannel(std::string_view name) {
         std::lock_guard<std::shared_mutex> lock(channelsMutex_);
-        channels_.erase(std::string(name));
+        auto it = channels_.find(std::string(name));
+        if (it != channels_.end()) {
+            // Queued records may still point at the channel. Once it is
+            // unpublished the suppression reporter queues no more for it, and
+            // the backend never waits for this lock, so they drain under it.
+            UnpublishChannel(*it->second);
+            deferredQueue_.Drain();
+            channels_.erase(it);
+        }
     }
 
     void AddSink(std::unique_ptr<ILogSink> sink) {
@@ -499,6 +1241,12 @@ public:
     void SetGlobalLevel(LogLevel level) {
         globalLevel_.store(level, std::memory_order_relaxed);
         spdlog::set_level(ToSpdlogLevel(level));
+
+        // spdlog::set_level overrides every logger; keep the channel levels in step
+        std::shared_lock<std::shared_mutex> lock(channelsMutex_);
+        for (const auto& [name, channel] : channels_) {
+            channel->SetLevel(level);
+        }
     }
 
     LogLevel GetGlobalLevel() const {
@@ -529,6 +1277,9 @@ public:
     }
 
     void Flush() {
+        deferredQueue_.Drain();
+        g_recordSinks.Flush();
+
         spdlog::apply_all([](std::shared_ptr<spdlog::logger> logger) {
             logger->flush();
             });
@@ -544,6 +1295,62 @@ public:
         return g_asyncMode.load(std::memory_order_relaxed);
     }
 
+    void SetDefaultSinksEnabled(bool enabled) {
+        defaultSinksEnabled_.store(enabled, std::memory_order_relaxed);
+
+        std::shared_lock<std::shared_mutex> lock(sinksMutex_);
+        const auto level = enabled ? spdlog::level::debug : spdlog::level::off;
+        if (defaultConsoleSink_) defaultConsoleSink_->set_level(level);
+        if (defaultMsvcSink_) defaultMsvcSink_->set_level(level);
+    }
+
+    void SetDeferredFormatting(bool enabled) {
+        std::lock_guard<std::mutex> lock(initMutex_);
+        deferredFormatting_.store(enabled, std::memory_order_relaxed);
+        if (!initialized_) return;
+
+        if (enabled) {
+            deferredQueue_.Start();
+        }
+        else {
+            deferredQueue_.Stop();
+        }
+    }
+
+    bool IsDeferredFormatting() const noexcept {
+        return deferredQueue_.IsRunning();
+    }
+
+    void SetRingPolicy(LogRingPolicy policy) noexcept {
+        deferredQueue_.SetPolicy(policy);
+    }
+
+    LogRingPolicy GetRingPolicy() const noexcept {
+        return deferredQueue_.GetPolicy();
+    }
+
+    void SetRingCapacity(size_t bytes) noexcept {
+        deferredQueue_.SetCapacity(bytes);
+    }
+
+    size_t GetRingCapacity() const noexcept {
+        return deferredQueue_.GetCapacity();
+    }
+
+    std::byte* BeginRecord(const LogRecordHeader& header) {
+        if (!deferredQueue_.IsRunning()) return nullptr;
+
+        LogRecordHeader stamped = header;
+        stamped.timestamp = spdlog::log_clock::now();
+        stamped.threadId = std::this_thread::get_id();
+        stamped.nativeThreadId = spdlog::details::os::thread_id();
+        return deferredQueue_.Begin(stamped);
+    }
+
+    void EndRecord() {
+        deferredQueue_.End();
+    }
+
     void UpdateStatistics(size_t messageBytes) {
         statistics_.messagesLogged.fetch_add(1, std::memory_order_relaxed);
         statistics_.bytesWritten.fetch_add(messageBytes, std::memory_order_relaxed);
@@ -591,15 +1398,47 @@ public:
         }
     }
 
+    // Keeps RemoveChannel from freeing a channel while the lock is held.
+    // Without `wait` the lock may come back unowned.
+    std::shared_lock<std::shared_mutex> LockChannels(bool wait) const {
+        if (wait) return std::shared_lock<std::shared_mutex>(channelsMutex_);
+        return std::shared_lock<std::shared_mutex>(channelsMutex_, std::try_to_lock);
+    }
+
 private:
+    // Gives a new channel its table slot; a name keeps its slot across
+    // RemoveChannel so cached handles stay valid. Requires channelsMutex_.
+    void PublishChannel(LogChannel& channel) {
+        auto [it, inserted] = channelIndices_.try_emplace(channel.name_, nextChannelIndex_);
+        if (inserted) {
+            if (nextChannelIndex_ == MAX_LOG_CHANNELS) {
+                channelIndices_.erase(it);
+                return;
+            }
+            ++nextChannelIndex_;
+        }
+
+        channel.index_ = it->second;
+        Detail::g_channelLevelMasks[channel.index_].store(Detail::LevelMask(channel.GetLevel()), std::memory_order_relaxed);
+        Detail::g_channelTable[channel.index_].store(&channel, std::memory_order_release);
+    }
+
+    static void UnpublishChannel(LogChannel& channel) {
+        if (channel.index_ == MAX_LOG_CHANNELS) return;
+        Detail::g_channelLevelMasks[channel.index_].store(0, std::memory_order_relaxed);
+        Detail::g_channelTable[channel.index_].store(nullptr, std::memory_order_release);
+    }
+
     void CreateDefaultSinks() {
+        const auto defaultLevel = defaultSinksEnabled_.load(std::memory_order_relaxed) ? spdlog::level::debug : spdlog::level::off;
+
         // Console sink for debug output
         auto consoleSink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-        consoleSink->set_level(spdlog::level::debug);
+        consoleSink->set_level(defaultLevel);
 
         // MSVC output window sink for Visual Studio
         auto msvcSink = std::make_shared<spdlog::sinks::msvc_sink_mt>();
-        msvcSink->set_level(spdlog::level::debug);
+        msvcSink->set_level(defaultLevel);
 
         // Store default sinks for new channels
         std::lock_guard<std::shared_mutex> lock(sinksMutex_);
@@ -624,12 +1463,17 @@ private:
 
     std::atomic<bool> initialized_;
     std::atomic<LogLevel> globalLevel_{ LogLevel::Debug };
+    std::atomic<bool> deferredFormatting_{ true };
+    std::atomic<bool> defaultSinksEnabled_{ true };
 
     mutable std::shared_mutex channelsMutex_;
     mutable std::shared_mutex sinksMutex_;
     std::mutex initMutex_;
 
     std::unordered_map<std::string, std::unique_ptr<LogChannel>> channels_;
+    std::unordered_map<std::string, uint32_t> channelIndices_;
+    uint32_t nextChannelIndex_ = 0;
+    std::array<uint64_t, static_cast<size_t>(LogLevel::Count)> defaultRateLimits_{};  // Given to new channels
 
     std::shared_ptr<spdlog::sinks::stdout_color_sink_mt> defaultConsoleSink_;
     std::shared_ptr<spdlog::sinks::msvc_sink_mt> defaultMsvcSink_;
@@ -640,11 +1484,100 @@ private:
 
     LogManager::Statistics statistics_;
 
+    DeferredRecordQueue deferredQueue_{ statistics_.messagesDropped };
+
 public:
     friend class LogManager;
     friend class LogManagerImpl;
 };
 
+// =============================================================================
+// LogSite Implementation
+// =============================================================================
+
+namespace {
+    // Every LOG_* statement that has run, plus the file/line rules applied to
+    // them. Rules are kept so sites that first run later pick them up too.
+    struct LogSiteRegistry {
+        struct Rule {
+            std::string file;
+            uint32_t line;
+            bool enabled;
+        };
+
+        std::mutex mutex;
+        LogSite* head = nullptr;
+        std::vector<Rule> rules;
+
+        static bool Matches(const Rule& rule, const std::source_location& location) noexcept {
+            if (rule.line != 0 && rule.line != location.line()) {
+                return false;
+            }
+            return std::string_view(location.file_name()).ends_with(rule.file);
+        }
+
+        // Newest matching rule wins; sites are on by default
+        bool Evaluate(const std::source_location& location) const noexcept {
+            for (auto it = rules.rbegin(); it != rules.rend(); ++it) {
+                if (Matches(*it, location)) {
+                    return it->enabled;
+                }
+            }
+            return true;
+        }
+    };
+
+    LogSiteRegistry& GetLogSiteRegistry() {
+        static LogSiteRegistry registry;
+        return registry;
+    }
+}
+
+bool LogSite::Register() noexcept {
+    uint8_t expected = UNREGISTERED;
+    if (!state_.compare_exchange_strong(expected, REGISTERING, std::memory_order_relaxed)) {
+        return expected != DISABLED;
+    }
+
+    LogSiteRegistry& registry = GetLogSiteRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    next_ = registry.head;
+    registry.head = this;
+
+    const bool enabled = registry.Evaluate(location_);
+    state_.store(enabled ? ENABLED : DISABLED, std::memory_order_relaxed);
+    return enabled;
+}
+
+// Token bucket kept as the time it is empty until (GCRA): a message fits when
+// that time is at most burst - 1 intervals ahead, and each one pushes it on by
+// an interval. One CAS per admitted message, one add per dropped one.
+bool LogSite::AdmitLimited(const LogChannel& channel, uint64_t limit) {
+    const LogRateLimit rate = LogRateLimit::Unpack(limit);
+    const int64_t interval = std::max<int64_t>(1'000'000'000 / rate.messagesPerSecond, 1);
+    const int64_t tolerance = interval * (static_cast<int64_t>(rate.burst) - 1);
+    const int64_t now = SteadyNowNs();
+
+    int64_t allowedAt = allowedAt_.load(std::memory_order_relaxed);
+    do {
+        if (allowedAt - tolerance > now) {
+            suppressedChannel_.store(channel.index_, std::memory_order_relaxed);
+            suppressed_.fetch_add(1, std::memory_order_relaxed);
+            DeferredRecordQueue::NotifySuppressed();
+            return false;
+        }
+    } while (!allowedAt_.compare_exchange_weak(allowedAt, std::max(allowedAt, now) + interval, std::memory_order_relaxed));
+
+    if (const uint32_t count = suppressed_.exchange(0, std::memory_order_relaxed)) {
+        ReportSuppressed(channel, count);
+    }
+    return true;
+}
+
+void LogSite::ReportSuppressed(const LogChannel& channel, uint32_t count) const {
+    channel.Log(level_, std::format("Suppressed {} messages from this call site", count), location_);
+}
+
 // =============================================================================
 // LogChannel Implementation
 // =============================================================================
@@ -652,11 +1585,37 @@ public:
 LogChannel::LogChannel(std::string_view name) noexcept
     : name_(name)
     , level_(LogLevel::Debug)
+    , index_(MAX_LOG_CHANNELS)
     , impl_(std::make_unique<Impl>(name)) {
 }
 
 void LogChannel::Log(LogLevel level, std::string_view message, const std::source_location& location) const {
     if (!ShouldLog(level)) return;
+
+    // While deferred formatting is on, plain messages take the same queue so
+    // they stay in order with formatted ones from the same thread
+    LogManager& manager = LogManager::Instance();
+    if (manager.IsDeferredFormatting()) {
+        LogRecordHeader header;
+        header.channel = this;
+        header.formatter = &FormatLogRecord<std::string_view>;
+        header.format = "{}";
+        header.formatSize = 2;
+        header.argumentBytes = static_cast<uint32_t>(EncodedLogArgumentsSize(message));
+        header.argumentKinds = LogArgumentKinds<std::string_view>;
+        header.location = location;
+        header.level = level;
+
+        if (std::byte* arguments = manager.BeginRecord(header)) {
+            EncodeLogArguments(arguments, message);
+            manager.EndRecord();
+            return;
+        }
+    }
+
+    if (g_recordSinks.IsActive()) {
+        WriteTextRecord(*this, level, message, location);
+    }
     impl_->Log(level, message, location);
 }
 
@@ -667,9 +1626,20 @@ void LogChannel::Log(LogLevel level, std::wstring_view message, const std::sourc
 
 void LogChannel::SetLevel(LogLevel level) noexcept {
     level_.store(level, std::memory_order_relaxed);
+    if (index_ != MAX_LOG_CHANNELS) {
+        Detail::g_channelLevelMasks[index_].store(Detail::LevelMask(level), std::memory_order_relaxed);
+    }
     impl_->SetLevel(level);
 }
 
+void LogChannel::SetRateLimit(LogLevel level, LogRateLimit limit) noexcept {
+    rateLimits_[static_cast<size_t>(level)].store(limit.Pack(), std::memory_order_relaxed);
+}
+
+LogRateLimit LogChannel::GetRateLimit(LogLevel level) const noexcept {
+    return LogRateLimit::Unpack(rateLimits_[static_cast<size_t>(level)].load(std::memory_order_relaxed));
+}
+
 LogLevel LogChannel::GetLevel() const noexcept {
     return level_.load(std::memory_order_relaxed);
 }
@@ -678,10 +1648,6 @@ std::string_view LogChannel::GetName() const noexcept {
     return name_;
 }
 
-bool LogChannel::ShouldLog(LogLevel level) const noexcept {
-    return level >= level_.load(std::memory_order_relaxed) && impl_->ShouldLog(level);
-}
-
 void LogChannel::AddSink(std::shared_ptr<void> sink) {
     auto spdlogSink = std::static_pointer_cast<spdlog::sinks::sink>(sink);
     impl_->AddSink(spdlogSink);
@@ -691,6 +1657,32 @@ void LogChannel::RemoveSink(void* sink) {
     impl_->RemoveSink(static_cast<spdlog::sinks::sink*>(sink));
 }
 
+void LogChannel::WriteRecord(const LogRecordHeader& header, std::string_view message) const {
+    impl_->Write(header, message);
+}
+
+void LogChannel::WriteEncodedRecord(const LogRecordHeader& header, const std::byte* arguments) const {
+    LogRecordHeader stamped = header;
+    stamped.timestamp = spdlog::log_clock::now();
+    stamped.threadId = std::this_thread::get_id();
+    stamped.nativeThreadId = spdlog::details::os::thread_id();
+    g_recordSinks.Write(stamped, arguments);
+
+    thread_local std::string message;
+    message.clear();
+    try {
+        header.formatter(std::string_view(header.format, header.formatSize), arguments, message);
+    }
+    catch (const std::exception&) {
+        message = "LOG FORMAT ERROR: Invalid format string";
+    }
+    impl_->Log(header.level, message, header.location);
+}
+
+bool LogChannel::HasSinks(LogLevel level) const {
+    return impl_->HasSinks(level);
+}
+
 // =============================================================================
 // LogManager Implementation
 // =============================================================================
@@ -710,6 +1702,77 @@ LogChannel& LogManager::GetChannel(std::string_view name) {
     return impl_->GetChannel(name);
 }
 
+ChannelHandle LogManager::RegisterChannel(std::string_view name) {
+    return impl_->RegisterChannel(name);
+}
+
+void LogManager::SetLogSitesEnabled(std::string_view file, uint32_t line, bool enabled) {
+    LogSiteRegistry& registry = GetLogSiteRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.rules.push_back({ std::string(file), line, enabled });
+
+    for (LogSite* site = registry.head; site != nullptr; site = site->next_) {
+        if (LogSiteRegistry::Matches(registry.rules.back(), site->location_)) {
+            site->SetEnabled(enabled);
+        }
+    }
+}
+
+void LogManager::ForEachLogSite(const std::function<void(LogSite&)>& visitor) {
+    LogSiteRegistry& registry = GetLogSiteRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (LogSite* site = registry.head; site != nullptr; site = site->next_) {
+        visitor(*site);
+    }
+}
+
+void LogManager::SetRateLimit(LogLevel level, LogRateLimit limit) {
+    impl_->SetRateLimit(level, limit);
+}
+
+void LogManager::SetSuppressionReportInterval(std::chrono::milliseconds interval) noexcept {
+    g_suppressionReportIntervalNs.store(std::chrono::nanoseconds(interval).count(), std::memory_order_relaxed);
+    DeferredRecordQueue::NotifySuppressed();
+}
+
+std::chrono::milliseconds LogManager::GetSuppressionReportInterval() const noexcept {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::nanoseconds(g_suppressionReportIntervalNs.load(std::memory_order_relaxed)));
+}
+
+void LogManager::ReportSuppressedMessages() {
+    std::vector<LogSite*> pending;
+    {
+        LogSiteRegistry& registry = GetLogSiteRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (LogSite* site = registry.head; site != nullptr; site = site->next_) {
+            if (site->suppressed_.load(std::memory_order_relaxed) != 0) {
+                pending.push_back(site);
+            }
+        }
+    }
+
+    if (pending.empty()) return;
+
+    // The backend only tries the lock: a caller reporting under it may be
+    // waiting on the backend for ring space. It reports at the next interval.
+    const std::shared_lock<std::shared_mutex> channelLock = impl_->LockChannels(!t_isLogBackend);
+    if (!channelLock.owns_lock()) {
+        g_suppressionPending.store(true, std::memory_order_release);
+        return;
+    }
+
+    // Sites only know the table slot of the channel they last dropped on
+    for (LogSite* site : pending) {
+        const uint32_t index = site->suppressedChannel_.load(std::memory_order_relaxed);
+        const LogChannel* channel = index < MAX_LOG_CHANNELS ? Detail::g_channelTable[index].load(std::memory_order_acquire) : nullptr;
+        if (channel == nullptr) continue;
+        if (const uint32_t count = site->suppressed_.exchange(0, std::memory_order_relaxed)) {
+            site->ReportSuppressed(*channel, count);
+        }
+    }
+}
+
 void LogManager::RemoveChannel(std::string_view name) {
     impl_->RemoveChannel(name);
 }
@@ -722,6 +1785,16 @@ void LogManager::RemoveSink(ILogSink* sink) {
     impl_->RemoveSink(sink);
 }
 
+void LogManager::AddRecordSink(std::unique_ptr<ILogRecordSink> sink) {
+    g_recordSinks.Add(std::move(sink));
+}
+
+void LogManager::RemoveRecordSink(ILogRecordSink* sink) {
+    // Let the backend finish with records already handed to the sink
+    impl_->Flush();
+    g_recordSinks.Remove(sink);
+}
+
 void LogManager::ClearSinks() {
     impl_->ClearSinks();
 }
@@ -755,6 +1828,7 @@ void LogManager::UpdateStatistics(size_t messageBytes) {
 }
 
 void LogManager::Flush() {
+    ReportSuppressedMessages();
     impl_->Flush();
 }
 
@@ -766,10 +1840,49 @@ bool LogManager::IsAsyncMode() const {
     return impl_->IsAsyncMode();
 }
 
+void LogManager::SetDefaultSinksEnabled(bool enabled) {
+    impl_->SetDefaultSinksEnabled(enabled);
+}
+
+void LogManager::SetDeferredFormatting(bool enabled) {
+    impl_->SetDeferredFormatting(enabled);
+}
+
+bool LogManager::IsDeferredFormatting() const noexcept {
+    return impl_->IsDeferredFormatting();
+}
+
+std::byte* LogManager::BeginRecord(const LogRecordHeader& header) {
+    return impl_->BeginRecord(header);
+}
+
+void LogManager::EndRecord() {
+    impl_->EndRecord();
+}
+
+void LogManager::SetRingPolicy(LogRingPolicy policy) noexcept {
+    impl_->SetRingPolicy(policy);
+}
+
+LogRingPolicy LogManager::GetRingPolicy() const noexcept {
+    return impl_->GetRingPolicy();
+}
+
+void LogManager::SetRingCapacity(size_t bytes) noexcept {
+    impl_->SetRingCapacity(bytes);
+}
+
+size_t LogManager::GetRingCapacity() const noexcept {
+    return impl_->GetRingCapacity();
+}
+
 void LogManager::SetEditorCallback(EditorLogCallback callback) {
     impl_->SetEditorCallback(std::move(callback));
 }
 
+void LogManager::ClearEditorCallback() {
+    impl_->ClearEditorCallback();
+}
 
 void LogManager::SetMemoryTrackingCallbacks(LogManager::MemoryAllocationCallback allocCallback, LogManager::MemoryDeallocationCallback deallocCallback) {
     impl_->SetMemoryTrackingCallbacks(allocCallback, deallocCallback);
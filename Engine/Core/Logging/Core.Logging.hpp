@@ -5,83 +5,84 @@
 import Akhanda.Core.Logging;
 
 // =============================================================================
-// Convenience Macros (Unchanged from Original)
+// Compile-Time Threshold
 // =============================================================================
 
-// Channel-based logging macros with compile-time filtering
-#define LOG_DEBUG(channel, message) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Debug)) { \
-        if ((channel).ShouldLog(::Akhanda::Logging::LogLevel::Debug)) { \
-            (channel).Debug(message); \
-        } \
-    } } while(0)
-
-#define LOG_INFO(channel, message) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Info)) { \
-        if ((channel).ShouldLog(::Akhanda::Logging::LogLevel::Info)) { \
-            (channel).Info(message); \
-        } \
-    } } while(0)
+// Statements below this level are discarded at compile time: their arguments
+// are never evaluated and no code is emitted. Values follow LogLevel (0 =
+// Trace ... 5 = Fatal). Define before the first include to override per
+// translation unit; the defaults match ShouldCompileLog.
+#ifndef AKH_LOG_COMPILE_LEVEL
+#if defined(AKH_DEBUG)
+#define AKH_LOG_COMPILE_LEVEL 0
+#elif defined(AKH_PROFILE)
+#define AKH_LOG_COMPILE_LEVEL 2
+#else
+#define AKH_LOG_COMPILE_LEVEL 3
+#endif
+#endif
 
-#define LOG_WARNING(channel, message) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Warning)) { \
-        if ((channel).ShouldLog(::Akhanda::Logging::LogLevel::Warning)) { \
-            (channel).Warning(message); \
+#define AKH_LOG_COMPILED(level) \
+    (static_cast<int>(::Akhanda::Logging::LogLevel::level) >= AKH_LOG_COMPILE_LEVEL)
+
+// One statement: compile-time level, runtime channel level, the call site's
+// own flag, then the channel's rate limit for the site. Arguments are
+// evaluated only when all four pass; `channel` is evaluated once. The site is
+// constant-initialized, so its checks are relaxed loads unless a rate limit
+// is set. A handle whose channel was removed makes the statement do nothing.
+#define AKH_LOG_STATEMENT(level, channel, call) \
+    do { if constexpr (AKH_LOG_COMPILED(level)) { \
+        auto&& akhLogTarget_ = (channel); \
+        if (::Akhanda::Logging::ShouldLog(akhLogTarget_, ::Akhanda::Logging::LogLevel::level)) { \
+            static constinit ::Akhanda::Logging::LogSite akhLogSite_(::Akhanda::Logging::LogLevel::level); \
+            if (akhLogSite_.IsEnabled()) { \
+                const ::Akhanda::Logging::LogChannel* akhLogChannel_ = ::Akhanda::Logging::ResolveChannel(akhLogTarget_); \
+                if (akhLogChannel_ && akhLogSite_.Admit(*akhLogChannel_)) { \
+                    akhLogChannel_->call; \
+                } \
+            } \
         } \
     } } while(0)
 
-#define LOG_ERROR(channel, message) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Error)) { \
-        if ((channel).ShouldLog(::Akhanda::Logging::LogLevel::Error)) { \
-            (channel).Error(message); \
-        } \
-    } } while(0)
+// =============================================================================
+// Convenience Macros
+// =============================================================================
 
-#define LOG_FATAL(channel, message) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Fatal)) { \
-        if ((channel).ShouldLog(::Akhanda::Logging::LogLevel::Fatal)) { \
-            (channel).Fatal(message); \
-        } \
-    } } while(0)
+// Channel-based logging macros with compile-time filtering. `channel` may be
+// a LogChannel or a ChannelHandle; with a handle a disabled statement costs
+// one load and a branch.
+#define LOG_TRACE(channel, message)   AKH_LOG_STATEMENT(Trace, channel, Trace(message))
+#define LOG_DEBUG(channel, message)   AKH_LOG_STATEMENT(Debug, channel, Debug(message))
+#define LOG_INFO(channel, message)    AKH_LOG_STATEMENT(Info, channel, Info(message))
+#define LOG_WARNING(channel, message) AKH_LOG_STATEMENT(Warning, channel, Warning(message))
+#define LOG_ERROR(channel, message)   AKH_LOG_STATEMENT(Error, channel, Error(message))
+#define LOG_FATAL(channel, message)   AKH_LOG_STATEMENT(Fatal, channel, Fatal(message))
 
 // =============================================================================
-// Formatted Logging Macros (Unchanged from Original)
+// Formatted Logging Macros
 // =============================================================================
 
-#define LOG_DEBUG_FORMAT(channel, fmt, ...) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Debug)) { \
-        if ((channel).ShouldLog(::Akhanda::Logging::LogLevel::Debug)) { \
-            (channel).DebugFormat(fmt, __VA_ARGS__); \
-        } \
-    } } while(0)
-
-#define LOG_INFO_FORMAT(channel, fmt, ...) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Info)) { \
-        if ((channel).ShouldLog(::Akhanda::Logging::LogLevel::Info)) { \
-            (channel).InfoFormat(fmt, __VA_ARGS__); \
-        } \
-    } } while(0)
+#define LOG_TRACE_FORMAT(channel, fmt, ...)   AKH_LOG_STATEMENT(Trace, channel, TraceFormat(fmt, __VA_ARGS__))
+#define LOG_DEBUG_FORMAT(channel, fmt, ...)   AKH_LOG_STATEMENT(Debug, channel, DebugFormat(fmt, __VA_ARGS__))
+#define LOG_INFO_FORMAT(channel, fmt, ...)    AKH_LOG_STATEMENT(Info, channel, InfoFormat(fmt, __VA_ARGS__))
+#define LOG_WARNING_FORMAT(channel, fmt, ...) AKH_LOG_STATEMENT(Warning, channel, WarningFormat(fmt, __VA_ARGS__))
+#define LOG_ERROR_FORMAT(channel, fmt, ...)   AKH_LOG_STATEMENT(Error, channel, ErrorFormat(fmt, __VA_ARGS__))
+#define LOG_FATAL_FORMAT(channel, fmt, ...)   AKH_LOG_STATEMENT(Fatal, channel, FatalFormat(fmt, __VA_ARGS__))
 
-#define LOG_WARNING_FORMAT(channel, fmt, ...) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Warning)) { \
-        if ((channel).ShouldLog(::Akhanda::Logging::LogLevel::Warning)) { \
-            (channel).WarningFormat(fmt, __VA_ARGS__); \
-        } \
-    } } while(0)
+// =============================================================================
+// Structured Logging Macros
+// =============================================================================
 
-#define LOG_ERROR_FORMAT(channel, fmt, ...) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Error)) { \
-        if ((channel).ShouldLog(::Akhanda::Logging::LogLevel::Error)) { \
-            (channel).ErrorFormat(fmt, __VA_ARGS__); \
-        } \
-    } } while(0)
+// LOG_INFO_EVENT(channel, "FrameEnd", Field("frame", n), Field("ms", ms))
+#define AKH_LOG_EVENT(level, channel, event, ...) \
+    AKH_LOG_STATEMENT(level, channel, Log(::Akhanda::Logging::LogLevel::level, event, __VA_ARGS__))
 
-#define LOG_FATAL_FORMAT(channel, fmt, ...) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Fatal)) { \
-        if ((channel).ShouldLog(::Akhanda::Logging::LogLevel::Fatal)) { \
-            (channel).FatalFormat(fmt, __VA_ARGS__); \
-        } \
-    } } while(0)
+#define LOG_TRACE_EVENT(channel, event, ...)   AKH_LOG_EVENT(Trace, channel, event, __VA_ARGS__)
+#define LOG_DEBUG_EVENT(channel, event, ...)   AKH_LOG_EVENT(Debug, channel, event, __VA_ARGS__)
+#define LOG_INFO_EVENT(channel, event, ...)    AKH_LOG_EVENT(Info, channel, event, __VA_ARGS__)
+#define LOG_WARNING_EVENT(channel, event, ...) AKH_LOG_EVENT(Warning, channel, event, __VA_ARGS__)
+#define LOG_ERROR_EVENT(channel, event, ...)   AKH_LOG_EVENT(Error, channel, event, __VA_ARGS__)
+#define LOG_FATAL_EVENT(channel, event, ...)   AKH_LOG_EVENT(Fatal, channel, event, __VA_ARGS__)
 
 // =============================================================================
 // Scope Logging Macro (Unchanged from Original)
@@ -104,56 +105,77 @@ import Akhanda.Core.Logging;
 
 // These macros skip the ShouldLog check when using spdlog's internal filtering
 // Use these for maximum performance in hot paths
+// A handle whose channel was removed makes them do nothing
 
 #define LOG_DEBUG_FAST(channel, message) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Debug)) { \
-        (channel).Debug(message); \
+    do { if constexpr (AKH_LOG_COMPILED(Debug)) { \
+        if (const auto* akhLogChannel_ = ::Akhanda::Logging::ResolveChannel(channel)) { \
+            akhLogChannel_->Debug(message); \
+        } \
     } } while(0)
 
 #define LOG_INFO_FAST(channel, message) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Info)) { \
-        (channel).Info(message); \
+    do { if constexpr (AKH_LOG_COMPILED(Info)) { \
+        if (const auto* akhLogChannel_ = ::Akhanda::Logging::ResolveChannel(channel)) { \
+            akhLogChannel_->Info(message); \
+        } \
     } } while(0)
 
 #define LOG_WARNING_FAST(channel, message) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Warning)) { \
-        (channel).Warning(message); \
+    do { if constexpr (AKH_LOG_COMPILED(Warning)) { \
+        if (const auto* akhLogChannel_ = ::Akhanda::Logging::ResolveChannel(channel)) { \
+            akhLogChannel_->Warning(message); \
+        } \
     } } while(0)
 
 #define LOG_ERROR_FAST(channel, message) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Error)) { \
-        (channel).Error(message); \
+    do { if constexpr (AKH_LOG_COMPILED(Error)) { \
+        if (const auto* akhLogChannel_ = ::Akhanda::Logging::ResolveChannel(channel)) { \
+            akhLogChannel_->Error(message); \
+        } \
     } } while(0)
 
 #define LOG_FATAL_FAST(channel, message) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Fatal)) { \
-        (channel).Fatal(message); \
+    do { if constexpr (AKH_LOG_COMPILED(Fatal)) { \
+        if (const auto* akhLogChannel_ = ::Akhanda::Logging::ResolveChannel(channel)) { \
+            akhLogChannel_->Fatal(message); \
+        } \
     } } while(0)
 
 // Formatted fast macros
 #define LOG_DEBUG_FORMAT_FAST(channel, fmt, ...) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Debug)) { \
-        (channel).DebugFormat(fmt, __VA_ARGS__); \
+    do { if constexpr (AKH_LOG_COMPILED(Debug)) { \
+        if (const auto* akhLogChannel_ = ::Akhanda::Logging::ResolveChannel(channel)) { \
+            akhLogChannel_->DebugFormat(fmt, __VA_ARGS__); \
+        } \
     } } while(0)
 
 #define LOG_INFO_FORMAT_FAST(channel, fmt, ...) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Info)) { \
-        (channel).InfoFormat(fmt, __VA_ARGS__); \
+    do { if constexpr (AKH_LOG_COMPILED(Info)) { \
+        if (const auto* akhLogChannel_ = ::Akhanda::Logging::ResolveChannel(channel)) { \
+            akhLogChannel_->InfoFormat(fmt, __VA_ARGS__); \
+        } \
     } } while(0)
 
 #define LOG_WARNING_FORMAT_FAST(channel, fmt, ...) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Warning)) { \
-        (channel).WarningFormat(fmt, __VA_ARGS__); \
+    do { if constexpr (AKH_LOG_COMPILED(Warning)) { \
+        if (const auto* akhLogChannel_ = ::Akhanda::Logging::ResolveChannel(channel)) { \
+            akhLogChannel_->WarningFormat(fmt, __VA_ARGS__); \
+        } \
     } } while(0)
 
 #define LOG_ERROR_FORMAT_FAST(channel, fmt, ...) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Error)) { \
-        (channel).ErrorFormat(fmt, __VA_ARGS__); \
+    do { if constexpr (AKH_LOG_COMPILED(Error)) { \
+        if (const auto* akhLogChannel_ = ::Akhanda::Logging::ResolveChannel(channel)) { \
+            akhLogChannel_->ErrorFormat(fmt, __VA_ARGS__); \
+        } \
     } } while(0)
 
 #define LOG_FATAL_FORMAT_FAST(channel, fmt, ...) \
-    do { if constexpr (::Akhanda::Logging::ShouldCompileLog(::Akhanda::Logging::LogLevel::Fatal)) { \
-        (channel).FatalFormat(fmt, __VA_ARGS__); \
+    do { if constexpr (AKH_LOG_COMPILED(Fatal)) { \
+        if (const auto* akhLogChannel_ = ::Akhanda::Logging::ResolveChannel(channel)) { \
+            akhLogChannel_->FatalFormat(fmt, __VA_ARGS__); \
+        } \
     } } while(0)
 
 // =============================================================================
@@ -294,8 +316,16 @@ import Akhanda.Core.Logging;
 // Basic usage (unchanged from your existing code):
 auto& renderChannel = LogManager::Instance().GetChannel("Render");
 LOG_INFO(renderChannel, "Rendering frame");
+
+// Cached channel handles (no name lookup per call):
+static const ChannelHandle streaming = LogManager::Instance().RegisterChannel("Streaming");
+LOG_DEBUG_FORMAT(streaming, "Streamed {} bytes", size);
+LOG_INFO(ChannelHandles::Renderer(), "Swap chain resized");
 LOG_ERROR_FORMAT(renderChannel, "Failed to create texture: {}", filename);
 
+// Silencing one noisy statement at runtime (line 0 silences the whole file):
+LogManager::Instance().SetLogSitesEnabled("Renderer/ShadowPass.cpp", 212, false);
+
 // Scope timing:
 LOG_SCOPE(renderChannel, "RenderFrame");
 
@@ -10,6 +10,18 @@ module;
 #include <string>
 #include <memory>
 #include <functional>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <concepts>
+#include <filesystem>
+#include <span>
+#include <vector>
 
 export module Akhanda.Core.Logging;
 
@@ -23,6 +35,7 @@ export namespace Akhanda::Logging {
     class LogMessage;
     struct LogEntry;
     class ILogSink;
+    class ILogRecordSink;
     class LogManager;
 }
 
@@ -96,6 +109,253 @@ export namespace Akhanda::Logging {
     };
 }
 
+// =============================================================================
+// Deferred Formatting
+// =============================================================================
+
+export namespace Akhanda::Logging {
+    // Argument types a record can be rebuilt from without the program that
+    // wrote it. Integers keep their width so the raw bytes can be walked.
+    enum class LogArgumentKind : uint8_t {
+        Bool, Char,
+        Int8, Int16, Int32, Int64,
+        UInt8, UInt16, UInt32, UInt64,
+        Float, Double,
+        String, Pointer,
+        Opaque          // Needs the writer's formatter (enums, durations, user types)
+    };
+
+    // Formats the raw argument bytes of one record. One instantiation exists
+    // per argument type list, so a record only needs to carry the pointer.
+    using LogRecordFormatter = void(*)(std::string_view format, const std::byte* arguments, std::string& output);
+
+    // Fixed part of a deferred record; the encoded arguments follow it.
+    // Producers fill the call-site fields, LogManager stamps the rest.
+    struct LogRecordHeader {
+        const LogChannel* channel = nullptr;
+        LogRecordFormatter formatter = nullptr;
+        const char* format = nullptr;       // Format string of the call site (static storage)
+        uint32_t formatSize = 0;
+        uint32_t argumentBytes = 0;
+        std::span<const LogArgumentKind> argumentKinds;  // Static storage, one per argument
+        std::source_location location;
+        std::chrono::system_clock::time_point timestamp;
+        std::thread::id threadId;
+        size_t nativeThreadId = 0;
+        LogLevel level = LogLevel::Info;
+        bool structured = false;            // format is an event name; arguments are key/value pairs
+    };
+
+    // What a thread does when its record ring has no room for the next record
+    enum class LogRingPolicy : uint8_t {
+        Block,          // Wait for the backend thread to make room
+        DropAndCount,   // Discard the record and count it in Statistics::messagesDropped
+        Grow            // Continue in a new ring twice the size
+    };
+
+    inline constexpr size_t DEFAULT_LOG_RING_CAPACITY = 256 * 1024;
+
+    // Strings are copied inline (length + bytes)
+    template<typename T>
+    inline constexpr bool IsLogStringArgument =
+        std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> ||
+        std::is_same_v<T, const char*> || std::is_same_v<T, char*>;
+
+    // Other trivially copyable values are copied by value. Pointers and ranges
+    // would refer to memory that may be gone by the time the backend formats
+    // them, so those fall back to formatting on the calling thread.
+    template<typename T>
+    inline constexpr bool IsDeferrableLogArgument = IsLogStringArgument<T> ||
+        std::is_same_v<T, const void*> || std::is_same_v<T, void*> ||
+        (std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> && !std::ranges::range<T>);
+
+    template<typename T>
+    using DecodedLogArgument = std::conditional_t<IsLogStringArgument<T>, std::string_view, T>;
+
+    template<typename T>
+    consteval LogArgumentKind GetLogArgumentKind() noexcept {
+        if constexpr (IsLogStringArgument<T>) return LogArgumentKind::String;
+        else if constexpr (std::is_same_v<T, bool>) return LogArgumentKind::Bool;
+        else if constexpr (std::is_same_v<T, char>) return LogArgumentKind::Char;
+        else if constexpr (std::is_same_v<T, const void*> || std::is_same_v<T, void*>) return LogArgumentKind::Pointer;
+        else if constexpr (std::is_same_v<T, float>) return LogArgumentKind::Float;
+        else if constexpr (std::is_same_v<T, double>) return LogArgumentKind::Double;
+        else if constexpr (std::is_same_v<T, wchar_t> || std::is_same_v<T, char8_t> ||
+            std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>) return LogArgumentKind::Opaque;
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            if constexpr (sizeof(T) == 1) return LogArgumentKind::Int8;
+            else if constexpr (sizeof(T) == 2) return LogArgumentKind::Int16;
+            else if constexpr (sizeof(T) == 4) return LogArgumentKind::Int32;
+            else if constexpr (sizeof(T) == 8) return LogArgumentKind::Int64;
+            else return LogArgumentKind::Opaque;
+        }
+        else if constexpr (std::is_integral_v<T>) {
+            if constexpr (sizeof(T) == 1) return LogArgumentKind::UInt8;
+            else if constexpr (sizeof(T) == 2) return LogArgumentKind::UInt16;
+            else if constexpr (sizeof(T) == 4) return LogArgumentKind::UInt32;
+            else if constexpr (sizeof(T) == 8) return LogArgumentKind::UInt64;
+            else return LogArgumentKind::Opaque;
+        }
+        else return LogArgumentKind::Opaque;
+    }
+
+    // Kinds of a decayed argument list, for LogRecordHeader::argumentKinds
+    template<typename... Args>
+    inline constexpr std::array<LogArgumentKind, sizeof...(Args)> LogArgumentKinds{ GetLogArgumentKind<Args>()... };
+
+    namespace Detail {
+        template<typename T>
+        std::string_view LogStringView(const T& value) noexcept {
+            if constexpr (std::is_pointer_v<T>) {
+                return value ? std::string_view(value) : std::string_view();
+            }
+            else {
+                return std::string_view(value);
+            }
+        }
+
+        template<typename T>
+        size_t EncodedLogArgumentSize(const T& value) noexcept {
+            if constexpr (IsLogStringArgument<T>) {
+                return sizeof(uint32_t) + LogStringView(value).size();
+            }
+            else {
+                return sizeof(T);
+            }
+        }
+
+        template<typename T>
+        std::byte* EncodeLogArgument(std::byte* output, const T& value) noexcept {
+            if constexpr (IsLogStringArgument<T>) {
+                const std::string_view text = LogStringView(value);
+                const uint32_t size = static_cast<uint32_t>(text.size());
+                std::memcpy(output, &size, sizeof(size));
+                std::memcpy(output + sizeof(size), text.data(), size);
+                return output + sizeof(size) + size;
+            }
+            else {
+                std::memcpy(output, std::addressof(value), sizeof(T));
+                return output + sizeof(T);
+            }
+        }
+
+        template<typename T>
+        DecodedLogArgument<T> DecodeLogArgument(const std::byte*& input) noexcept {
+            if constexpr (IsLogStringArgument<T>) {
+                uint32_t size = 0;
+                std::memcpy(&size, input, sizeof(size));
+                const std::string_view text(reinterpret_cast<const char*>(input + sizeof(size)), size);
+                input += sizeof(size) + size;
+                return text;
+            }
+            else {
+                std::array<std::byte, sizeof(T)> bytes;
+                std::memcpy(bytes.data(), input, sizeof(T));
+                input += sizeof(T);
+                return std::bit_cast<T>(bytes);
+            }
+        }
+    }
+
+    // Total encoded size of an argument list
+    template<typename... Args>
+    size_t EncodedLogArgumentsSize(const Args&... args) noexcept {
+        return (size_t(0) + ... + Detail::EncodedLogArgumentSize(args));
+    }
+
+    template<typename... Args>
+    std::byte* EncodeLogArguments(std::byte* output, const Args&... args) noexcept {
+        ((output = Detail::EncodeLogArgument(output, args)), ...);
+        return output;
+    }
+
+    // Appends the formatted message to output; Args are the decayed argument types
+    template<typename... Args>
+    void FormatLogRecord(std::string_view format, const std::byte* arguments, std::string& output) {
+        // Braced initialization decodes the arguments left to right
+        std::tuple<DecodedLogArgument<Args>...> values{ Detail::DecodeLogArgument<Args>(arguments)... };
+        std::apply([&](auto&... decoded) {
+            std::vformat_to(std::back_inserter(output), format, std::make_format_args(decoded...));
+            }, values);
+    }
+}
+
+// =============================================================================
+// Structured Fields
+// =============================================================================
+
+export namespace Akhanda::Logging {
+    // One key/value pair of a structured record. A record encodes each field
+    // as its key (a String argument) followed by the value, so record sinks
+    // walk it with argumentKinds like any other record.
+    template<typename T>
+    struct LogField {
+        std::string_view key;
+        T value;
+    };
+
+    // Values are numbers, bools, chars, strings, untyped pointers and enums
+    // (logged as their underlying value); strings are viewed, not copied
+    template<typename T>
+    constexpr auto Field(std::string_view key, const T& value) noexcept {
+        using Value = std::decay_t<T>;
+        if constexpr (std::is_enum_v<Value>) {
+            return LogField<std::underlying_type_t<Value>>{ key, static_cast<std::underlying_type_t<Value>>(value) };
+        }
+        else {
+            static_assert(GetLogArgumentKind<Value>() != LogArgumentKind::Opaque, "Unsupported log field type");
+            return LogField<DecodedLogArgument<Value>>{ key, value };
+        }
+    }
+
+    // Kinds of a field list, for LogRecordHeader::argumentKinds
+    template<typename... Ts>
+    inline constexpr std::array<LogArgumentKind, 2 * sizeof...(Ts)> LogFieldKinds = [] {
+        std::array<LogArgumentKind, 2 * sizeof...(Ts)> kinds{};
+        [[maybe_unused]] size_t index = 0;
+        ((kinds[index++] = LogArgumentKind::String, kinds[index++] = GetLogArgumentKind<Ts>()), ...);
+        return kinds;
+    }();
+
+    template<typename... Ts>
+    size_t EncodedLogFieldsSize(const LogField<Ts>&... fields) noexcept {
+        return (size_t(0) + ... + (Detail::EncodedLogArgumentSize(fields.key) + Detail::EncodedLogArgumentSize(fields.value)));
+    }
+
+    template<typename... Ts>
+    std::byte* EncodeLogFields(std::byte* output, const LogField<Ts>&... fields) noexcept {
+        ((output = Detail::EncodeLogArgument(Detail::EncodeLogArgument(output, fields.key), fields.value)), ...);
+        return output;
+    }
+
+    namespace Detail {
+        template<typename T>
+        void AppendLogField(const std::byte*& input, std::string& output) {
+            const std::string_view key = DecodeLogArgument<std::string_view>(input);
+            const DecodedLogArgument<T> value = DecodeLogArgument<T>(input);
+            output += ' ';
+            output.append(key);
+            output += '=';
+            if constexpr (IsLogStringArgument<T>) {
+                output += '"';
+                output.append(value);
+                output += '"';
+            }
+            else {
+                std::format_to(std::back_inserter(output), "{}", value);
+            }
+        }
+    }
+
+    // Appends the text form of a structured record: the event name, then
+    // key=value for each field with string values in quotes
+    template<typename... Ts>
+    void FormatLogFields(std::string_view event, const std::byte* arguments, std::string& output) {
+        output.append(event);
+        (Detail::AppendLogField<Ts>(arguments, output), ...);
+    }
+}
+
 // =============================================================================
 // Log Sink Interface (simplified)
 // =============================================================================
@@ -116,6 +376,145 @@ export namespace Akhanda::Logging {
         // Identification
         virtual std::string_view GetName() const = 0;
     };
+
+    // Receives records before they are formatted: the header and the encoded
+    // arguments described by header.argumentKinds. Called on the backend
+    // thread for deferred records and on the logging thread otherwise, so
+    // implementations must be thread-safe. Wide-string messages are not sent.
+    class ILogRecordSink {
+    public:
+        virtual ~ILogRecordSink() = default;
+
+        virtual void WriteRecord(const LogRecordHeader& header, const std::byte* arguments) = 0;
+        virtual void Flush() = 0;
+    };
+}
+
+// =============================================================================
+// Call Sites
+// =============================================================================
+
+export namespace Akhanda::Logging {
+    // A format string plus where it was written. The conversion runs in the
+    // caller, so LogFormat and the *Format helpers record their caller's
+    // location rather than their own.
+    template<typename CharT, typename... Args>
+    struct BasicLogFormatString {
+        template<typename T>
+            requires std::convertible_to<const T&, std::basic_string_view<CharT>>
+        consteval BasicLogFormatString(const T& text, std::source_location where = std::source_location::current())
+            : format(text)
+            , location(where) {
+        }
+
+        BasicLogFormatString(std::basic_format_string<CharT, Args...> text,
+            std::source_location where = std::source_location::current()) noexcept
+            : format(text)
+            , location(where) {
+        }
+
+        std::basic_format_string<CharT, Args...> format;
+        std::source_location location;
+    };
+
+    template<typename... Args>
+    using LogFormatString = BasicLogFormatString<char, std::type_identity_t<Args>...>;
+
+    template<typename... Args>
+    using WLogFormatString = BasicLogFormatString<wchar_t, std::type_identity_t<Args>...>;
+
+    // Name of a structured record plus where it was logged. Names must be
+    // string literals: records point at them rather than copying them.
+    struct LogEventName {
+        template<typename T>
+            requires std::convertible_to<const T&, std::string_view>
+        consteval LogEventName(const T& text, std::source_location where = std::source_location::current())
+            : name(text)
+            , location(where) {
+        }
+
+        std::string_view name;
+        std::source_location location;
+    };
+
+    // How long a pending "Suppressed N messages" line waits for its site to log
+    // again before the backend writes it anyway
+    inline constexpr std::chrono::milliseconds DEFAULT_SUPPRESSION_REPORT_INTERVAL{ 1000 };
+
+    // Token bucket applied to each LOG_* statement on a channel and level:
+    // `burst` messages back to back, then `messagesPerSecond` on average
+    struct LogRateLimit {
+        uint32_t messagesPerSecond = 0;     // 0 turns limiting off
+        uint32_t burst = 1;
+
+        constexpr uint64_t Pack() const noexcept {
+            return messagesPerSecond == 0 ? 0 : (uint64_t(burst == 0 ? 1u : burst) << 32) | messagesPerSecond;
+        }
+
+        static constexpr LogRateLimit Unpack(uint64_t packed) noexcept {
+            return { static_cast<uint32_t>(packed), packed == 0 ? 1u : static_cast<uint32_t>(packed >> 32) };
+        }
+    };
+
+    // Static state of one LOG_* statement. It is constant-initialized, so
+    // checking it is one relaxed load. The first execution registers the site
+    // with LogManager, which can then switch it off by file and line.
+    class LogSite {
+    public:
+        constexpr explicit LogSite(LogLevel level, std::source_location location = std::source_location::current()) noexcept
+            : location_(location)
+            , level_(level) {
+        }
+
+        LogSite(const LogSite&) = delete;
+        LogSite& operator=(const LogSite&) = delete;
+
+        bool IsEnabled() noexcept {
+            const uint8_t state = state_.load(std::memory_order_relaxed);
+            if (state == ENABLED) [[likely]] {
+                return true;
+            }
+            return state == UNREGISTERED ? Register() : state != DISABLED;
+        }
+
+        void SetEnabled(bool enabled) noexcept {
+            state_.store(enabled ? ENABLED : DISABLED, std::memory_order_relaxed);
+        }
+
+        // Whether the channel's rate limit for this level lets the message
+        // through. Without a limit this is one relaxed load; with one it is a
+        // lock-free token bucket on the site. The first message through after
+        // some were dropped is preceded by a "Suppressed N messages" line.
+        bool Admit(const LogChannel& channel);
+
+        // Messages dropped since the last summary
+        uint32_t GetSuppressedCount() const noexcept { return suppressed_.load(std::memory_order_relaxed); }
+
+        const std::source_location& GetLocation() const noexcept { return location_; }
+        LogLevel GetLevel() const noexcept { return level_; }
+
+    private:
+        static constexpr uint8_t UNREGISTERED = 0;
+        static constexpr uint8_t REGISTERING = 1;
+        static constexpr uint8_t ENABLED = 2;
+        static constexpr uint8_t DISABLED = 3;
+
+        bool Register() noexcept;
+        bool AdmitLimited(const LogChannel& channel, uint64_t limit);
+        void ReportSuppressed(const LogChannel& channel, uint32_t count) const;
+
+        std::source_location location_;
+        LogLevel level_;
+        std::atomic<uint8_t> state_{ UNREGISTERED };
+        LogSite* next_ = nullptr;           // Registered sites, guarded by the registry lock
+
+        // Rate limiting, touched only while the channel has a limit
+        std::atomic<int64_t> allowedAt_{ 0 };       // Bucket drained until then (steady clock ns)
+        std::atomic<uint32_t> suppressed_{ 0 };
+        std::atomic<uint32_t> suppressedChannel_{ ~0u };  // Table slot of the channel last dropped on
+
+        friend class LogManager;
+    };
 }
 
 // =============================================================================
@@ -139,11 +538,23 @@ export namespace Akhanda::Logging {
 
         // Formatted logging (unchanged API)
         template<typename... Args>
-        void LogFormat(LogLevel level, std::format_string<Args...> fmt, Args&&... args) const;
+        void LogFormat(LogLevel level, LogFormatString<Args...> fmt, Args&&... args) const;
         template<typename... Args>
-        void LogFormat(LogLevel level, std::wformat_string<Args...> fmt, Args&&... args) const;
+        void LogFormat(LogLevel level, WLogFormatString<Args...> fmt, Args&&... args) const;
+
+        // Structured logging: an event name and typed fields made with Field(),
+        // encoded into the record without building a message. Text sinks get
+        // "event key=value ...", record sinks the fields themselves.
+        template<typename... Ts>
+            requires (sizeof...(Ts) > 0)
+        void Log(LogLevel level, LogEventName event, const LogField<Ts>&... fields) const;
 
         // Convenience methods (unchanged API)
+        void Trace(std::string_view message,
+            const std::source_location& location = std::source_location::current()) const {
+            Log(LogLevel::Trace, message, location);
+        }
+
         void Debug(std::string_view message,
             const std::source_location& location = std::source_location::current()) const {
             Log(LogLevel::Debug, message, location);
@@ -171,27 +582,32 @@ export namespace Akhanda::Logging {
 
         // Formatted convenience methods (unchanged API)
         template<typename... Args>
-        void DebugFormat(std::format_string<Args...> fmt, Args&&... args) const {
+        void TraceFormat(LogFormatString<Args...> fmt, Args&&... args) const {
+            LogFormat(LogLevel::Trace, fmt, std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        void DebugFormat(LogFormatString<Args...> fmt, Args&&... args) const {
             LogFormat(LogLevel::Debug, fmt, std::forward<Args>(args)...);
         }
 
         template<typename... Args>
-        void InfoFormat(std::format_string<Args...> fmt, Args&&... args) const {
+        void InfoFormat(LogFormatString<Args...> fmt, Args&&... args) const {
             LogFormat(LogLevel::Info, fmt, std::forward<Args>(args)...);
         }
 
         template<typename... Args>
-        void WarningFormat(std::format_string<Args...> fmt, Args&&... args) const {
+        void WarningFormat(LogFormatString<Args...> fmt, Args&&... args) const {
             LogFormat(LogLevel::Warning, fmt, std::forward<Args>(args)...);
         }
 
         template<typename... Args>
-        void ErrorFormat(std::format_string<Args...> fmt, Args&&... args) const {
+        void ErrorFormat(LogFormatString<Args...> fmt, Args&&... args) const {
             LogFormat(LogLevel::Error, fmt, std::forward<Args>(args)...);
         }
 
         template<typename... Args>
-        void FatalFormat(std::format_string<Args...> fmt, Args&&... args) const {
+        void FatalFormat(LogFormatString<Args...> fmt, Args&&... args) const {
             LogFormat(LogLevel::Fatal, fmt, std::forward<Args>(args)...);
         }
 
@@ -199,17 +615,36 @@ export namespace Akhanda::Logging {
         void SetLevel(LogLevel level) noexcept;
         LogLevel GetLevel() const noexcept;
 
+        // Limits each LOG_* statement at this level; see LogSite::Admit
+        void SetRateLimit(LogLevel level, LogRateLimit limit) noexcept;
+        LogRateLimit GetRateLimit(LogLevel level) const noexcept;
+
         // Query (unchanged API)
         std::string_view GetName() const noexcept;
-        bool ShouldLog(LogLevel level) const noexcept;
+        bool ShouldLog(LogLevel level) const noexcept {
+            return level >= level_.load(std::memory_order_relaxed);
+        }
 
         // Internal interface for LogManager (public but not intended for general use)
         void AddSink(std::shared_ptr<void> sink);  // Using void* to avoid spdlog dependency in header
         void RemoveSink(void* sink);
 
+        // Delivers a message formatted by the backend thread to this channel's sinks
+        void WriteRecord(const LogRecordHeader& header, std::string_view message) const;
+
+        // Stamps, formats and delivers a record on the calling thread, for
+        // records that do not go through the rings
+        void WriteEncodedRecord(const LogRecordHeader& header, const std::byte* arguments) const;
+
+        // Whether any sink takes messages at this level; the backend skips
+        // formatting records nobody would see as text
+        bool HasSinks(LogLevel level) const;
+
     private:
         std::string name_;
         std::atomic<LogLevel> level_;
+        uint32_t index_;                    // Slot in the channel table, MAX_LOG_CHANNELS if none
+        std::array<std::atomic<uint64_t>, static_cast<size_t>(LogLevel::Count)> rateLimits_{};  // LogRateLimit::Pack
 
         // spdlog logger instance (implementation detail)
         class Impl;
@@ -217,9 +652,78 @@ export namespace Akhanda::Logging {
 
         // Friend declarations for internal access
         friend class LogManager;
+        friend class LogSite;
     };
 }
 
+// =============================================================================
+// Channel Handles
+// =============================================================================
+
+export namespace Akhanda::Logging {
+    inline constexpr uint32_t MAX_LOG_CHANNELS = 256;
+
+    namespace Detail {
+        // Indexed by ChannelHandle. The extra last slot belongs to the invalid
+        // handle and stays empty. Bit n of a mask is set while LogLevel n is
+        // enabled, so zero-initialized slots log nothing.
+        inline std::array<std::atomic<uint8_t>, MAX_LOG_CHANNELS + 1> g_channelLevelMasks{};
+        inline std::array<std::atomic<LogChannel*>, MAX_LOG_CHANNELS + 1> g_channelTable{};
+
+        constexpr uint8_t LevelMask(LogLevel minimum) noexcept {
+            constexpr uint32_t ALL_LEVELS = (1u << static_cast<uint32_t>(LogLevel::Count)) - 1;
+            return static_cast<uint8_t>((ALL_LEVELS << static_cast<uint32_t>(minimum)) & ALL_LEVELS);
+        }
+    }
+
+    // Cached index of a registered channel. Checking a level is one relaxed
+    // load; the handle stays valid if the channel is removed and re-created.
+    struct ChannelHandle {
+        uint32_t index = MAX_LOG_CHANNELS;
+
+        bool IsValid() const noexcept {
+            return index < MAX_LOG_CHANNELS;
+        }
+
+        bool ShouldLog(LogLevel level) const noexcept {
+            return (Detail::g_channelLevelMasks[index].load(std::memory_order_relaxed) >> static_cast<uint32_t>(level)) & 1u;
+        }
+
+        // Only valid while the channel exists, as with LogChannel references
+        LogChannel& Get() const noexcept {
+            return *TryGet();
+        }
+
+        // nullptr for invalid handles and removed channels
+        LogChannel* TryGet() const noexcept {
+            return Detail::g_channelTable[index].load(std::memory_order_acquire);
+        }
+    };
+
+    // Let the LOG_* macros take either a channel or a handle
+    inline bool ShouldLog(const LogChannel& channel, LogLevel level) noexcept {
+        return channel.ShouldLog(level);
+    }
+
+    inline bool ShouldLog(ChannelHandle handle, LogLevel level) noexcept {
+        return handle.ShouldLog(level);
+    }
+
+    // nullptr when a handle's channel is gone, which the macros skip
+    inline const LogChannel* ResolveChannel(const LogChannel& channel) noexcept {
+        return &channel;
+    }
+
+    inline const LogChannel* ResolveChannel(ChannelHandle handle) noexcept {
+        return handle.TryGet();
+    }
+
+    inline bool LogSite::Admit(const LogChannel& channel) {
+        const uint64_t limit = channel.rateLimits_[static_cast<size_t>(level_)].load(std::memory_order_relaxed);
+        return limit == 0 || AdmitLimited(channel, limit);
+    }
+}
+
 // =============================================================================
 // Log Manager (same public API)
 // =============================================================================
@@ -246,11 +750,40 @@ export namespace Akhanda::Logging {
         LogChannel& GetChannel(std::string_view name);
         void RemoveChannel(std::string_view name);
 
+        // Creates the channel if needed and returns its table slot. The first
+        // MAX_LOG_CHANNELS names get one; later ones get an invalid handle
+        // that never logs.
+        ChannelHandle RegisterChannel(std::string_view name);
+
+        // Switches LOG_* statements on or off by call site. `file` matches the
+        // end of the source path; line 0 matches the whole file. Rules also
+        // apply to sites that first run later; the newest matching rule wins.
+        void SetLogSitesEnabled(std::string_view file, uint32_t line, bool enabled);
+        void ForEachLogSite(const std::function<void(LogSite&)>& visitor);
+
+        // Sets the rate limit of one level on every channel, including the
+        // ones created later. Channels can override it with SetRateLimit.
+        void SetRateLimit(LogLevel level, LogRateLimit limit);
+
+        // Logs the pending "Suppressed N messages" line of every site that
+        // dropped messages and has not logged since. Flush calls it too, and
+        // with deferred formatting the backend does every interval.
+        void ReportSuppressedMessages();
+        void SetSuppressionReportInterval(std::chrono::milliseconds interval) noexcept;
+        std::chrono::milliseconds GetSuppressionReportInterval() const noexcept;
+
         // Sink management (unchanged API) 
         void AddSink(std::unique_ptr<ILogSink> sink);
         void RemoveSink(ILogSink* sink);
         void ClearSinks();
 
+        // Sinks that receive records unformatted, such as BinaryLogSink
+        void AddRecordSink(std::unique_ptr<ILogRecordSink> sink);
+        void RemoveRecordSink(ILogRecordSink* sink);
+
+        // Console and debugger output that every channel gets (on by default)
+        void SetDefaultSinksEnabled(bool enabled);
+
         // Global configuration (unchanged API)
         void SetGlobalLevel(LogLevel level);
         LogLevel GetGlobalLevel() const;
@@ -282,6 +815,24 @@ export namespace Akhanda::Logging {
         void SetAsyncMode(bool enabled);
         bool IsAsyncMode() const;
 
+        // Deferred formatting: LogFormat only captures its arguments and the
+        // backend thread formats them. On by default; requires Initialize().
+        void SetDeferredFormatting(bool enabled);
+        bool IsDeferredFormatting() const noexcept;
+
+        // Every logging thread owns a record ring; the backend merges them in
+        // timestamp order. Capacity applies to rings created after the call.
+        void SetRingPolicy(LogRingPolicy policy) noexcept;
+        LogRingPolicy GetRingPolicy() const noexcept;
+        void SetRingCapacity(size_t bytes) noexcept;
+        size_t GetRingCapacity() const noexcept;
+
+        // Internal interface for LogChannel (public but not intended for general use).
+        // BeginRecord returns where argumentBytes of encoded arguments go, or
+        // nullptr when deferred formatting is off; EndRecord publishes the record.
+        std::byte* BeginRecord(const LogRecordHeader& header);
+        void EndRecord();
+
         // Editor integration
         using EditorLogCallback = std::function<void(const LogEntry&)>;
         void SetEditorCallback(EditorLogCallback callback);
@@ -298,6 +849,189 @@ export namespace Akhanda::Logging {
     };
 }
 
+// =============================================================================
+// Binary Log Files
+// =============================================================================
+
+export namespace Akhanda::Logging {
+    struct BinaryLogOptions {
+        bool compress = true;               // LZ4-style compression per block
+        size_t blockSize = 64 * 1024;       // Uncompressed bytes per block
+    };
+
+    // Writes records without formatting them. Format strings, channel and
+    // file names go into a string table once; each record is then a site ID,
+    // a timestamp delta, a thread index and varint-encoded arguments.
+    // Records with Opaque arguments are formatted here and stored as text.
+    // Structured records keep their fields and read back as "event key=value".
+    class BinaryLogSink : public ILogRecordSink {
+    public:
+        explicit BinaryLogSink(const std::filesystem::path& path, const BinaryLogOptions& options = {});
+        ~BinaryLogSink() override;
+
+        BinaryLogSink(const BinaryLogSink&) = delete;
+        BinaryLogSink& operator=(const BinaryLogSink&) = delete;
+
+        bool IsOpen() const noexcept;
+
+        void WriteRecord(const LogRecordHeader& header, const std::byte* arguments) override;
+        void Flush() override;
+
+        // Bytes written to the file so far, including the pending block once flushed
+        uint64_t GetBytesWritten() const noexcept;
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl_;
+    };
+
+    // One decoded record. The views stay valid until the next call to
+    // BinaryLogReader::Next.
+    struct BinaryLogRecord {
+        std::chrono::system_clock::time_point timestamp;
+        LogLevel level = LogLevel::Info;
+        std::string_view channel;
+        std::string_view file;
+        uint32_t line = 0;
+        uint32_t threadIndex = 0;
+        uint64_t nativeThreadId = 0;
+        std::string_view message;
+    };
+
+    // Empty channels match every channel; the time range is inclusive
+    struct BinaryLogFilter {
+        std::chrono::system_clock::time_point from = std::chrono::system_clock::time_point::min();
+        std::chrono::system_clock::time_point to = std::chrono::system_clock::time_point::max();
+        std::vector<std::string> channels;
+        LogLevel minimumLevel = LogLevel::Trace;
+    };
+
+    // Reads a file written by BinaryLogSink and renders the original text.
+    // Records outside the filter are skipped without being formatted.
+    class BinaryLogReader {
+    public:
+        explicit BinaryLogReader(const std::filesystem::path& path, BinaryLogFilter filter = {});
+        ~BinaryLogReader();
+
+        BinaryLogReader(const BinaryLogReader&) = delete;
+        BinaryLogReader& operator=(const BinaryLogReader&) = delete;
+
+        bool IsOpen() const noexcept;
+
+        // False at the end of the file or on corrupt data (see GetError)
+        bool Next(BinaryLogRecord& record);
+
+        std::chrono::system_clock::time_point GetStartTime() const noexcept;
+        std::string_view GetError() const noexcept;
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl_;
+    };
+
+    // "[time] [channel] [level] [file:line] message", as the text sinks write it
+    std::string FormatBinaryLogRecord(const BinaryLogRecord& record);
+
+    namespace Detail {
+        // LZ4 block format. Compress returns the compressed size, or 0 when
+        // the data does not get smaller; Decompress needs the exact raw size.
+        size_t CompressLogBlock(std::span<const std::byte> input, std::vector<std::byte>& output);
+        bool DecompressLogBlock(std::span<const std::byte> input, size_t rawSize, std::vector<std::byte>& output);
+    }
+}
+
+// =============================================================================
+// Crash-Safe Log Ring
+// =============================================================================
+
+export namespace Akhanda::Logging {
+    struct MappedLogOptions {
+        size_t capacity = 4 * 1024 * 1024;  // Ring bytes; the oldest lines are overwritten
+        uint32_t checkpointInterval = 64;   // Lines between header checkpoints
+        bool installCrashHandlers = true;   // Finalize the header on fatal signals
+    };
+
+    enum class MappedLogState : uint32_t {
+        Open,           // Still being written, or the process died without a handler running
+        Closed,         // The sink was destroyed normally
+        Crashed         // A fatal-signal or exception handler finalized the header
+    };
+
+    // Writes formatted lines into a ring inside a memory-mapped file. A line
+    // belongs to the kernel as soon as Write returns, so it survives the
+    // process dying; Flush only starts writeback to disk. Lines still queued
+    // in front of the sink (async loggers, deferred records) are not covered.
+    // The file is recreated on open, so recover a previous run's file first.
+    class MappedLogSink : public ILogSink {
+    public:
+        explicit MappedLogSink(const std::filesystem::path& path, const MappedLogOptions& options = {});
+        ~MappedLogSink() override;
+
+        MappedLogSink(const MappedLogSink&) = delete;
+        MappedLogSink& operator=(const MappedLogSink&) = delete;
+
+        bool IsOpen() const noexcept;
+
+        void Write(const LogEntry& entry) override;
+        void Flush() override;
+        void SetLevel(LogLevel level) override;
+        LogLevel GetLevel() const override;
+        std::string_view GetName() const override;
+
+        // Lines written so far
+        uint64_t GetSequence() const noexcept;
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl_;
+    };
+
+    struct MappedLogRecovery {
+        MappedLogState state = MappedLogState::Open;
+        int crashCode = 0;                  // Signal number or exception code when Crashed
+        std::chrono::system_clock::time_point startTime;
+        uint64_t firstSequence = 0;         // Sequence of entries.front(); earlier lines were overwritten
+        std::vector<std::string> entries;   // Oldest first, without line endings
+        std::string error;                  // Empty when the file was read
+    };
+
+    // Reads every complete line left in a ring file, whether or not the
+    // writer shut down cleanly. A line torn by the crash is dropped.
+    MappedLogRecovery RecoverMappedLog(const std::filesystem::path& path);
+}
+
+// =============================================================================
+// JSON Lines
+// =============================================================================
+
+export namespace Akhanda::Logging {
+    // Writes one JSON object per line for tools to read without parsing text:
+    //
+    //   {"time":<ns since epoch>,"level":"Info","channel":"Renderer","file":"...",
+    //    "line":42,"thread":1234,"event":"FrameEnd","frame":12,"ms":16.6}
+    //
+    // Structured records get "event" and one member per field, keeping the
+    // field's type; other records get "message" with the formatted text.
+    // Writing reuses one buffer, so records do not allocate once it has grown.
+    class JsonLogSink : public ILogRecordSink {
+    public:
+        explicit JsonLogSink(const std::filesystem::path& path);
+        ~JsonLogSink() override;
+
+        JsonLogSink(const JsonLogSink&) = delete;
+        JsonLogSink& operator=(const JsonLogSink&) = delete;
+
+        bool IsOpen() const noexcept;
+
+        void WriteRecord(const LogRecordHeader& header, const std::byte* arguments) override;
+        void Flush() override;
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl_;
+    };
+}
+
 // =============================================================================
 // Scoped Logging Utilities (unchanged API)
 // =============================================================================
@@ -331,26 +1065,89 @@ export namespace Akhanda::Logging {
 
 export namespace Akhanda::Logging {
     template<typename... Args>
-    void LogChannel::LogFormat(LogLevel level, std::format_string<Args...> fmt, Args&&... args) const {
+    void LogChannel::LogFormat(LogLevel level, LogFormatString<Args...> fmt, Args&&... args) const {
 
         // Early exit if this level won't be logged
         if (!ShouldLog(level)) {
             return;
         }
 
+        // Capture the arguments and leave formatting to the backend thread
+        if constexpr ((IsDeferrableLogArgument<std::decay_t<Args>> && ...)) {
+            LogManager& manager = LogManager::Instance();
+            if (manager.IsDeferredFormatting()) {
+                const std::string_view format = fmt.format.get();
+
+                LogRecordHeader header;
+                header.channel = this;
+                header.formatter = &FormatLogRecord<std::decay_t<Args>...>;
+                header.format = format.data();
+                header.formatSize = static_cast<uint32_t>(format.size());
+                header.argumentBytes = static_cast<uint32_t>(EncodedLogArgumentsSize<std::decay_t<Args>...>(args...));
+                header.argumentKinds = LogArgumentKinds<std::decay_t<Args>...>;
+                header.location = fmt.location;
+                header.level = level;
+
+                if (std::byte* arguments = manager.BeginRecord(header)) {
+                    EncodeLogArguments<std::decay_t<Args>...>(arguments, args...);
+                    manager.EndRecord();
+                    return;
+                }
+            }
+        }
+
         try {
             // Use std::format for safe formatting
-            auto formatted = std::format(fmt, std::forward<Args>(args)...);
-            Log(level, formatted, std::source_location::current());
+            auto formatted = std::format(fmt.format, std::forward<Args>(args)...);
+            Log(level, formatted, fmt.location);
         }
         catch (const std::exception&) {
             // Format error - log the error instead
-            Log(LogLevel::Error, "LOG FORMAT ERROR: Invalid format string", std::source_location::current());
+            Log(LogLevel::Error, "LOG FORMAT ERROR: Invalid format string", fmt.location);
         }
     }
     
+    template<typename... Ts>
+        requires (sizeof...(Ts) > 0)
+    void LogChannel::Log(LogLevel level, LogEventName event, const LogField<Ts>&... fields) const {
+        if (!ShouldLog(level)) {
+            return;
+        }
+
+        LogRecordHeader header;
+        header.channel = this;
+        header.formatter = &FormatLogFields<Ts...>;
+        header.format = event.name.data();
+        header.formatSize = static_cast<uint32_t>(event.name.size());
+        header.argumentBytes = static_cast<uint32_t>(EncodedLogFieldsSize(fields...));
+        header.argumentKinds = LogFieldKinds<Ts...>;
+        header.location = event.location;
+        header.level = level;
+        header.structured = true;
+
+        LogManager& manager = LogManager::Instance();
+        if (manager.IsDeferredFormatting()) {
+            if (std::byte* arguments = manager.BeginRecord(header)) {
+                EncodeLogFields(arguments, fields...);
+                manager.EndRecord();
+                return;
+            }
+        }
+
+        // Fields that fit are encoded on the stack
+        std::array<std::byte, 512> local;
+        std::vector<std::byte> large;
+        std::byte* arguments = local.data();
+        if (header.argumentBytes > local.size()) {
+            large.resize(header.argumentBytes);
+            arguments = large.data();
+        }
+        EncodeLogFields(arguments, fields...);
+        WriteEncodedRecord(header, arguments);
+    }
+
     template<typename... Args>
-    void LogChannel::LogFormat(LogLevel level, std::wformat_string<Args...> fmt, Args&&... args) const {
+    void LogChannel::LogFormat(LogLevel level, WLogFormatString<Args...> fmt, Args&&... args) const {
 
         // Early exit if this level won't be logged
         if (!ShouldLog(level)) {
@@ -359,12 +1156,12 @@ export namespace Akhanda::Logging {
 
         try {
             // Use std::format for safe formatting
-            auto formatted = std::format(fmt, std::forward<Args>(args)...);
-            Log(level, formatted, std::source_location::current());
+            auto formatted = std::format(fmt.format, std::forward<Args>(args)...);
+            Log(level, formatted, fmt.location);
         }
         catch (const std::exception&) {
             // Format error - log the error instead
-            Log(LogLevel::Error, "LOG FORMAT ERROR: Invalid format string", std::source_location::current());
+            Log(LogLevel::Error, "LOG FORMAT ERROR: Invalid format string", fmt.location);
         }
     }
 }
@@ -374,16 +1171,36 @@ export namespace Akhanda::Logging {
 // =============================================================================
 
 export namespace Akhanda::Logging {
-    // Predefined engine channels
+    // Predefined engine channels, registered on first use
+    namespace ChannelHandles {
+        inline ChannelHandle Engine() { static const ChannelHandle handle = LogManager::Instance().RegisterChannel("Engine"); return handle; }
+        inline ChannelHandle Renderer() { static const ChannelHandle handle = LogManager::Instance().RegisterChannel("Renderer"); return handle; }
+        inline ChannelHandle Physics() { static const ChannelHandle handle = LogManager::Instance().RegisterChannel("Physics"); return handle; }
+        inline ChannelHandle Audio() { static const ChannelHandle handle = LogManager::Instance().RegisterChannel("Audio"); return handle; }
+        inline ChannelHandle AI() { static const ChannelHandle handle = LogManager::Instance().RegisterChannel("AI"); return handle; }
+        inline ChannelHandle Networking() { static const ChannelHandle handle = LogManager::Instance().RegisterChannel("Networking"); return handle; }
+        inline ChannelHandle Editor() { static const ChannelHandle handle = LogManager::Instance().RegisterChannel("Editor"); return handle; }
+        inline ChannelHandle Game() { static const ChannelHandle handle = LogManager::Instance().RegisterChannel("Game"); return handle; }
+        inline ChannelHandle Plugin() { static const ChannelHandle handle = LogManager::Instance().RegisterChannel("Plugin"); return handle; }
+    }
+
+    namespace Detail {
+        // Falls back to the name lookup if the table was full or the channel removed
+        inline LogChannel& ChannelOrLookup(ChannelHandle handle, std::string_view name) {
+            LogChannel* channel = handle.TryGet();
+            return channel != nullptr ? *channel : LogManager::Instance().GetChannel(name);
+        }
+    }
+
     namespace Channels {
-        inline LogChannel& Engine() { return LogManager::Instance().GetChannel("Engine"); }
-        inline LogChannel& Renderer() { return LogManager::Instance().GetChannel("Renderer"); }
-        inline LogChannel& Physics() { return LogManager::Instance().GetChannel("Physics"); }
-        inline LogChannel& Audio() { return LogManager::Instance().GetChannel("Audio"); }
-        inline LogChannel& AI() { return LogManager::Instance().GetChannel("AI"); }
-        inline LogChannel& Networking() { return LogManager::Instance().GetChannel("Networking"); }
-        inline LogChannel& Editor() { return LogManager::Instance().GetChannel("Editor"); }
-        inline LogChannel& Game() { return LogManager::Instance().GetChannel("Game"); }
-        inline LogChannel& Plugin() { return LogManager::Instance().GetChannel("Plugin"); }
+        inline LogChannel& Engine() { return Detail::ChannelOrLookup(ChannelHandles::Engine(), "Engine"); }
+        inline LogChannel& Renderer() { return Detail::ChannelOrLookup(ChannelHandles::Renderer(), "Renderer"); }
+        inline LogChannel& Physics() { return Detail::ChannelOrLookup(ChannelHandles::Physics(), "Physics"); }
+        inline LogChannel& Audio() { return Detail::ChannelOrLookup(ChannelHandles::Audio(), "Audio"); }
+        inline LogChannel& AI() { return Detail::ChannelOrLookup(ChannelHandles::AI(), "AI"); }
+        inline LogChannel& Networking() { return Detail::ChannelOrLookup(ChannelHandles::Networking(), "Networking"); }
+        inline LogChannel& Editor() { return Detail::ChannelOrLookup(ChannelHandles::Editor(), "Editor"); }
+        inline LogChannel& Game() { return Detail::ChannelOrLookup(ChannelHandles::Game(), "Game"); }
+        inline LogChannel& Plugin() { return Detail::ChannelOrLookup(ChannelHandles::Plugin(), "Plugin"); }
     }
 }
\ No newline at end of file
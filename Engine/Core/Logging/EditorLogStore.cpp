@@ -0,0 +1,350 @@
+// EditorLogStore.cpp - Indexed message store behind the editor log view
+#include "EditorLogStore.hpp"
+#include <algorithm>
+#include <bit>
+#include <functional>
+
+import Akhanda.Core.Logging;
+
+using namespace Akhanda::Logging;
+
+// =============================================================================
+// Building Blocks
+// =============================================================================
+
+uint32_t EditorLogStore::StringPool::Intern(std::string_view text) {
+    if (const auto it = ids_.find(text); it != ids_.end()) {
+        return it->second;
+    }
+    const uint32_t id = static_cast<uint32_t>(strings_.size());
+    const std::string& stored = strings_.emplace_back(text);
+    ids_.emplace(stored, id);
+    return id;
+}
+
+void EditorLogStore::SequenceList::PopFront() {
+    ++head_;
+    // Compact once the dead prefix outweighs the live entries
+    if (head_ >= 64 && head_ * 2 >= sequences_.size()) {
+        sequences_.erase(sequences_.begin(), sequences_.begin() + static_cast<std::ptrdiff_t>(head_));
+        head_ = 0;
+    }
+}
+
+// =============================================================================
+// EditorLogStore
+// =============================================================================
+
+EditorLogStore::EditorLogStore(size_t capacity)
+    : capacity_(std::max<size_t>(capacity, 1))
+    , records_(capacity_) {
+    for (SlotBitmap& bitmap : levelBitmaps_) {
+        bitmap.Resize(capacity_);
+    }
+}
+
+EditorLogStore::AddResult EditorLogStore::Add(const EditorLogMessage& message, bool collapsible) {
+    const uint32_t channel = channels_.Intern(message.channel);
+    if (channel == channelBitmaps_.size()) {
+        channelBitmaps_.emplace_back().Resize(capacity_);
+        channelVisible_.push_back(filter_.channels.empty()
+            || std::find(filter_.channels.begin(), filter_.channels.end(), message.channel) != filter_.channels.end());
+    }
+
+    // A repeat of a stored message only bumps the stored count
+    uint64_t hash = 0;
+    if (collapsible) {
+        hash = HashMessage(channel, message.message);
+        if (const auto it = collapseTable_.find(hash); it != collapseTable_.end()) {
+            Record& existing = records_[SlotOf(it->second)];
+            if (existing.channel == channel && existing.text == message.message) {
+                ++existing.collapseCount;
+                return { existing.sequence, true, Matches(existing) };
+            }
+        }
+    }
+
+    const uint64_t sequence = nextSequence_++;
+    Record& record = records_[SlotOf(sequence)];
+    if (sequence - firstSequence_ >= capacity_) {
+        Evict(record);
+    }
+
+    record.sequence = sequence;
+    record.collapseHash = hash;
+    record.level = message.level;
+    record.collapsible = collapsible;
+    record.isBold = message.isBold;
+    record.isItalic = message.isItalic;
+    record.channel = channel;
+    record.category = names_.Intern(message.category);
+    record.fileName = names_.Intern(message.fileName);
+    record.functionName = names_.Intern(message.functionName);
+    record.lineNumber = message.lineNumber;
+    record.messageId = message.messageId;
+    record.collapseCount = collapsible ? 1 : 0;
+    record.textColor = message.textColor;
+    record.backgroundColor = message.backgroundColor;
+    record.timestamp = message.timestamp;
+    record.threadId = message.threadId;
+    record.formattedTime = message.formattedTime;
+    record.text = message.message;
+    Index(record);
+
+    const bool visible = Matches(record);
+    if (visible) {
+        view_.PushBack(sequence);
+    }
+    return { sequence, false, visible };
+}
+
+void EditorLogStore::Clear() {
+    firstSequence_ = nextSequence_;
+    collapseTable_.clear();
+    for (SlotBitmap& bitmap : levelBitmaps_) {
+        bitmap.Resize(capacity_);
+    }
+    for (SlotBitmap& bitmap : channelBitmaps_) {
+        bitmap.Resize(capacity_);
+    }
+    trigrams_.clear();
+    view_.Clear();
+}
+
+void EditorLogStore::SetCapacity(size_t capacity) {
+    capacity = std::max<size_t>(capacity, 1);
+    if (capacity == capacity_) return;
+
+    // Keep the newest records, then index them again at their new slots
+    std::vector<Record> kept;
+    const uint64_t keepFrom = nextSequence_ - std::min<uint64_t>(GetSize(), capacity);
+    kept.reserve(static_cast<size_t>(nextSequence_ - keepFrom));
+    for (uint64_t sequence = keepFrom; sequence < nextSequence_; ++sequence) {
+        kept.push_back(std::move(records_[SlotOf(sequence)]));
+    }
+
+    capacity_ = capacity;
+    records_.assign(capacity_, Record{});
+    Clear();
+    firstSequence_ = keepFrom;
+
+    for (Record& record : kept) {
+        Record& slot = records_[SlotOf(record.sequence)];
+        slot = std::move(record);
+        Index(slot);
+    }
+    RebuildView();
+}
+
+void EditorLogStore::SetFilter(Filter filter) {
+    const bool narrowsSearch = filter.minLevel == filter_.minLevel && filter.channels == filter_.channels
+        && !filter_.text.empty() && filter.text.find(filter_.text) != std::string::npos;
+    filter_ = std::move(filter);
+
+    channelVisible_.assign(channels_.Size(), filter_.channels.empty());
+    for (const std::string& name : filter_.channels) {
+        for (uint32_t id = 0; id < channels_.Size(); ++id) {
+            if (channels_.Get(id) == name) {
+                channelVisible_[id] = true;
+            }
+        }
+    }
+
+    if (!narrowsSearch) {
+        RebuildView();
+        return;
+    }
+
+    // Typing more of a search can only hide messages that are visible now
+    SequenceList narrowed;
+    for (size_t i = 0; i < view_.Size(); ++i) {
+        if (Matches(records_[SlotOf(view_[i])])) {
+            narrowed.PushBack(view_[i]);
+        }
+    }
+    view_ = std::move(narrowed);
+}
+
+std::vector<EditorLogMessage> EditorLogStore::GetVisible(size_t startIndex, size_t count) const {
+    std::vector<EditorLogMessage> result;
+    if (startIndex >= view_.Size()) {
+        return result;
+    }
+
+    const size_t endIndex = startIndex + std::min(count, view_.Size() - startIndex);
+    result.reserve(endIndex - startIndex);
+    for (size_t i = startIndex; i < endIndex; ++i) {
+        result.push_back(Materialize(records_[SlotOf(view_[i])]));
+    }
+    return result;
+}
+
+std::vector<EditorLogMessage> EditorLogStore::GetAll() const {
+    std::vector<EditorLogMessage> result;
+    result.reserve(GetSize());
+    for (uint64_t sequence = OldestSequence(); sequence < nextSequence_; ++sequence) {
+        result.push_back(Materialize(records_[SlotOf(sequence)]));
+    }
+    return result;
+}
+
+EditorLogMessage EditorLogStore::Get(uint64_t sequence) const {
+    return Contains(sequence) ? Materialize(records_[SlotOf(sequence)]) : EditorLogMessage{};
+}
+
+// =============================================================================
+// Indexes
+// =============================================================================
+
+void EditorLogStore::Index(const Record& record) {
+    const size_t slot = SlotOf(record.sequence);
+    levelBitmaps_[static_cast<size_t>(record.level)].Set(slot);
+    channelBitmaps_[record.channel].Set(slot);
+
+    CollectTrigrams(record.text);
+    for (const uint32_t trigram : trigramScratch_) {
+        trigrams_[trigram].PushBack(record.sequence);
+    }
+
+    if (record.collapsible) {
+        collapseTable_.insert_or_assign(record.collapseHash, record.sequence);
+    }
+}
+
+// The record is always the oldest one stored, so it sits at the front of
+// every list that has it
+void EditorLogStore::Evict(Record& record) {
+    const size_t slot = SlotOf(record.sequence);
+    levelBitmaps_[static_cast<size_t>(record.level)].Reset(slot);
+    channelBitmaps_[record.channel].Reset(slot);
+
+    CollectTrigrams(record.text);
+    for (const uint32_t trigram : trigramScratch_) {
+        const auto it = trigrams_.find(trigram);
+        if (it == trigrams_.end()) continue;
+        if (!it->second.Empty() && it->second.Front() == record.sequence) {
+            it->second.PopFront();
+        }
+        if (it->second.Empty()) {
+            trigrams_.erase(it);
+        }
+    }
+
+    if (record.collapsible) {
+        if (const auto it = collapseTable_.find(record.collapseHash); it != collapseTable_.end() && it->second == record.sequence) {
+            collapseTable_.erase(it);
+        }
+    }
+
+    if (!view_.Empty() && view_.Front() == record.sequence) {
+        view_.PopFront();
+    }
+}
+
+// Distinct trigrams of the text, sorted, into trigramScratch_
+void EditorLogStore::CollectTrigrams(std::string_view text) {
+    trigramScratch_.clear();
+    for (size_t i = 0; i + 3 <= text.size(); ++i) {
+        trigramScratch_.push_back((uint32_t(uint8_t(text[i])) << 16) | (uint32_t(uint8_t(text[i + 1])) << 8) | uint8_t(text[i + 2]));
+    }
+    std::sort(trigramScratch_.begin(), trigramScratch_.end());
+    trigramScratch_.erase(std::unique(trigramScratch_.begin(), trigramScratch_.end()), trigramScratch_.end());
+}
+
+bool EditorLogStore::Matches(const Record& record) const {
+    return record.level >= filter_.minLevel
+        && channelVisible_[record.channel]
+        && (filter_.text.empty() || record.text.find(filter_.text) != std::string::npos);
+}
+
+void EditorLogStore::RebuildView() {
+    view_.Clear();
+    if (GetSize() == 0) return;
+
+    // Searches of three or more characters only look at the messages in the
+    // shortest posting list of the search's trigrams
+    if (filter_.text.size() >= 3) {
+        CollectTrigrams(filter_.text);
+        const SequenceList* shortest = nullptr;
+        for (const uint32_t trigram : trigramScratch_) {
+            const auto it = trigrams_.find(trigram);
+            if (it == trigrams_.end()) return;
+            if (!shortest || it->second.Size() < shortest->Size()) {
+                shortest = &it->second;
+            }
+        }
+        for (size_t i = 0; i < shortest->Size(); ++i) {
+            const uint64_t sequence = (*shortest)[i];
+            if (Matches(records_[SlotOf(sequence)])) {
+                view_.PushBack(sequence);
+            }
+        }
+        return;
+    }
+
+    // Otherwise combine the level and channel bitmaps a word at a time
+    const size_t wordCount = levelBitmaps_[0].Words().size();
+    std::vector<uint64_t> mask(wordCount, 0);
+    for (size_t level = static_cast<size_t>(filter_.minLevel); level < levelBitmaps_.size(); ++level) {
+        const std::vector<uint64_t>& words = levelBitmaps_[level].Words();
+        for (size_t w = 0; w < wordCount; ++w) mask[w] |= words[w];
+    }
+    if (!filter_.channels.empty()) {
+        std::vector<uint64_t> channelMask(wordCount, 0);
+        for (uint32_t channel = 0; channel < channelBitmaps_.size(); ++channel) {
+            if (!channelVisible_[channel]) continue;
+            const std::vector<uint64_t>& words = channelBitmaps_[channel].Words();
+            for (size_t w = 0; w < wordCount; ++w) channelMask[w] |= words[w];
+        }
+        for (size_t w = 0; w < wordCount; ++w) mask[w] &= channelMask[w];
+    }
+
+    // Slots in sequence order: from the oldest slot to the end, then wrapped
+    const uint64_t oldest = OldestSequence();
+    const size_t oldestSlot = SlotOf(oldest);
+    const auto visit = [&](size_t begin, size_t end, uint64_t firstSequence) {
+        for (size_t w = begin / 64; w * 64 < end; ++w) {
+            uint64_t bits = mask[w];
+            while (bits) {
+                const size_t slot = w * 64 + static_cast<size_t>(std::countr_zero(bits));
+                bits &= bits - 1;
+                if (slot < begin || slot >= end) continue;
+                const Record& record = records_[slot];
+                if (filter_.text.empty() || record.text.find(filter_.text) != std::string::npos) {
+                    view_.PushBack(firstSequence + (slot - begin));
+                }
+            }
+        }
+    };
+    const size_t stored = GetSize();
+    const size_t firstRun = std::min(stored, capacity_ - oldestSlot);
+    visit(oldestSlot, oldestSlot + firstRun, oldest);
+    visit(0, stored - firstRun, oldest + firstRun);
+}
+
+EditorLogMessage EditorLogStore::Materialize(const Record& record) const {
+    EditorLogMessage message;
+    message.level = record.level;
+    message.channel = channels_.Get(record.channel);
+    message.message = record.text;
+    message.formattedTime = record.formattedTime;
+    message.timestamp = record.timestamp;
+    message.threadId = record.threadId;
+    message.messageId = record.messageId;
+    message.category = names_.Get(record.category);
+    message.isCollapsible = record.collapsible;
+    message.collapseCount = record.collapseCount;
+    message.fileName = names_.Get(record.fileName);
+    message.functionName = names_.Get(record.functionName);
+    message.lineNumber = record.lineNumber;
+    message.textColor = record.textColor;
+    message.backgroundColor = record.backgroundColor;
+    message.isBold = record.isBold;
+    message.isItalic = record.isItalic;
+    return message;
+}
+
+uint64_t EditorLogStore::HashMessage(uint32_t channel, std::string_view text) const noexcept {
+    const uint64_t hash = std::hash<std::string_view>{}(text);
+    return hash ^ (uint64_t(channel) + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2));
+}
@@ -0,0 +1,176 @@
+// EditorLogStore.hpp - Indexed message store behind the editor log view
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "EditorSink.hpp"
+
+import Akhanda.Core.Logging;
+
+namespace Akhanda::Logging {
+
+    // =============================================================================
+    // Editor Log Store
+    // =============================================================================
+    //
+    // A fixed number of slots reused as a ring; the newest message overwrites
+    // the oldest. Channel, category and source names are interned, so a slot
+    // only owns its text. Every slot is indexed when written and unindexed
+    // when overwritten:
+    //
+    //   - collapse table: hash of channel and text -> the slot that repeats count on
+    //   - level and channel bitmaps: one bit per slot
+    //   - trigram postings: sequences of the messages containing each trigram
+    //
+    // The filtered view is a list of visible sequences, appended to and trimmed
+    // as messages come and go. Changing the filter rebuilds it from the indexes
+    // (or from the current view when a search only gets longer).
+    //
+    // Not thread-safe; AdvancedEditorSink guards it with its message lock.
+
+    class EditorLogStore {
+    public:
+        struct Filter {
+            LogLevel minLevel = LogLevel::Trace;
+            std::vector<std::string> channels;  // Empty shows every channel
+            std::string text;                   // Case-sensitive substring
+        };
+
+        explicit EditorLogStore(size_t capacity);
+
+        // Stores a message, or counts it against the live copy when it is
+        // collapsible and the same channel and text are still stored
+        struct AddResult {
+            uint64_t sequence = 0;
+            bool collapsed = false;
+            bool visible = false;
+        };
+        AddResult Add(const EditorLogMessage& message, bool collapsible);
+
+        void Clear();
+
+        // Keeps the newest messages that still fit
+        void SetCapacity(size_t capacity);
+        size_t GetCapacity() const noexcept { return capacity_; }
+
+        // Messages stored, visible or not
+        size_t GetSize() const noexcept { return static_cast<size_t>(nextSequence_ - OldestSequence()); }
+
+        void SetFilter(Filter filter);
+        const Filter& GetFilter() const noexcept { return filter_; }
+
+        // The filtered view, oldest first
+        size_t GetVisibleCount() const noexcept { return view_.Size(); }
+        std::vector<EditorLogMessage> GetVisible(size_t startIndex, size_t count) const;
+
+        // Every stored message, oldest first
+        std::vector<EditorLogMessage> GetAll() const;
+
+        bool Contains(uint64_t sequence) const noexcept {
+            return sequence >= OldestSequence() && sequence < nextSequence_;
+        }
+        EditorLogMessage Get(uint64_t sequence) const;
+
+    private:
+        struct Record {
+            uint64_t sequence = 0;
+            uint64_t collapseHash = 0;
+            LogLevel level = LogLevel::Info;
+            bool collapsible = false;
+            bool isBold = false;
+            bool isItalic = false;
+            uint32_t channel = 0;
+            uint32_t category = 0;
+            uint32_t fileName = 0;
+            uint32_t functionName = 0;
+            uint32_t lineNumber = 0;
+            uint32_t messageId = 0;
+            uint32_t collapseCount = 0;
+            uint32_t textColor = 0;
+            uint32_t backgroundColor = 0;
+            std::chrono::high_resolution_clock::time_point timestamp;
+            std::thread::id threadId;
+            std::string formattedTime;
+            std::string text;
+        };
+
+        // Interned strings; IDs are dense and never reused
+        class StringPool {
+        public:
+            uint32_t Intern(std::string_view text);
+            const std::string& Get(uint32_t id) const { return strings_[id]; }
+            size_t Size() const noexcept { return strings_.size(); }
+
+        private:
+            std::deque<std::string> strings_;   // Stable addresses for the views in ids_
+            std::unordered_map<std::string_view, uint32_t> ids_;
+        };
+
+        class SlotBitmap {
+        public:
+            void Resize(size_t bits) { words_.assign((bits + 63) / 64, 0); }
+            void Set(size_t bit) noexcept { words_[bit / 64] |= uint64_t(1) << (bit % 64); }
+            void Reset(size_t bit) noexcept { words_[bit / 64] &= ~(uint64_t(1) << (bit % 64)); }
+            bool Test(size_t bit) const noexcept { return (words_[bit / 64] >> (bit % 64)) & 1; }
+            const std::vector<uint64_t>& Words() const noexcept { return words_; }
+
+        private:
+            std::vector<uint64_t> words_;
+        };
+
+        // Ascending sequences, trimmed from the front as messages are overwritten
+        class SequenceList {
+        public:
+            void PushBack(uint64_t sequence) { sequences_.push_back(sequence); }
+            void PopFront();
+            uint64_t Front() const noexcept { return sequences_[head_]; }
+            uint64_t operator[](size_t index) const noexcept { return sequences_[head_ + index]; }
+            size_t Size() const noexcept { return sequences_.size() - head_; }
+            bool Empty() const noexcept { return Size() == 0; }
+            void Clear() noexcept { sequences_.clear(); head_ = 0; }
+
+        private:
+            std::vector<uint64_t> sequences_;
+            size_t head_ = 0;
+        };
+
+        uint64_t OldestSequence() const noexcept {
+            return nextSequence_ - firstSequence_ > capacity_ ? nextSequence_ - capacity_ : firstSequence_;
+        }
+        size_t SlotOf(uint64_t sequence) const noexcept { return static_cast<size_t>(sequence % capacity_); }
+
+        void Evict(Record& record);
+        void Index(const Record& record);
+        void CollectTrigrams(std::string_view text);
+        bool Matches(const Record& record) const;
+        void RebuildView();
+        EditorLogMessage Materialize(const Record& record) const;
+        uint64_t HashMessage(uint32_t channel, std::string_view text) const noexcept;
+
+        size_t capacity_;
+        uint64_t firstSequence_ = 0;      // Sequences before this were cleared
+        uint64_t nextSequence_ = 0;
+        std::vector<Record> records_;
+
+        StringPool channels_;
+        StringPool names_;                // Categories and source locations
+
+        std::unordered_map<uint64_t, uint64_t> collapseTable_;
+        std::array<SlotBitmap, static_cast<size_t>(LogLevel::Count)> levelBitmaps_;
+        std::vector<SlotBitmap> channelBitmaps_;
+        std::unordered_map<uint32_t, SequenceList> trigrams_;
+        std::vector<uint32_t> trigramScratch_;
+
+        Filter filter_;
+        std::vector<bool> channelVisible_;  // Per channel ID, from filter_.channels
+        SequenceList view_;
+    };
+}
@@ -1,5 +1,6 @@
 // EditorSink.cpp - Editor Integration Implementation
 #include "Engine/Core/Logging/EditorSink.hpp"
+#include "Engine/Core/Logging/EditorLogStore.hpp"
 #include <algorithm>
 #include <chrono>
 #include <fstream>
@@ -31,10 +32,13 @@ class AdvancedEditorSink::Impl {
 public:
     explicit Impl(const AdvancedEditorSink::Config& config)
         : config_(config)
+        , store_(config.maxMessages)
         , nextMessageId_(1)
         , running_(true) {
 
-        messages_.reserve(config_.maxMessages);
+        EditorLogStore::Filter filter;
+        filter.minLevel = LogLevel::Debug;
+        store_.SetFilter(std::move(filter));
 
         if (config_.asyncProcessing) {
             // Start async processing thread
@@ -55,12 +59,8 @@ public:
         }
     }
 
+    // Everything is stored; the filters only decide what the view shows
     void ProcessMessage(const LogEntry& entry) {
-        if (!ShouldProcessMessage(entry)) {
-            stats_.filteredMessages.fetch_add(1, std::memory_order_relaxed);
-            return;
-        }
-
         auto editorMessage = CreateEditorMessage(entry);
 
         if (config_.asyncProcessing) {
@@ -94,8 +94,7 @@ public:
 
     void Clear() {
         std::lock_guard<std::shared_mutex> lock(messagesMutex_);
-        messages_.clear();
-        collapsedMessages_.clear();
+        store_.Clear();
         NotifyEvent(EditorLogEvent::LogCleared);
     }
 
@@ -103,70 +102,47 @@ public:
         std::lock_guard<std::shared_mutex> lock(configMutex_);
         config_.maxMessages = maxMessages;
 
-        // Trim if necessary
+        // Keeps the newest messages
         std::lock_guard<std::shared_mutex> msgLock(messagesMutex_);
-        if (messages_.size() > maxMessages) {
-            size_t toRemove = messages_.size() - maxMessages;
-            messages_.erase(messages_.begin(), messages_.begin() + toRemove);
-        }
+        store_.SetCapacity(maxMessages);
     }
 
+    // Counts and indices refer to the filtered view
     size_t GetMessageCount() const {
         std::shared_lock<std::shared_mutex> lock(messagesMutex_);
-        return messages_.size();
+        return store_.GetVisibleCount();
     }
 
     std::vector<EditorLogMessage> GetMessages(size_t startIndex, size_t count) const {
         std::shared_lock<std::shared_mutex> lock(messagesMutex_);
-
-        if (startIndex >= messages_.size()) {
-            return {};
-        }
-
-        size_t endIndex = std::min(startIndex + count, messages_.size());
-        return std::vector<EditorLogMessage>(messages_.begin() + startIndex, messages_.begin() + endIndex);
+        return store_.GetVisible(startIndex, count);
     }
 
     std::vector<EditorLogMessage> GetMessagesInRange(
         std::chrono::high_resolution_clock::time_point start,
         std::chrono::high_resolution_clock::time_point end) const {
 
-        std::shared_lock<std::shared_mutex> lock(messagesMutex_);
-        std::vector<EditorLogMessage> result;
-
-        for (const auto& msg : messages_) {
-            if (msg.timestamp >= start && msg.timestamp <= end) {
-                result.push_back(msg);
-            }
-        }
-
+        std::vector<EditorLogMessage> result = GetAllMessages();
+        std::erase_if(result, [&](const EditorLogMessage& msg) {
+            return msg.timestamp < start || msg.timestamp > end;
+        });
         return result;
     }
 
     void SetLevelFilter(LogLevel minLevel) {
-        std::lock_guard<std::shared_mutex> lock(configMutex_);
-        levelFilter_ = minLevel;
-        NotifyEvent(EditorLogEvent::FilterChanged);
+        UpdateFilter([&](EditorLogStore::Filter& filter) { filter.minLevel = minLevel; });
     }
 
     void SetChannelFilter(const std::vector<std::string>& allowedChannels) {
-        std::lock_guard<std::shared_mutex> lock(configMutex_);
-        channelFilter_ = allowedChannels;
-        NotifyEvent(EditorLogEvent::FilterChanged);
+        UpdateFilter([&](EditorLogStore::Filter& filter) { filter.channels = allowedChannels; });
     }
 
     void SetTextFilter(const std::string& searchText) {
-        std::lock_guard<std::shared_mutex> lock(configMutex_);
-        textFilter_ = searchText;
-        NotifyEvent(EditorLogEvent::FilterChanged);
+        UpdateFilter([&](EditorLogStore::Filter& filter) { filter.text = searchText; });
     }
 
     void ClearFilters() {
-        std::lock_guard<std::shared_mutex> lock(configMutex_);
-        levelFilter_ = LogLevel::Debug;
-        channelFilter_.clear();
-        textFilter_.clear();
-        NotifyEvent(EditorLogEvent::FilterChanged);
+        UpdateFilter([](EditorLogStore::Filter& filter) { filter = EditorLogStore::Filter{ LogLevel::Debug }; });
     }
 
     bool ExportToFile(const std::string& filename, const std::vector<EditorLogMessage>& messages) const {
@@ -243,31 +219,16 @@ public:
     }
 
 private:
-    bool ShouldProcessMessage(const LogEntry& entry) const {
-        std::shared_lock<std::shared_mutex> lock(configMutex_);
-
-        // Level filter
-        if (entry.level < levelFilter_) {
-            return false;
+    template<typename Change>
+    void UpdateFilter(Change&& change) {
+        {
+            std::lock_guard<std::shared_mutex> lock(messagesMutex_);
+            EditorLogStore::Filter filter = store_.GetFilter();
+            change(filter);
+            store_.SetFilter(std::move(filter));
+            stats_.filteredMessages.store(store_.GetSize() - store_.GetVisibleCount(), std::memory_order_relaxed);
         }
-
-        // Channel filter
-        if (!channelFilter_.empty()) {
-            bool channelAllowed = std::find(channelFilter_.begin(), channelFilter_.end(),
-                entry.channel) != channelFilter_.end();
-            if (!channelAllowed) {
-                return false;
-            }
-        }
-
-        // Text filter
-        if (!textFilter_.empty()) {
-            if (entry.message.find(textFilter_) == std::string::npos) {
-                return false;
-            }
-        }
-
-        return true;
+        NotifyEvent(EditorLogEvent::FilterChanged);
     }
 
     EditorLogMessage CreateEditorMessage(const LogEntry& entry) {
@@ -333,32 +294,22 @@ private:
         bool shouldCollapse = config_.enableCollapsing && ShouldCollapseMessage(msg);
 
         std::lock_guard<std::shared_mutex> lock(messagesMutex_);
+        const EditorLogStore::AddResult result = store_.Add(msg, shouldCollapse);
 
-        if (shouldCollapse) {
-            // Try to find similar message to collapse
-            auto it = collapsedMessages_.find(GenerateCollapseKey(msg));
-            if (it != collapsedMessages_.end()) {
-                it->second.collapseCount++;
-                stats_.collapsedMessages.fetch_add(1, std::memory_order_relaxed);
-                NotifyEvent(EditorLogEvent::MessageCollapsed, &it->second);
-                return;
-            }
-            else {
-                msg.isCollapsible = true;
-                msg.collapseCount = 1;
-                collapsedMessages_[GenerateCollapseKey(msg)] = msg;
+        if (result.collapsed) {
+            stats_.collapsedMessages.fetch_add(1, std::memory_order_relaxed);
+        }
+        else {
+            stats_.totalMessages.fetch_add(1, std::memory_order_relaxed);
+            if (!result.visible) {
+                stats_.filteredMessages.fetch_add(1, std::memory_order_relaxed);
             }
         }
 
-        // Add to message store
-        if (messages_.size() >= config_.maxMessages) {
-            messages_.erase(messages_.begin());
+        // Only changes to the view are worth an editor refresh
+        if (result.visible) {
+            NotifyStoredEvent(result.collapsed ? EditorLogEvent::MessageCollapsed : EditorLogEvent::MessageAdded, result.sequence);
         }
-
-        messages_.push_back(msg);
-        stats_.totalMessages.fetch_add(1, std::memory_order_relaxed);
-
-        NotifyEvent(EditorLogEvent::MessageAdded, &msg);
     }
 
     bool ShouldCollapseMessage(const EditorLogMessage& msg) {
@@ -371,10 +322,6 @@ private:
         return msg.level == LogLevel::Debug || msg.level == LogLevel::Info;
     }
 
-    std::string GenerateCollapseKey(const EditorLogMessage& msg) {
-        return msg.channel + "|" + msg.message;
-    }
-
     void ProcessingLoop() {
         std::vector<EditorLogMessage> batch;
         batch.reserve(100);
@@ -412,24 +359,27 @@ private:
         }
     }
 
+    // Materializes the stored copy only when someone is listening
+    void NotifyStoredEvent(EditorLogEvent event, uint64_t sequence) {
+        std::shared_lock<std::shared_mutex> lock(callbackMutex_);
+        if (eventCallback_) {
+            const EditorLogMessage message = store_.Get(sequence);
+            eventCallback_(event, &message);
+        }
+    }
+
     std::vector<EditorLogMessage> GetAllMessages() const {
         std::shared_lock<std::shared_mutex> lock(messagesMutex_);
-        return messages_;
+        return store_.GetVisible(0, SIZE_MAX);
     }
 
     // Configuration and state
     mutable std::shared_mutex configMutex_;
     AdvancedEditorSink::Config config_;
 
-    // Filtering
-    LogLevel levelFilter_ = LogLevel::Debug;
-    std::vector<std::string> channelFilter_;
-    std::string textFilter_;
-
-    // Message storage
+    // Message storage and the filtered view
     mutable std::shared_mutex messagesMutex_;
-    std::vector<EditorLogMessage> messages_;
-    std::unordered_map<std::string, EditorLogMessage> collapsedMessages_;
+    EditorLogStore store_;
     std::atomic<uint32_t> nextMessageId_;
 
     // Async processing
@@ -583,7 +533,7 @@ void EditorLogIntegration::Shutdown() {
 // Utility Functions Implementation
 // =============================================================================
 
-std::string FormatMessageForEditor(const EditorLogMessage& message, bool includeTimestamp) {
+std::string Akhanda::Logging::FormatMessageForEditor(const EditorLogMessage& message, bool includeTimestamp) {
     std::ostringstream oss;
 
     if (includeTimestamp) {
@@ -605,7 +555,7 @@ std::string FormatMessageForEditor(const EditorLogMessage& message, bool include
     return oss.str();
 }
 
-uint32_t GetLevelColor(LogLevel level) {
+uint32_t Akhanda::Logging::GetLevelColor(LogLevel level) {
     switch (level) {
     case LogLevel::Debug:   return 0xFF808080;  // Gray
     case LogLevel::Info:    return 0xFFFFFFFF;  // White
@@ -616,7 +566,7 @@ uint32_t GetLevelColor(LogLevel level) {
     }
 }
 
-std::string DetectMessageCategory(const std::string& message, const std::string& channel) {
+std::string Akhanda::Logging::DetectMessageCategory(const std::string& message, const std::string& channel) {
     // Simple pattern matching for categorization
     std::string lowerMessage = message;
     std::transform(message.begin(), message.end(), lowerMessage.begin(), ::tolower);
@@ -662,7 +612,7 @@ std::string DetectMessageCategory(const std::string& message, const std::string&
     return "General";
 }
 
-std::string FormatMessageAsHTML(const EditorLogMessage& message) {
+std::string Akhanda::Logging::FormatMessageAsHTML(const EditorLogMessage& message) {
     std::ostringstream oss;
 
     oss << "<div class=\"log-message log-" << ToString(message.level) << "\">";
@@ -680,7 +630,7 @@ std::string FormatMessageAsHTML(const EditorLogMessage& message) {
     return oss.str();
 }
 
-std::string FormatMessageAsJSON(const EditorLogMessage& message) {
+std::string Akhanda::Logging::FormatMessageAsJSON(const EditorLogMessage& message) {
     std::ostringstream oss;
 
     oss << "{"
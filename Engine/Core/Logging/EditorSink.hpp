@@ -124,13 +124,13 @@ namespace Akhanda::Logging {
         void SetMaxMessages(size_t maxMessages);
         size_t GetMessageCount() const;
 
-        // Message retrieval
+        // Message retrieval; counts and indices refer to the filtered view
         std::vector<EditorLogMessage> GetMessages(size_t startIndex = 0, size_t count = SIZE_MAX) const;
         std::vector<EditorLogMessage> GetMessagesInRange(
             std::chrono::high_resolution_clock::time_point start,
             std::chrono::high_resolution_clock::time_point end) const;
 
-        // Filtering
+        // Filtering decides what the view shows; every message is stored
         void SetLevelFilter(LogLevel minLevel);
         void SetChannelFilter(const std::vector<std::string>& allowedChannels);
         void SetTextFilter(const std::string& searchText);
@@ -0,0 +1,440 @@
+// Core.Math.AABBTree.cpp - Dynamic AABB tree (incremental bounding volume hierarchy)
+module;
+
+#include <cassert>
+
+module Akhanda.Core.Math;
+
+import <algorithm>;
+
+using namespace Akhanda::Math;
+
+// =============================================================================
+// Private Helpers
+// =============================================================================
+#pragma region Helpers
+
+namespace {
+
+    // Surface area heuristic cost of a box
+    inline float Area(const AABB& bounds) noexcept {
+        const Vector3 d = bounds.max - bounds.min;
+        return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+    }
+
+    inline bool ContainsBox(const AABB& outer, const AABB& inner) noexcept {
+        return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+            inner.max.x <= outer.max.x && inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+    }
+
+}
+
+#pragma endregion
+
+// =============================================================================
+// DynamicAABBTree Implementation
+// =============================================================================
+#pragma region DynamicAABBTree
+
+DynamicAABBTree::DynamicAABBTree(float fatMargin, float displacementMultiplier) noexcept
+    : fatMargin_(fatMargin)
+    , displacementMultiplier_(displacementMultiplier) {
+}
+
+int32_t DynamicAABBTree::CreateProxy(const AABB& bounds, uint32_t userData) noexcept {
+    const int32_t proxyId = AllocateNode();
+    Node& node = nodes_[proxyId];
+    node.bounds = FattenBounds(bounds, Vector3::ZERO);
+    node.userData = userData;
+    node.height = 0;
+
+    InsertLeaf(proxyId);
+    ++proxyCount_;
+    return proxyId;
+}
+
+void DynamicAABBTree::DestroyProxy(int32_t proxyId) noexcept {
+    assert(proxyId >= 0 && static_cast<size_t>(proxyId) < nodes_.size() && nodes_[proxyId].IsLeaf());
+
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    --proxyCount_;
+}
+
+bool DynamicAABBTree::MoveProxy(int32_t proxyId, const AABB& bounds, const Vector3& displacement) noexcept {
+    assert(proxyId >= 0 && static_cast<size_t>(proxyId) < nodes_.size() && nodes_[proxyId].IsLeaf());
+
+    if (ContainsBox(nodes_[proxyId].bounds, bounds)) {
+        return false;
+    }
+
+    RemoveLeaf(proxyId);
+    nodes_[proxyId].bounds = FattenBounds(bounds, displacement);
+    InsertLeaf(proxyId);
+    return true;
+}
+
+void DynamicAABBTree::Clear() noexcept {
+    nodes_.clear();
+    root_ = NULL_NODE;
+    freeList_ = NULL_NODE;
+    proxyCount_ = 0;
+}
+
+float DynamicAABBTree::GetAreaRatio() const noexcept {
+    if (root_ == NULL_NODE) {
+        return 0.0f;
+    }
+
+    const float rootArea = Area(nodes_[root_].bounds);
+    if (rootArea <= 0.0f) {
+        return 0.0f;
+    }
+
+    float totalArea = 0.0f;
+    for (const Node& node : nodes_) {
+        if (node.height > 0) {
+            totalArea += Area(node.bounds);
+        }
+    }
+    return totalArea / rootArea;
+}
+
+bool DynamicAABBTree::Validate() const noexcept {
+    size_t freeCount = 0;
+    for (int32_t freeIndex = freeList_; freeIndex != NULL_NODE; freeIndex = nodes_[freeIndex].parent) {
+        if (nodes_[freeIndex].height != -1 || ++freeCount > nodes_.size()) {
+            return false;
+        }
+    }
+
+    if (root_ == NULL_NODE) {
+        return proxyCount_ == 0 && freeCount == nodes_.size();
+    }
+    if (nodes_[root_].parent != NULL_NODE) {
+        return false;
+    }
+
+    size_t leafCount = 0;
+    size_t visited = 0;
+    TraversalStack<int32_t> stack;
+    stack.Push(root_);
+    while (!stack.Empty()) {
+        const int32_t nodeId = stack.Pop();
+        const Node& node = nodes_[nodeId];
+        ++visited;
+
+        if (node.IsLeaf()) {
+            if (node.child2 != NULL_NODE || node.height != 0) {
+                return false;
+            }
+            ++leafCount;
+            continue;
+        }
+
+        const Node& child1 = nodes_[node.child1];
+        const Node& child2 = nodes_[node.child2];
+        if (child1.parent != nodeId || child2.parent != nodeId) {
+            return false;
+        }
+        if (node.height != 1 + std::max(child1.height, child2.height)) {
+            return false;
+        }
+        if (!ContainsBox(node.bounds, child1.bounds) || !ContainsBox(node.bounds, child2.bounds)) {
+            return false;
+        }
+
+        stack.Push(node.child1);
+        stack.Push(node.child2);
+    }
+
+    return leafCount == proxyCount_ && visited + freeCount == nodes_.size();
+}
+
+int32_t DynamicAABBTree::AllocateNode() noexcept {
+    int32_t nodeId;
+    if (freeList_ != NULL_NODE) {
+        nodeId = freeList_;
+        freeList_ = nodes_[nodeId].parent;
+    }
+    else {
+        nodeId = static_cast<int32_t>(nodes_.size());
+        nodes_.emplace_back();
+    }
+
+    Node& node = nodes_[nodeId];
+    node.parent = NULL_NODE;
+    node.child1 = NULL_NODE;
+    node.child2 = NULL_NODE;
+    node.height = 0;
+    node.userData = 0;
+    return nodeId;
+}
+
+void DynamicAABBTree::FreeNode(int32_t nodeId) noexcept {
+    Node& node = nodes_[nodeId];
+    node.parent = freeList_;
+    node.height = -1;
+    freeList_ = nodeId;
+}
+
+AABB DynamicAABBTree::FattenBounds(const AABB& bounds, const Vector3& displacement) const noexcept {
+    AABB fat(bounds.min - Vector3(fatMargin_), bounds.max + Vector3(fatMargin_));
+
+    // Extend along the direction of travel so steady motion reinserts less often
+    const Vector3 predicted = displacement * displacementMultiplier_;
+    for (size_t axis = 0; axis < 3; ++axis) {
+        if (predicted[axis] < 0.0f) {
+            fat.min[axis] += predicted[axis];
+        }
+        else {
+            fat.max[axis] += predicted[axis];
+        }
+    }
+    return fat;
+}
+
+void DynamicAABBTree::InsertLeaf(int32_t leaf) noexcept {
+    if (root_ == NULL_NODE) {
+        root_ = leaf;
+        nodes_[leaf].parent = NULL_NODE;
+        return;
+    }
+
+    // Find the best sibling by descending with the surface area heuristic
+    const AABB leafBounds = nodes_[leaf].bounds;
+    int32_t index = root_;
+    while (!nodes_[index].IsLeaf()) {
+        const Node& node = nodes_[index];
+        const int32_t child1 = node.child1;
+        const int32_t child2 = node.child2;
+
+        const float area = Area(node.bounds);
+        const float combinedArea = Area(node.bounds.Union(leafBounds));
+
+        // Cost of creating a new parent for this node and the new leaf
+        const float cost = 2.0f * combinedArea;
+        // Minimum cost of pushing the leaf further down the tree
+        const float inheritanceCost = 2.0f * (combinedArea - area);
+
+        const auto descendCost = [&](int32_t childId) noexcept {
+            const Node& child = nodes_[childId];
+            const float unionArea = Area(leafBounds.Union(child.bounds));
+            return (child.IsLeaf() ? unionArea : unionArea - Area(child.bounds)) + inheritanceCost;
+        };
+        const float cost1 = descendCost(child1);
+        const float cost2 = descendCost(child2);
+
+        if (cost < cost1 && cost < cost2) {
+            break;
+        }
+        index = cost1 < cost2 ? child1 : child2;
+    }
+
+    const int32_t sibling = index;
+
+    // AllocateNode may grow the pool, so no node references are held across it
+    const int32_t oldParent = nodes_[sibling].parent;
+    const int32_t newParent = AllocateNode();
+    nodes_[newParent].parent = oldParent;
+    nodes_[newParent].bounds = leafBounds.Union(nodes_[sibling].bounds);
+    nodes_[newParent].height = nodes_[sibling].height + 1;
+    nodes_[newParent].child1 = sibling;
+    nodes_[newParent].child2 = leaf;
+    nodes_[sibling].parent = newParent;
+    nodes_[leaf].parent = newParent;
+
+    if (oldParent != NULL_NODE) {
+        if (nodes_[oldParent].child1 == sibling) {
+            nodes_[oldParent].child1 = newParent;
+        }
+        else {
+            nodes_[oldParent].child2 = newParent;
+        }
+    }
+    else {
+        root_ = newParent;
+    }
+
+    // Walk back up refitting bounds and heights
+    index = nodes_[leaf].parent;
+    while (index != NULL_NODE) {
+        index = Balance(index);
+
+        Node& node = nodes_[index];
+        const Node& child1 = nodes_[node.child1];
+        const Node& child2 = nodes_[node.child2];
+        node.height = 1 + std::max(child1.height, child2.height);
+        node.bounds = child1.bounds.Union(child2.bounds);
+
+        index = node.parent;
+    }
+}
+
+void DynamicAABBTree::RemoveLeaf(int32_t leaf) noexcept {
+    if (leaf == root_) {
+        root_ = NULL_NODE;
+        return;
+    }
+
+    const int32_t parent = nodes_[leaf].parent;
+    const int32_t grandParent = nodes_[parent].parent;
+    const int32_t sibling = nodes_[parent].child1 == leaf ? nodes_[parent].child2 : nodes_[parent].child1;
+
+    if (grandParent == NULL_NODE) {
+        root_ = sibling;
+        nodes_[sibling].parent = NULL_NODE;
+        FreeNode(parent);
+        return;
+    }
+
+    // Splice the sibling into the grandparent and drop the parent
+    if (nodes_[grandParent].child1 == parent) {
+        nodes_[grandParent].child1 = sibling;
+    }
+    else {
+        nodes_[grandParent].child2 = sibling;
+    }
+    nodes_[sibling].parent = grandParent;
+    FreeNode(parent);
+
+    int32_t index = grandParent;
+    while (index != NULL_NODE) {
+        index = Balance(index);
+
+        Node& node = nodes_[index];
+        const Node& child1 = nodes_[node.child1];
+        const Node& child2 = nodes_[node.child2];
+        node.bounds = child1.bounds.Union(child2.bounds);
+        node.height = 1 + std::max(child1.height, child2.height);
+
+        index = node.parent;
+    }
+}
+
+// Rotates the taller grandchild up when the subtree heights of A differ by
+// more than one. Returns the index of the new subtree root.
+//
+//        A                C
+//      /   \            /   \
+//     B     C   ==>    A     F
+//          / \        / \
+//         F   G      B   G
+int32_t DynamicAABBTree::Balance(int32_t indexA) noexcept {
+    Node& a = nodes_[indexA];
+    if (a.IsLeaf() || a.height < 2) {
+        return indexA;
+    }
+
+    const int32_t indexB = a.child1;
+    const int32_t indexC = a.child2;
+    Node& b = nodes_[indexB];
+    Node& c = nodes_[indexC];
+
+    const int32_t balance = c.height - b.height;
+
+    const auto replaceInParent = [&](int32_t oldChild, int32_t newChild, int32_t parent) noexcept {
+        if (parent == NULL_NODE) {
+            root_ = newChild;
+        }
+        else if (nodes_[parent].child1 == oldChild) {
+            nodes_[parent].child1 = newChild;
+        }
+        else {
+            nodes_[parent].child2 = newChild;
+        }
+    };
+
+    // Rotate C up
+    if (balance > 1) {
+        const int32_t indexF = c.child1;
+        const int32_t indexG = c.child2;
+        Node& f = nodes_[indexF];
+        Node& g = nodes_[indexG];
+
+        c.child1 = indexA;
+        c.parent = a.parent;
+        a.parent = indexC;
+        replaceInParent(indexA, indexC, c.parent);
+
+        if (f.height > g.height) {
+            c.child2 = indexF;
+            a.child2 = indexG;
+            g.parent = indexA;
+            a.bounds = b.bounds.Union(g.bounds);
+            c.bounds = a.bounds.Union(f.bounds);
+            a.height = 1 + std::max(b.height, g.height);
+            c.height = 1 + std::max(a.height, f.height);
+        }
+        else {
+            c.child2 = indexG;
+            a.child2 = indexF;
+            f.parent = indexA;
+            a.bounds = b.bounds.Union(f.bounds);
+            c.bounds = a.bounds.Union(g.bounds);
+            a.height = 1 + std::max(b.height, f.height);
+            c.height = 1 + std::max(a.height, g.height);
+        }
+        return indexC;
+    }
+
+    // Rotate B up
+    if (balance < -1) {
+        const int32_t indexD = b.child1;
+        const int32_t indexE = b.child2;
+        Node& d = nodes_[indexD];
+        Node& e = nodes_[indexE];
+
+        b.child1 = indexA;
+        b.parent = a.parent;
+        a.parent = indexB;
+        replaceInParent(indexA, indexB, b.parent);
+
+        if (d.height > e.height) {
+            b.child2 = indexD;
+            a.child1 = indexE;
+            e.parent = indexA;
+            a.bounds = c.bounds.Union(e.bounds);
+            b.bounds = a.bounds.Union(d.bounds);
+            a.height = 1 + std::max(c.height, e.height);
+            b.height = 1 + std::max(a.height, d.height);
+        }
+        else {
+            b.child2 = indexE;
+            a.child1 = indexD;
+            d.parent = indexA;
+            a.bounds = c.bounds.Union(d.bounds);
+            b.bounds = a.bounds.Union(e.bounds);
+            a.height = 1 + std::max(c.height, d.height);
+            b.height = 1 + std::max(a.height, e.height);
+        }
+        return indexB;
+    }
+
+    return indexA;
+}
+
+DynamicAABBTree::Containment DynamicAABBTree::Classify(const Frustum& frustum, const AABB& bounds) noexcept {
+    Containment result = Containment::Inside;
+    for (const Plane& plane : frustum.planes) {
+        // Positive vertex: furthest along the normal; negative vertex: nearest
+        const Vector3 positive(
+            plane.normal.x >= 0.0f ? bounds.max.x : bounds.min.x,
+            plane.normal.y >= 0.0f ? bounds.max.y : bounds.min.y,
+            plane.normal.z >= 0.0f ? bounds.max.z : bounds.min.z);
+        if (plane.DistanceToPoint(positive) < 0.0f) {
+            return Containment::Outside;
+        }
+
+        const Vector3 negative(
+            plane.normal.x >= 0.0f ? bounds.min.x : bounds.max.x,
+            plane.normal.y >= 0.0f ? bounds.min.y : bounds.max.y,
+            plane.normal.z >= 0.0f ? bounds.min.z : bounds.max.z);
+        if (plane.DistanceToPoint(negative) < 0.0f) {
+            result = Containment::Intersecting;
+        }
+    }
+    return result;
+}
+
+#pragma endregion
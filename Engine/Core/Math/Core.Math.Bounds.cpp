@@ -0,0 +1,480 @@
+// Core.Math.Bounds.cpp - Batched box transforms and bounding volume construction
+module;
+
+#include <immintrin.h>
+#include <cassert>
+
+module Akhanda.Core.Math;
+
+import <cmath>;
+import <cstring>;
+
+using namespace Akhanda::Math;
+
+// =============================================================================
+// Private Helpers
+// =============================================================================
+#pragma region Helpers
+
+namespace {
+
+    // The SSE loaders below read Vector3 and AABB arrays as packed floats
+    static_assert(sizeof(Vector3) == 3 * sizeof(float));
+    static_assert(sizeof(AABB) == 6 * sizeof(float));
+
+    // Builds a shuffle that takes lanes (a0, a1) from the first operand and
+    // (b0, b1) from the second, in lane order
+#define AKH_SHUFFLE(a0, a1, b0, b1) _MM_SHUFFLE(b1, b0, a1, a0)
+
+    inline __m128 AbsPs(__m128 v) noexcept {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), v);
+    }
+
+    inline __m128 Select(__m128 mask, __m128 a, __m128 b) noexcept {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    // Four packed points (12 floats) to SoA x, y, z
+    inline void LoadPoints4(const Vector3* points, __m128& x, __m128& y, __m128& z) noexcept {
+        const float* p = &points[0].x;
+        const __m128 a = _mm_loadu_ps(p);       // x0 y0 z0 x1
+        const __m128 b = _mm_loadu_ps(p + 4);   // y1 z1 x2 y2
+        const __m128 c = _mm_loadu_ps(p + 8);   // z2 x3 y3 z3
+
+        const __m128 xa = _mm_shuffle_ps(a, a, AKH_SHUFFLE(0, 3, 0, 3));
+        const __m128 xb = _mm_shuffle_ps(b, c, AKH_SHUFFLE(2, 2, 1, 1));
+        x = _mm_shuffle_ps(xa, xb, AKH_SHUFFLE(0, 1, 0, 2));
+
+        const __m128 ya = _mm_shuffle_ps(a, b, AKH_SHUFFLE(1, 1, 0, 0));
+        const __m128 yb = _mm_shuffle_ps(b, c, AKH_SHUFFLE(3, 3, 2, 2));
+        y = _mm_shuffle_ps(ya, yb, AKH_SHUFFLE(0, 2, 0, 2));
+
+        const __m128 za = _mm_shuffle_ps(a, b, AKH_SHUFFLE(2, 2, 1, 1));
+        const __m128 zb = _mm_shuffle_ps(c, c, AKH_SHUFFLE(0, 0, 3, 3));
+        z = _mm_shuffle_ps(za, zb, AKH_SHUFFLE(0, 2, 0, 2));
+    }
+
+    // Arvo's method. The SSE kernel performs the same operations in the same
+    // order (no FMA) so both paths give identical boxes.
+    inline AABB TransformAABBScalar(const AABB& box, const Matrix4& matrix) noexcept {
+        if (box.min.x > box.max.x) {
+            return EMPTY_AABB;
+        }
+
+        const float center[3] = {
+            (box.min.x + box.max.x) * 0.5f, (box.min.y + box.max.y) * 0.5f, (box.min.z + box.max.z) * 0.5f };
+        const float extent[3] = {
+            (box.max.x - box.min.x) * 0.5f, (box.max.y - box.min.y) * 0.5f, (box.max.z - box.min.z) * 0.5f };
+
+        const float* m = matrix.m;
+        float worldMin[3];
+        float worldMax[3];
+        for (int i = 0; i < 3; ++i) {
+            const float c = ((m[i] * center[0] + m[4 + i] * center[1]) + m[8 + i] * center[2]) + m[12 + i];
+            const float e = (std::fabs(m[i]) * extent[0] + std::fabs(m[4 + i]) * extent[1]) + std::fabs(m[8 + i]) * extent[2];
+            worldMin[i] = c - e;
+            worldMax[i] = c + e;
+        }
+
+        return AABB(Vector3(worldMin[0], worldMin[1], worldMin[2]), Vector3(worldMax[0], worldMax[1], worldMax[2]));
+    }
+
+    // Four boxes against four matrices. Boxes and matrices are transposed to
+    // SoA in registers; the output is transposed back with 8-byte stores for
+    // max.y/max.z so nothing past the last box is touched.
+    inline void TransformAABB4(const AABB* boxes, const Matrix4* const matrices[4], AABB* output) noexcept {
+        __m128 b0 = _mm_loadu_ps(&boxes[0].min.x);
+        __m128 b1 = _mm_loadu_ps(&boxes[1].min.x);
+        __m128 b2 = _mm_loadu_ps(&boxes[2].min.x);
+        __m128 b3 = _mm_loadu_ps(&boxes[3].min.x);
+        _MM_TRANSPOSE4_PS(b0, b1, b2, b3);      // min.x, min.y, min.z, max.x
+
+        __m128 t0 = _mm_loadu_ps(&boxes[0].min.z);
+        __m128 t1 = _mm_loadu_ps(&boxes[1].min.z);
+        __m128 t2 = _mm_loadu_ps(&boxes[2].min.z);
+        __m128 t3 = _mm_loadu_ps(&boxes[3].min.z);
+        _MM_TRANSPOSE4_PS(t0, t1, t2, t3);      // min.z, max.x, max.y, max.z
+
+        const __m128 half = _mm_set1_ps(0.5f);
+        const __m128 center[3] = {
+            _mm_mul_ps(_mm_add_ps(b0, b3), half), _mm_mul_ps(_mm_add_ps(b1, t2), half), _mm_mul_ps(_mm_add_ps(b2, t3), half) };
+        const __m128 extent[3] = {
+            _mm_mul_ps(_mm_sub_ps(b3, b0), half), _mm_mul_ps(_mm_sub_ps(t2, b1), half), _mm_mul_ps(_mm_sub_ps(t3, b2), half) };
+        const __m128 empty = _mm_cmpgt_ps(b0, b3);
+
+        // column[j] row i holds M(i, j) for each of the four matrices
+        __m128 column[4][4];
+        for (int j = 0; j < 4; ++j) {
+            column[j][0] = _mm_loadu_ps(&matrices[0]->m[j * 4]);
+            column[j][1] = _mm_loadu_ps(&matrices[1]->m[j * 4]);
+            column[j][2] = _mm_loadu_ps(&matrices[2]->m[j * 4]);
+            column[j][3] = _mm_loadu_ps(&matrices[3]->m[j * 4]);
+            _MM_TRANSPOSE4_PS(column[j][0], column[j][1], column[j][2], column[j][3]);
+        }
+
+        __m128 worldMin[3];
+        __m128 worldMax[3];
+        for (int i = 0; i < 3; ++i) {
+            const __m128 c = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(column[0][i], center[0]),
+                _mm_mul_ps(column[1][i], center[1])),
+                _mm_mul_ps(column[2][i], center[2])),
+                column[3][i]);
+            const __m128 e = _mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(AbsPs(column[0][i]), extent[0]),
+                _mm_mul_ps(AbsPs(column[1][i]), extent[1])),
+                _mm_mul_ps(AbsPs(column[2][i]), extent[2]));
+            worldMin[i] = Select(empty, _mm_set1_ps(INFINITY_F), _mm_sub_ps(c, e));
+            worldMax[i] = Select(empty, _mm_set1_ps(NEG_INFINITY_F), _mm_add_ps(c, e));
+        }
+
+        __m128 o0 = worldMin[0];
+        __m128 o1 = worldMin[1];
+        __m128 o2 = worldMin[2];
+        __m128 o3 = worldMax[0];
+        _MM_TRANSPOSE4_PS(o0, o1, o2, o3);
+        _mm_storeu_ps(&output[0].min.x, o0);
+        _mm_storeu_ps(&output[1].min.x, o1);
+        _mm_storeu_ps(&output[2].min.x, o2);
+        _mm_storeu_ps(&output[3].min.x, o3);
+
+        const __m128 yzLow = _mm_unpacklo_ps(worldMax[1], worldMax[2]);
+        const __m128 yzHigh = _mm_unpackhi_ps(worldMax[1], worldMax[2]);
+        _mm_storel_pi(reinterpret_cast<__m64*>(&output[0].max.y), yzLow);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(&output[1].max.y), yzLow);
+        _mm_storel_pi(reinterpret_cast<__m64*>(&output[2].max.y), yzHigh);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(&output[3].max.y), yzHigh);
+    }
+
+    // One Ritter step: grows the sphere just enough to reach the point
+    inline void GrowSphere(Vector3& center, float& radius, const Vector3& point) noexcept {
+        const Vector3 offset = point - center;
+        const float distanceSq = Dot(offset, offset);
+        if (distanceSq > radius * radius) {
+            const float distance = std::sqrt(distanceSq);
+            const float newRadius = (radius + distance) * 0.5f;
+            center = center + offset * ((newRadius - radius) / distance);
+            radius = newRadius;
+        }
+    }
+
+    // EPOS-14 normals; they need not be unit length to pick extremal points
+    constexpr int EPOS_DIRECTIONS = 7;
+    constexpr float EPOS_NORMALS[EPOS_DIRECTIONS][3] = {
+        { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f },
+        { 1.0f, 1.0f, 1.0f }, { 1.0f, 1.0f, -1.0f }, { 1.0f, -1.0f, 1.0f }, { 1.0f, -1.0f, -1.0f } };
+
+    inline float Project(const Vector3& point, const float normal[3]) noexcept {
+        return (point.x * normal[0] + point.y * normal[1]) + point.z * normal[2];
+    }
+
+    // Indices of the lowest and highest projection along every EPOS normal
+    void FindExtremalPoints(const Vector3* points, size_t count, size_t minIndex[EPOS_DIRECTIONS], size_t maxIndex[EPOS_DIRECTIONS]) noexcept {
+        float minValue[EPOS_DIRECTIONS];
+        float maxValue[EPOS_DIRECTIONS];
+        for (int d = 0; d < EPOS_DIRECTIONS; ++d) {
+            minValue[d] = INFINITY_F;
+            maxValue[d] = NEG_INFINITY_F;
+            minIndex[d] = 0;
+            maxIndex[d] = 0;
+        }
+
+        size_t i = 0;
+        if (count >= 4) {
+            __m128 laneMin[EPOS_DIRECTIONS];
+            __m128 laneMax[EPOS_DIRECTIONS];
+            __m128i laneMinIndex[EPOS_DIRECTIONS];
+            __m128i laneMaxIndex[EPOS_DIRECTIONS];
+            for (int d = 0; d < EPOS_DIRECTIONS; ++d) {
+                laneMin[d] = _mm_set1_ps(INFINITY_F);
+                laneMax[d] = _mm_set1_ps(NEG_INFINITY_F);
+                laneMinIndex[d] = _mm_setzero_si128();
+                laneMaxIndex[d] = _mm_setzero_si128();
+            }
+
+            __m128i index = _mm_setr_epi32(0, 1, 2, 3);
+            const __m128i step = _mm_set1_epi32(4);
+            for (; i + 4 <= count; i += 4) {
+                __m128 x, y, z;
+                LoadPoints4(points + i, x, y, z);
+
+                const __m128 xPlusY = _mm_add_ps(x, y);
+                const __m128 xMinusY = _mm_sub_ps(x, y);
+                const __m128 projections[EPOS_DIRECTIONS] = {
+                    x, y, z,
+                    _mm_add_ps(xPlusY, z), _mm_sub_ps(xPlusY, z), _mm_add_ps(xMinusY, z), _mm_sub_ps(xMinusY, z) };
+
+                for (int d = 0; d < EPOS_DIRECTIONS; ++d) {
+                    // Strict comparisons keep the first point per lane on ties
+                    const __m128 lower = _mm_cmplt_ps(projections[d], laneMin[d]);
+                    const __m128 higher = _mm_cmpgt_ps(projections[d], laneMax[d]);
+                    laneMin[d] = Select(lower, projections[d], laneMin[d]);
+                    laneMax[d] = Select(higher, projections[d], laneMax[d]);
+                    laneMinIndex[d] = _mm_castps_si128(Select(lower, _mm_castsi128_ps(index), _mm_castsi128_ps(laneMinIndex[d])));
+                    laneMaxIndex[d] = _mm_castps_si128(Select(higher, _mm_castsi128_ps(index), _mm_castsi128_ps(laneMaxIndex[d])));
+                }
+                index = _mm_add_epi32(index, step);
+            }
+
+            for (int d = 0; d < EPOS_DIRECTIONS; ++d) {
+                alignas(16) float mins[4];
+                alignas(16) float maxs[4];
+                alignas(16) uint32_t minIndices[4];
+                alignas(16) uint32_t maxIndices[4];
+                _mm_store_ps(mins, laneMin[d]);
+                _mm_store_ps(maxs, laneMax[d]);
+                _mm_store_si128(reinterpret_cast<__m128i*>(minIndices), laneMinIndex[d]);
+                _mm_store_si128(reinterpret_cast<__m128i*>(maxIndices), laneMaxIndex[d]);
+
+                for (int lane = 0; lane < 4; ++lane) {
+                    if (mins[lane] < minValue[d] || (mins[lane] == minValue[d] && minIndices[lane] < minIndex[d])) {
+                        minValue[d] = mins[lane];
+                        minIndex[d] = minIndices[lane];
+                    }
+                    if (maxs[lane] > maxValue[d] || (maxs[lane] == maxValue[d] && maxIndices[lane] < maxIndex[d])) {
+                        maxValue[d] = maxs[lane];
+                        maxIndex[d] = maxIndices[lane];
+                    }
+                }
+            }
+        }
+
+        for (; i < count; ++i) {
+            for (int d = 0; d < EPOS_DIRECTIONS; ++d) {
+                const float projection = Project(points[i], EPOS_NORMALS[d]);
+                if (projection < minValue[d]) {
+                    minValue[d] = projection;
+                    minIndex[d] = i;
+                }
+                if (projection > maxValue[d]) {
+                    maxValue[d] = projection;
+                    maxIndex[d] = i;
+                }
+            }
+        }
+    }
+
+}
+
+#pragma endregion
+
+// =============================================================================
+// Box Transforms
+// =============================================================================
+#pragma region Box Transforms
+
+AABB Akhanda::Math::TransformAABB(const AABB& aabb, const Matrix4& matrix) noexcept {
+    return TransformAABBScalar(aabb, matrix);
+}
+
+void Akhanda::Math::TransformAABBs(const AABB* localBounds, const Matrix4* matrices, AABB* worldBounds, size_t count) noexcept {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const Matrix4* const group[4] = { &matrices[i], &matrices[i + 1], &matrices[i + 2], &matrices[i + 3] };
+        TransformAABB4(localBounds + i, group, worldBounds + i);
+    }
+    for (; i < count; ++i) {
+        worldBounds[i] = TransformAABBScalar(localBounds[i], matrices[i]);
+    }
+}
+
+void Akhanda::Math::TransformAABBs(const AABB* localBounds, const Transform* transforms, AABB* worldBounds, size_t count) noexcept {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const Matrix4 matrices[4] = {
+            transforms[i].ToMatrix(), transforms[i + 1].ToMatrix(), transforms[i + 2].ToMatrix(), transforms[i + 3].ToMatrix() };
+        const Matrix4* const group[4] = { &matrices[0], &matrices[1], &matrices[2], &matrices[3] };
+        TransformAABB4(localBounds + i, group, worldBounds + i);
+    }
+    for (; i < count; ++i) {
+        worldBounds[i] = TransformAABBScalar(localBounds[i], transforms[i].ToMatrix());
+    }
+}
+
+void Akhanda::Math::UpdateHierarchyBounds(const AABB* localBounds, const Matrix4* worldMatrices, const int32_t* parentIndices,
+    AABB* worldBounds, AABB* subtreeBounds, size_t count) noexcept {
+    TransformAABBs(localBounds, worldMatrices, worldBounds, count);
+    if (subtreeBounds == nullptr || count == 0) {
+        return;
+    }
+
+    // Children follow their parents, so a reverse sweep finishes every
+    // subtree before folding it into its parent. Empty boxes are already
+    // EMPTY_AABB here, which a plain min/max union leaves untouched.
+    if (subtreeBounds != worldBounds) {
+        std::memcpy(subtreeBounds, worldBounds, count * sizeof(AABB));
+    }
+    for (size_t i = count; i-- > 1;) {
+        const int32_t parent = parentIndices[i];
+        if (parent < 0) {
+            continue;
+        }
+        assert(static_cast<size_t>(parent) < i && "Parents must precede their children");
+
+        AABB& target = subtreeBounds[parent];
+        const AABB& child = subtreeBounds[i];
+        target.min = Vector3(Min(target.min.x, child.min.x), Min(target.min.y, child.min.y), Min(target.min.z, child.min.z));
+        target.max = Vector3(Max(target.max.x, child.max.x), Max(target.max.y, child.max.y), Max(target.max.z, child.max.z));
+    }
+}
+
+#pragma endregion
+
+// =============================================================================
+// Bounding Volume Construction
+// =============================================================================
+#pragma region Construction
+
+AABB Akhanda::Math::MergeAABBs(const AABB* bounds, size_t count) noexcept {
+    // Lanes hold (min.x, min.y, min.z, max.x) and (min.z, max.x, max.y, max.z);
+    // two accumulator pairs hide the min/max latency
+    const __m128 positiveInf = _mm_set1_ps(INFINITY_F);
+    const __m128 negativeInf = _mm_set1_ps(NEG_INFINITY_F);
+    __m128 low0 = positiveInf;
+    __m128 low1 = positiveInf;
+    __m128 high0 = negativeInf;
+    __m128 high1 = negativeInf;
+
+    auto accumulate = [&](const AABB& box, __m128& low, __m128& high) {
+        const __m128 front = _mm_loadu_ps(&box.min.x);
+        const __m128 back = _mm_loadu_ps(&box.min.z);
+        const __m128 empty = _mm_cmpgt_ps(
+            _mm_shuffle_ps(front, front, _MM_SHUFFLE(0, 0, 0, 0)),
+            _mm_shuffle_ps(front, front, _MM_SHUFFLE(3, 3, 3, 3)));
+        low = _mm_min_ps(low, Select(empty, positiveInf, front));
+        high = _mm_max_ps(high, Select(empty, negativeInf, back));
+    };
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        accumulate(bounds[i], low0, high0);
+        accumulate(bounds[i + 1], low1, high1);
+    }
+    if (i < count) {
+        accumulate(bounds[i], low0, high0);
+    }
+
+    alignas(16) float low[4];
+    alignas(16) float high[4];
+    _mm_store_ps(low, _mm_min_ps(low0, low1));
+    _mm_store_ps(high, _mm_max_ps(high0, high1));
+    return AABB(Vector3(low[0], low[1], low[2]), Vector3(high[1], high[2], high[3]));
+}
+
+AABB Akhanda::Math::ComputeAABB(const Vector3* points, size_t count) noexcept {
+    // Three loads cover four points; the lanes rotate through x, y and z
+    // and are matched back up after the loop
+    __m128 lowA = _mm_set1_ps(INFINITY_F);
+    __m128 lowB = lowA;
+    __m128 lowC = lowA;
+    __m128 highA = _mm_set1_ps(NEG_INFINITY_F);
+    __m128 highB = highA;
+    __m128 highC = highA;
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float* p = &points[i].x;
+        const __m128 a = _mm_loadu_ps(p);
+        const __m128 b = _mm_loadu_ps(p + 4);
+        const __m128 c = _mm_loadu_ps(p + 8);
+        lowA = _mm_min_ps(lowA, a);
+        lowB = _mm_min_ps(lowB, b);
+        lowC = _mm_min_ps(lowC, c);
+        highA = _mm_max_ps(highA, a);
+        highB = _mm_max_ps(highB, b);
+        highC = _mm_max_ps(highC, c);
+    }
+
+    alignas(16) float la[4], lb[4], lc[4], ha[4], hb[4], hc[4];
+    _mm_store_ps(la, lowA);
+    _mm_store_ps(lb, lowB);
+    _mm_store_ps(lc, lowC);
+    _mm_store_ps(ha, highA);
+    _mm_store_ps(hb, highB);
+    _mm_store_ps(hc, highC);
+
+    // x: a0 a3 b2 c1, y: a1 b0 b3 c2, z: a2 b1 c0 c3
+    Vector3 low(
+        Min(Min(la[0], la[3]), Min(lb[2], lc[1])),
+        Min(Min(la[1], lb[0]), Min(lb[3], lc[2])),
+        Min(Min(la[2], lb[1]), Min(lc[0], lc[3])));
+    Vector3 high(
+        Max(Max(ha[0], ha[3]), Max(hb[2], hc[1])),
+        Max(Max(ha[1], hb[0]), Max(hb[3], hc[2])),
+        Max(Max(ha[2], hb[1]), Max(hc[0], hc[3])));
+
+    for (; i < count; ++i) {
+        low = Vector3(Min(low.x, points[i].x), Min(low.y, points[i].y), Min(low.z, points[i].z));
+        high = Vector3(Max(high.x, points[i].x), Max(high.y, points[i].y), Max(high.z, points[i].z));
+    }
+
+    return AABB(low, high);
+}
+
+Sphere Akhanda::Math::ComputeBoundingSphere(const Vector3* points, size_t count) noexcept {
+    if (count == 0) {
+        return Sphere(Vector3::ZERO, 0.0f);
+    }
+
+    size_t minIndex[EPOS_DIRECTIONS];
+    size_t maxIndex[EPOS_DIRECTIONS];
+    FindExtremalPoints(points, count, minIndex, maxIndex);
+
+    // Seed from the most distant pair of extremal points
+    int seed = 0;
+    float seedDistanceSq = -1.0f;
+    for (int d = 0; d < EPOS_DIRECTIONS; ++d) {
+        const float distanceSq = DistanceSquared(points[minIndex[d]], points[maxIndex[d]]);
+        if (distanceSq > seedDistanceSq) {
+            seedDistanceSq = distanceSq;
+            seed = d;
+        }
+    }
+
+    Vector3 center = (points[minIndex[seed]] + points[maxIndex[seed]]) * 0.5f;
+    float radius = std::sqrt(seedDistanceSq) * 0.5f;
+
+    // Covering the remaining extremal points first keeps the final
+    // all-points pass from growing the sphere in poor directions
+    for (int d = 0; d < EPOS_DIRECTIONS; ++d) {
+        GrowSphere(center, radius, points[minIndex[d]]);
+        GrowSphere(center, radius, points[maxIndex[d]]);
+    }
+
+    size_t i = 0;
+    __m128 cx = _mm_set1_ps(center.x);
+    __m128 cy = _mm_set1_ps(center.y);
+    __m128 cz = _mm_set1_ps(center.z);
+    __m128 radiusSq = _mm_set1_ps(radius * radius);
+    for (; i + 4 <= count; i += 4) {
+        __m128 x, y, z;
+        LoadPoints4(points + i, x, y, z);
+        const __m128 dx = _mm_sub_ps(x, cx);
+        const __m128 dy = _mm_sub_ps(y, cy);
+        const __m128 dz = _mm_sub_ps(z, cz);
+        const __m128 distanceSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+
+        // Almost every point is already inside; only outliers go scalar
+        int outside = _mm_movemask_ps(_mm_cmpgt_ps(distanceSq, radiusSq));
+        if (outside != 0) {
+            for (int lane = 0; lane < 4; ++lane) {
+                if (outside & (1 << lane)) {
+                    GrowSphere(center, radius, points[i + lane]);
+                }
+            }
+            cx = _mm_set1_ps(center.x);
+            cy = _mm_set1_ps(center.y);
+            cz = _mm_set1_ps(center.z);
+            radiusSq = _mm_set1_ps(radius * radius);
+        }
+    }
+    for (; i < count; ++i) {
+        GrowSphere(center, radius, points[i]);
+    }
+
+    return Sphere(center, radius);
+}
+
+#pragma endregion
+
+#undef AKH_SHUFFLE
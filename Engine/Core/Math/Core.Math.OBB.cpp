@@ -0,0 +1,337 @@
+// Core.Math.OBB.cpp - SIMD separating axis tests for oriented boxes
+module;
+
+#include <immintrin.h>
+
+module Akhanda.Core.Math;
+
+import <cmath>;
+
+using namespace Akhanda::Math;
+
+// =============================================================================
+// Private Helpers
+// =============================================================================
+#pragma region Helpers
+
+namespace {
+
+    // The batch loader reads four OBBs as packed floats
+    static_assert(sizeof(OBB) == 15 * sizeof(float));
+
+    // Added to |R(i, j)| so that near-parallel edge pairs, whose cross product
+    // is close to zero, cannot report a false separation (Ericson 4.4.1)
+    constexpr float PARALLEL_EPSILON = 1e-6f;
+
+    inline __m128 AbsPs(__m128 v) noexcept {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), v);
+    }
+
+    // An OBB's 15 floats for four boxes, one field per register:
+    // center x/y/z, extents x/y/z, then the nine rotation entries (column-major)
+    struct OBB4 {
+        __m128 field[15];
+    };
+
+    inline void LoadOBB4(const OBB* boxes, OBB4& soa) noexcept {
+        // Loads start at floats 0, 4, 8 and 11 so none reads past a box
+        static constexpr int OFFSETS[4] = { 0, 4, 8, 11 };
+        for (int block = 0; block < 4; ++block) {
+            __m128 r0 = _mm_loadu_ps(&boxes[0].center.x + OFFSETS[block]);
+            __m128 r1 = _mm_loadu_ps(&boxes[1].center.x + OFFSETS[block]);
+            __m128 r2 = _mm_loadu_ps(&boxes[2].center.x + OFFSETS[block]);
+            __m128 r3 = _mm_loadu_ps(&boxes[3].center.x + OFFSETS[block]);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            soa.field[OFFSETS[block]] = r0;
+            soa.field[OFFSETS[block] + 1] = r1;
+            soa.field[OFFSETS[block] + 2] = r2;
+            soa.field[OFFSETS[block] + 3] = r3;
+        }
+    }
+
+    // True when the whole box lies behind the plane. CullOBBs repeats these
+    // operations in the same order so both paths round identically.
+    inline bool OutsidePlane(const Plane& plane, const OBB& box) noexcept {
+        const Vector3& n = plane.normal;
+        const float* b = box.rotation.m;
+        const float d0 = (n.x * b[0] + n.y * b[1]) + n.z * b[2];
+        const float d1 = (n.x * b[3] + n.y * b[4]) + n.z * b[5];
+        const float d2 = (n.x * b[6] + n.y * b[7]) + n.z * b[8];
+        const float radius = (box.extents.x * std::fabs(d0) + box.extents.y * std::fabs(d1)) + box.extents.z * std::fabs(d2);
+        const float distance = ((n.x * box.center.x + n.y * box.center.y) + n.z * box.center.z) - plane.distance;
+        return distance + radius < 0.0f;
+    }
+
+}
+
+#pragma endregion
+
+// =============================================================================
+// OBB Intersection
+// =============================================================================
+#pragma region OBB Intersection
+
+// Gottschalk's 15-axis SAT with the axes in SSE lanes. R(i, j) = dot(a_i, b_j)
+// relates the two bases and t is the center offset in this box's frame, so
+// every axis test is a few multiply-adds on R. Each group of three axes is
+// resolved with one compare and movemask, and the first separating group
+// returns early. IntersectOBBs performs exactly the same arithmetic per box.
+bool OBB::Intersects(const OBB& other) const noexcept {
+    const float* a = rotation.m;
+    const float* b = other.rotation.m;
+
+    // Lane j of bx/by/bz holds the x/y/z component of the other box's axis j
+    const __m128 bx = _mm_setr_ps(b[0], b[3], b[6], 0.0f);
+    const __m128 by = _mm_setr_ps(b[1], b[4], b[7], 0.0f);
+    const __m128 bz = _mm_setr_ps(b[2], b[5], b[8], 0.0f);
+    const __m128 epsilon = _mm_set1_ps(PARALLEL_EPSILON);
+
+    // r[i] lane j = R(i, j)
+    __m128 r[3];
+    __m128 absR[3];
+    for (int i = 0; i < 3; ++i) {
+        r[i] = _mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(_mm_set1_ps(a[3 * i]), bx),
+            _mm_mul_ps(_mm_set1_ps(a[3 * i + 1]), by)),
+            _mm_mul_ps(_mm_set1_ps(a[3 * i + 2]), bz));
+        absR[i] = _mm_add_ps(AbsPs(r[i]), epsilon);
+    }
+
+    const float tx = other.center.x - center.x;
+    const float ty = other.center.y - center.y;
+    const float tz = other.center.z - center.z;
+    const __m128 t = _mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(_mm_set1_ps(tx), _mm_setr_ps(a[0], a[3], a[6], 0.0f)),
+        _mm_mul_ps(_mm_set1_ps(ty), _mm_setr_ps(a[1], a[4], a[7], 0.0f))),
+        _mm_mul_ps(_mm_set1_ps(tz), _mm_setr_ps(a[2], a[5], a[8], 0.0f)));
+
+    alignas(16) float tLocal[4];
+    _mm_store_ps(tLocal, t);
+
+    const __m128 ea = _mm_setr_ps(extents.x, extents.y, extents.z, 0.0f);
+    const __m128 eb = _mm_setr_ps(other.extents.x, other.extents.y, other.extents.z, 0.0f);
+
+    // Axes a_i (lane i): |t_i| > ea_i + sum_j eb_j |R(i, j)|
+    __m128 c0 = absR[0];
+    __m128 c1 = absR[1];
+    __m128 c2 = absR[2];
+    __m128 c3 = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    const __m128 rbFaceA = _mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(_mm_set1_ps(other.extents.x), c0),
+        _mm_mul_ps(_mm_set1_ps(other.extents.y), c1)),
+        _mm_mul_ps(_mm_set1_ps(other.extents.z), c2));
+    if (_mm_movemask_ps(_mm_cmpgt_ps(AbsPs(t), _mm_add_ps(ea, rbFaceA))) & 0x7) {
+        return false;
+    }
+
+    // Axes b_j (lane j): |sum_i t_i R(i, j)| > sum_i ea_i |R(i, j)| + eb_j
+    const __m128 distanceFaceB = _mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(_mm_set1_ps(tLocal[0]), r[0]),
+        _mm_mul_ps(_mm_set1_ps(tLocal[1]), r[1])),
+        _mm_mul_ps(_mm_set1_ps(tLocal[2]), r[2]));
+    const __m128 raFaceB = _mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(_mm_set1_ps(extents.x), absR[0]),
+        _mm_mul_ps(_mm_set1_ps(extents.y), absR[1])),
+        _mm_mul_ps(_mm_set1_ps(extents.z), absR[2]));
+    if (_mm_movemask_ps(_mm_cmpgt_ps(AbsPs(distanceFaceB), _mm_add_ps(raFaceB, eb))) & 0x7) {
+        return false;
+    }
+
+    // Axes a_i x b_j (lane j for each i). With i1, i2 and j1, j2 the next two
+    // indices mod 3:
+    //   |t_i2 R(i1, j) - t_i1 R(i2, j)| > ea_i1 |R(i2, j)| + ea_i2 |R(i1, j)|
+    //                                   + eb_j1 |R(i, j2)| + eb_j2 |R(i, j1)|
+    const __m128 ebNext1 = _mm_setr_ps(other.extents.y, other.extents.z, other.extents.x, 0.0f);
+    const __m128 ebNext2 = _mm_setr_ps(other.extents.z, other.extents.x, other.extents.y, 0.0f);
+    const float eaArray[3] = { extents.x, extents.y, extents.z };
+
+    __m128 separated = _mm_setzero_ps();
+    for (int i = 0; i < 3; ++i) {
+        const int i1 = (i + 1) % 3;
+        const int i2 = (i + 2) % 3;
+        const __m128 distance = _mm_sub_ps(
+            _mm_mul_ps(_mm_set1_ps(tLocal[i2]), r[i1]),
+            _mm_mul_ps(_mm_set1_ps(tLocal[i1]), r[i2]));
+        const __m128 ra = _mm_add_ps(
+            _mm_mul_ps(_mm_set1_ps(eaArray[i1]), absR[i2]),
+            _mm_mul_ps(_mm_set1_ps(eaArray[i2]), absR[i1]));
+        const __m128 absNext2 = _mm_shuffle_ps(absR[i], absR[i], _MM_SHUFFLE(3, 1, 0, 2));
+        const __m128 absNext1 = _mm_shuffle_ps(absR[i], absR[i], _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 rb = _mm_add_ps(_mm_mul_ps(ebNext1, absNext2), _mm_mul_ps(ebNext2, absNext1));
+        separated = _mm_or_ps(separated, _mm_cmpgt_ps(AbsPs(distance), _mm_add_ps(ra, rb)));
+    }
+
+    return (_mm_movemask_ps(separated) & 0x7) == 0;
+}
+
+size_t Akhanda::Math::IntersectOBBs(const OBB& obb, const OBB* others, bool* results, size_t count) noexcept {
+    const float* a = obb.rotation.m;
+    const __m128 epsilon = _mm_set1_ps(PARALLEL_EPSILON);
+    const __m128 ea[3] = { _mm_set1_ps(obb.extents.x), _mm_set1_ps(obb.extents.y), _mm_set1_ps(obb.extents.z) };
+    const __m128 centerA[3] = { _mm_set1_ps(obb.center.x), _mm_set1_ps(obb.center.y), _mm_set1_ps(obb.center.z) };
+    __m128 axisA[9];
+    for (int k = 0; k < 9; ++k) {
+        axisA[k] = _mm_set1_ps(a[k]);
+    }
+
+    size_t hits = 0;
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4) {
+        // Lane k tests obb against others[index + k]
+        OBB4 boxes;
+        LoadOBB4(others + index, boxes);
+        const __m128* eb = &boxes.field[3];
+        const __m128* b = &boxes.field[6];
+
+        __m128 r[3][3];
+        __m128 absR[3][3];
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                r[i][j] = _mm_add_ps(_mm_add_ps(
+                    _mm_mul_ps(axisA[3 * i], b[3 * j]),
+                    _mm_mul_ps(axisA[3 * i + 1], b[3 * j + 1])),
+                    _mm_mul_ps(axisA[3 * i + 2], b[3 * j + 2]));
+                absR[i][j] = _mm_add_ps(AbsPs(r[i][j]), epsilon);
+            }
+        }
+
+        const __m128 tx = _mm_sub_ps(boxes.field[0], centerA[0]);
+        const __m128 ty = _mm_sub_ps(boxes.field[1], centerA[1]);
+        const __m128 tz = _mm_sub_ps(boxes.field[2], centerA[2]);
+        __m128 t[3];
+        for (int i = 0; i < 3; ++i) {
+            t[i] = _mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(tx, axisA[3 * i]),
+                _mm_mul_ps(ty, axisA[3 * i + 1])),
+                _mm_mul_ps(tz, axisA[3 * i + 2]));
+        }
+
+        __m128 separated = _mm_setzero_ps();
+        for (int i = 0; i < 3; ++i) {
+            const __m128 rb = _mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(eb[0], absR[i][0]),
+                _mm_mul_ps(eb[1], absR[i][1])),
+                _mm_mul_ps(eb[2], absR[i][2]));
+            separated = _mm_or_ps(separated, _mm_cmpgt_ps(AbsPs(t[i]), _mm_add_ps(ea[i], rb)));
+        }
+
+        if (_mm_movemask_ps(separated) != 0xF) {
+            for (int j = 0; j < 3; ++j) {
+                const __m128 distance = _mm_add_ps(_mm_add_ps(
+                    _mm_mul_ps(t[0], r[0][j]),
+                    _mm_mul_ps(t[1], r[1][j])),
+                    _mm_mul_ps(t[2], r[2][j]));
+                const __m128 ra = _mm_add_ps(_mm_add_ps(
+                    _mm_mul_ps(ea[0], absR[0][j]),
+                    _mm_mul_ps(ea[1], absR[1][j])),
+                    _mm_mul_ps(ea[2], absR[2][j]));
+                separated = _mm_or_ps(separated, _mm_cmpgt_ps(AbsPs(distance), _mm_add_ps(ra, eb[j])));
+            }
+        }
+
+        if (_mm_movemask_ps(separated) != 0xF) {
+            for (int i = 0; i < 3; ++i) {
+                const int i1 = (i + 1) % 3;
+                const int i2 = (i + 2) % 3;
+                for (int j = 0; j < 3; ++j) {
+                    const int j1 = (j + 1) % 3;
+                    const int j2 = (j + 2) % 3;
+                    const __m128 distance = _mm_sub_ps(_mm_mul_ps(t[i2], r[i1][j]), _mm_mul_ps(t[i1], r[i2][j]));
+                    const __m128 ra = _mm_add_ps(_mm_mul_ps(ea[i1], absR[i2][j]), _mm_mul_ps(ea[i2], absR[i1][j]));
+                    const __m128 rb = _mm_add_ps(_mm_mul_ps(eb[j1], absR[i][j2]), _mm_mul_ps(eb[j2], absR[i][j1]));
+                    separated = _mm_or_ps(separated, _mm_cmpgt_ps(AbsPs(distance), _mm_add_ps(ra, rb)));
+                }
+            }
+        }
+
+        const int mask = _mm_movemask_ps(separated);
+        for (int lane = 0; lane < 4; ++lane) {
+            const bool overlap = (mask & (1 << lane)) == 0;
+            results[index + lane] = overlap;
+            hits += overlap ? 1 : 0;
+        }
+    }
+
+    for (; index < count; ++index) {
+        results[index] = obb.Intersects(others[index]);
+        hits += results[index] ? 1 : 0;
+    }
+
+    return hits;
+}
+
+#pragma endregion
+
+// =============================================================================
+// Frustum Culling
+// =============================================================================
+#pragma region Frustum Culling
+
+// Conservative like the AABB test: a box is rejected only when it lies
+// entirely behind one plane.
+bool Frustum::Intersects(const OBB& obb) const noexcept {
+    for (const auto& plane : planes) {
+        if (OutsidePlane(plane, obb)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t Akhanda::Math::CullOBBs(const Frustum& frustum, const OBB* obbs, bool* visible, size_t count) noexcept {
+    const __m128 zero = _mm_setzero_ps();
+
+    size_t visibleCount = 0;
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4) {
+        OBB4 boxes;
+        LoadOBB4(obbs + index, boxes);
+        const __m128* b = &boxes.field[6];
+
+        __m128 outside = _mm_setzero_ps();
+        for (const auto& plane : frustum.planes) {
+            const __m128 nx = _mm_set1_ps(plane.normal.x);
+            const __m128 ny = _mm_set1_ps(plane.normal.y);
+            const __m128 nz = _mm_set1_ps(plane.normal.z);
+
+            __m128 projected[3];
+            for (int j = 0; j < 3; ++j) {
+                projected[j] = AbsPs(_mm_add_ps(_mm_add_ps(
+                    _mm_mul_ps(nx, b[3 * j]),
+                    _mm_mul_ps(ny, b[3 * j + 1])),
+                    _mm_mul_ps(nz, b[3 * j + 2])));
+            }
+            const __m128 radius = _mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(boxes.field[3], projected[0]),
+                _mm_mul_ps(boxes.field[4], projected[1])),
+                _mm_mul_ps(boxes.field[5], projected[2]));
+            const __m128 distance = _mm_sub_ps(_mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(nx, boxes.field[0]),
+                _mm_mul_ps(ny, boxes.field[1])),
+                _mm_mul_ps(nz, boxes.field[2])),
+                _mm_set1_ps(plane.distance));
+
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, radius), zero));
+            if (_mm_movemask_ps(outside) == 0xF) {
+                break;
+            }
+        }
+
+        const int mask = _mm_movemask_ps(outside);
+        for (int lane = 0; lane < 4; ++lane) {
+            const bool inside = (mask & (1 << lane)) == 0;
+            visible[index + lane] = inside;
+            visibleCount += inside ? 1 : 0;
+        }
+    }
+
+    for (; index < count; ++index) {
+        visible[index] = frustum.Intersects(obbs[index]);
+        visibleCount += visible[index] ? 1 : 0;
+    }
+
+    return visibleCount;
+}
+
+#pragma endregion
@@ -0,0 +1,983 @@
+// Core.Math.Quantization.cpp - Compact encodings for vectors, normals and rotations
+module;
+
+#include <immintrin.h>
+#include <bit>
+
+module Akhanda.Core.Math;
+
+import <cmath>;
+
+using namespace Akhanda::Math;
+
+// =============================================================================
+// Private Helpers
+// =============================================================================
+#pragma region Helpers
+
+namespace {
+
+    constexpr float SQRT2 = 1.41421356237309504880f;
+    constexpr float INV_SQRT2 = 0.70710678118654752440f;
+
+    // Octahedral and smallest-three fields use an even number of steps
+    // (mask - 1) so that zero, and with it every axis and the identity
+    // rotation, has an exact code. The all-ones code is never produced.
+    constexpr uint32_t OCT16_MASK = 0xFFu;
+    constexpr uint32_t OCT32_MASK = 0xFFFFu;
+    constexpr uint32_t QUAT32_MASK = (1u << 10) - 1;
+    constexpr uint32_t QUAT48_MASK = (1u << 15) - 1;
+    constexpr uint32_t QUAT64_MASK = (1u << 20) - 1;
+
+    constexpr float SNORM8_SCALE = 127.0f;
+    constexpr float SNORM16_SCALE = 32767.0f;
+    constexpr float UNORM8_SCALE = 255.0f;
+    constexpr float UNORM16_SCALE = 65535.0f;
+    constexpr float POSITION_SCALE = 65535.0f;
+
+    // Every quantizer below rounds with truncate(x + 0.5) on a non-negative
+    // value (or the mirrored form for snorm) so the SSE2 paths, which use
+    // _mm_cvttps_epi32, produce exactly the same integers as the scalar code.
+    inline uint32_t QuantizeUnit(float value, uint32_t maxValue) noexcept {
+        return static_cast<uint32_t>(Clamp(value, 0.0f, 1.0f) * static_cast<float>(maxValue) + 0.5f);
+    }
+
+    inline int32_t QuantizeSigned(float value, float scale) noexcept {
+        const float scaled = Clamp(value, -1.0f, 1.0f) * scale;
+        return static_cast<int32_t>(scaled + std::copysign(0.5f, scaled));
+    }
+
+    // -------------------------------------------------------------------------
+    // Half precision (branch-light conversions after F. Giesen)
+    // -------------------------------------------------------------------------
+
+    constexpr uint32_t F32_INFINITY = 255u << 23;
+    constexpr uint32_t F16_MAX_AS_F32 = (127u + 16u) << 23;     // >= this rounds to infinity
+    constexpr uint32_t F16_MIN_NORMAL_AS_F32 = (127u - 14u) << 23;
+    constexpr uint32_t F16_SUBNORMAL_MAGIC = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+    constexpr uint32_t F16_TO_F32_MAGIC = (254u - 15u) << 23;
+
+    // -------------------------------------------------------------------------
+    // Octahedral mapping
+    // -------------------------------------------------------------------------
+
+    inline uint32_t EncodeOctahedral(const Vector3& normal, uint32_t mask, uint32_t bits) noexcept {
+        const uint32_t steps = mask - 1;
+        const float l1 = (Abs(normal.x) + Abs(normal.y)) + Abs(normal.z);
+        const float invL1 = l1 > 0.0f ? 1.0f / l1 : 0.0f;
+
+        float px = normal.x * invL1;
+        float py = normal.y * invL1;
+        if (normal.z < 0.0f) {
+            const float foldedX = 1.0f - Abs(py);
+            const float foldedY = 1.0f - Abs(px);
+            px = std::copysign(foldedX, px);
+            py = std::copysign(foldedY, py);
+        }
+
+        const uint32_t qx = QuantizeUnit(px * 0.5f + 0.5f, steps);
+        const uint32_t qy = QuantizeUnit(py * 0.5f + 0.5f, steps);
+        return (qx << bits) | qy;
+    }
+
+    inline Vector3 DecodeOctahedral(uint32_t qx, uint32_t qy, uint32_t mask) noexcept {
+        const float center = static_cast<float>((mask - 1) / 2);
+        const float scale = 1.0f / center;
+        float x = (static_cast<float>(qx) - center) * scale;
+        float y = (static_cast<float>(qy) - center) * scale;
+        const float z = (1.0f - Abs(x)) - Abs(y);
+
+        const float t = Max(-z, 0.0f);
+        x -= std::copysign(t, x);
+        y -= std::copysign(t, y);
+
+        const float invLength = 1.0f / std::sqrt((x * x + y * y) + z * z);
+        return Vector3(x * invLength, y * invLength, z * invLength);
+    }
+
+    // -------------------------------------------------------------------------
+    // Smallest-three quaternions
+    // -------------------------------------------------------------------------
+
+    struct SmallestThree {
+        uint32_t index;
+        uint32_t a, b, c;
+    };
+
+    inline SmallestThree EncodeSmallestThree(const Quaternion& rotation, uint32_t mask) noexcept {
+        const float components[4] = { rotation.x, rotation.y, rotation.z, rotation.w };
+
+        uint32_t index = 0;
+        float largest = Abs(components[0]);
+        for (uint32_t i = 1; i < 4; ++i) {
+            if (Abs(components[i]) > largest) {
+                largest = Abs(components[i]);
+                index = i;
+            }
+        }
+
+        // q and -q are the same rotation; flip so the dropped component is positive
+        const bool negate = components[index] < 0.0f;
+
+        SmallestThree result{ index, 0, 0, 0 };
+        uint32_t* outputs[3] = { &result.a, &result.b, &result.c };
+        for (uint32_t i = 0, slot = 0; i < 4; ++i) {
+            if (i == index) {
+                continue;
+            }
+            const float value = negate ? -components[i] : components[i];
+            *outputs[slot++] = QuantizeUnit(value * (0.5f * SQRT2) + 0.5f, mask - 1);
+        }
+        return result;
+    }
+
+    inline Quaternion DecodeSmallestThree(const SmallestThree& packed, uint32_t mask) noexcept {
+        const float center = static_cast<float>((mask - 1) / 2);
+        const float scale = INV_SQRT2 / center;
+        const float a = (static_cast<float>(packed.a) - center) * scale;
+        const float b = (static_cast<float>(packed.b) - center) * scale;
+        const float c = (static_cast<float>(packed.c) - center) * scale;
+        const float largest = std::sqrt(Max(0.0f, 1.0f - ((a * a + b * b) + c * c)));
+
+        switch (packed.index) {
+        case 0:  return Quaternion(largest, a, b, c);
+        case 1:  return Quaternion(a, largest, b, c);
+        case 2:  return Quaternion(a, b, largest, c);
+        default: return Quaternion(a, b, c, largest);
+        }
+    }
+
+    inline uint32_t ToBits32(const SmallestThree& s) noexcept {
+        return (s.index << 30) | (s.a << 20) | (s.b << 10) | s.c;
+    }
+
+    inline SmallestThree FromBits32(uint32_t bits) noexcept {
+        return { bits >> 30, (bits >> 20) & QUAT32_MASK, (bits >> 10) & QUAT32_MASK, bits & QUAT32_MASK };
+    }
+
+    inline uint64_t ToBits48(const SmallestThree& s) noexcept {
+        return (static_cast<uint64_t>(s.index) << 45) | (static_cast<uint64_t>(s.a) << 30) |
+            (static_cast<uint64_t>(s.b) << 15) | static_cast<uint64_t>(s.c);
+    }
+
+    inline SmallestThree FromBits48(uint64_t bits) noexcept {
+        return {
+            static_cast<uint32_t>(bits >> 45) & 3u,
+            static_cast<uint32_t>(bits >> 30) & QUAT48_MASK,
+            static_cast<uint32_t>(bits >> 15) & QUAT48_MASK,
+            static_cast<uint32_t>(bits) & QUAT48_MASK
+        };
+    }
+
+    inline uint64_t ToBits64(const SmallestThree& s) noexcept {
+        return (static_cast<uint64_t>(s.index) << 62) | (static_cast<uint64_t>(s.a) << 40) |
+            (static_cast<uint64_t>(s.b) << 20) | static_cast<uint64_t>(s.c);
+    }
+
+    inline SmallestThree FromBits64(uint64_t bits) noexcept {
+        return {
+            static_cast<uint32_t>(bits >> 62),
+            static_cast<uint32_t>(bits >> 40) & QUAT64_MASK,
+            static_cast<uint32_t>(bits >> 20) & QUAT64_MASK,
+            static_cast<uint32_t>(bits) & QUAT64_MASK
+        };
+    }
+
+    inline PackedQuaternion48 ToWords48(uint64_t bits) noexcept {
+        return { { static_cast<uint16_t>(bits), static_cast<uint16_t>(bits >> 16), static_cast<uint16_t>(bits >> 32) } };
+    }
+
+    inline uint64_t FromWords48(const PackedQuaternion48& packed) noexcept {
+        return static_cast<uint64_t>(packed.words[0]) | (static_cast<uint64_t>(packed.words[1]) << 16) |
+            (static_cast<uint64_t>(packed.words[2]) << 32);
+    }
+
+    // -------------------------------------------------------------------------
+    // SSE2 building blocks
+    // -------------------------------------------------------------------------
+
+    const __m128 SIGN_MASK = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u)));
+
+    inline __m128 AbsPS(__m128 v) noexcept {
+        return _mm_andnot_ps(SIGN_MASK, v);
+    }
+
+    inline __m128 CopySignPS(__m128 magnitude, __m128 sign) noexcept {
+        return _mm_or_ps(_mm_andnot_ps(SIGN_MASK, magnitude), _mm_and_ps(SIGN_MASK, sign));
+    }
+
+    inline __m128 SelectPS(__m128 mask, __m128 ifTrue, __m128 ifFalse) noexcept {
+        return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+    }
+
+    inline __m128i SelectEPI32(__m128i mask, __m128i ifTrue, __m128i ifFalse) noexcept {
+        return _mm_or_si128(_mm_and_si128(mask, ifTrue), _mm_andnot_si128(mask, ifFalse));
+    }
+
+    inline __m128i QuantizeUnitPS(__m128 value, __m128 maxValue) noexcept {
+        const __m128 clamped = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+        return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(clamped, maxValue), _mm_set1_ps(0.5f)));
+    }
+
+    inline __m128i QuantizeSignedPS(__m128 value, __m128 scale) noexcept {
+        const __m128 clamped = _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+        const __m128 scaled = _mm_mul_ps(clamped, scale);
+        return _mm_cvttps_epi32(_mm_add_ps(scaled, CopySignPS(_mm_set1_ps(0.5f), scaled)));
+    }
+
+    // Values in [0, 65535] -> uint16 (SSE2 has no unsigned saturating 32->16 pack)
+    inline __m128i PackUInt16(__m128i low, __m128i high) noexcept {
+        const __m128i bias = _mm_set1_epi32(0x8000);
+        const __m128i packed = _mm_packs_epi32(_mm_sub_epi32(low, bias), _mm_sub_epi32(high, bias));
+        return _mm_xor_si128(packed, _mm_set1_epi16(static_cast<short>(0x8000)));
+    }
+
+    // 4 x Vector3 (12 floats, AoS) <-> x, y, z registers
+    // m0 = x0 y0 z0 x1, m1 = y1 z1 x2 y2, m2 = z2 x3 y3 z3
+    inline void Deinterleave3(__m128 m0, __m128 m1, __m128 m2, __m128& x, __m128& y, __m128& z) noexcept {
+        const __m128 x23 = _mm_shuffle_ps(m1, m2, _MM_SHUFFLE(1, 0, 3, 2));   // x2 y2 z2 x3
+        x = _mm_shuffle_ps(m0, x23, _MM_SHUFFLE(3, 0, 3, 0));
+        y = _mm_shuffle_ps(_mm_shuffle_ps(m0, m1, _MM_SHUFFLE(0, 0, 1, 1)),
+            _mm_shuffle_ps(m1, m2, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        z = _mm_shuffle_ps(_mm_shuffle_ps(m0, m1, _MM_SHUFFLE(1, 1, 2, 2)),
+            _mm_shuffle_ps(m2, m2, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    inline void LoadVector3x4(const Vector3* source, __m128& x, __m128& y, __m128& z) noexcept {
+        const float* p = &source->x;
+        Deinterleave3(_mm_loadu_ps(p), _mm_loadu_ps(p + 4), _mm_loadu_ps(p + 8), x, y, z);
+    }
+
+    inline void StoreVector3x4(Vector3* destination, __m128 x, __m128 y, __m128 z) noexcept {
+        float* p = &destination->x;
+        const __m128 m0 = _mm_shuffle_ps(_mm_unpacklo_ps(x, y),
+            _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));
+        const __m128 m1 = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)),
+            _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 m2 = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+            _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        _mm_storeu_ps(p, m0);
+        _mm_storeu_ps(p + 4, m1);
+        _mm_storeu_ps(p + 8, m2);
+    }
+
+    inline __m128i EncodeOctahedralPS(__m128 x, __m128 y, __m128 z, __m128 maxValue, int bits) noexcept {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 half = _mm_set1_ps(0.5f);
+
+        const __m128 l1 = _mm_add_ps(_mm_add_ps(AbsPS(x), AbsPS(y)), AbsPS(z));
+        const __m128 invL1 = _mm_and_ps(_mm_cmpgt_ps(l1, zero), _mm_div_ps(one, l1));
+
+        __m128 px = _mm_mul_ps(x, invL1);
+        __m128 py = _mm_mul_ps(y, invL1);
+        const __m128 lower = _mm_cmplt_ps(z, zero);
+        const __m128 foldedX = CopySignPS(_mm_sub_ps(one, AbsPS(py)), px);
+        const __m128 foldedY = CopySignPS(_mm_sub_ps(one, AbsPS(px)), py);
+        px = SelectPS(lower, foldedX, px);
+        py = SelectPS(lower, foldedY, py);
+
+        const __m128i qx = QuantizeUnitPS(_mm_add_ps(_mm_mul_ps(px, half), half), maxValue);
+        const __m128i qy = QuantizeUnitPS(_mm_add_ps(_mm_mul_ps(py, half), half), maxValue);
+        return _mm_or_si128(_mm_sll_epi32(qx, _mm_cvtsi32_si128(bits)), qy);
+    }
+
+    inline void DecodeOctahedralPS(__m128i qx, __m128i qy, uint32_t mask, __m128& x, __m128& y, __m128& z) noexcept {
+        const float centerValue = static_cast<float>((mask - 1) / 2);
+        const __m128 center = _mm_set1_ps(centerValue);
+        const __m128 scale = _mm_set1_ps(1.0f / centerValue);
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        x = _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(qx), center), scale);
+        y = _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(qy), center), scale);
+        z = _mm_sub_ps(_mm_sub_ps(one, AbsPS(x)), AbsPS(y));
+
+        const __m128 t = _mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), z), _mm_setzero_ps());
+        x = _mm_sub_ps(x, CopySignPS(t, x));
+        y = _mm_sub_ps(y, CopySignPS(t, y));
+
+        const __m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+        const __m128 invLength = _mm_div_ps(one, _mm_sqrt_ps(lengthSq));
+        x = _mm_mul_ps(x, invLength);
+        y = _mm_mul_ps(y, invLength);
+        z = _mm_mul_ps(z, invLength);
+    }
+
+    struct SmallestThreeSIMD {
+        __m128i index;
+        __m128i a, b, c;
+    };
+
+    inline SmallestThreeSIMD EncodeSmallestThreePS(const Quaternion* source, uint32_t mask) noexcept {
+        __m128 x = _mm_loadu_ps(&source[0].x);
+        __m128 y = _mm_loadu_ps(&source[1].x);
+        __m128 z = _mm_loadu_ps(&source[2].x);
+        __m128 w = _mm_loadu_ps(&source[3].x);
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+
+        // Largest magnitude, first index wins ties (matches the scalar scan)
+        __m128 largest = AbsPS(x);
+        __m128 signedLargest = x;
+        __m128i index = _mm_setzero_si128();
+        const __m128 candidates[3] = { y, z, w };
+        for (int i = 0; i < 3; ++i) {
+            const __m128 greater = _mm_cmpgt_ps(AbsPS(candidates[i]), largest);
+            largest = SelectPS(greater, AbsPS(candidates[i]), largest);
+            signedLargest = SelectPS(greater, candidates[i], signedLargest);
+            index = SelectEPI32(_mm_castps_si128(greater), _mm_set1_epi32(i + 1), index);
+        }
+
+        const __m128 flip = _mm_and_ps(_mm_cmplt_ps(signedLargest, _mm_setzero_ps()), SIGN_MASK);
+        x = _mm_xor_ps(x, flip);
+        y = _mm_xor_ps(y, flip);
+        z = _mm_xor_ps(z, flip);
+        w = _mm_xor_ps(w, flip);
+
+        // Remaining components in order: a = idx==0 ? y : x, b = idx<=1 ? z : y, c = idx<=2 ? w : z
+        const __m128 is0 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_setzero_si128()));
+        const __m128 le1 = _mm_castsi128_ps(_mm_cmplt_epi32(index, _mm_set1_epi32(2)));
+        const __m128 le2 = _mm_castsi128_ps(_mm_cmplt_epi32(index, _mm_set1_epi32(3)));
+        const __m128 a = SelectPS(is0, y, x);
+        const __m128 b = SelectPS(le1, z, y);
+        const __m128 c = SelectPS(le2, w, z);
+
+        const __m128 scale = _mm_set1_ps(0.5f * SQRT2);
+        const __m128 half = _mm_set1_ps(0.5f);
+        const __m128 range = _mm_set1_ps(static_cast<float>(mask - 1));
+        return {
+            index,
+            QuantizeUnitPS(_mm_add_ps(_mm_mul_ps(a, scale), half), range),
+            QuantizeUnitPS(_mm_add_ps(_mm_mul_ps(b, scale), half), range),
+            QuantizeUnitPS(_mm_add_ps(_mm_mul_ps(c, scale), half), range)
+        };
+    }
+
+    inline void DecodeSmallestThreePS(const SmallestThreeSIMD& packed, uint32_t mask, Quaternion* destination) noexcept {
+        const float centerValue = static_cast<float>((mask - 1) / 2);
+        const __m128 center = _mm_set1_ps(centerValue);
+        const __m128 scale = _mm_set1_ps(INV_SQRT2 / centerValue);
+        const __m128 a = _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(packed.a), center), scale);
+        const __m128 b = _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(packed.b), center), scale);
+        const __m128 c = _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(packed.c), center), scale);
+
+        const __m128 sumSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, a), _mm_mul_ps(b, b)), _mm_mul_ps(c, c));
+        const __m128 largest = _mm_sqrt_ps(_mm_max_ps(_mm_setzero_ps(), _mm_sub_ps(_mm_set1_ps(1.0f), sumSq)));
+
+        const __m128 is0 = _mm_castsi128_ps(_mm_cmpeq_epi32(packed.index, _mm_setzero_si128()));
+        const __m128 is1 = _mm_castsi128_ps(_mm_cmpeq_epi32(packed.index, _mm_set1_epi32(1)));
+        const __m128 is2 = _mm_castsi128_ps(_mm_cmpeq_epi32(packed.index, _mm_set1_epi32(2)));
+        const __m128 is3 = _mm_castsi128_ps(_mm_cmpeq_epi32(packed.index, _mm_set1_epi32(3)));
+
+        __m128 x = SelectPS(is0, largest, a);
+        __m128 y = SelectPS(is0, a, SelectPS(is1, largest, b));
+        __m128 z = SelectPS(_mm_or_ps(is0, is1), b, SelectPS(is2, largest, c));
+        __m128 w = SelectPS(is3, largest, c);
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+
+        _mm_storeu_ps(&destination[0].x, x);
+        _mm_storeu_ps(&destination[1].x, y);
+        _mm_storeu_ps(&destination[2].x, z);
+        _mm_storeu_ps(&destination[3].x, w);
+    }
+
+}
+
+#pragma endregion
+
+// =============================================================================
+// Half Precision
+// =============================================================================
+#pragma region Half
+
+uint16_t Akhanda::Math::FloatToHalf(float value) noexcept {
+    uint32_t bits = std::bit_cast<uint32_t>(value);
+    const uint32_t sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    uint32_t result;
+    if (bits >= F16_MAX_AS_F32) {
+        // Overflow to infinity; NaN becomes a quiet NaN
+        result = bits > F32_INFINITY ? 0x7E00u : 0x7C00u;
+    }
+    else if (bits < F16_MIN_NORMAL_AS_F32) {
+        // Subnormal result: let the FPU round the mantissa by adding a magic value
+        const float rounded = std::bit_cast<float>(bits) + std::bit_cast<float>(F16_SUBNORMAL_MAGIC);
+        result = std::bit_cast<uint32_t>(rounded) - F16_SUBNORMAL_MAGIC;
+    }
+    else {
+        const uint32_t mantissaOdd = (bits >> 13) & 1u;
+        bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xFFFu;
+        bits += mantissaOdd;
+        result = bits >> 13;
+    }
+
+    return static_cast<uint16_t>(result | (sign >> 16));
+}
+
+float Akhanda::Math::HalfToFloat(uint16_t value) noexcept {
+    const uint32_t exponentMantissa = value & 0x7FFFu;
+    uint32_t bits = std::bit_cast<uint32_t>(std::bit_cast<float>(exponentMantissa << 13) * std::bit_cast<float>(F16_TO_F32_MAGIC));
+    if (exponentMantissa > 0x7BFFu) {
+        bits |= F32_INFINITY; // Inf/NaN keep their payload
+    }
+    bits |= static_cast<uint32_t>(value & 0x8000u) << 16;
+    return std::bit_cast<float>(bits);
+}
+
+void Akhanda::Math::FloatToHalf(const float* input, uint16_t* output, size_t count) noexcept {
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    for (; i + 8 <= count; i += 8) {
+        const __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(input + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), halves);
+    }
+#endif
+
+    const __m128i subnormalMagic = _mm_set1_epi32(static_cast<int>(F16_SUBNORMAL_MAGIC));
+    const __m128i normalBias = _mm_set1_epi32(static_cast<int>(0xFFFu - ((127u - 15u) << 23)));
+    for (; i + 4 <= count; i += 4) {
+        const __m128 value = _mm_loadu_ps(input + i);
+        const __m128 sign = _mm_and_ps(value, SIGN_MASK);
+        const __m128 absValue = _mm_xor_ps(value, sign);
+        const __m128i absBits = _mm_castps_si128(absValue);
+
+        const __m128i isRegular = _mm_cmpgt_epi32(_mm_set1_epi32(static_cast<int>(F16_MAX_AS_F32)), absBits);
+        const __m128i nanBit = _mm_and_si128(_mm_castps_si128(_mm_cmpunord_ps(absValue, absValue)), _mm_set1_epi32(0x200));
+        const __m128i special = _mm_or_si128(nanBit, _mm_set1_epi32(0x7C00));
+
+        const __m128i isSubnormal = _mm_cmpgt_epi32(_mm_set1_epi32(static_cast<int>(F16_MIN_NORMAL_AS_F32)), absBits);
+        const __m128i subnormal = _mm_sub_epi32(
+            _mm_castps_si128(_mm_add_ps(absValue, _mm_castsi128_ps(subnormalMagic))), subnormalMagic);
+
+        const __m128i mantissaOdd = _mm_srai_epi32(_mm_slli_epi32(absBits, 31 - 13), 31);
+        const __m128i normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(absBits, normalBias), mantissaOdd), 13);
+
+        const __m128i finite = SelectEPI32(isSubnormal, subnormal, normal);
+        const __m128i result = _mm_or_si128(SelectEPI32(isRegular, finite, special),
+            _mm_srai_epi32(_mm_castps_si128(sign), 16));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(result, result));
+    }
+
+    for (; i < count; ++i) {
+        output[i] = FloatToHalf(input[i]);
+    }
+}
+
+void Akhanda::Math::HalfToFloat(const uint16_t* input, float* output, size_t count) noexcept {
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(output + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i))));
+    }
+#endif
+
+    const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(F16_TO_F32_MAGIC)));
+    for (; i + 4 <= count; i += 4) {
+        const __m128i halves = _mm_unpacklo_epi16(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + i)), _mm_setzero_si128());
+        const __m128i exponentMantissa = _mm_and_si128(halves, _mm_set1_epi32(0x7FFF));
+        const __m128i sign = _mm_slli_epi32(_mm_xor_si128(halves, exponentMantissa), 16);
+
+        const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exponentMantissa, 13)), magic);
+        const __m128i wasInfNaN = _mm_cmpgt_epi32(exponentMantissa, _mm_set1_epi32(0x7BFF));
+        const __m128i infNaN = _mm_and_si128(wasInfNaN, _mm_set1_epi32(static_cast<int>(F32_INFINITY)));
+
+        _mm_storeu_ps(output + i, _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, infNaN))));
+    }
+
+    for (; i < count; ++i) {
+        output[i] = HalfToFloat(input[i]);
+    }
+}
+
+#pragma endregion
+
+// =============================================================================
+// Normalized Integers
+// =============================================================================
+#pragma region Normalized
+
+int8_t Akhanda::Math::FloatToSnorm8(float value) noexcept {
+    return static_cast<int8_t>(QuantizeSigned(value, SNORM8_SCALE));
+}
+
+float Akhanda::Math::Snorm8ToFloat(int8_t value) noexcept {
+    return Max(static_cast<float>(value) * (1.0f / SNORM8_SCALE), -1.0f);
+}
+
+uint8_t Akhanda::Math::FloatToUnorm8(float value) noexcept {
+    return static_cast<uint8_t>(QuantizeUnit(value, 0xFFu));
+}
+
+float Akhanda::Math::Unorm8ToFloat(uint8_t value) noexcept {
+    return static_cast<float>(value) * (1.0f / UNORM8_SCALE);
+}
+
+int16_t Akhanda::Math::FloatToSnorm16(float value) noexcept {
+    return static_cast<int16_t>(QuantizeSigned(value, SNORM16_SCALE));
+}
+
+float Akhanda::Math::Snorm16ToFloat(int16_t value) noexcept {
+    return Max(static_cast<float>(value) * (1.0f / SNORM16_SCALE), -1.0f);
+}
+
+uint16_t Akhanda::Math::FloatToUnorm16(float value) noexcept {
+    return static_cast<uint16_t>(QuantizeUnit(value, 0xFFFFu));
+}
+
+float Akhanda::Math::Unorm16ToFloat(uint16_t value) noexcept {
+    return static_cast<float>(value) * (1.0f / UNORM16_SCALE);
+}
+
+void Akhanda::Math::FloatToSnorm8(const float* input, int8_t* output, size_t count) noexcept {
+    const __m128 scale = _mm_set1_ps(SNORM8_SCALE);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i q0 = QuantizeSignedPS(_mm_loadu_ps(input + i), scale);
+        const __m128i q1 = QuantizeSignedPS(_mm_loadu_ps(input + i + 4), scale);
+        const __m128i q2 = QuantizeSignedPS(_mm_loadu_ps(input + i + 8), scale);
+        const __m128i q3 = QuantizeSignedPS(_mm_loadu_ps(input + i + 12), scale);
+        const __m128i packed = _mm_packs_epi16(_mm_packs_epi32(q0, q1), _mm_packs_epi32(q2, q3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), packed);
+    }
+    for (; i < count; ++i) {
+        output[i] = FloatToSnorm8(input[i]);
+    }
+}
+
+void Akhanda::Math::Snorm8ToFloat(const int8_t* input, float* output, size_t count) noexcept {
+    const __m128 scale = _mm_set1_ps(1.0f / SNORM8_SCALE);
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const __m128i low16 = _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+        const __m128i high16 = _mm_srai_epi16(_mm_unpackhi_epi8(bytes, bytes), 8);
+        const __m128i words[4] = {
+            _mm_srai_epi32(_mm_unpacklo_epi16(low16, low16), 16),
+            _mm_srai_epi32(_mm_unpackhi_epi16(low16, low16), 16),
+            _mm_srai_epi32(_mm_unpacklo_epi16(high16, high16), 16),
+            _mm_srai_epi32(_mm_unpackhi_epi16(high16, high16), 16)
+        };
+        for (int j = 0; j < 4; ++j) {
+            _mm_storeu_ps(output + i + j * 4, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(words[j]), scale), minusOne));
+        }
+    }
+    for (; i < count; ++i) {
+        output[i] = Snorm8ToFloat(input[i]);
+    }
+}
+
+void Akhanda::Math::FloatToUnorm8(const float* input, uint8_t* output, size_t count) noexcept {
+    const __m128 range = _mm_set1_ps(UNORM8_SCALE);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i q0 = QuantizeUnitPS(_mm_loadu_ps(input + i), range);
+        const __m128i q1 = QuantizeUnitPS(_mm_loadu_ps(input + i + 4), range);
+        const __m128i q2 = QuantizeUnitPS(_mm_loadu_ps(input + i + 8), range);
+        const __m128i q3 = QuantizeUnitPS(_mm_loadu_ps(input + i + 12), range);
+        const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(q0, q1), _mm_packs_epi32(q2, q3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), packed);
+    }
+    for (; i < count; ++i) {
+        output[i] = FloatToUnorm8(input[i]);
+    }
+}
+
+void Akhanda::Math::Unorm8ToFloat(const uint8_t* input, float* output, size_t count) noexcept {
+    const __m128 scale = _mm_set1_ps(1.0f / UNORM8_SCALE);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const __m128i low16 = _mm_unpacklo_epi8(bytes, zero);
+        const __m128i high16 = _mm_unpackhi_epi8(bytes, zero);
+        const __m128i words[4] = {
+            _mm_unpacklo_epi16(low16, zero), _mm_unpackhi_epi16(low16, zero),
+            _mm_unpacklo_epi16(high16, zero), _mm_unpackhi_epi16(high16, zero)
+        };
+        for (int j = 0; j < 4; ++j) {
+            _mm_storeu_ps(output + i + j * 4, _mm_mul_ps(_mm_cvtepi32_ps(words[j]), scale));
+        }
+    }
+    for (; i < count; ++i) {
+        output[i] = Unorm8ToFloat(input[i]);
+    }
+}
+
+void Akhanda::Math::FloatToSnorm16(const float* input, int16_t* output, size_t count) noexcept {
+    const __m128 scale = _mm_set1_ps(SNORM16_SCALE);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i q0 = QuantizeSignedPS(_mm_loadu_ps(input + i), scale);
+        const __m128i q1 = QuantizeSignedPS(_mm_loadu_ps(input + i + 4), scale);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(q0, q1));
+    }
+    for (; i < count; ++i) {
+        output[i] = FloatToSnorm16(input[i]);
+    }
+}
+
+void Akhanda::Math::Snorm16ToFloat(const int16_t* input, float* output, size_t count) noexcept {
+    const __m128 scale = _mm_set1_ps(1.0f / SNORM16_SCALE);
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(words, words), 16);
+        const __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(words, words), 16);
+        _mm_storeu_ps(output + i, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(low), scale), minusOne));
+        _mm_storeu_ps(output + i + 4, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(high), scale), minusOne));
+    }
+    for (; i < count; ++i) {
+        output[i] = Snorm16ToFloat(input[i]);
+    }
+}
+
+void Akhanda::Math::FloatToUnorm16(const float* input, uint16_t* output, size_t count) noexcept {
+    const __m128 range = _mm_set1_ps(UNORM16_SCALE);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i q0 = QuantizeUnitPS(_mm_loadu_ps(input + i), range);
+        const __m128i q1 = QuantizeUnitPS(_mm_loadu_ps(input + i + 4), range);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), PackUInt16(q0, q1));
+    }
+    for (; i < count; ++i) {
+        output[i] = FloatToUnorm16(input[i]);
+    }
+}
+
+void Akhanda::Math::Unorm16ToFloat(const uint16_t* input, float* output, size_t count) noexcept {
+    const __m128 scale = _mm_set1_ps(1.0f / UNORM16_SCALE);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        _mm_storeu_ps(output + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(words, zero)), scale));
+        _mm_storeu_ps(output + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(words, zero)), scale));
+    }
+    for (; i < count; ++i) {
+        output[i] = Unorm16ToFloat(input[i]);
+    }
+}
+
+#pragma endregion
+
+// =============================================================================
+// Octahedral Normals
+// =============================================================================
+#pragma region Octahedral
+
+uint16_t Akhanda::Math::EncodeOctahedral16(const Vector3& normal) noexcept {
+    return static_cast<uint16_t>(EncodeOctahedral(normal, OCT16_MASK, 8));
+}
+
+Vector3 Akhanda::Math::DecodeOctahedral16(uint16_t packed) noexcept {
+    return DecodeOctahedral(packed >> 8, packed & OCT16_MASK, OCT16_MASK);
+}
+
+uint32_t Akhanda::Math::EncodeOctahedral32(const Vector3& normal) noexcept {
+    return EncodeOctahedral(normal, OCT32_MASK, 16);
+}
+
+Vector3 Akhanda::Math::DecodeOctahedral32(uint32_t packed) noexcept {
+    return DecodeOctahedral(packed >> 16, packed & OCT32_MASK, OCT32_MASK);
+}
+
+void Akhanda::Math::EncodeOctahedral16(const Vector3* normals, uint16_t* output, size_t count) noexcept {
+    const __m128 range = _mm_set1_ps(static_cast<float>(OCT16_MASK - 1));
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 x, y, z;
+        LoadVector3x4(normals + i, x, y, z);
+        const __m128i packed = EncodeOctahedralPS(x, y, z, range, 8);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output + i), PackUInt16(packed, packed));
+    }
+    for (; i < count; ++i) {
+        output[i] = EncodeOctahedral16(normals[i]);
+    }
+}
+
+void Akhanda::Math::DecodeOctahedral16(const uint16_t* packed, Vector3* output, size_t count) noexcept {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i words = _mm_unpacklo_epi16(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(packed + i)), _mm_setzero_si128());
+        __m128 x, y, z;
+        DecodeOctahedralPS(_mm_srli_epi32(words, 8), _mm_and_si128(words, _mm_set1_epi32(OCT16_MASK)),
+            OCT16_MASK, x, y, z);
+        StoreVector3x4(output + i, x, y, z);
+    }
+    for (; i < count; ++i) {
+        output[i] = DecodeOctahedral16(packed[i]);
+    }
+}
+
+void Akhanda::Math::EncodeOctahedral32(const Vector3* normals, uint32_t* output, size_t count) noexcept {
+    const __m128 range = _mm_set1_ps(static_cast<float>(OCT32_MASK - 1));
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 x, y, z;
+        LoadVector3x4(normals + i, x, y, z);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), EncodeOctahedralPS(x, y, z, range, 16));
+    }
+    for (; i < count; ++i) {
+        output[i] = EncodeOctahedral32(normals[i]);
+    }
+}
+
+void Akhanda::Math::DecodeOctahedral32(const uint32_t* packed, Vector3* output, size_t count) noexcept {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(packed + i));
+        __m128 x, y, z;
+        DecodeOctahedralPS(_mm_srli_epi32(words, 16), _mm_and_si128(words, _mm_set1_epi32(OCT32_MASK)),
+            OCT32_MASK, x, y, z);
+        StoreVector3x4(output + i, x, y, z);
+    }
+    for (; i < count; ++i) {
+        output[i] = DecodeOctahedral32(packed[i]);
+    }
+}
+
+#pragma endregion
+
+// =============================================================================
+// Smallest-Three Quaternions
+// =============================================================================
+#pragma region Quaternions
+
+uint32_t Akhanda::Math::PackQuaternion32(const Quaternion& rotation) noexcept {
+    return ToBits32(EncodeSmallestThree(rotation, QUAT32_MASK));
+}
+
+Quaternion Akhanda::Math::UnpackQuaternion32(uint32_t packed) noexcept {
+    return DecodeSmallestThree(FromBits32(packed), QUAT32_MASK);
+}
+
+PackedQuaternion48 Akhanda::Math::PackQuaternion48(const Quaternion& rotation) noexcept {
+    return ToWords48(ToBits48(EncodeSmallestThree(rotation, QUAT48_MASK)));
+}
+
+Quaternion Akhanda::Math::UnpackQuaternion48(const PackedQuaternion48& packed) noexcept {
+    return DecodeSmallestThree(FromBits48(FromWords48(packed)), QUAT48_MASK);
+}
+
+uint64_t Akhanda::Math::PackQuaternion64(const Quaternion& rotation) noexcept {
+    return ToBits64(EncodeSmallestThree(rotation, QUAT64_MASK));
+}
+
+Quaternion Akhanda::Math::UnpackQuaternion64(uint64_t packed) noexcept {
+    return DecodeSmallestThree(FromBits64(packed), QUAT64_MASK);
+}
+
+void Akhanda::Math::PackQuaternion32(const Quaternion* rotations, uint32_t* output, size_t count) noexcept {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const SmallestThreeSIMD s = EncodeSmallestThreePS(rotations + i, QUAT32_MASK);
+        const __m128i bits = _mm_or_si128(
+            _mm_or_si128(_mm_slli_epi32(s.index, 30), _mm_slli_epi32(s.a, 20)),
+            _mm_or_si128(_mm_slli_epi32(s.b, 10), s.c));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), bits);
+    }
+    for (; i < count; ++i) {
+        output[i] = PackQuaternion32(rotations[i]);
+    }
+}
+
+void Akhanda::Math::UnpackQuaternion32(const uint32_t* packed, Quaternion* output, size_t count) noexcept {
+    const __m128i mask = _mm_set1_epi32(QUAT32_MASK);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(packed + i));
+        const SmallestThreeSIMD s = {
+            _mm_srli_epi32(bits, 30),
+            _mm_and_si128(_mm_srli_epi32(bits, 20), mask),
+            _mm_and_si128(_mm_srli_epi32(bits, 10), mask),
+            _mm_and_si128(bits, mask)
+        };
+        DecodeSmallestThreePS(s, QUAT32_MASK, output + i);
+    }
+    for (; i < count; ++i) {
+        output[i] = UnpackQuaternion32(packed[i]);
+    }
+}
+
+void Akhanda::Math::PackQuaternion48(const Quaternion* rotations, PackedQuaternion48* output, size_t count) noexcept {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const SmallestThreeSIMD s = EncodeSmallestThreePS(rotations + i, QUAT48_MASK);
+        // Bits 0..31: c | b << 15 | a << 30, bits 32..47: a >> 2 | index << 13
+        alignas(16) uint32_t low[4];
+        alignas(16) uint32_t high[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(low),
+            _mm_or_si128(_mm_or_si128(s.c, _mm_slli_epi32(s.b, 15)), _mm_slli_epi32(s.a, 30)));
+        _mm_store_si128(reinterpret_cast<__m128i*>(high),
+            _mm_or_si128(_mm_srli_epi32(s.a, 2), _mm_slli_epi32(s.index, 13)));
+        for (size_t j = 0; j < 4; ++j) {
+            output[i + j] = { { static_cast<uint16_t>(low[j]), static_cast<uint16_t>(low[j] >> 16), static_cast<uint16_t>(high[j]) } };
+        }
+    }
+    for (; i < count; ++i) {
+        output[i] = PackQuaternion48(rotations[i]);
+    }
+}
+
+void Akhanda::Math::UnpackQuaternion48(const PackedQuaternion48* packed, Quaternion* output, size_t count) noexcept {
+    const __m128i mask = _mm_set1_epi32(QUAT48_MASK);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const PackedQuaternion48* p = packed + i;
+        const __m128i low = _mm_setr_epi32(
+            p[0].words[0] | (p[0].words[1] << 16), p[1].words[0] | (p[1].words[1] << 16),
+            p[2].words[0] | (p[2].words[1] << 16), p[3].words[0] | (p[3].words[1] << 16));
+        const __m128i high = _mm_setr_epi32(p[0].words[2], p[1].words[2], p[2].words[2], p[3].words[2]);
+        const SmallestThreeSIMD s = {
+            _mm_and_si128(_mm_srli_epi32(high, 13), _mm_set1_epi32(3)),
+            _mm_or_si128(_mm_srli_epi32(low, 30), _mm_slli_epi32(_mm_and_si128(high, _mm_set1_epi32(0x1FFF)), 2)),
+            _mm_and_si128(_mm_srli_epi32(low, 15), mask),
+            _mm_and_si128(low, mask)
+        };
+        DecodeSmallestThreePS(s, QUAT48_MASK, output + i);
+    }
+    for (; i < count; ++i) {
+        output[i] = UnpackQuaternion48(packed[i]);
+    }
+}
+
+void Akhanda::Math::PackQuaternion64(const Quaternion* rotations, uint64_t* output, size_t count) noexcept {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const SmallestThreeSIMD s = EncodeSmallestThreePS(rotations + i, QUAT64_MASK);
+        // Bits 0..31: c | b << 20, bits 32..63: b >> 12 | a << 8 | index << 30
+        const __m128i low = _mm_or_si128(s.c, _mm_slli_epi32(s.b, 20));
+        const __m128i high = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(s.b, 12), _mm_slli_epi32(s.a, 8)),
+            _mm_slli_epi32(s.index, 30));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_unpacklo_epi32(low, high));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 2), _mm_unpackhi_epi32(low, high));
+    }
+    for (; i < count; ++i) {
+        output[i] = PackQuaternion64(rotations[i]);
+    }
+}
+
+void Akhanda::Math::UnpackQuaternion64(const uint64_t* packed, Quaternion* output, size_t count) noexcept {
+    const __m128i mask = _mm_set1_epi32(QUAT64_MASK);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128 first = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(packed + i)));
+        const __m128 second = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(packed + i + 2)));
+        const __m128i low = _mm_castps_si128(_mm_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0)));
+        const __m128i high = _mm_castps_si128(_mm_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1)));
+        const SmallestThreeSIMD s = {
+            _mm_srli_epi32(high, 30),
+            _mm_and_si128(_mm_srli_epi32(high, 8), mask),
+            _mm_or_si128(_mm_srli_epi32(low, 20), _mm_slli_epi32(_mm_and_si128(high, _mm_set1_epi32(0xFF)), 12)),
+            _mm_and_si128(low, mask)
+        };
+        DecodeSmallestThreePS(s, QUAT64_MASK, output + i);
+    }
+    for (; i < count; ++i) {
+        output[i] = UnpackQuaternion64(packed[i]);
+    }
+}
+
+#pragma endregion
+
+// =============================================================================
+// Position Quantizer
+// =============================================================================
+#pragma region PositionQuantizer
+
+PositionQuantizer::PositionQuantizer() noexcept
+    : PositionQuantizer(AABB(Vector3(-1.0f, -1.0f, -1.0f), Vector3::ONE)) {
+}
+
+PositionQuantizer::PositionQuantizer(const AABB& bounds) noexcept
+    : bounds_(bounds) {
+    const Vector3 extent = bounds.max - bounds.min;
+    // A flat axis quantizes everything to min
+    scale_ = Vector3(
+        extent.x > 0.0f ? POSITION_SCALE / extent.x : 0.0f,
+        extent.y > 0.0f ? POSITION_SCALE / extent.y : 0.0f,
+        extent.z > 0.0f ? POSITION_SCALE / extent.z : 0.0f);
+    step_ = Vector3(Max(extent.x, 0.0f), Max(extent.y, 0.0f), Max(extent.z, 0.0f)) / POSITION_SCALE;
+}
+
+QuantizedPosition PositionQuantizer::Encode(const Vector3& position) const noexcept {
+    const auto quantize = [](float value, float min, float scale) noexcept {
+        return static_cast<uint16_t>(static_cast<uint32_t>(Clamp((value - min) * scale, 0.0f, POSITION_SCALE) + 0.5f));
+    };
+    return {
+        quantize(position.x, bounds_.min.x, scale_.x),
+        quantize(position.y, bounds_.min.y, scale_.y),
+        quantize(position.z, bounds_.min.z, scale_.z)
+    };
+}
+
+Vector3 PositionQuantizer::Decode(const QuantizedPosition& quantized) const noexcept {
+    return Vector3(
+        static_cast<float>(quantized.x) * step_.x + bounds_.min.x,
+        static_cast<float>(quantized.y) * step_.y + bounds_.min.y,
+        static_cast<float>(quantized.z) * step_.z + bounds_.min.z);
+}
+
+void PositionQuantizer::Encode(const Vector3* positions, QuantizedPosition* output, size_t count) const noexcept {
+    const __m128 minX = _mm_set1_ps(bounds_.min.x), minY = _mm_set1_ps(bounds_.min.y), minZ = _mm_set1_ps(bounds_.min.z);
+    const __m128 scaleX = _mm_set1_ps(scale_.x), scaleY = _mm_set1_ps(scale_.y), scaleZ = _mm_set1_ps(scale_.z);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 top = _mm_set1_ps(POSITION_SCALE);
+    const __m128 half = _mm_set1_ps(0.5f);
+
+    const auto quantize = [&](__m128 value, __m128 min, __m128 scale) noexcept {
+        const __m128 t = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(value, min), scale), zero), top);
+        return _mm_cvttps_epi32(_mm_add_ps(t, half));
+    };
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 x, y, z;
+        LoadVector3x4(positions + i, x, y, z);
+
+        alignas(16) uint32_t qx[4], qy[4], qz[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(qx), quantize(x, minX, scaleX));
+        _mm_store_si128(reinterpret_cast<__m128i*>(qy), quantize(y, minY, scaleY));
+        _mm_store_si128(reinterpret_cast<__m128i*>(qz), quantize(z, minZ, scaleZ));
+        for (size_t j = 0; j < 4; ++j) {
+            output[i + j] = { static_cast<uint16_t>(qx[j]), static_cast<uint16_t>(qy[j]), static_cast<uint16_t>(qz[j]) };
+        }
+    }
+    for (; i < count; ++i) {
+        output[i] = Encode(positions[i]);
+    }
+}
+
+void PositionQuantizer::Decode(const QuantizedPosition* quantized, Vector3* output, size_t count) const noexcept {
+    const __m128 minX = _mm_set1_ps(bounds_.min.x), minY = _mm_set1_ps(bounds_.min.y), minZ = _mm_set1_ps(bounds_.min.z);
+    const __m128 stepX = _mm_set1_ps(step_.x), stepY = _mm_set1_ps(step_.y), stepZ = _mm_set1_ps(step_.z);
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        // 4 x 6 bytes = three 64-bit loads of interleaved x y z words
+        const uint16_t* words = &quantized[i].x;
+        const __m128i w0 = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(words)), zero);     // x0 y0 z0 x1
+        const __m128i w1 = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(words + 4)), zero); // y1 z1 x2 y2
+        const __m128i w2 = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(words + 8)), zero); // z2 x3 y3 z3
+
+        __m128 x, y, z;
+        Deinterleave3(_mm_cvtepi32_ps(w0), _mm_cvtepi32_ps(w1), _mm_cvtepi32_ps(w2), x, y, z);
+
+        StoreVector3x4(output + i,
+            _mm_add_ps(_mm_mul_ps(x, stepX), minX),
+            _mm_add_ps(_mm_mul_ps(y, stepY), minY),
+            _mm_add_ps(_mm_mul_ps(z, stepZ), minZ));
+    }
+    for (; i < count; ++i) {
+        output[i] = Decode(quantized[i]);
+    }
+}
+
+#pragma endregion
@@ -0,0 +1,565 @@
+// Core.Math.Random.cpp - High-throughput random streams (xoshiro256++)
+module;
+
+#include <immintrin.h>
+#include <bit>
+#include <cstring>
+
+module Akhanda.Core.Math;
+
+import <algorithm>;
+import <cmath>;
+
+using namespace Akhanda::Math;
+
+// =============================================================================
+// Private Helpers
+// =============================================================================
+#pragma region Helpers
+
+namespace {
+
+    constexpr uint64_t DEFAULT_SEED = 0x853C49E6748FEA9BULL;
+
+    // Jump polynomials from the xoshiro256 reference implementation
+    constexpr uint64_t JUMP[4] = {
+        0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+    };
+    constexpr uint64_t LONG_JUMP[4] = {
+        0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL, 0x77710069854EE241ULL, 0x39109BB02ACBE635ULL
+    };
+
+    constexpr float UINT24_TO_FLOAT = 1.0f / 16777216.0f;
+
+    // sin/cos polynomial coefficients on [-PI/4, PI/4] (Cephes)
+    constexpr float SIN_C1 = -1.6666654611e-1f;
+    constexpr float SIN_C2 = 8.3321608736e-3f;
+    constexpr float SIN_C3 = -1.9515295891e-4f;
+    constexpr float COS_C1 = 4.166664568298827e-2f;
+    constexpr float COS_C2 = -1.388731625493765e-3f;
+    constexpr float COS_C3 = 2.443315711809948e-5f;
+
+    // logf polynomial coefficients (Cephes)
+    constexpr float LOG_SQRTHF = 0.707106781186547524f;
+    constexpr float LOG_P0 = 7.0376836292e-2f;
+    constexpr float LOG_P1 = -1.1514610310e-1f;
+    constexpr float LOG_P2 = 1.1676998740e-1f;
+    constexpr float LOG_P3 = -1.2420140846e-1f;
+    constexpr float LOG_P4 = 1.4249322787e-1f;
+    constexpr float LOG_P5 = -1.6668057665e-1f;
+    constexpr float LOG_P6 = 2.0000714765e-1f;
+    constexpr float LOG_P7 = -2.4999993993e-1f;
+    constexpr float LOG_P8 = 3.3333331174e-1f;
+    constexpr float LOG_Q1 = -2.12194440e-4f;
+    constexpr float LOG_Q2 = 0.693359375f;
+
+    inline uint64_t RotateLeft(uint64_t x, int k) noexcept {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    inline uint64_t SplitMix64(uint64_t& state) noexcept {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // One xoshiro256++ step of a single lane of a [word][lane] state
+    inline uint64_t StepLane(uint64_t (&s)[4][RandomStream::LANE_COUNT], size_t lane) noexcept {
+        const uint64_t result = RotateLeft(s[0][lane] + s[3][lane], 23) + s[0][lane];
+        const uint64_t t = s[1][lane] << 17;
+
+        s[2][lane] ^= s[0][lane];
+        s[3][lane] ^= s[1][lane];
+        s[1][lane] ^= s[2][lane];
+        s[0][lane] ^= s[3][lane];
+        s[2][lane] ^= t;
+        s[3][lane] = RotateLeft(s[3][lane], 45);
+
+        return result;
+    }
+
+    void JumpLane(uint64_t (&s)[4][RandomStream::LANE_COUNT], size_t lane, const uint64_t (&polynomial)[4]) noexcept {
+        uint64_t accumulated[4] = { 0, 0, 0, 0 };
+
+        for (const uint64_t word : polynomial) {
+            for (int bit = 0; bit < 64; ++bit) {
+                if (word & (1ULL << bit)) {
+                    for (size_t w = 0; w < 4; ++w) {
+                        accumulated[w] ^= s[w][lane];
+                    }
+                }
+                StepLane(s, lane);
+            }
+        }
+
+        for (size_t w = 0; w < 4; ++w) {
+            s[w][lane] = accumulated[w];
+        }
+    }
+
+    // Top 24 bits of a 32-bit value mapped to [0, 1)
+    inline float ToUnitFloat(uint32_t value) noexcept {
+        return static_cast<float>(value >> 8) * UINT24_TO_FLOAT;
+    }
+
+    // Lemire multiply-shift reduction to [0, range)
+    inline uint32_t ReduceRange(uint32_t value, uint32_t range) noexcept {
+        return static_cast<uint32_t>((static_cast<uint64_t>(value) * range) >> 32);
+    }
+
+    // sin/cos of (turns * 2 PI) for turns in [0, 1). Every operation below is
+    // mirrored one-to-one by the AVX2 path so both produce identical bits.
+    inline void SinCosTurns(float turns, float& sine, float& cosine) noexcept {
+        const float t = turns * 4.0f;
+        const float q = std::floor(t + 0.5f);
+        const float x = (t - q) * HALF_PI;
+        const float x2 = x * x;
+
+        const float sinX = x + (x * x2) * (SIN_C1 + x2 * (SIN_C2 + x2 * SIN_C3));
+        const float cosX = (1.0f - 0.5f * x2) + (x2 * x2) * (COS_C1 + x2 * (COS_C2 + x2 * COS_C3));
+
+        const int quadrant = static_cast<int>(q) & 3;
+        const bool swap = (quadrant & 1) != 0;
+        const bool negateSin = (quadrant & 2) != 0;
+        const bool negateCos = ((quadrant & 1) ^ ((quadrant >> 1) & 1)) != 0;
+
+        sine = swap ? cosX : sinX;
+        cosine = swap ? sinX : cosX;
+        if (negateSin) sine = -sine;
+        if (negateCos) cosine = -cosine;
+    }
+
+    // Natural log for x in (0, 1]
+    inline float LogPositive(float x) noexcept {
+        uint32_t bits = std::bit_cast<uint32_t>(x);
+        const int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xFF) - 126;
+        bits = (bits & 0x807FFFFFu) | 0x3F000000u;
+        float m = std::bit_cast<float>(bits);
+
+        const bool below = m < LOG_SQRTHF;
+        const float e = static_cast<float>(exponent) - (below ? 1.0f : 0.0f);
+        m = (m + (below ? m : 0.0f)) - 1.0f;
+
+        const float z = m * m;
+        float y = LOG_P0;
+        y = y * m + LOG_P1;
+        y = y * m + LOG_P2;
+        y = y * m + LOG_P3;
+        y = y * m + LOG_P4;
+        y = y * m + LOG_P5;
+        y = y * m + LOG_P6;
+        y = y * m + LOG_P7;
+        y = y * m + LOG_P8;
+        y = (y * m) * z;
+        y = y + LOG_Q1 * e;
+        y = y + -0.5f * z;
+        return (m + y) + LOG_Q2 * e;
+    }
+
+    // Direction on the unit sphere from two uniforms (Archimedes' projection)
+    inline Vector3 UnitVectorFromUniforms(float u, float turns) noexcept {
+        const float z = 1.0f - 2.0f * u;
+        const float rxy = std::sqrt(Max(0.0f, 1.0f - z * z));
+        float s, c;
+        SinCosTurns(turns, s, c);
+        return Vector3(rxy * c, rxy * s, z);
+    }
+
+#if defined(__AVX2__)
+
+    template<int K>
+    inline __m256i RotateLeft(__m256i x) noexcept {
+        return _mm256_or_si256(_mm256_slli_epi64(x, K), _mm256_srli_epi64(x, 64 - K));
+    }
+
+    // All four lanes held in registers for the duration of a bulk fill
+    struct LaneRegisters {
+        __m256i s0, s1, s2, s3;
+
+        explicit LaneRegisters(const uint64_t (&s)[4][RandomStream::LANE_COUNT]) noexcept
+            : s0(_mm256_load_si256(reinterpret_cast<const __m256i*>(s[0])))
+            , s1(_mm256_load_si256(reinterpret_cast<const __m256i*>(s[1])))
+            , s2(_mm256_load_si256(reinterpret_cast<const __m256i*>(s[2])))
+            , s3(_mm256_load_si256(reinterpret_cast<const __m256i*>(s[3]))) {
+        }
+
+        void Store(uint64_t (&s)[4][RandomStream::LANE_COUNT]) const noexcept {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(s[0]), s0);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(s[1]), s1);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(s[2]), s2);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(s[3]), s3);
+        }
+
+        // Four 64-bit outputs, viewed by callers as eight 32-bit values
+        __m256i Next() noexcept {
+            const __m256i result = _mm256_add_epi64(RotateLeft<23>(_mm256_add_epi64(s0, s3)), s0);
+            const __m256i t = _mm256_slli_epi64(s1, 17);
+
+            s2 = _mm256_xor_si256(s2, s0);
+            s3 = _mm256_xor_si256(s3, s1);
+            s1 = _mm256_xor_si256(s1, s2);
+            s0 = _mm256_xor_si256(s0, s3);
+            s2 = _mm256_xor_si256(s2, t);
+            s3 = RotateLeft<45>(s3);
+
+            return result;
+        }
+    };
+
+    inline __m256 ToUnitFloat(__m256i value) noexcept {
+        return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(value, 8)), _mm256_set1_ps(UINT24_TO_FLOAT));
+    }
+
+    inline __m256 Negate(__m256 value, __m256 mask) noexcept {
+        return _mm256_xor_ps(value, _mm256_and_ps(mask, _mm256_set1_ps(-0.0f)));
+    }
+
+    inline void SinCosTurns(__m256 turns, __m256& sine, __m256& cosine) noexcept {
+        const __m256 t = _mm256_mul_ps(turns, _mm256_set1_ps(4.0f));
+        const __m256 q = _mm256_round_ps(_mm256_add_ps(t, _mm256_set1_ps(0.5f)), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        const __m256 x = _mm256_mul_ps(_mm256_sub_ps(t, q), _mm256_set1_ps(HALF_PI));
+        const __m256 x2 = _mm256_mul_ps(x, x);
+
+        __m256 sinPoly = _mm256_add_ps(_mm256_set1_ps(SIN_C2), _mm256_mul_ps(x2, _mm256_set1_ps(SIN_C3)));
+        sinPoly = _mm256_add_ps(_mm256_set1_ps(SIN_C1), _mm256_mul_ps(x2, sinPoly));
+        const __m256 sinX = _mm256_add_ps(x, _mm256_mul_ps(_mm256_mul_ps(x, x2), sinPoly));
+
+        __m256 cosPoly = _mm256_add_ps(_mm256_set1_ps(COS_C2), _mm256_mul_ps(x2, _mm256_set1_ps(COS_C3)));
+        cosPoly = _mm256_add_ps(_mm256_set1_ps(COS_C1), _mm256_mul_ps(x2, cosPoly));
+        const __m256 cosX = _mm256_add_ps(
+            _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(_mm256_set1_ps(0.5f), x2)),
+            _mm256_mul_ps(_mm256_mul_ps(x2, x2), cosPoly));
+
+        const __m256i quadrant = _mm256_cvttps_epi32(q);
+        const __m256i one = _mm256_set1_epi32(1);
+        const __m256i bit0 = _mm256_and_si256(quadrant, one);
+        const __m256i bit1 = _mm256_and_si256(_mm256_srli_epi32(quadrant, 1), one);
+        const __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(bit0, one));
+        const __m256 negateSin = _mm256_castsi256_ps(_mm256_cmpeq_epi32(bit1, one));
+        const __m256 negateCos = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_xor_si256(bit0, bit1), one));
+
+        sine = Negate(_mm256_blendv_ps(sinX, cosX, swap), negateSin);
+        cosine = Negate(_mm256_blendv_ps(cosX, sinX, swap), negateCos);
+    }
+
+    inline __m256 LogPositive(__m256 x) noexcept {
+        __m256i bits = _mm256_castps_si256(x);
+        const __m256i exponent = _mm256_sub_epi32(
+            _mm256_and_si256(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(0xFF)), _mm256_set1_epi32(126));
+        bits = _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(static_cast<int>(0x807FFFFFu))), _mm256_set1_epi32(0x3F000000));
+        __m256 m = _mm256_castsi256_ps(bits);
+
+        const __m256 below = _mm256_cmp_ps(m, _mm256_set1_ps(LOG_SQRTHF), _CMP_LT_OQ);
+        const __m256 e = _mm256_sub_ps(_mm256_cvtepi32_ps(exponent), _mm256_and_ps(below, _mm256_set1_ps(1.0f)));
+        m = _mm256_sub_ps(_mm256_add_ps(m, _mm256_and_ps(below, m)), _mm256_set1_ps(1.0f));
+
+        const __m256 z = _mm256_mul_ps(m, m);
+        __m256 y = _mm256_set1_ps(LOG_P0);
+        y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(LOG_P1));
+        y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(LOG_P2));
+        y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(LOG_P3));
+        y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(LOG_P4));
+        y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(LOG_P5));
+        y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(LOG_P6));
+        y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(LOG_P7));
+        y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(LOG_P8));
+        y = _mm256_mul_ps(_mm256_mul_ps(y, m), z);
+        y = _mm256_add_ps(y, _mm256_mul_ps(_mm256_set1_ps(LOG_Q1), e));
+        y = _mm256_add_ps(y, _mm256_mul_ps(_mm256_set1_ps(-0.5f), z));
+        return _mm256_add_ps(_mm256_add_ps(m, y), _mm256_mul_ps(_mm256_set1_ps(LOG_Q2), e));
+    }
+
+    // Eight directions from two blocks: u from the even elements, turns from the odd ones
+    inline void UnitVectors(__m256 uniforms, __m256& x, __m256& y, __m256& z) noexcept {
+        const __m256 u = _mm256_moveldup_ps(uniforms);
+        const __m256 turns = _mm256_movehdup_ps(uniforms);
+
+        z = _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(_mm256_set1_ps(2.0f), u));
+        const __m256 rxy = _mm256_sqrt_ps(_mm256_max_ps(_mm256_setzero_ps(),
+            _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(z, z))));
+
+        __m256 s, c;
+        SinCosTurns(turns, s, c);
+        x = _mm256_mul_ps(rxy, c);
+        y = _mm256_mul_ps(rxy, s);
+    }
+
+#endif
+
+} // anonymous namespace
+
+#pragma endregion
+
+// =============================================================================
+// RandomStream Implementation
+// =============================================================================
+#pragma region RandomStream
+
+RandomStream::RandomStream() noexcept {
+    SetSeed(DEFAULT_SEED);
+}
+
+RandomStream::RandomStream(uint64_t seed, uint32_t streamIndex) noexcept {
+    SetSeed(seed, streamIndex);
+}
+
+void RandomStream::SetSeed(uint64_t seed, uint32_t streamIndex) noexcept {
+    uint64_t splitMix = seed;
+    for (size_t w = 0; w < 4; ++w) {
+        state_[w][0] = SplitMix64(splitMix);
+    }
+
+    // Lane N is lane N-1 advanced by 2^128 steps
+    for (size_t lane = 1; lane < LANE_COUNT; ++lane) {
+        for (size_t w = 0; w < 4; ++w) {
+            state_[w][lane] = state_[w][lane - 1];
+        }
+        JumpLane(state_, lane, JUMP);
+    }
+
+    Jump(streamIndex);
+}
+
+void RandomStream::Jump(uint32_t streamCount) noexcept {
+    for (uint32_t i = 0; i < streamCount; ++i) {
+        for (size_t lane = 0; lane < LANE_COUNT; ++lane) {
+            JumpLane(state_, lane, LONG_JUMP);
+        }
+    }
+}
+
+uint64_t RandomStream::NextUInt64() noexcept {
+    return StepLane(state_, 0);
+}
+
+uint32_t RandomStream::NextUInt() noexcept {
+    return static_cast<uint32_t>(NextUInt64() >> 32);
+}
+
+float RandomStream::NextFloat() noexcept {
+    return ToUnitFloat(NextUInt());
+}
+
+float RandomStream::NextFloat(float min, float max) noexcept {
+    return min + NextFloat() * (max - min);
+}
+
+int32_t RandomStream::NextInt(int32_t min, int32_t max) noexcept {
+    if (min >= max) return min;
+    const uint32_t range = static_cast<uint32_t>(static_cast<int64_t>(max) - static_cast<int64_t>(min));
+    return static_cast<int32_t>(static_cast<int64_t>(min) + ReduceRange(NextUInt(), range));
+}
+
+void RandomStream::NextBlock(uint32_t* block) noexcept {
+    for (size_t lane = 0; lane < LANE_COUNT; ++lane) {
+        const uint64_t value = StepLane(state_, lane);
+        block[lane * 2 + 0] = static_cast<uint32_t>(value);
+        block[lane * 2 + 1] = static_cast<uint32_t>(value >> 32);
+    }
+}
+
+void RandomStream::FillUInt(uint32_t* output, size_t count) noexcept {
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    LaneRegisters lanes(state_);
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), lanes.Next());
+    }
+    lanes.Store(state_);
+#endif
+
+    for (; i < count; i += 8) {
+        uint32_t block[8];
+        NextBlock(block);
+        std::memcpy(output + i, block, Min<size_t>(8, count - i) * sizeof(uint32_t));
+    }
+}
+
+void RandomStream::FillFloat(float* output, size_t count, float min, float max) noexcept {
+    const float scale = max - min;
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256 minVec = _mm256_set1_ps(min);
+    const __m256 scaleVec = _mm256_set1_ps(scale);
+    LaneRegisters lanes(state_);
+    for (; i + 8 <= count; i += 8) {
+        const __m256 unit = ToUnitFloat(lanes.Next());
+        _mm256_storeu_ps(output + i, _mm256_add_ps(minVec, _mm256_mul_ps(unit, scaleVec)));
+    }
+    lanes.Store(state_);
+#endif
+
+    for (; i < count; i += 8) {
+        uint32_t block[8];
+        NextBlock(block);
+        const size_t n = Min<size_t>(8, count - i);
+        for (size_t j = 0; j < n; ++j) {
+            output[i + j] = min + ToUnitFloat(block[j]) * scale;
+        }
+    }
+}
+
+void RandomStream::FillInt(int32_t* output, size_t count, int32_t min, int32_t max) noexcept {
+    if (min >= max) {
+        std::fill(output, output + count, min);
+        return;
+    }
+
+    const uint32_t range = static_cast<uint32_t>(static_cast<int64_t>(max) - static_cast<int64_t>(min));
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256i rangeVec = _mm256_set1_epi64x(static_cast<int64_t>(range));
+    const __m256i minVec = _mm256_set1_epi32(min);
+    LaneRegisters lanes(state_);
+    for (; i + 8 <= count; i += 8) {
+        const __m256i value = lanes.Next();
+        // Even elements: product high half moved down; odd elements: high half already in place
+        const __m256i evenProduct = _mm256_srli_epi64(_mm256_mul_epu32(value, rangeVec), 32);
+        const __m256i oddProduct = _mm256_mul_epu32(_mm256_srli_epi64(value, 32), rangeVec);
+        const __m256i reduced = _mm256_blend_epi32(evenProduct, oddProduct, 0b10101010);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm256_add_epi32(reduced, minVec));
+    }
+    lanes.Store(state_);
+#endif
+
+    for (; i < count; i += 8) {
+        uint32_t block[8];
+        NextBlock(block);
+        const size_t n = Min<size_t>(8, count - i);
+        for (size_t j = 0; j < n; ++j) {
+            output[i + j] = static_cast<int32_t>(static_cast<uint32_t>(min) + ReduceRange(block[j], range));
+        }
+    }
+}
+
+void RandomStream::FillGaussian(float* output, size_t count, float mean, float stdDev) noexcept {
+    // Box-Muller on (even, odd) uniform pairs; even outputs take cos, odd outputs take sin
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256 meanVec = _mm256_set1_ps(mean);
+    const __m256 stdDevVec = _mm256_set1_ps(stdDev);
+    LaneRegisters lanes(state_);
+    for (; i + 8 <= count; i += 8) {
+        const __m256 uniforms = ToUnitFloat(lanes.Next());
+        const __m256 u = _mm256_moveldup_ps(uniforms);
+        const __m256 turns = _mm256_movehdup_ps(uniforms);
+
+        const __m256 logU = LogPositive(_mm256_sub_ps(_mm256_set1_ps(1.0f), u));
+        const __m256 radius = _mm256_sqrt_ps(_mm256_mul_ps(_mm256_set1_ps(-2.0f), logU));
+        __m256 s, c;
+        SinCosTurns(turns, s, c);
+
+        const __m256 normal = _mm256_mul_ps(radius, _mm256_blend_ps(c, s, 0b10101010));
+        _mm256_storeu_ps(output + i, _mm256_add_ps(meanVec, _mm256_mul_ps(normal, stdDevVec)));
+    }
+    lanes.Store(state_);
+#endif
+
+    for (; i < count; i += 8) {
+        uint32_t block[8];
+        NextBlock(block);
+        float values[8];
+        for (size_t pair = 0; pair < 4; ++pair) {
+            const float u = ToUnitFloat(block[pair * 2 + 0]);
+            const float turns = ToUnitFloat(block[pair * 2 + 1]);
+            const float radius = std::sqrt(-2.0f * LogPositive(1.0f - u));
+            float s, c;
+            SinCosTurns(turns, s, c);
+            values[pair * 2 + 0] = mean + (radius * c) * stdDev;
+            values[pair * 2 + 1] = mean + (radius * s) * stdDev;
+        }
+
+        const size_t n = Min<size_t>(8, count - i);
+        std::memcpy(output + i, values, n * sizeof(float));
+    }
+}
+
+void RandomStream::FillUnitVector3(Vector3* output, size_t count) noexcept {
+    // Four directions per block
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    LaneRegisters lanes(state_);
+    for (; i + 4 <= count; i += 4) {
+        __m256 x, y, z;
+        UnitVectors(ToUnitFloat(lanes.Next()), x, y, z);
+
+        alignas(32) float xs[8], ys[8], zs[8];
+        _mm256_store_ps(xs, x);
+        _mm256_store_ps(ys, y);
+        _mm256_store_ps(zs, z);
+        for (size_t j = 0; j < 4; ++j) {
+            output[i + j] = Vector3(xs[j * 2], ys[j * 2], zs[j * 2]);
+        }
+    }
+    lanes.Store(state_);
+#endif
+
+    for (; i < count; i += 4) {
+        uint32_t block[8];
+        NextBlock(block);
+        const size_t n = Min<size_t>(4, count - i);
+        for (size_t j = 0; j < n; ++j) {
+            output[i + j] = UnitVectorFromUniforms(ToUnitFloat(block[j * 2]), ToUnitFloat(block[j * 2 + 1]));
+        }
+    }
+}
+
+void RandomStream::FillPointInSphere(Vector3* output, size_t count, float radius) noexcept {
+    // Radius is the max of three uniforms (CDF r^3), so no cube root and no
+    // rejection loop; eight points consume two direction blocks and three
+    // radius blocks.
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256 radiusVec = _mm256_set1_ps(radius);
+    LaneRegisters lanes(state_);
+    for (; i + 8 <= count; i += 8) {
+        __m256 xa, ya, za, xb, yb, zb;
+        UnitVectors(ToUnitFloat(lanes.Next()), xa, ya, za);
+        UnitVectors(ToUnitFloat(lanes.Next()), xb, yb, zb);
+
+        const __m256 r0 = ToUnitFloat(lanes.Next());
+        const __m256 r1 = ToUnitFloat(lanes.Next());
+        const __m256 r2 = ToUnitFloat(lanes.Next());
+        const __m256 scale = _mm256_mul_ps(_mm256_max_ps(_mm256_max_ps(r0, r1), r2), radiusVec);
+
+        alignas(32) float xs[16], ys[16], zs[16], scales[8];
+        _mm256_store_ps(xs, xa);
+        _mm256_store_ps(ys, ya);
+        _mm256_store_ps(zs, za);
+        _mm256_store_ps(xs + 8, xb);
+        _mm256_store_ps(ys + 8, yb);
+        _mm256_store_ps(zs + 8, zb);
+        _mm256_store_ps(scales, scale);
+        for (size_t j = 0; j < 8; ++j) {
+            output[i + j] = Vector3(xs[j * 2] * scales[j], ys[j * 2] * scales[j], zs[j * 2] * scales[j]);
+        }
+    }
+    lanes.Store(state_);
+#endif
+
+    for (; i < count; i += 8) {
+        uint32_t directions[16];
+        uint32_t radii[24];
+        NextBlock(directions);
+        NextBlock(directions + 8);
+        NextBlock(radii);
+        NextBlock(radii + 8);
+        NextBlock(radii + 16);
+
+        const size_t n = Min<size_t>(8, count - i);
+        for (size_t j = 0; j < n; ++j) {
+            const Vector3 direction = UnitVectorFromUniforms(ToUnitFloat(directions[j * 2]), ToUnitFloat(directions[j * 2 + 1]));
+            const float scale = Max(Max(ToUnitFloat(radii[j]), ToUnitFloat(radii[j + 8])), ToUnitFloat(radii[j + 16])) * radius;
+            output[i + j] = Vector3(direction.x * scale, direction.y * scale, direction.z * scale);
+        }
+    }
+}
+
+#pragma endregion
@@ -0,0 +1,479 @@
+// Core.Math.Spatial.cpp - Spatial hash grid and loose octree for neighbor queries
+module;
+
+#include <atomic>
+#include <bit>
+
+module Akhanda.Core.Math;
+
+import <algorithm>;
+import <cmath>;
+
+using namespace Akhanda::Math;
+
+// =============================================================================
+// Private Helpers
+// =============================================================================
+#pragma region Helpers
+
+namespace {
+
+    // Contiguous share of [0, count) for one build task
+    inline void TaskRange(size_t count, uint32_t taskIndex, uint32_t taskCount, size_t& begin, size_t& end) noexcept {
+        begin = count * taskIndex / taskCount;
+        end = count * (taskIndex + 1) / taskCount;
+    }
+
+    inline size_t TableCapacity(size_t minimum) noexcept {
+        return std::bit_ceil(std::max<size_t>(minimum, 16));
+    }
+
+    // Spreads the low 10 bits of v so that there are two zero bits between each
+    inline uint32_t Part1By2(uint32_t v) noexcept {
+        v &= 0x000003FF;
+        v = (v | (v << 16)) & 0x030000FF;
+        v = (v | (v << 8)) & 0x0300F00F;
+        v = (v | (v << 4)) & 0x030C30C3;
+        v = (v | (v << 2)) & 0x09249249;
+        return v;
+    }
+
+    template<typename T>
+    inline T FetchAdd(T& value, T amount, bool concurrent) noexcept {
+        if (concurrent) {
+            return std::atomic_ref<T>(value).fetch_add(amount, std::memory_order_relaxed);
+        }
+        const T previous = value;
+        value += amount;
+        return previous;
+    }
+
+    template<typename T>
+    inline T FetchSub(T& value, T amount, bool concurrent) noexcept {
+        if (concurrent) {
+            return std::atomic_ref<T>(value).fetch_sub(amount, std::memory_order_relaxed);
+        }
+        const T previous = value;
+        value -= amount;
+        return previous;
+    }
+
+    template<typename T>
+    inline T FetchOr(T& value, T bits, bool concurrent) noexcept {
+        if (concurrent) {
+            return std::atomic_ref<T>(value).fetch_or(bits, std::memory_order_relaxed);
+        }
+        const T previous = value;
+        value |= bits;
+        return previous;
+    }
+
+    // Claims an empty key slot or returns the current owner's key
+    template<typename T>
+    inline T ClaimKey(T& slotKey, T emptyKey, T key, bool concurrent) noexcept {
+        if (concurrent) {
+            std::atomic_ref<T> ref(slotKey);
+            T current = ref.load(std::memory_order_relaxed);
+            if (current == emptyKey && ref.compare_exchange_strong(current, key, std::memory_order_relaxed)) {
+                return key;
+            }
+            return current;
+        }
+        if (slotKey == emptyKey) {
+            slotKey = key;
+        }
+        return slotKey;
+    }
+
+}
+
+#pragma endregion
+
+// =============================================================================
+// SpatialHashGrid Implementation
+// =============================================================================
+#pragma region SpatialHashGrid
+
+SpatialHashGrid::SpatialHashGrid(float cellSize) noexcept {
+    SetCellSize(cellSize);
+}
+
+void SpatialHashGrid::SetCellSize(float cellSize) noexcept {
+    cellSize_ = Max(cellSize, EPSILON);
+    invCellSize_ = 1.0f / cellSize_;
+}
+
+void SpatialHashGrid::Build(std::span<const Vector3> points) noexcept {
+    PrepareBuild(points.size());
+    BuildKeys(points, 0, 1);
+    BuildOffsets();
+    BuildScatter(points, 0, 1);
+}
+
+void SpatialHashGrid::Clear() noexcept {
+    slots_.clear();
+    slotShift_ = 64;
+    cellCount_ = 0;
+    pointSlots_.clear();
+    sortedIndices_.clear();
+    sortedPoints_.clear();
+}
+
+std::span<const uint32_t> SpatialHashGrid::GetCell(const Vector3& position) const noexcept {
+    const Slot* slot = FindSlot(PackCell(ToCell(position)));
+    if (slot == nullptr) {
+        return {};
+    }
+    return std::span<const uint32_t>(sortedIndices_.data() + slot->start, slot->count);
+}
+
+std::span<uint32_t> SpatialHashGrid::QueryRadius(const Vector3& center, float radius, std::span<uint32_t> output) const noexcept {
+    size_t count = 0;
+    ForEachInRadius(center, radius, [&](uint32_t index) {
+        if (count == output.size()) {
+            return false;
+        }
+        output[count++] = index;
+        return count < output.size();
+    });
+    return output.first(count);
+}
+
+std::span<uint32_t> SpatialHashGrid::QueryAABB(const AABB& bounds, std::span<uint32_t> output) const noexcept {
+    size_t count = 0;
+    ForEachInAABB(bounds, [&](uint32_t index) {
+        if (count == output.size()) {
+            return false;
+        }
+        output[count++] = index;
+        return count < output.size();
+    });
+    return output.first(count);
+}
+
+SpatialHashGrid::CellCoord SpatialHashGrid::ToCell(const Vector3& position) const noexcept {
+    constexpr float limit = static_cast<float>(COORD_BIAS - 1);
+    const auto toCoord = [this](float value) {
+        return static_cast<int32_t>(Clamp(std::floor(value * invCellSize_), -limit, limit));
+    };
+    return { toCoord(position.x), toCoord(position.y), toCoord(position.z) };
+}
+
+const SpatialHashGrid::Slot* SpatialHashGrid::FindSlot(uint64_t key) const noexcept {
+    if (slots_.empty()) {
+        return nullptr;
+    }
+
+    const size_t mask = slots_.size() - 1;
+    size_t index = static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> slotShift_);
+    for (;;) {
+        const Slot& slot = slots_[index];
+        if (slot.key == key) {
+            return &slot;
+        }
+        if (slot.key == EMPTY_KEY) {
+            return nullptr;
+        }
+        index = (index + 1) & mask;
+    }
+}
+
+void SpatialHashGrid::PrepareBuild(size_t pointCount) noexcept {
+    // At most one cell per point, so a load factor of one half always fits
+    const size_t capacity = TableCapacity(pointCount * 2);
+    slots_.assign(capacity, Slot{ EMPTY_KEY, 0, 0 });
+    slotShift_ = 64 - static_cast<uint32_t>(std::countr_zero(capacity));
+    cellCount_ = 0;
+
+    pointSlots_.resize(pointCount);
+    sortedIndices_.resize(pointCount);
+    sortedPoints_.resize(pointCount);
+}
+
+void SpatialHashGrid::BuildKeys(std::span<const Vector3> points, uint32_t taskIndex, uint32_t taskCount) noexcept {
+    const bool concurrent = taskCount > 1;
+    const size_t mask = slots_.size() - 1;
+    size_t begin, end;
+    TaskRange(points.size(), taskIndex, taskCount, begin, end);
+
+    for (size_t i = begin; i < end; ++i) {
+        const uint64_t key = PackCell(ToCell(points[i]));
+        size_t index = static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> slotShift_);
+        while (ClaimKey(slots_[index].key, EMPTY_KEY, key, concurrent) != key) {
+            index = (index + 1) & mask;
+        }
+        FetchAdd(slots_[index].count, 1u, concurrent);
+        pointSlots_[i] = static_cast<uint32_t>(index);
+    }
+}
+
+void SpatialHashGrid::BuildOffsets() noexcept {
+    // Store each cell's end; the scatter pass decrements it back to the start
+    uint32_t offset = 0;
+    cellCount_ = 0;
+    for (Slot& slot : slots_) {
+        if (slot.key != EMPTY_KEY) {
+            offset += slot.count;
+            slot.start = offset;
+            ++cellCount_;
+        }
+    }
+}
+
+void SpatialHashGrid::BuildScatter(std::span<const Vector3> points, uint32_t taskIndex, uint32_t taskCount) noexcept {
+    const bool concurrent = taskCount > 1;
+    size_t begin, end;
+    TaskRange(points.size(), taskIndex, taskCount, begin, end);
+
+    // Walk backwards so a serial build keeps ascending indices within a cell
+    for (size_t i = end; i-- > begin;) {
+        const uint32_t position = FetchSub(slots_[pointSlots_[i]].start, 1u, concurrent) - 1;
+        sortedIndices_[position] = static_cast<uint32_t>(i);
+        sortedPoints_[position] = points[i];
+    }
+}
+
+#pragma endregion
+
+// =============================================================================
+// LooseOctree Implementation
+// =============================================================================
+#pragma region LooseOctree
+
+LooseOctree::LooseOctree(const AABB& worldBounds, uint32_t maxDepth) noexcept {
+    SetWorldBounds(worldBounds, maxDepth);
+}
+
+void LooseOctree::SetWorldBounds(const AABB& worldBounds, uint32_t maxDepth) noexcept {
+    // The root cell is the cube enclosing the requested bounds
+    const Vector3 extents = (worldBounds.max - worldBounds.min) * 0.5f;
+    worldCenter_ = (worldBounds.min + worldBounds.max) * 0.5f;
+    rootHalfSize_ = Max(Max(Max(extents.x, extents.y), extents.z), EPSILON);
+    invRootSize_ = 0.5f / rootHalfSize_;
+    worldBounds_ = AABB(worldCenter_ - Vector3(rootHalfSize_), worldCenter_ + Vector3(rootHalfSize_));
+    maxDepth_ = std::min(maxDepth, MAX_DEPTH);
+    Clear();
+}
+
+void LooseOctree::Build(std::span<const AABB> objects) noexcept {
+    PrepareBuild(objects.size());
+    BuildKeys(objects, 0, 1);
+    while (buildFailed_ != 0) {
+        GrowTable();
+        BuildKeys(objects, 0, 1);
+    }
+    BuildOffsets();
+    BuildScatter(objects, 0, 1);
+}
+
+void LooseOctree::Clear() noexcept {
+    slots_.clear();
+    slotShift_ = 32;
+    slotsUsed_ = 0;
+    buildFailed_ = 0;
+    nodes_.clear();
+    nodeSlots_.clear();
+    objectSlots_.clear();
+    sortedIndices_.clear();
+    sortedBounds_.clear();
+}
+
+std::span<uint32_t> LooseOctree::QueryAABB(const AABB& bounds, std::span<uint32_t> output) const noexcept {
+    size_t count = 0;
+    ForEachInAABB(bounds, [&](uint32_t index) {
+        if (count == output.size()) {
+            return false;
+        }
+        output[count++] = index;
+        return count < output.size();
+    });
+    return output.first(count);
+}
+
+std::span<uint32_t> LooseOctree::QuerySphere(const Sphere& sphere, std::span<uint32_t> output) const noexcept {
+    size_t count = 0;
+    ForEachInSphere(sphere, [&](uint32_t index) {
+        if (count == output.size()) {
+            return false;
+        }
+        output[count++] = index;
+        return count < output.size();
+    });
+    return output.first(count);
+}
+
+uint32_t LooseOctree::ComputeKey(const AABB& bounds) const noexcept {
+    // Only the center has to be inside; loose bounds cover the rest
+    const Vector3 center = (bounds.min + bounds.max) * 0.5f;
+    if (center.x < worldBounds_.min.x || center.y < worldBounds_.min.y || center.z < worldBounds_.min.z ||
+        center.x > worldBounds_.max.x || center.y > worldBounds_.max.y || center.z > worldBounds_.max.z) {
+        return ROOT_KEY;
+    }
+
+    // Deepest level whose cell half size still covers the object's extent;
+    // with looseness 2 the node's loose bounds then contain the whole object
+    const Vector3 extents = (bounds.max - bounds.min) * 0.5f;
+    const float extent = Max(Max(extents.x, extents.y), extents.z);
+    uint32_t depth = 0;
+    float halfSize = rootHalfSize_ * 0.5f;
+    while (depth < maxDepth_ && extent <= halfSize) {
+        ++depth;
+        halfSize *= 0.5f;
+    }
+
+    const uint32_t cells = 1u << depth;
+    const auto toCell = [&](float value, float origin) {
+        return std::min(static_cast<uint32_t>((value - origin) * invRootSize_ * static_cast<float>(cells)), cells - 1);
+    };
+    const uint32_t x = toCell(center.x, worldBounds_.min.x);
+    const uint32_t y = toCell(center.y, worldBounds_.min.y);
+    const uint32_t z = toCell(center.z, worldBounds_.min.z);
+
+    return (1u << (3 * depth)) | Part1By2(x) | (Part1By2(y) << 1) | (Part1By2(z) << 2);
+}
+
+const LooseOctree::Slot* LooseOctree::FindSlot(uint32_t key) const noexcept {
+    if (slots_.empty()) {
+        return nullptr;
+    }
+
+    const uint32_t mask = static_cast<uint32_t>(slots_.size() - 1);
+    uint32_t index = (key * 0x9E3779B1u) >> slotShift_;
+    for (;;) {
+        const Slot& slot = slots_[index];
+        if (slot.key == key) {
+            return &slot;
+        }
+        if (slot.key == EMPTY_KEY) {
+            return nullptr;
+        }
+        index = (index + 1) & mask;
+    }
+}
+
+void LooseOctree::PrepareBuild(size_t objectCount) noexcept {
+    // Keep a table that already grew to fit this scene; ancestors can make the
+    // node count exceed the object count, in which case BuildKeys reports it
+    const size_t capacity = std::max(TableCapacity(objectCount * 2), slots_.size());
+    slots_.assign(capacity, Slot{ EMPTY_KEY, 0, 0, 0 });
+    slotShift_ = 32 - static_cast<uint32_t>(std::countr_zero(capacity));
+    slotsUsed_ = 0;
+    buildFailed_ = 0;
+    nodes_.clear();
+
+    objectSlots_.resize(objectCount);
+    sortedIndices_.resize(objectCount);
+    sortedBounds_.resize(objectCount);
+}
+
+void LooseOctree::GrowTable() noexcept {
+    slots_.assign(slots_.size() * 2, Slot{ EMPTY_KEY, 0, 0, 0 });
+    --slotShift_;
+    slotsUsed_ = 0;
+    buildFailed_ = 0;
+}
+
+void LooseOctree::BuildKeys(std::span<const AABB> objects, uint32_t taskIndex, uint32_t taskCount) noexcept {
+    const bool concurrent = taskCount > 1;
+    const uint32_t mask = static_cast<uint32_t>(slots_.size() - 1);
+    const uint32_t maxLoad = static_cast<uint32_t>(slots_.size() - slots_.size() / 4);
+    size_t begin, end;
+    TaskRange(objects.size(), taskIndex, taskCount, begin, end);
+
+    // Finds or inserts a node, failing once the table passes its load limit so
+    // probing always terminates
+    const auto claimSlot = [&](uint32_t key, uint32_t& slotIndex) {
+        uint32_t index = (key * 0x9E3779B1u) >> slotShift_;
+        for (;;) {
+            uint32_t& slotKey = slots_[index].key;
+            const uint32_t current = concurrent ? std::atomic_ref<uint32_t>(slotKey).load(std::memory_order_relaxed) : slotKey;
+            if (current == key) {
+                slotIndex = index;
+                return true;
+            }
+            if (current == EMPTY_KEY) {
+                if (FetchAdd(slotsUsed_, 1u, concurrent) >= maxLoad) {
+                    FetchOr(buildFailed_, 1u, concurrent);
+                    return false;
+                }
+                if (ClaimKey(slotKey, EMPTY_KEY, key, concurrent) == key) {
+                    slotIndex = index;
+                    return true;
+                }
+                // Lost the race for this slot; the winner accounted for it
+                FetchSub(slotsUsed_, 1u, concurrent);
+                continue;
+            }
+            index = (index + 1) & mask;
+        }
+    };
+
+    for (size_t i = begin; i < end; ++i) {
+        const uint32_t key = ComputeKey(objects[i]);
+        uint32_t slotIndex;
+        if (!claimSlot(key, slotIndex)) {
+            return;
+        }
+        FetchAdd(slots_[slotIndex].count, 1u, concurrent);
+        objectSlots_[i] = slotIndex;
+
+        // Link up to the root, stopping at the first link that already exists;
+        // whoever set it is responsible for the rest of the path
+        for (uint32_t child = key; child != ROOT_KEY; child >>= 3) {
+            uint32_t parentIndex;
+            if (!claimSlot(child >> 3, parentIndex)) {
+                return;
+            }
+            const uint32_t bit = 1u << (child & 7);
+            if (FetchOr(slots_[parentIndex].childMask, bit, concurrent) & bit) {
+                break;
+            }
+        }
+    }
+}
+
+void LooseOctree::BuildOffsets() noexcept {
+    nodes_.clear();
+    nodeSlots_.clear();
+    const Slot* root = FindSlot(ROOT_KEY);
+    if (root == nullptr) {
+        return;
+    }
+
+    // Breadth-first: siblings end up adjacent, and so do their objects. Each
+    // slot's start is set to its range end for the scatter pass to count down.
+    uint32_t offset = 0;
+    nodeSlots_.push_back(static_cast<uint32_t>(root - slots_.data()));
+    nodes_.push_back({ 0, root->childMask, 0, 0 });
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+        Slot& slot = slots_[nodeSlots_[i]];
+        const uint32_t firstChild = static_cast<uint32_t>(nodes_.size());
+        nodes_[i].firstChild = firstChild;
+        nodes_[i].start = offset;
+        nodes_[i].count = slot.count;
+        offset += slot.count;
+        slot.start = offset;
+
+        for (uint32_t bit = 0; bit < 8; ++bit) {
+            if ((slot.childMask & (1u << bit)) != 0) {
+                const Slot* child = FindSlot((slot.key << 3) | bit);
+                nodeSlots_.push_back(static_cast<uint32_t>(child - slots_.data()));
+                nodes_.push_back({ 0, child->childMask, 0, 0 });
+            }
+        }
+    }
+}
+
+void LooseOctree::BuildScatter(std::span<const AABB> objects, uint32_t taskIndex, uint32_t taskCount) noexcept {
+    const bool concurrent = taskCount > 1;
+    size_t begin, end;
+    TaskRange(objects.size(), taskIndex, taskCount, begin, end);
+
+    for (size_t i = end; i-- > begin;) {
+        const uint32_t position = FetchSub(slots_[objectSlots_[i]].start, 1u, concurrent) - 1;
+        sortedIndices_[position] = static_cast<uint32_t>(i);
+        sortedBounds_[position] = objects[i];
+    }
+}
+
+#pragma endregion
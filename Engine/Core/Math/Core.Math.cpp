@@ -849,93 +849,7 @@ bool OBB::Contains(const Vector3& point) const noexcept {
         Abs(localPoint.z) <= extents.z;
 }
 
-bool OBB::Intersects(const OBB& other) const noexcept {
-    // SAT (Separating Axis Theorem) implementation
-    const Vector3 translation = other.center - center;
-
-    // Test axes from this OBB
-    for (int i = 0; i < 3; ++i) {
-        Vector3 axis;
-        axis[i] = 1.0f;
-        axis = rotation * axis;
-
-        float projectedDistance = Abs(Dot(translation, axis));
-        float projectedExtents = extents[i];
-
-        // Project other OBB onto this axis
-        float otherProjectedExtents = 0.0f;
-        for (int j = 0; j < 3; ++j) {
-            Vector3 otherAxis;
-            otherAxis[j] = 1.0f;
-            otherAxis = other.rotation * otherAxis;
-            otherProjectedExtents += other.extents[j] * Abs(Dot(axis, otherAxis));
-        }
-
-        if (projectedDistance > projectedExtents + otherProjectedExtents) {
-            return false;
-        }
-    }
-
-    // Test axes from other OBB
-    for (int i = 0; i < 3; ++i) {
-        Vector3 axis;
-        axis[i] = 1.0f;
-        axis = other.rotation * axis;
-
-        float projectedDistance = Abs(Dot(translation, axis));
-        float projectedExtents = other.extents[i];
-
-        // Project this OBB onto other's axis
-        float thisProjectedExtents = 0.0f;
-        for (int j = 0; j < 3; ++j) {
-            Vector3 thisAxis;
-            thisAxis[j] = 1.0f;
-            thisAxis = rotation * thisAxis;
-            thisProjectedExtents += extents[j] * Abs(Dot(axis, thisAxis));
-        }
-
-        if (projectedDistance > projectedExtents + thisProjectedExtents) {
-            return false;
-        }
-    }
-
-    // Test cross product axes
-    for (int i = 0; i < 3; ++i) {
-        for (int j = 0; j < 3; ++j) {
-            Vector3 axis1, axis2;
-            axis1[i] = 1.0f;
-            axis2[j] = 1.0f;
-            axis1 = rotation * axis1;
-            axis2 = other.rotation * axis2;
-
-            const Vector3 crossAxis = Cross(axis1, axis2);
-            if (LengthSquared(crossAxis) < EPSILON) continue; // Parallel axes
-
-            const Vector3 normalizedCrossAxis = Normalize(crossAxis);
-            const float projectedDistance = Abs(Dot(translation, normalizedCrossAxis));
-
-            float thisProjectedExtents = 0.0f;
-            float otherProjectedExtents = 0.0f;
-
-            for (int k = 0; k < 3; ++k) {
-                Vector3 thisAxis, otherAxis;
-                thisAxis[k] = 1.0f;
-                otherAxis[k] = 1.0f;
-                thisAxis = rotation * thisAxis;
-                otherAxis = other.rotation * otherAxis;
-
-                thisProjectedExtents += extents[k] * Abs(Dot(normalizedCrossAxis, thisAxis));
-                otherProjectedExtents += other.extents[k] * Abs(Dot(normalizedCrossAxis, otherAxis));
-            }
-
-            if (projectedDistance > thisProjectedExtents + otherProjectedExtents) {
-                return false;
-            }
-        }
-    }
-
-    return true; // No separating axis found
-}
+// OBB::Intersects is implemented with the SIMD separating axis tests in Core.Math.OBB.cpp
 
 AABB OBB::ToAABB() const noexcept {
     Vector3 min_point = center;
@@ -1420,36 +1334,8 @@ namespace Akhanda::Math {
 
     // Transform bounding calculations
     AABB TransformAABB(const AABB& aabb, const Transform& transform) noexcept {
-        const Matrix4 matrix = transform.ToMatrix();
-
-        // Transform all 8 corners of the AABB
-        const Vector3 corners[8] = {
-            Vector3(aabb.min.x, aabb.min.y, aabb.min.z),
-            Vector3(aabb.max.x, aabb.min.y, aabb.min.z),
-            Vector3(aabb.min.x, aabb.max.y, aabb.min.z),
-            Vector3(aabb.max.x, aabb.max.y, aabb.min.z),
-            Vector3(aabb.min.x, aabb.min.y, aabb.max.z),
-            Vector3(aabb.max.x, aabb.min.y, aabb.max.z),
-            Vector3(aabb.min.x, aabb.max.y, aabb.max.z),
-            Vector3(aabb.max.x, aabb.max.y, aabb.max.z)
-        };
-
-        AABB result;
-        bool first = true;
-
-        for (const auto& corner : corners) {
-            const Vector3 transformedCorner = matrix.TransformPoint(corner);
-
-            if (first) {
-                result.min = result.max = transformedCorner;
-                first = false;
-            }
-            else {
-                result.Expand(transformedCorner);
-            }
-        }
-
-        return result;
+        // Arvo's method gives the same box as transforming all 8 corners
+        return TransformAABB(aabb, transform.ToMatrix());
     }
 
     Sphere TransformSphere(const Sphere& sphere, const Transform& transform) noexcept {
@@ -2675,31 +2561,12 @@ Color4 Akhanda::Math::UnpackColor(uint32_t packed) noexcept {
 }
 
 uint32_t Akhanda::Math::PackNormal(const Vector3& normal) noexcept {
-    // Pack normal into 32-bit using spheremap transform
-    const Vector3 n = Normalize(normal);
-    const float f = std::sqrt(8.0f * n.z + 8.0f);
-    const float x = n.x / f + 0.5f;
-    const float y = n.y / f + 0.5f;
-
-    const uint32_t ix = static_cast<uint32_t>(Saturate(x) * 65535.0f + 0.5f);
-    const uint32_t iy = static_cast<uint32_t>(Saturate(y) * 65535.0f + 0.5f);
-
-    return (ix << 16) | iy;
+    // 16:16 octahedral, the layout UnpackNormal expects
+    return EncodeOctahedral32(normal);
 }
 
 Vector3 Akhanda::Math::UnpackNormal(uint32_t packed) noexcept {
-    // Unpack normal from 32-bit spheremap
-    const float x = (static_cast<float>((packed >> 16) & 0xFFFF) / 65535.0f) * 2.0f - 1.0f;
-    const float y = (static_cast<float>(packed & 0xFFFF) / 65535.0f) * 2.0f - 1.0f;
-
-    const float z = 1.0f - Abs(x) - Abs(y);
-    const float t = Saturate(-z);
-
-    return Normalize(Vector3(
-        x + (x >= 0.0f ? -t : t),
-        y + (y >= 0.0f ? -t : t),
-        z
-    ));
+    return DecodeOctahedral32(packed);
 }
 
 // =============================================================================
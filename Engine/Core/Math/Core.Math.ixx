@@ -9,6 +9,7 @@ import <algorithm>;
 import <array>;
 import <cmath>;
 import <concepts>;
+import <span>;
 import <vector>;
 
 export namespace Akhanda::Math {
@@ -619,6 +620,7 @@ export namespace Akhanda::Math {
         bool Contains(const Vector3& point) const noexcept;
         bool Intersects(const Sphere& sphere) const noexcept;
         bool Intersects(const AABB& aabb) const noexcept;
+        bool Intersects(const OBB& obb) const noexcept;
     };
 
 
@@ -1025,6 +1027,505 @@ export namespace Akhanda::Math {
     Vector3 RandomPointInSphere() noexcept;
     Vector3 RandomPointOnSphere() noexcept;
 
+    // High-throughput random stream: four interleaved xoshiro256++ lanes.
+    // Lanes are spaced 2^128 apart and streams 2^192 apart, so each thread can
+    // own a stream without overlap. Bulk fills advance all four lanes in
+    // lockstep (AVX2 when available); the scalar path produces bit-identical
+    // output, so a seed reproduces the same values on every ISA level.
+    class RandomStream {
+    public:
+        static constexpr size_t LANE_COUNT = 4;
+
+        RandomStream() noexcept;
+        explicit RandomStream(uint64_t seed, uint32_t streamIndex = 0) noexcept;
+
+        void SetSeed(uint64_t seed, uint32_t streamIndex = 0) noexcept;
+
+        // Advance every lane by 2^192 steps (moves to the next stream)
+        void Jump(uint32_t streamCount = 1) noexcept;
+
+        // Single values (lane 0)
+        uint64_t NextUInt64() noexcept;
+        uint32_t NextUInt() noexcept;
+        float NextFloat() noexcept;
+        float NextFloat(float min, float max) noexcept;
+        int32_t NextInt(int32_t min, int32_t max) noexcept;
+
+        // Bulk fills
+        void FillUInt(uint32_t* output, size_t count) noexcept;
+        void FillFloat(float* output, size_t count, float min = 0.0f, float max = 1.0f) noexcept;
+        void FillInt(int32_t* output, size_t count, int32_t min, int32_t max) noexcept;
+        void FillGaussian(float* output, size_t count, float mean = 0.0f, float stdDev = 1.0f) noexcept;
+        void FillUnitVector3(Vector3* output, size_t count) noexcept;
+        void FillPointInSphere(Vector3* output, size_t count, float radius = 1.0f) noexcept;
+
+    private:
+        void NextBlock(uint32_t* block) noexcept; // 8 x 32-bit values, one step of all lanes
+
+        alignas(32) uint64_t state_[4][LANE_COUNT]; // [word][lane]
+    };
+
+// =============================================================================
+// Quantization
+// =============================================================================
+
+    // Half precision (IEEE 754 binary16, round-to-nearest-even)
+    uint16_t FloatToHalf(float value) noexcept;
+    float HalfToFloat(uint16_t value) noexcept;
+
+    // Normalized integers (D3D conversion rules: snorm maps -MAX..MAX, unorm 0..MAX)
+    int8_t FloatToSnorm8(float value) noexcept;
+    float Snorm8ToFloat(int8_t value) noexcept;
+    uint8_t FloatToUnorm8(float value) noexcept;
+    float Unorm8ToFloat(uint8_t value) noexcept;
+    int16_t FloatToSnorm16(float value) noexcept;
+    float Snorm16ToFloat(int16_t value) noexcept;
+    uint16_t FloatToUnorm16(float value) noexcept;
+    float Unorm16ToFloat(uint16_t value) noexcept;
+
+    // Octahedral unit vectors: x in the high half, y in the low half
+    uint16_t EncodeOctahedral16(const Vector3& normal) noexcept;
+    Vector3 DecodeOctahedral16(uint16_t packed) noexcept;
+    uint32_t EncodeOctahedral32(const Vector3& normal) noexcept;
+    Vector3 DecodeOctahedral32(uint32_t packed) noexcept;
+
+    // Smallest-three rotations: 2-bit index of the dropped component plus
+    // three components in [-1/sqrt2, 1/sqrt2] at 10, 15 or 20 bits each.
+    // The 48-bit form is stored as three 16-bit words to keep 6-byte strides.
+    struct PackedQuaternion48 {
+        uint16_t words[3];
+    };
+
+    uint32_t PackQuaternion32(const Quaternion& rotation) noexcept;
+    Quaternion UnpackQuaternion32(uint32_t packed) noexcept;
+    PackedQuaternion48 PackQuaternion48(const Quaternion& rotation) noexcept;
+    Quaternion UnpackQuaternion48(const PackedQuaternion48& packed) noexcept;
+    uint64_t PackQuaternion64(const Quaternion& rotation) noexcept;
+    Quaternion UnpackQuaternion64(uint64_t packed) noexcept;
+
+    // 16 bits per axis, relative to fixed bounds
+    struct QuantizedPosition {
+        uint16_t x, y, z;
+    };
+
+    class PositionQuantizer {
+    public:
+        PositionQuantizer() noexcept;
+        explicit PositionQuantizer(const AABB& bounds) noexcept;
+
+        QuantizedPosition Encode(const Vector3& position) const noexcept;
+        Vector3 Decode(const QuantizedPosition& quantized) const noexcept;
+
+        void Encode(const Vector3* positions, QuantizedPosition* output, size_t count) const noexcept;
+        void Decode(const QuantizedPosition* quantized, Vector3* output, size_t count) const noexcept;
+
+        const AABB& GetBounds() const noexcept { return bounds_; }
+        // Worst-case per-axis reconstruction error for points inside the bounds
+        Vector3 GetMaxError() const noexcept { return step_ * 0.5f; }
+
+    private:
+        AABB bounds_;
+        Vector3 scale_;   // 65535 / extent
+        Vector3 step_;    // extent / 65535
+    };
+
+    // Batch conversions (SSE2; F16C for halves when built with AVX2).
+    // Each produces the same values as the scalar function applied per element
+    // (F16C may keep a different NaN payload).
+    void FloatToHalf(const float* input, uint16_t* output, size_t count) noexcept;
+    void HalfToFloat(const uint16_t* input, float* output, size_t count) noexcept;
+    void FloatToSnorm8(const float* input, int8_t* output, size_t count) noexcept;
+    void Snorm8ToFloat(const int8_t* input, float* output, size_t count) noexcept;
+    void FloatToUnorm8(const float* input, uint8_t* output, size_t count) noexcept;
+    void Unorm8ToFloat(const uint8_t* input, float* output, size_t count) noexcept;
+    void FloatToSnorm16(const float* input, int16_t* output, size_t count) noexcept;
+    void Snorm16ToFloat(const int16_t* input, float* output, size_t count) noexcept;
+    void FloatToUnorm16(const float* input, uint16_t* output, size_t count) noexcept;
+    void Unorm16ToFloat(const uint16_t* input, float* output, size_t count) noexcept;
+    void EncodeOctahedral16(const Vector3* normals, uint16_t* output, size_t count) noexcept;
+    void DecodeOctahedral16(const uint16_t* packed, Vector3* output, size_t count) noexcept;
+    void EncodeOctahedral32(const Vector3* normals, uint32_t* output, size_t count) noexcept;
+    void DecodeOctahedral32(const uint32_t* packed, Vector3* output, size_t count) noexcept;
+    void PackQuaternion32(const Quaternion* rotations, uint32_t* output, size_t count) noexcept;
+    void UnpackQuaternion32(const uint32_t* packed, Quaternion* output, size_t count) noexcept;
+    void PackQuaternion48(const Quaternion* rotations, PackedQuaternion48* output, size_t count) noexcept;
+    void UnpackQuaternion48(const PackedQuaternion48* packed, Quaternion* output, size_t count) noexcept;
+    void PackQuaternion64(const Quaternion* rotations, uint64_t* output, size_t count) noexcept;
+    void UnpackQuaternion64(const uint64_t* packed, Quaternion* output, size_t count) noexcept;
+
+// =============================================================================
+// Bounding Volumes
+// =============================================================================
+
+    // Boxes with min.x > max.x are empty. Batch transforms write them back as
+    // EMPTY_AABB, and merges skip them.
+    inline constexpr AABB EMPTY_AABB{ Vector3(INFINITY_F), Vector3(NEG_INFINITY_F) };
+
+    // Arvo's method: exact bounds of an affinely transformed box. The
+    // absolute 3x3 part scales the extents, so no corners are transformed.
+    AABB TransformAABB(const AABB& aabb, const Matrix4& matrix) noexcept;
+
+    // Batch versions (SSE2, four boxes per iteration in SoA form). They
+    // match the scalar results exactly and may run in place.
+    void TransformAABBs(const AABB* localBounds, const Matrix4* matrices, AABB* worldBounds, size_t count) noexcept;
+    void TransformAABBs(const AABB* localBounds, const Transform* transforms, AABB* worldBounds, size_t count) noexcept;
+
+    // Union of all non-empty boxes; EMPTY_AABB when there are none
+    AABB MergeAABBs(const AABB* bounds, size_t count) noexcept;
+
+    // Tight box around a point set; EMPTY_AABB for no points
+    AABB ComputeAABB(const Vector3* points, size_t count) noexcept;
+
+    // EPOS-14 (extremal points along seven directions) seeds a sphere, which
+    // a Ritter pass then grows to cover every point. The result is usually
+    // within a few percent of the minimum enclosing sphere.
+    Sphere ComputeBoundingSphere(const Vector3* points, size_t count) noexcept;
+
+    // Bounds for a flattened transform hierarchy in which every parent comes
+    // before its children (parentIndices[i] < i, or -1 for a root).
+    // worldBounds[i] receives node i's own box. subtreeBounds is optional;
+    // when given it also encloses all descendants, for hierarchical culling.
+    void UpdateHierarchyBounds(const AABB* localBounds, const Matrix4* worldMatrices, const int32_t* parentIndices,
+        AABB* worldBounds, AABB* subtreeBounds, size_t count) noexcept;
+
+    // One box against many, four candidates per SSE iteration. results[i]
+    // receives obb.Intersects(others[i]); returns the number of overlaps.
+    size_t IntersectOBBs(const OBB& obb, const OBB* others, bool* results, size_t count) noexcept;
+
+    // Frustum culling for many boxes; visible[i] receives
+    // frustum.Intersects(obbs[i]). Returns the number of visible boxes.
+    size_t CullOBBs(const Frustum& frustum, const OBB* obbs, bool* visible, size_t count) noexcept;
+
+// =============================================================================
+// Spatial Partitioning
+// =============================================================================
+
+    // Dynamic bounding volume hierarchy for moving objects (broadphase, culling,
+    // triggers). Leaves store fattened AABBs so small motions do not touch the
+    // tree; internal nodes are kept balanced with AVL-style rotations. Nodes
+    // live in a pool with an intrusive free list, and proxy ids stay stable
+    // until the proxy is destroyed.
+    //
+    // Query callbacks return false to stop the traversal. RayCast callbacks
+    // return the new maximum t: 0 stops, the current maximum continues, a
+    // smaller value clips the ray (closest-hit queries).
+    class DynamicAABBTree {
+    public:
+        static constexpr int32_t NULL_NODE = -1;
+
+        explicit DynamicAABBTree(float fatMargin = 0.1f, float displacementMultiplier = 2.0f) noexcept;
+
+        int32_t CreateProxy(const AABB& bounds, uint32_t userData) noexcept;
+        void DestroyProxy(int32_t proxyId) noexcept;
+        // Returns true when the proxy left its fat AABB and was reinserted
+        bool MoveProxy(int32_t proxyId, const AABB& bounds, const Vector3& displacement = Vector3::ZERO) noexcept;
+        void Clear() noexcept;
+
+        uint32_t GetUserData(int32_t proxyId) const noexcept { return nodes_[proxyId].userData; }
+        const AABB& GetFatAABB(int32_t proxyId) const noexcept { return nodes_[proxyId].bounds; }
+
+        size_t GetProxyCount() const noexcept { return proxyCount_; }
+        int32_t GetHeight() const noexcept { return root_ == NULL_NODE ? 0 : nodes_[root_].height; }
+        // Sum of internal node areas over root area; lower is a better tree
+        float GetAreaRatio() const noexcept;
+        // Checks links, heights and bounds containment (tests and debug builds)
+        bool Validate() const noexcept;
+
+        template<typename Callback>
+        void Query(const AABB& bounds, Callback&& callback) const;
+
+        template<typename Callback>
+        void Query(const Frustum& frustum, Callback&& callback) const;
+
+        template<typename Callback>
+        void RayCast(const Ray& ray, float maxDistance, Callback&& callback) const;
+
+        // Every pair of proxies whose fat AABBs overlap, each pair once
+        template<typename Callback>
+        void QueryOverlapPairs(Callback&& callback) const;
+
+    private:
+        struct Node {
+            AABB bounds;
+            int32_t parent;     // Next free node while on the free list
+            int32_t child1;
+            int32_t child2;
+            int32_t height;     // 0 for leaves, -1 for free nodes
+            uint32_t userData;
+
+            bool IsLeaf() const noexcept { return child1 == NULL_NODE; }
+        };
+
+        // Traversal stack that stays on the stack frame for typical depths
+        template<typename T>
+        class TraversalStack {
+        public:
+            void Push(const T& value) {
+                if (size_ < INLINE_CAPACITY) {
+                    inline_[size_] = value;
+                }
+                else {
+                    overflow_.push_back(value);
+                }
+                ++size_;
+            }
+            T Pop() noexcept {
+                --size_;
+                if (size_ < INLINE_CAPACITY) {
+                    return inline_[size_];
+                }
+                const T value = overflow_.back();
+                overflow_.pop_back();
+                return value;
+            }
+            bool Empty() const noexcept { return size_ == 0; }
+
+        private:
+            static constexpr size_t INLINE_CAPACITY = 128;
+            T inline_[INLINE_CAPACITY];
+            std::vector<T> overflow_;
+            size_t size_ = 0;
+        };
+
+        enum class Containment { Outside, Intersecting, Inside };
+
+        struct FrustumEntry {
+            int32_t node;
+            bool inside;    // Whole subtree is inside, skip the plane tests
+        };
+
+        struct NodePair {
+            int32_t a;
+            int32_t b;      // a == b walks the pairs within one subtree
+        };
+
+        int32_t AllocateNode() noexcept;
+        void FreeNode(int32_t nodeId) noexcept;
+        void InsertLeaf(int32_t leaf) noexcept;
+        void RemoveLeaf(int32_t leaf) noexcept;
+        int32_t Balance(int32_t nodeId) noexcept;
+        AABB FattenBounds(const AABB& bounds, const Vector3& displacement) const noexcept;
+
+        static Containment Classify(const Frustum& frustum, const AABB& bounds) noexcept;
+        static bool Overlaps(const AABB& a, const AABB& b) noexcept {
+            return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+                a.min.y <= b.max.y && a.max.y >= b.min.y &&
+                a.min.z <= b.max.z && a.max.z >= b.min.z;
+        }
+        static bool IntersectsRay(const AABB& bounds, const Vector3& origin, const Vector3& invDirection, float maxT) noexcept {
+            float tEnter = 0.0f;
+            float tExit = maxT;
+            return ClipToSlab(bounds.min.x, bounds.max.x, origin.x, invDirection.x, tEnter, tExit) &&
+                ClipToSlab(bounds.min.y, bounds.max.y, origin.y, invDirection.y, tEnter, tExit) &&
+                ClipToSlab(bounds.min.z, bounds.max.z, origin.z, invDirection.z, tEnter, tExit) &&
+                tEnter <= tExit;
+        }
+        // A ray parallel to the slab (infinite inverse) never crosses its planes,
+        // so it hits only when the origin lies within it. Multiplying instead
+        // would give 0 * inf = NaN for an origin exactly on a plane.
+        static bool ClipToSlab(float min, float max, float origin, float invDirection, float& tEnter, float& tExit) noexcept {
+            if (invDirection == INFINITY_F || invDirection == NEG_INFINITY_F) {
+                return origin >= min && origin <= max;
+            }
+            const float t1 = (min - origin) * invDirection;
+            const float t2 = (max - origin) * invDirection;
+            tEnter = Max(tEnter, Min(t1, t2));
+            tExit = Min(tExit, Max(t1, t2));
+            return true;
+        }
+
+        std::vector<Node> nodes_;
+        int32_t root_ = NULL_NODE;
+        int32_t freeList_ = NULL_NODE;
+        size_t proxyCount_ = 0;
+        float fatMargin_;
+        float displacementMultiplier_;
+    };
+
+    // Uniform grid over points, keyed by cell coordinates in an open-addressing
+    // table. Rebuilt from scratch with a counting sort so every cell's points are
+    // contiguous; queries walk the overlapped cells and never allocate.
+    // Choose a cell size close to the typical query radius.
+    class SpatialHashGrid {
+    public:
+        explicit SpatialHashGrid(float cellSize = 1.0f) noexcept;
+
+        void SetCellSize(float cellSize) noexcept;
+        float GetCellSize() const noexcept { return cellSize_; }
+
+        void Build(std::span<const Vector3> points) noexcept;
+        // parallelFor(taskCount, task) must call task(i) for every i in [0, taskCount)
+        // and return once all calls have finished. Point order within a cell is
+        // unspecified when taskCount > 1.
+        template<typename ParallelFor>
+        void Build(std::span<const Vector3> points, uint32_t taskCount, ParallelFor&& parallelFor);
+        void Clear() noexcept;
+
+        size_t GetPointCount() const noexcept { return sortedIndices_.size(); }
+        size_t GetCellCount() const noexcept { return cellCount_; }
+
+        // Indices of the points sharing the cell that contains position
+        std::span<const uint32_t> GetCell(const Vector3& position) const noexcept;
+
+        // Writes matching point indices to output and returns the filled prefix;
+        // matches beyond output.size() are dropped
+        std::span<uint32_t> QueryRadius(const Vector3& center, float radius, std::span<uint32_t> output) const noexcept;
+        std::span<uint32_t> QueryAABB(const AABB& bounds, std::span<uint32_t> output) const noexcept;
+
+        // callback(uint32_t pointIndex) -> bool, return false to stop
+        template<typename Callback>
+        void ForEachInRadius(const Vector3& center, float radius, Callback&& callback) const;
+        template<typename Callback>
+        void ForEachInAABB(const AABB& bounds, Callback&& callback) const;
+
+    private:
+        struct Slot {
+            uint64_t key;       // Packed cell coordinates, EMPTY_KEY when unused
+            uint32_t start;
+            uint32_t count;
+        };
+
+        struct CellCoord {
+            int32_t x, y, z;
+        };
+
+        static constexpr uint64_t EMPTY_KEY = ~0ull;
+        static constexpr int32_t COORD_BIAS = 1 << 20;  // 21 bits per axis
+
+        CellCoord ToCell(const Vector3& position) const noexcept;
+        static uint64_t PackCell(const CellCoord& cell) noexcept {
+            return (static_cast<uint64_t>(cell.x + COORD_BIAS)) |
+                (static_cast<uint64_t>(cell.y + COORD_BIAS) << 21) |
+                (static_cast<uint64_t>(cell.z + COORD_BIAS) << 42);
+        }
+        static CellCoord UnpackCell(uint64_t key) noexcept {
+            return { static_cast<int32_t>(key & 0x1FFFFF) - COORD_BIAS,
+                static_cast<int32_t>((key >> 21) & 0x1FFFFF) - COORD_BIAS,
+                static_cast<int32_t>((key >> 42) & 0x1FFFFF) - COORD_BIAS };
+        }
+        const Slot* FindSlot(uint64_t key) const noexcept;
+
+        // Build phases; the per-task ones split the points into contiguous ranges
+        void PrepareBuild(size_t pointCount) noexcept;
+        void BuildKeys(std::span<const Vector3> points, uint32_t taskIndex, uint32_t taskCount) noexcept;
+        void BuildOffsets() noexcept;
+        void BuildScatter(std::span<const Vector3> points, uint32_t taskIndex, uint32_t taskCount) noexcept;
+
+        // Visits the non-empty cells in [minCell, maxCell], scanning the table
+        // instead when the range holds more cells than are occupied
+        template<typename Visitor>
+        bool ForEachCell(const CellCoord& minCell, const CellCoord& maxCell, Visitor&& visitor) const;
+
+        float cellSize_;
+        float invCellSize_;
+        std::vector<Slot> slots_;               // Power-of-two capacity, linear probing
+        uint32_t slotShift_ = 64;
+        size_t cellCount_ = 0;
+        std::vector<uint32_t> pointSlots_;      // Slot of every input point
+        std::vector<uint32_t> sortedIndices_;
+        std::vector<Vector3> sortedPoints_;
+    };
+
+    // Loose octree (looseness 2) over object bounds. An object is stored in the
+    // one node whose cell contains its center and whose size fits its extent,
+    // so placement is O(1) with no splitting. Rebuilds hash nodes by locational
+    // code, then lay them out breadth-first with their objects counting-sorted
+    // alongside, so queries walk flat arrays without any lookups.
+    class LooseOctree {
+    public:
+        static constexpr uint32_t MAX_DEPTH = 10;
+
+        explicit LooseOctree(const AABB& worldBounds = AABB(Vector3(-512.0f), Vector3(512.0f)), uint32_t maxDepth = 8) noexcept;
+
+        // Objects whose center is outside the world bounds are kept at the root
+        void SetWorldBounds(const AABB& worldBounds, uint32_t maxDepth) noexcept;
+
+        void Build(std::span<const AABB> objects) noexcept;
+        // Same contract as SpatialHashGrid::Build
+        template<typename ParallelFor>
+        void Build(std::span<const AABB> objects, uint32_t taskCount, ParallelFor&& parallelFor);
+        void Clear() noexcept;
+
+        size_t GetObjectCount() const noexcept { return sortedIndices_.size(); }
+        size_t GetNodeCount() const noexcept { return nodes_.size(); }
+
+        // Same output contract as SpatialHashGrid
+        std::span<uint32_t> QueryAABB(const AABB& bounds, std::span<uint32_t> output) const noexcept;
+        std::span<uint32_t> QuerySphere(const Sphere& sphere, std::span<uint32_t> output) const noexcept;
+
+        // callback(uint32_t objectIndex) -> bool, return false to stop
+        template<typename Callback>
+        void ForEachInAABB(const AABB& bounds, Callback&& callback) const;
+        template<typename Callback>
+        void ForEachInSphere(const Sphere& sphere, Callback&& callback) const;
+
+    private:
+        struct Slot {
+            uint32_t key;       // Locational code: 1 sentinel bit + 3 bits per level, 0 when unused
+            uint32_t childMask;
+            uint32_t start;
+            uint32_t count;
+        };
+
+        struct Node {
+            uint32_t firstChild; // Children are contiguous, in child-bit order
+            uint32_t childMask;
+            uint32_t start;
+            uint32_t count;
+        };
+
+        struct NodeEntry {
+            uint32_t node;
+            Vector3 center;
+            float halfSize;     // Half size of the cell; loose bounds are twice this
+        };
+
+        static constexpr uint32_t EMPTY_KEY = 0;
+        static constexpr uint32_t ROOT_KEY = 1;
+
+        uint32_t ComputeKey(const AABB& bounds) const noexcept;
+        const Slot* FindSlot(uint32_t key) const noexcept;
+
+        void PrepareBuild(size_t objectCount) noexcept;
+        // Sets buildFailed_ when the node table fills up and must grow
+        void BuildKeys(std::span<const AABB> objects, uint32_t taskIndex, uint32_t taskCount) noexcept;
+        void GrowTable() noexcept;
+        // Lays out the nodes breadth-first and assigns each one its object range
+        void BuildOffsets() noexcept;
+        void BuildScatter(std::span<const AABB> objects, uint32_t taskIndex, uint32_t taskCount) noexcept;
+
+        // overlaps(const AABB&) -> bool is applied to node loose bounds and object bounds
+        template<typename Overlap, typename Callback>
+        void Traverse(Overlap&& overlaps, Callback&& callback) const;
+
+        static bool Overlaps(const AABB& a, const AABB& b) noexcept {
+            return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+                a.min.y <= b.max.y && a.max.y >= b.min.y &&
+                a.min.z <= b.max.z && a.max.z >= b.min.z;
+        }
+        static bool Overlaps(const AABB& box, const Sphere& sphere) noexcept {
+            const float dx = Max(Max(box.min.x - sphere.center.x, sphere.center.x - box.max.x), 0.0f);
+            const float dy = Max(Max(box.min.y - sphere.center.y, sphere.center.y - box.max.y), 0.0f);
+            const float dz = Max(Max(box.min.z - sphere.center.z, sphere.center.z - box.max.z), 0.0f);
+            return dx * dx + dy * dy + dz * dz <= sphere.radius * sphere.radius;
+        }
+
+        AABB worldBounds_;
+        Vector3 worldCenter_;
+        float rootHalfSize_;
+        float invRootSize_;
+        uint32_t maxDepth_;
+        std::vector<Slot> slots_;               // Power-of-two capacity, linear probing
+        uint32_t slotShift_ = 32;
+        uint32_t slotsUsed_ = 0;
+        uint32_t buildFailed_ = 0;
+        std::vector<Node> nodes_;               // Breadth-first, root first
+        std::vector<uint32_t> nodeSlots_;       // Table slot of every node during a rebuild
+        std::vector<uint32_t> objectSlots_;     // Slot of every input object
+        std::vector<uint32_t> sortedIndices_;
+        std::vector<AABB> sortedBounds_;
+    };
+
 // =============================================================================
 // Utility Functions
 // =============================================================================
@@ -1257,6 +1758,294 @@ export namespace Akhanda::Math {
         return totalLength;
     }
 
+// =============================================================================
+// Spatial Partitioning Implementation
+// =============================================================================
+
+    template<typename Callback>
+    void DynamicAABBTree::Query(const AABB& bounds, Callback&& callback) const {
+        if (root_ == NULL_NODE) {
+            return;
+        }
+
+        TraversalStack<int32_t> stack;
+        stack.Push(root_);
+        while (!stack.Empty()) {
+            const int32_t nodeId = stack.Pop();
+            const Node& node = nodes_[nodeId];
+            if (!Overlaps(node.bounds, bounds)) {
+                continue;
+            }
+
+            if (node.IsLeaf()) {
+                if (!callback(nodeId)) {
+                    return;
+                }
+            }
+            else {
+                stack.Push(node.child1);
+                stack.Push(node.child2);
+            }
+        }
+    }
+
+    template<typename Callback>
+    void DynamicAABBTree::Query(const Frustum& frustum, Callback&& callback) const {
+        if (root_ == NULL_NODE) {
+            return;
+        }
+
+        TraversalStack<FrustumEntry> stack;
+        stack.Push({ root_, false });
+        while (!stack.Empty()) {
+            const FrustumEntry entry = stack.Pop();
+            const Node& node = nodes_[entry.node];
+
+            bool inside = entry.inside;
+            if (!inside) {
+                const Containment containment = Classify(frustum, node.bounds);
+                if (containment == Containment::Outside) {
+                    continue;
+                }
+                inside = containment == Containment::Inside;
+            }
+
+            if (node.IsLeaf()) {
+                if (!callback(entry.node)) {
+                    return;
+                }
+            }
+            else {
+                stack.Push({ node.child1, inside });
+                stack.Push({ node.child2, inside });
+            }
+        }
+    }
+
+    template<typename Callback>
+    void DynamicAABBTree::RayCast(const Ray& ray, float maxDistance, Callback&& callback) const {
+        if (root_ == NULL_NODE) {
+            return;
+        }
+
+        const Vector3 invDirection(
+            ray.direction.x != 0.0f ? 1.0f / ray.direction.x : INFINITY_F,
+            ray.direction.y != 0.0f ? 1.0f / ray.direction.y : INFINITY_F,
+            ray.direction.z != 0.0f ? 1.0f / ray.direction.z : INFINITY_F);
+        float maxT = maxDistance;
+
+        TraversalStack<int32_t> stack;
+        stack.Push(root_);
+        while (!stack.Empty()) {
+            const int32_t nodeId = stack.Pop();
+            const Node& node = nodes_[nodeId];
+            if (!IntersectsRay(node.bounds, ray.origin, invDirection, maxT)) {
+                continue;
+            }
+
+            if (node.IsLeaf()) {
+                const float result = callback(nodeId, ray, maxT);
+                if (result == 0.0f) {
+                    return;
+                }
+                if (result > 0.0f) {
+                    maxT = result;
+                }
+            }
+            else {
+                stack.Push(node.child1);
+                stack.Push(node.child2);
+            }
+        }
+    }
+
+    template<typename Callback>
+    void DynamicAABBTree::QueryOverlapPairs(Callback&& callback) const {
+        if (root_ == NULL_NODE) {
+            return;
+        }
+
+        TraversalStack<NodePair> stack;
+        stack.Push({ root_, root_ });
+        while (!stack.Empty()) {
+            const NodePair pair = stack.Pop();
+            const Node& a = nodes_[pair.a];
+
+            if (pair.a == pair.b) {
+                if (!a.IsLeaf()) {
+                    stack.Push({ a.child1, a.child1 });
+                    stack.Push({ a.child2, a.child2 });
+                    stack.Push({ a.child1, a.child2 });
+                }
+                continue;
+            }
+
+            const Node& b = nodes_[pair.b];
+            if (!Overlaps(a.bounds, b.bounds)) {
+                continue;
+            }
+
+            if (a.IsLeaf() && b.IsLeaf()) {
+                if (!callback(pair.a, pair.b)) {
+                    return;
+                }
+            }
+            else if (b.IsLeaf() || (!a.IsLeaf() && a.height >= b.height)) {
+                stack.Push({ a.child1, pair.b });
+                stack.Push({ a.child2, pair.b });
+            }
+            else {
+                stack.Push({ pair.a, b.child1 });
+                stack.Push({ pair.a, b.child2 });
+            }
+        }
+    }
+
+    template<typename ParallelFor>
+    void SpatialHashGrid::Build(std::span<const Vector3> points, uint32_t taskCount, ParallelFor&& parallelFor) {
+        taskCount = std::max(taskCount, 1u);
+        PrepareBuild(points.size());
+        parallelFor(taskCount, [&](uint32_t taskIndex) { BuildKeys(points, taskIndex, taskCount); });
+        BuildOffsets();
+        parallelFor(taskCount, [&](uint32_t taskIndex) { BuildScatter(points, taskIndex, taskCount); });
+    }
+
+    template<typename Visitor>
+    bool SpatialHashGrid::ForEachCell(const CellCoord& minCell, const CellCoord& maxCell, Visitor&& visitor) const {
+        if (cellCount_ == 0 || minCell.x > maxCell.x || minCell.y > maxCell.y || minCell.z > maxCell.z) {
+            return true;
+        }
+
+        const uint64_t rangeCells = static_cast<uint64_t>(maxCell.x - minCell.x + 1) *
+            static_cast<uint64_t>(maxCell.y - minCell.y + 1) * static_cast<uint64_t>(maxCell.z - minCell.z + 1);
+        if (rangeCells > cellCount_) {
+            for (const Slot& slot : slots_) {
+                if (slot.key == EMPTY_KEY) {
+                    continue;
+                }
+                const CellCoord cell = UnpackCell(slot.key);
+                if (cell.x >= minCell.x && cell.x <= maxCell.x && cell.y >= minCell.y && cell.y <= maxCell.y &&
+                    cell.z >= minCell.z && cell.z <= maxCell.z && !visitor(slot)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        for (int32_t z = minCell.z; z <= maxCell.z; ++z) {
+            for (int32_t y = minCell.y; y <= maxCell.y; ++y) {
+                for (int32_t x = minCell.x; x <= maxCell.x; ++x) {
+                    const Slot* slot = FindSlot(PackCell({ x, y, z }));
+                    if (slot != nullptr && !visitor(*slot)) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    template<typename Callback>
+    void SpatialHashGrid::ForEachInRadius(const Vector3& center, float radius, Callback&& callback) const {
+        if (radius < 0.0f) {
+            return;
+        }
+
+        const float radiusSq = radius * radius;
+        const Vector3 extent(radius);
+        ForEachCell(ToCell(center - extent), ToCell(center + extent), [&](const Slot& slot) {
+            for (uint32_t i = slot.start, end = slot.start + slot.count; i < end; ++i) {
+                const Vector3& p = sortedPoints_[i];
+                const float dx = p.x - center.x;
+                const float dy = p.y - center.y;
+                const float dz = p.z - center.z;
+                if (dx * dx + dy * dy + dz * dz <= radiusSq && !callback(sortedIndices_[i])) {
+                    return false;
+                }
+            }
+            return true;
+        });
+    }
+
+    template<typename Callback>
+    void SpatialHashGrid::ForEachInAABB(const AABB& bounds, Callback&& callback) const {
+        ForEachCell(ToCell(bounds.min), ToCell(bounds.max), [&](const Slot& slot) {
+            for (uint32_t i = slot.start, end = slot.start + slot.count; i < end; ++i) {
+                const Vector3& p = sortedPoints_[i];
+                if (p.x >= bounds.min.x && p.x <= bounds.max.x && p.y >= bounds.min.y && p.y <= bounds.max.y &&
+                    p.z >= bounds.min.z && p.z <= bounds.max.z && !callback(sortedIndices_[i])) {
+                    return false;
+                }
+            }
+            return true;
+        });
+    }
+
+    template<typename ParallelFor>
+    void LooseOctree::Build(std::span<const AABB> objects, uint32_t taskCount, ParallelFor&& parallelFor) {
+        taskCount = std::max(taskCount, 1u);
+        PrepareBuild(objects.size());
+        parallelFor(taskCount, [&](uint32_t taskIndex) { BuildKeys(objects, taskIndex, taskCount); });
+        while (buildFailed_ != 0) {
+            GrowTable();
+            parallelFor(taskCount, [&](uint32_t taskIndex) { BuildKeys(objects, taskIndex, taskCount); });
+        }
+        BuildOffsets();
+        parallelFor(taskCount, [&](uint32_t taskIndex) { BuildScatter(objects, taskIndex, taskCount); });
+    }
+
+    template<typename Overlap, typename Callback>
+    void LooseOctree::Traverse(Overlap&& overlaps, Callback&& callback) const {
+        if (nodes_.empty()) {
+            return;
+        }
+
+        // Depth-first; each level leaves at most seven siblings pending
+        NodeEntry stack[8 * (MAX_DEPTH + 1)];
+        uint32_t size = 0;
+        stack[size++] = { 0, worldCenter_, rootHalfSize_ };
+        while (size > 0) {
+            const NodeEntry entry = stack[--size];
+            const Node& node = nodes_[entry.node];
+
+            // The root also holds objects outside the world bounds, so it is never culled
+            if (entry.node != 0) {
+                const Vector3 loose(entry.halfSize * 2.0f);
+                if (!overlaps(AABB(entry.center - loose, entry.center + loose))) {
+                    continue;
+                }
+            }
+
+            for (uint32_t i = node.start, end = node.start + node.count; i < end; ++i) {
+                if (overlaps(sortedBounds_[i]) && !callback(sortedIndices_[i])) {
+                    return;
+                }
+            }
+
+            const float childHalf = entry.halfSize * 0.5f;
+            uint32_t child = node.firstChild;
+            for (uint32_t bit = 0; bit < 8; ++bit) {
+                if ((node.childMask & (1u << bit)) == 0) {
+                    continue;
+                }
+                const Vector3 offset((bit & 1) ? childHalf : -childHalf,
+                    (bit & 2) ? childHalf : -childHalf,
+                    (bit & 4) ? childHalf : -childHalf);
+                stack[size++] = { child++, entry.center + offset, childHalf };
+            }
+        }
+    }
+
+    template<typename Callback>
+    void LooseOctree::ForEachInAABB(const AABB& bounds, Callback&& callback) const {
+        Traverse([&](const AABB& box) { return Overlaps(box, bounds); }, callback);
+    }
+
+    template<typename Callback>
+    void LooseOctree::ForEachInSphere(const Sphere& sphere, Callback&& callback) const {
+        Traverse([&](const AABB& box) { return Overlaps(box, sphere); }, callback);
+    }
+
     // =============================================================================
     // Type Aliases for Common Names  
     // =============================================================================
@@ -465,6 +465,9 @@ namespace Akhanda::Shaders {
             if (cache_) {
                 // Recreate cache with new configuration
                 cache_ = std::make_unique<ShaderCache>(config_);
+                if (config_.GetEnableShaderCache()) {
+                    cache_->LoadFromDisk();
+                }
             }
 
             logChannel_.Log(Logging::LogLevel::Info, "ShaderManager configuration updated");
@@ -484,6 +487,7 @@ namespace Akhanda::Shaders {
                     request.stage,
                     request.variant,
                     request.optimization,
+                    request.shaderModel,
                     cacheEntry
                 )) {
                     // Create shader from cached data
@@ -596,6 +600,7 @@ namespace Akhanda::Shaders {
                     request.stage,
                     request.variant,
                     request.optimization,
+                    request.shaderModel,
                     bytecodeVector,
                     std::move(reflectionCopy)
                 );
@@ -1024,6 +1029,16 @@ namespace Akhanda::Shaders {
         // ShaderCache Implementation
         // ============================================================================
 
+        namespace {
+            // Bump when anything outside the compiler changes what a cached
+            // shader would compile to, such as the compile flags or defines
+            constexpr std::uint64_t SHADER_CACHE_REVISION = 2;
+
+            std::uint64_t GetCompilerRevision() {
+                return Core::HashString64(std::string(D3DCOMPILER_DLL_A) + "|" + std::to_string(D3D_COMPILER_VERSION));
+            }
+        }
+
         ShaderCache::ShaderCache(const Configuration::ShaderConfig& config)
             : config_(config)
         {
@@ -1041,131 +1056,202 @@ namespace Akhanda::Shaders {
             ShaderStage stage,
             const ShaderVariant& variant,
             Configuration::ShaderOptimization optimization,
+            Configuration::ShaderModel shaderModel,
             CacheEntry& outEntry
         ) {
-            std::shared_lock<std::shared_mutex> lock(cacheMutex_);
+            const ShaderKey key = ShaderKey::Make(sourcePath, entryPoint, stage, variant, optimization, shaderModel);
+
+            // The entry is checked before anything is copied, so a stale one
+            // costs no copy of its bytecode and reflection
+            bool current = false;
+            const bool found = cache_.Read(key, [&](const CacheEntry& entry) {
+                // Check if source file has been modified
+                if (std::filesystem::exists(sourcePath) && std::filesystem::last_write_time(sourcePath) > entry.lastModified) {
+                    return; // Source file is newer
+                }
+
+                // Verify source hash if available; it covers the included files too
+                if (entry.sourceHash != 0) {
+                    const std::uint64_t currentHash = entry.reflection ? HashShaderSources(sourcePath, entry.reflection->includedFiles)
+                        : HashShaderSources(sourcePath, {});
+                    if (currentHash != entry.sourceHash) {
+                        return; // Source content changed
+                    }
+                }
 
-            std::string key = GenerateCacheKey(sourcePath, entryPoint, stage, variant, optimization);
-            auto it = cache_.find(key);
+                // Copy the data we need (can't copy the whole entry due to unique_ptr)
+                current = true;
+                outEntry.bytecode = entry.bytecode;
+                outEntry.reflection = entry.reflection ? std::make_unique<ShaderReflectionData>(*entry.reflection) : nullptr;
+                outEntry.sourceHash = entry.sourceHash;
+                outEntry.lastModified = entry.lastModified;
+                outEntry.sourcePath = entry.sourcePath;
+                outEntry.variant = entry.variant;
+                outEntry.optimization = entry.optimization;
+                outEntry.description = entry.description;
+            });
 
-            if (it == cache_.end()) {
-                return false;
+            if (!found) {
+                return TryGetPackedShader(key, sourcePath, entryPoint, stage, variant, optimization, shaderModel, outEntry);
             }
+            return current;
+        }
 
-            const CacheEntry& entry = it->second;
+        void ShaderCache::CacheShader(
+            const std::filesystem::path& sourcePath,
+            const std::string& entryPoint,
+            ShaderStage stage,
+            const ShaderVariant& variant,
+            Configuration::ShaderOptimization optimization,
+            Configuration::ShaderModel shaderModel,
+            const std::vector<std::uint8_t>& bytecode,
+            std::unique_ptr<ShaderReflectionData> reflection
+        ) {
+            const ShaderKey key = ShaderKey::Make(sourcePath, entryPoint, stage, variant, optimization, shaderModel);
+
+            CacheEntry entry;
+            entry.bytecode = bytecode;
+            entry.reflection = std::move(reflection);
+            entry.sourceHash = entry.reflection ? HashShaderSources(sourcePath, entry.reflection->includedFiles)
+                : HashShaderSources(sourcePath, {});
+            entry.sourcePath = sourcePath;
+            entry.variant = variant;
+            entry.optimization = optimization;
+            entry.description = DescribeCacheKey(sourcePath, entryPoint, stage, variant, optimization, shaderModel);
 
-            // Check if source file has been modified
             if (std::filesystem::exists(sourcePath)) {
-                auto lastWriteTime = std::filesystem::last_write_time(sourcePath);
-                if (lastWriteTime > entry.lastModified) {
-                    return false; // Source file is newer
-                }
+                entry.lastModified = std::filesystem::last_write_time(sourcePath);
             }
 
-            // Verify source hash if available
-            if (entry.sourceHash != 0) {
-                std::uint64_t currentHash = CalculateFileHash(sourcePath);
-                if (currentHash != entry.sourceHash) {
-                    return false; // Source content changed
-                }
+            if (pack_) {
+                pack_->Add(key, entry.sourceHash, entry.bytecode, entry.reflection.get());
             }
 
-            // Copy the data we need (can't copy the whole entry due to unique_ptr)
-            outEntry.bytecode = entry.bytecode;
-            outEntry.reflection = std::make_unique<ShaderReflectionData>(*entry.reflection);
-            outEntry.sourceHash = entry.sourceHash;
-            outEntry.lastModified = entry.lastModified;
-            outEntry.sourcePath = entry.sourcePath;
-            outEntry.variant = entry.variant;
-            outEntry.optimization = entry.optimization;
-
-            return true;
+            cache_.InsertOrAssign(key, std::move(entry));
         }
 
-        void ShaderCache::CacheShader(
+        bool ShaderCache::TryGetPackedShader(
+            const ShaderKey& key,
             const std::filesystem::path& sourcePath,
             const std::string& entryPoint,
             ShaderStage stage,
             const ShaderVariant& variant,
             Configuration::ShaderOptimization optimization,
-            const std::vector<std::uint8_t>& bytecode,
-            std::unique_ptr<ShaderReflectionData> reflection
+            Configuration::ShaderModel shaderModel,
+            CacheEntry& outEntry
         ) {
-            std::unique_lock<std::shared_mutex> lock(cacheMutex_);
+            if (!pack_) {
+                return false;
+            }
+
+            const ShaderPackEntry packed = pack_->Find(key);
+            if (!packed) {
+                return false;
+            }
 
-            std::string key = GenerateCacheKey(sourcePath, entryPoint, stage, variant, optimization);
+            // The pack outlives the source files' timestamps, so only the
+            // content hash of the source and its includes says whether the
+            // entry is still current. One stored without reflection was
+            // hashed without includes, as CacheShader does.
+            auto reflection = packed.ReadReflection();
+            const std::uint64_t currentHash = reflection ? HashShaderSources(sourcePath, reflection->includedFiles)
+                : HashShaderSources(sourcePath, {});
+            if (currentHash != packed.GetSourceHash()) {
+                return false;
+            }
 
+            // Kept in memory from now on, so the next lookup neither searches
+            // the pack nor deserializes the reflection again
             CacheEntry entry;
-            entry.bytecode = bytecode;
+            const auto bytecode = packed.GetBytecode();
+            entry.bytecode.assign(bytecode.begin(), bytecode.end());
             entry.reflection = std::move(reflection);
-            entry.sourceHash = CalculateFileHash(sourcePath);
+            entry.sourceHash = packed.GetSourceHash();
+            if (std::filesystem::exists(sourcePath)) {
+                entry.lastModified = std::filesystem::last_write_time(sourcePath);
+            }
             entry.sourcePath = sourcePath;
             entry.variant = variant;
             entry.optimization = optimization;
+            entry.description = DescribeCacheKey(sourcePath, entryPoint, stage, variant, optimization, shaderModel);
 
-            if (std::filesystem::exists(sourcePath)) {
-                entry.lastModified = std::filesystem::last_write_time(sourcePath);
-            }
+            outEntry.bytecode = entry.bytecode;
+            outEntry.reflection = entry.reflection ? std::make_unique<ShaderReflectionData>(*entry.reflection) : nullptr;
+            outEntry.sourceHash = entry.sourceHash;
+            outEntry.lastModified = entry.lastModified;
+            outEntry.sourcePath = entry.sourcePath;
+            outEntry.variant = entry.variant;
+            outEntry.optimization = entry.optimization;
+            outEntry.description = entry.description;
 
-            cache_.emplace(key, std::move(entry));
+            cache_.InsertOrAssign(key, std::move(entry));
+            return true;
         }
 
         void ShaderCache::InvalidateCache(const std::filesystem::path& sourcePath) {
-            std::unique_lock<std::shared_mutex> lock(cacheMutex_);
-
             // Remove all cache entries that depend on this source file
-            auto it = cache_.begin();
-            while (it != cache_.end()) {
-                if (it->second.sourcePath == sourcePath) {
-                    it = cache_.erase(it);
-                }
-                else {
-                    ++it;
-                }
-            }
+            cache_.EraseIf([&sourcePath](const CacheEntry& entry) { return entry.sourcePath == sourcePath; });
         }
 
         void ShaderCache::ClearCache() {
-            std::unique_lock<std::shared_mutex> lock(cacheMutex_);
-            cache_.clear();
+            cache_.Clear();
+            if (pack_) {
+                pack_->Clear();
+            }
         }
 
         std::uint64_t ShaderCache::GetCacheSize() const {
-            std::shared_lock<std::shared_mutex> lock(cacheMutex_);
             std::uint64_t totalSize = 0;
-            for (const auto& [key, entry] : cache_) {
+            cache_.ForEach([&totalSize](const ShaderKey&, const CacheEntry& entry) {
                 totalSize += entry.bytecode.size();
-            }
+            });
             return totalSize;
         }
 
         std::uint32_t ShaderCache::GetCachedShaderCount() const {
-            std::shared_lock<std::shared_mutex> lock(cacheMutex_);
-            return static_cast<std::uint32_t>(cache_.size());
+            return static_cast<std::uint32_t>(cache_.Size());
         }
 
         void ShaderCache::SaveToDisk() {
-            // Implementation would serialize cache to disk
-            // For now, just log that we're saving
+            // Every compiled shader is already in the journal, so saving
+            // only folds the journal into the pack
+            if (!pack_ || pack_->GetJournalEntryCount() == 0) {
+                return;
+            }
+
             auto& logChannel = Logging::LogManager::Instance().GetChannel("ShaderCache");
-            logChannel.LogFormat(Logging::LogLevel::Info, "Saving shader cache with {} entries", GetCachedShaderCount());
+            if (pack_->Compact()) {
+                logChannel.LogFormat(Logging::LogLevel::Info, "Saved shader cache with {} entries to '{}'",
+                    pack_->GetEntryCount(), pack_->GetPath().string());
+            }
+            else {
+                logChannel.LogFormat(Logging::LogLevel::Warning, "Could not rewrite shader cache '{}'; {} shaders stay in its journal",
+                    pack_->GetPath().string(), pack_->GetJournalEntryCount());
+            }
         }
 
         void ShaderCache::LoadFromDisk() {
-            // Implementation would deserialize cache from disk
-            // For now, just log that we're loading
+            ShaderPack::Options options;
+            options.path = std::filesystem::path(config_.GetShaderCachePath()) / "shaders.pack";
+            options.compilerRevision = GetCompilerRevision();
+            options.engineRevision = SHADER_CACHE_REVISION;
+            pack_ = std::make_unique<ShaderPack>(std::move(options));
+
             auto& logChannel = Logging::LogManager::Instance().GetChannel("ShaderCache");
-            logChannel.Log(Logging::LogLevel::Info, "Loading shader cache from disk");
+            logChannel.LogFormat(Logging::LogLevel::Info, "Loaded shader cache '{}' with {} entries",
+                pack_->GetPath().string(), pack_->GetEntryCount());
         }
 
-        std::string ShaderCache::GenerateCacheKey(
+        // Lookups go by ShaderKey; this text only names an entry in logs
+        std::string ShaderCache::DescribeCacheKey(
             const std::filesystem::path& sourcePath,
             const std::string& entryPoint,
             ShaderStage stage,
             const ShaderVariant& variant,
-            Configuration::ShaderOptimization optimization
+            Configuration::ShaderOptimization optimization,
+            Configuration::ShaderModel shaderModel
         ) const {
-            std::string key = sourcePath.string() + "|" + entryPoint + "|" + std::to_string(static_cast<int>(stage)) + "|" + std::to_string(static_cast<int>(optimization));
+            std::string key = sourcePath.string() + "|" + entryPoint + "|" + std::to_string(static_cast<int>(stage)) + "|" + std::to_string(static_cast<int>(optimization)) + "|" + std::to_string(static_cast<int>(shaderModel));
 
             // Add variant defines
             for (const auto& define : variant.defines) {
@@ -1175,21 +1261,6 @@ namespace Akhanda::Shaders {
             return key;
         }
 
-        std::uint64_t ShaderCache::CalculateFileHash(const std::filesystem::path& filePath) const {
-            if (!std::filesystem::exists(filePath)) {
-                return 0;
-            }
-
-            std::ifstream file(filePath, std::ios::binary);
-            if (!file.is_open()) {
-                return 0;
-            }
-
-            std::hash<std::string> hasher;
-            std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-            return hasher(content);
-        }
-
         // ============================================================================
         // HotReloadManager Implementation
         // ============================================================================
@@ -26,6 +26,8 @@ module;
 export module Akhanda.Engine.Shaders.D3D12;
 
 import Akhanda.Engine.Shaders;
+import Akhanda.Engine.Shaders.Key;
+import Akhanda.Engine.Shaders.Pack;
 import Akhanda.Engine.RHI.Interfaces;
 import Akhanda.Core.Result;
 import Akhanda.Core.Logging;
@@ -158,6 +160,7 @@ export namespace Akhanda::Shaders::D3D12 {
             std::filesystem::path sourcePath;
             ShaderVariant variant;
             Configuration::ShaderOptimization optimization;
+            std::string description;        // Readable key, for diagnostics only
 
             // Add move constructor and move assignment operator
             CacheEntry() = default;
@@ -173,6 +176,7 @@ export namespace Akhanda::Shaders::D3D12 {
             ShaderStage stage,
             const ShaderVariant& variant,
             Configuration::ShaderOptimization optimization,
+            Configuration::ShaderModel shaderModel,
             CacheEntry& outEntry
         );
 
@@ -182,6 +186,7 @@ export namespace Akhanda::Shaders::D3D12 {
             ShaderStage stage,
             const ShaderVariant& variant,
             Configuration::ShaderOptimization optimization,
+            Configuration::ShaderModel shaderModel,
             const std::vector<std::uint8_t>& bytecode,
             std::unique_ptr<ShaderReflectionData> reflection
         );
@@ -196,18 +201,29 @@ export namespace Akhanda::Shaders::D3D12 {
 
     private:
         Configuration::ShaderConfig config_;
-        std::unordered_map<std::string, CacheEntry> cache_;
-        mutable std::shared_mutex cacheMutex_;
+        ShaderKeyMap<CacheEntry> cache_;
+        std::unique_ptr<ShaderPack> pack_;      // Shaders compiled in earlier runs; opened by LoadFromDisk
 
-        std::string GenerateCacheKey(
+        std::string DescribeCacheKey(
             const std::filesystem::path& sourcePath,
             const std::string& entryPoint,
             ShaderStage stage,
             const ShaderVariant& variant,
-            Configuration::ShaderOptimization optimization
+            Configuration::ShaderOptimization optimization,
+            Configuration::ShaderModel shaderModel
         ) const;
 
-        std::uint64_t CalculateFileHash(const std::filesystem::path& filePath) const;
+        // A current pack entry is also added to cache_
+        bool TryGetPackedShader(
+            const ShaderKey& key,
+            const std::filesystem::path& sourcePath,
+            const std::string& entryPoint,
+            ShaderStage stage,
+            const ShaderVariant& variant,
+            Configuration::ShaderOptimization optimization,
+            Configuration::ShaderModel shaderModel,
+            CacheEntry& outEntry
+        );
     };
 
     // ============================================================================
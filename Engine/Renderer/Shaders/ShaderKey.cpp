@@ -0,0 +1,133 @@
+// Engine/Renderer/Shaders/ShaderKey.cpp
+// Akhanda Game Engine - Fixed-Size Shader Cache Keys Implementation
+// Copyright (c) 2025 Aditya Vennelakanti. All rights reserved.
+
+module;
+
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+#include <type_traits>
+
+module Akhanda.Engine.Shaders.Key;
+
+namespace {
+
+    using Akhanda::Shaders::ShaderKey;
+
+    // Two lanes over the same 8-byte words with different mixes, so the
+    // halves of a key are independent; the finish avalanches each lane.
+    class KeyHasher {
+    public:
+        void Word(std::uint64_t word) noexcept {
+            low_ = (low_ ^ word) * 0x9E3779B97F4A7C15ull;
+            low_ ^= low_ >> 32;
+            high_ = (high_ + word) * 0xBF58476D1CE4E5B9ull;
+            high_ ^= high_ >> 29;
+        }
+
+        // Code units packed into words after transform. The last word holds
+        // the remaining units and the length's low byte, which is enough to
+        // tell "ab" + "c" from "a" + "bc".
+        template<typename CharT, typename Transform>
+        void Text(std::basic_string_view<CharT> text, Transform&& transform) noexcept {
+            using Unit = std::make_unsigned_t<CharT>;
+            constexpr size_t UNITS_PER_WORD = sizeof(std::uint64_t) / sizeof(CharT);
+            constexpr unsigned BITS = sizeof(CharT) * 8;
+
+            // A fixed count per word, so the inner loop unrolls
+            size_t i = 0;
+            for (; i + UNITS_PER_WORD <= text.size(); i += UNITS_PER_WORD) {
+                std::uint64_t word = 0;
+                for (size_t j = 0; j < UNITS_PER_WORD; ++j) {
+                    word |= std::uint64_t{ static_cast<Unit>(transform(text[i + j])) } << (j * BITS);
+                }
+                Word(word);
+            }
+
+            std::uint64_t word = std::uint64_t{ text.size() } << 56;
+            for (unsigned shift = 0; i < text.size(); ++i, shift += BITS) {
+                word |= std::uint64_t{ static_cast<Unit>(transform(text[i])) } << shift;
+            }
+            Word(word);
+        }
+
+        void Text(std::string_view text) noexcept {
+            Text(text, [](char c) noexcept { return c; });
+        }
+
+        ShaderKey Finish() const noexcept {
+            return ShaderKey{ Avalanche(low_), Avalanche(high_ ^ 0xC2B2AE3D27D4EB4Full) };
+        }
+
+    private:
+        static std::uint64_t Avalanche(std::uint64_t hash) noexcept {
+            hash ^= hash >> 33;
+            hash *= 0xFF51AFD7ED558CCDull;
+            hash ^= hash >> 33;
+            hash *= 0xC4CEB9FE1A85EC53ull;
+            return hash ^ (hash >> 33);
+        }
+
+        std::uint64_t low_ = 0xCBF29CE484222325ull;
+        std::uint64_t high_ = 0x84222325CBF29CE4ull;
+    };
+
+} // namespace
+
+namespace Akhanda::Shaders {
+
+    ShaderKey ShaderKey::FromString(std::string_view text) noexcept {
+        KeyHasher hasher;
+        hasher.Text(text);
+        return hasher.Finish();
+    }
+
+    ShaderKey ShaderKey::Make(
+        const std::filesystem::path& sourcePath,
+        std::string_view entryPoint,
+        ShaderStage stage,
+        const ShaderVariant& variant,
+        Configuration::ShaderOptimization optimization,
+        Configuration::ShaderModel shaderModel
+    ) noexcept {
+        using PathChar = std::filesystem::path::value_type;
+
+        KeyHasher hasher;
+        hasher.Text(std::basic_string_view<PathChar>(sourcePath.native()), [](PathChar c) noexcept {
+            if (c == PathChar('\\')) {
+                return PathChar('/');
+            }
+#ifdef _WIN32
+            if (c >= PathChar('A') && c <= PathChar('Z')) {
+                return static_cast<PathChar>(c - PathChar('A') + PathChar('a'));
+            }
+#endif
+            return c;
+        });
+        hasher.Text(entryPoint);
+        hasher.Word(static_cast<std::uint64_t>(stage) |
+            static_cast<std::uint64_t>(optimization) << 16 |
+            static_cast<std::uint64_t>(shaderModel) << 32);
+
+        const ShaderKey variantKey = HashVariant(variant);
+        hasher.Word(variantKey.low);
+        hasher.Word(variantKey.high);
+        return hasher.Finish();
+    }
+
+    ShaderKey ShaderKey::HashVariant(const ShaderVariant& variant) noexcept {
+        // Adding the defines' keys makes the order irrelevant
+        ShaderKey key{ variant.defines.size(), 0 };
+        for (const ShaderDefine& define : variant.defines) {
+            KeyHasher hasher;
+            hasher.Text(define.name);
+            hasher.Text(define.value);
+            const ShaderKey defineKey = hasher.Finish();
+            key.low += defineKey.low;
+            key.high += defineKey.high;
+        }
+        return key;
+    }
+
+} // namespace Akhanda::Shaders
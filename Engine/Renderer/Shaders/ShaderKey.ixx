@@ -0,0 +1,147 @@
+// Engine/Renderer/Shaders/ShaderKey.ixx
+// Akhanda Game Engine - Fixed-Size Shader Cache Keys
+// Copyright (c) 2025 Aditya Vennelakanti. All rights reserved.
+
+module;
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+export module Akhanda.Engine.Shaders.Key;
+
+import Akhanda.Engine.Shaders;
+import Akhanda.Core.Configuration.Rendering;
+
+export namespace Akhanda::Shaders {
+
+    // ============================================================================
+    // Shader Key
+    // ============================================================================
+
+    // 128-bit identity of one compiled shader. Two independent 64-bit hashes
+    // make a collision between the permutations of one project negligible.
+    struct ShaderKey {
+        std::uint64_t low = 0;
+        std::uint64_t high = 0;
+
+        static ShaderKey FromString(std::string_view text) noexcept;
+
+        // Everything that decides what a compile produces, hashed in place
+        // without building a string. Path separators are unified, and on
+        // Windows the path's ASCII case is folded, so each spelling of one
+        // file gives the same key.
+        static ShaderKey Make(
+            const std::filesystem::path& sourcePath,
+            std::string_view entryPoint,
+            ShaderStage stage,
+            const ShaderVariant& variant,
+            Configuration::ShaderOptimization optimization,
+            Configuration::ShaderModel shaderModel
+        ) noexcept;
+
+        // The same for any order of the variant's defines
+        static ShaderKey HashVariant(const ShaderVariant& variant) noexcept;
+
+        friend constexpr bool operator==(const ShaderKey&, const ShaderKey&) = default;
+        friend constexpr auto operator<=>(const ShaderKey&, const ShaderKey&) = default;
+    };
+
+    struct ShaderKeyHash {
+        size_t operator()(const ShaderKey& key) const noexcept {
+            return static_cast<size_t>(key.low ^ (key.high * 0x9E3779B97F4A7C15ull));
+        }
+    };
+
+    // ============================================================================
+    // Shader Key Map
+    // ============================================================================
+
+    // Values keyed by ShaderKey, split across stripes that each have their
+    // own lock, so lookups of different shaders from several threads do not
+    // contend on one reader count. The stripe comes from the key's high half
+    // and the bucket mostly from its low half.
+    template<typename T, size_t STRIPE_COUNT = 16>
+    class ShaderKeyMap {
+        static_assert((STRIPE_COUNT & (STRIPE_COUNT - 1)) == 0, "Stripe count must be a power of two");
+
+    public:
+        // Calls fn with the value under a shared lock; false when absent
+        template<typename Fn>
+        bool Read(const ShaderKey& key, Fn&& fn) const {
+            const Stripe& stripe = GetStripe(key);
+            std::shared_lock<std::shared_mutex> lock(stripe.mutex);
+            const auto it = stripe.entries.find(key);
+            if (it == stripe.entries.end()) {
+                return false;
+            }
+            fn(it->second);
+            return true;
+        }
+
+        void InsertOrAssign(const ShaderKey& key, T value) {
+            Stripe& stripe = GetStripe(key);
+            std::unique_lock<std::shared_mutex> lock(stripe.mutex);
+            stripe.entries.insert_or_assign(key, std::move(value));
+        }
+
+        // Locks one stripe at a time, so it is not atomic across stripes
+        template<typename Predicate>
+        size_t EraseIf(Predicate&& predicate) {
+            size_t erased = 0;
+            for (Stripe& stripe : stripes_) {
+                std::unique_lock<std::shared_mutex> lock(stripe.mutex);
+                erased += std::erase_if(stripe.entries, [&](const auto& entry) { return predicate(entry.second); });
+            }
+            return erased;
+        }
+
+        template<typename Fn>
+        void ForEach(Fn&& fn) const {
+            for (const Stripe& stripe : stripes_) {
+                std::shared_lock<std::shared_mutex> lock(stripe.mutex);
+                for (const auto& [key, value] : stripe.entries) {
+                    fn(key, value);
+                }
+            }
+        }
+
+        void Clear() {
+            for (Stripe& stripe : stripes_) {
+                std::unique_lock<std::shared_mutex> lock(stripe.mutex);
+                stripe.entries.clear();
+            }
+        }
+
+        size_t Size() const {
+            size_t size = 0;
+            for (const Stripe& stripe : stripes_) {
+                std::shared_lock<std::shared_mutex> lock(stripe.mutex);
+                size += stripe.entries.size();
+            }
+            return size;
+        }
+
+    private:
+        // Own cache line each, so locking one stripe does not slow its neighbours
+        struct alignas(64) Stripe {
+            mutable std::shared_mutex mutex;
+            std::unordered_map<ShaderKey, T, ShaderKeyHash> entries;
+        };
+
+        Stripe& GetStripe(const ShaderKey& key) noexcept {
+            return stripes_[key.high & (STRIPE_COUNT - 1)];
+        }
+        const Stripe& GetStripe(const ShaderKey& key) const noexcept {
+            return stripes_[key.high & (STRIPE_COUNT - 1)];
+        }
+
+        std::array<Stripe, STRIPE_COUNT> stripes_;
+    };
+
+} // namespace Akhanda::Shaders
@@ -0,0 +1,862 @@
+// Engine/Renderer/Shaders/ShaderPack.cpp
+// Akhanda Game Engine - Persistent Shader Pack Cache Implementation
+// Copyright (c) 2025 Aditya Vennelakanti. All rights reserved.
+
+module;
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+
+module Akhanda.Engine.Shaders.Pack;
+
+import Akhanda.Core.Hash;
+import Akhanda.Core.MappedFile;
+
+using Akhanda::Core::MappedFile;
+
+// =============================================================================
+// File Layout
+// =============================================================================
+//
+//   Pack:     PackHeader, then entryCount IndexEntry records sorted by key,
+//             then the bytecode and reflection blobs, each starting on a
+//             16-byte boundary. Entries are found by binary search over the
+//             mapped index; nothing is read until a shader is looked up.
+//
+//   Journal:  JournalHeader, then one record per shader added since the
+//             pack was written: RecordHeader, bytecode, reflection, padding
+//             to 8 bytes. Later records replace earlier ones with the same
+//             key. A record counts only when its checksum holds, so a
+//             record torn by the process dying ends the journal and is cut
+//             off when it is next opened.
+//
+//   Both headers name the compiler and engine revisions the shaders were
+//   built with. Compaction writes the merged pack to "<pack>.tmp" and
+//   renames it over the pack before deleting the journal, so every point
+//   of a crash leaves either the old pack and journal or the new pack.
+
+namespace {
+
+    using Akhanda::Shaders::ShaderKey;
+
+    constexpr std::array<char, 8> PACK_MAGIC = { 'A', 'K', 'H', 'S', 'P', 'A', 'K', '\0' };
+    constexpr std::array<char, 8> JOURNAL_MAGIC = { 'A', 'K', 'H', 'S', 'L', 'O', 'G', '\0' };
+    constexpr std::uint32_t PACK_VERSION = 1;
+    constexpr std::uint64_t BLOB_ALIGNMENT = 16;
+
+    struct PackHeader {
+        std::array<char, 8> magic;
+        std::uint32_t version;
+        std::uint32_t entryCount;
+        std::uint64_t compilerRevision;
+        std::uint64_t engineRevision;
+        std::uint64_t fileSize;
+        std::uint64_t indexChecksum;
+        std::uint64_t reserved[2];
+    };
+    static_assert(sizeof(PackHeader) == 64);
+
+    struct IndexEntry {
+        ShaderKey key;
+        std::uint64_t sourceHash;
+        std::uint64_t bytecodeOffset;
+        std::uint64_t reflectionOffset;
+        std::uint32_t bytecodeSize;
+        std::uint32_t reflectionSize;
+    };
+    static_assert(sizeof(IndexEntry) == 48);
+
+    struct JournalHeader {
+        std::array<char, 8> magic;
+        std::uint32_t version;
+        std::uint32_t reserved;
+        std::uint64_t compilerRevision;
+        std::uint64_t engineRevision;
+    };
+    static_assert(sizeof(JournalHeader) == 32);
+
+    struct RecordHeader {
+        ShaderKey key;
+        std::uint64_t sourceHash;
+        std::uint32_t bytecodeSize;
+        std::uint32_t reflectionSize;
+        std::uint64_t checksum;         // Over the fields above and both payloads
+    };
+    static_assert(sizeof(RecordHeader) == 40);
+
+    constexpr std::uint64_t Align(std::uint64_t value, std::uint64_t alignment) noexcept {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    // FNV-1a, continued from hash
+    std::uint64_t Checksum(const void* data, size_t size, std::uint64_t hash = Akhanda::Core::FNV_OFFSET_BASIS_64) noexcept {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * Akhanda::Core::FNV_PRIME_64;
+        }
+        return hash;
+    }
+
+    std::uint64_t RecordChecksum(const RecordHeader& header, std::span<const std::uint8_t> bytecode,
+        std::span<const std::uint8_t> reflection) noexcept {
+        std::uint64_t hash = Checksum(&header, offsetof(RecordHeader, checksum));
+        hash = Checksum(bytecode.data(), bytecode.size(), hash);
+        return Checksum(reflection.data(), reflection.size(), hash);
+    }
+
+    bool ReadWholeFile(const std::filesystem::path& path, std::string& content) {
+        content.clear();
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+        content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    bool WriteBytes(std::ofstream& file, const void* data, size_t size) {
+        file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        return file.good();
+    }
+
+    bool WritePadding(std::ofstream& file, std::uint64_t size) {
+        static constexpr std::array<char, BLOB_ALIGNMENT> ZEROS{};
+        return WriteBytes(file, ZEROS.data(), static_cast<size_t>(size));
+    }
+
+    // ========================================================================
+    // Reflection Serialization
+    // ========================================================================
+
+    class BlobWriter {
+    public:
+        explicit BlobWriter(std::vector<std::uint8_t>& out) : out_(out) {}
+
+        template<typename T>
+        void Put(T value) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            const auto* bytes = reinterpret_cast<const std::uint8_t*>(&value);
+            out_.insert(out_.end(), bytes, bytes + sizeof(T));
+        }
+
+        void PutString(std::string_view text) {
+            Put(static_cast<std::uint32_t>(text.size()));
+            out_.insert(out_.end(), text.begin(), text.end());
+        }
+
+        void PutPath(const std::filesystem::path& path) {
+            const std::u8string text = path.u8string();
+            PutString(std::string_view(reinterpret_cast<const char*>(text.data()), text.size()));
+        }
+
+        template<typename Container, typename PutElement>
+        void PutList(const Container& elements, PutElement&& putElement) {
+            Put(static_cast<std::uint32_t>(elements.size()));
+            for (const auto& element : elements) {
+                putElement(element);
+            }
+        }
+
+        void PutStrings(const std::vector<std::string>& strings) {
+            PutList(strings, [this](const std::string& text) { PutString(text); });
+        }
+
+    private:
+        std::vector<std::uint8_t>& out_;
+    };
+
+    // Reads what BlobWriter wrote. Running past the end or finding a count
+    // the remaining bytes cannot hold marks the reader failed and returns
+    // empty values from then on.
+    class BlobReader {
+    public:
+        explicit BlobReader(std::span<const std::uint8_t> data) : data_(data) {}
+
+        bool IsValid() const noexcept { return valid_; }
+        bool IsAtEnd() const noexcept { return position_ == data_.size(); }
+
+        template<typename T>
+        T Get() {
+            static_assert(std::is_trivially_copyable_v<T>);
+            T value{};
+            if (Require(sizeof(T))) {
+                std::memcpy(&value, data_.data() + position_, sizeof(T));
+                position_ += sizeof(T);
+            }
+            return value;
+        }
+
+        std::string GetString() {
+            const std::uint32_t size = Get<std::uint32_t>();
+            if (!Require(size)) return {};
+            std::string text(reinterpret_cast<const char*>(data_.data() + position_), size);
+            position_ += size;
+            return text;
+        }
+
+        std::filesystem::path GetPath() {
+            const std::string text = GetString();
+            return std::filesystem::path(std::u8string(reinterpret_cast<const char8_t*>(text.data()), text.size()));
+        }
+
+        // Every element takes at least minimumSize bytes
+        size_t GetCount(size_t minimumSize) {
+            const std::uint32_t count = Get<std::uint32_t>();
+            if (!valid_ || count > (data_.size() - position_) / minimumSize) {
+                valid_ = false;
+                return 0;
+            }
+            return count;
+        }
+
+        template<typename T, typename GetElement>
+        void GetList(std::vector<T>& elements, size_t minimumSize, GetElement&& getElement) {
+            const size_t count = GetCount(minimumSize);
+            elements.clear();
+            elements.reserve(count);
+            for (size_t i = 0; i < count && valid_; ++i) {
+                elements.push_back(getElement());
+            }
+        }
+
+        void GetStrings(std::vector<std::string>& strings) {
+            GetList(strings, sizeof(std::uint32_t), [this] { return GetString(); });
+        }
+
+    private:
+        bool Require(size_t size) {
+            if (!valid_ || size > data_.size() - position_) {
+                valid_ = false;
+            }
+            return valid_;
+        }
+
+        std::span<const std::uint8_t> data_;
+        size_t position_ = 0;
+        bool valid_ = true;
+    };
+
+    using Akhanda::Shaders::ShaderParameter;
+    using Akhanda::Shaders::ShaderResource;
+    using Akhanda::Shaders::ShaderReflectionData;
+
+    void PutParameter(BlobWriter& writer, const ShaderParameter& parameter) {
+        writer.PutString(parameter.name);
+        writer.Put(parameter.dataType);
+        writer.Put(parameter.size);
+        writer.Put(parameter.offset);
+        writer.Put(parameter.arraySize);
+        writer.Put(parameter.columns);
+        writer.Put(parameter.rows);
+        writer.Put(parameter.isArray);
+        writer.Put(parameter.isMatrix);
+        writer.Put(parameter.isStruct);
+        writer.PutString(parameter.structTypeName);
+        writer.PutList(parameter.defaultValue, [&](std::uint8_t byte) { writer.Put(byte); });
+        writer.Put(parameter.hasDefaultValue);
+    }
+
+    ShaderParameter GetParameter(BlobReader& reader) {
+        ShaderParameter parameter;
+        parameter.name = reader.GetString();
+        parameter.dataType = reader.Get<decltype(parameter.dataType)>();
+        parameter.size = reader.Get<std::uint32_t>();
+        parameter.offset = reader.Get<std::uint32_t>();
+        parameter.arraySize = reader.Get<std::uint32_t>();
+        parameter.columns = reader.Get<std::uint32_t>();
+        parameter.rows = reader.Get<std::uint32_t>();
+        parameter.isArray = reader.Get<bool>();
+        parameter.isMatrix = reader.Get<bool>();
+        parameter.isStruct = reader.Get<bool>();
+        parameter.structTypeName = reader.GetString();
+        reader.GetList(parameter.defaultValue, 1, [&] { return reader.Get<std::uint8_t>(); });
+        parameter.hasDefaultValue = reader.Get<bool>();
+        return parameter;
+    }
+
+    void PutResource(BlobWriter& writer, const ShaderResource& resource) {
+        writer.PutString(resource.name);
+        writer.Put(resource.resourceType);
+        writer.Put(resource.bindPoint);
+        writer.Put(resource.bindCount);
+        writer.Put(resource.space);
+        writer.Put(resource.visibleStages);
+        writer.Put(resource.size);
+        writer.PutList(resource.parameters, [&](const ShaderParameter& parameter) { PutParameter(writer, parameter); });
+    }
+
+    ShaderResource GetResource(BlobReader& reader) {
+        ShaderResource resource;
+        resource.name = reader.GetString();
+        resource.resourceType = reader.Get<decltype(resource.resourceType)>();
+        resource.bindPoint = reader.Get<std::uint32_t>();
+        resource.bindCount = reader.Get<std::uint32_t>();
+        resource.space = reader.Get<std::uint32_t>();
+        resource.visibleStages = reader.Get<decltype(resource.visibleStages)>();
+        resource.size = reader.Get<std::uint32_t>();
+        reader.GetList(resource.parameters, sizeof(std::uint32_t), [&] { return GetParameter(reader); });
+        return resource;
+    }
+
+} // namespace
+
+namespace Akhanda::Shaders {
+
+    struct ShaderPack::PackFile {
+        std::shared_ptr<const MappedFile> mapping;
+        const IndexEntry* index = nullptr;
+        std::uint32_t count = 0;
+
+        const IndexEntry* Find(const ShaderKey& key) const noexcept {
+            const IndexEntry* end = index + count;
+            const IndexEntry* entry = std::lower_bound(index, end, key,
+                [](const IndexEntry& candidate, const ShaderKey& wanted) { return candidate.key < wanted; });
+            return entry != end && entry->key == key ? entry : nullptr;
+        }
+
+        std::span<const std::uint8_t> Bytes(std::uint64_t offset, std::uint32_t size) const noexcept {
+            return { reinterpret_cast<const std::uint8_t*>(mapping->Data()) + offset, size };
+        }
+    };
+
+    struct ShaderPack::PendingEntry {
+        std::vector<std::uint8_t> bytecode;
+        std::vector<std::uint8_t> reflection;
+        std::uint64_t sourceHash = 0;
+    };
+
+    // ============================================================================
+    // ShaderPackEntry Implementation
+    // ============================================================================
+
+    std::unique_ptr<ShaderReflectionData> ShaderPackEntry::ReadReflection() const {
+        return reflection_.empty() ? nullptr : ShaderPack::DeserializeReflection(reflection_);
+    }
+
+    // ============================================================================
+    // ShaderPack Implementation
+    // ============================================================================
+
+    ShaderPack::ShaderPack(Options options) : options_(std::move(options)) {
+        std::error_code error;
+        std::filesystem::remove(std::filesystem::path(options_.path) += ".tmp", error);
+        OpenPack();
+        ReplayJournal();
+    }
+
+    ShaderPack::~ShaderPack() = default;
+
+    std::filesystem::path ShaderPack::GetJournalPath() const {
+        return std::filesystem::path(options_.path) += ".log";
+    }
+
+    void ShaderPack::OpenPack() {
+        pack_.reset();
+        auto mapping = MappedFile::Open(options_.path);
+        if (!mapping || mapping->Size() < sizeof(PackHeader)) {
+            return;
+        }
+
+        const auto* base = reinterpret_cast<const std::uint8_t*>(mapping->Data());
+        PackHeader header;
+        std::memcpy(&header, base, sizeof(header));
+        if (header.magic != PACK_MAGIC || header.version != PACK_VERSION ||
+            header.compilerRevision != options_.compilerRevision || header.engineRevision != options_.engineRevision ||
+            header.fileSize != mapping->Size()) {
+            return;
+        }
+
+        const std::uint64_t indexEnd = sizeof(PackHeader) + std::uint64_t{ header.entryCount } * sizeof(IndexEntry);
+        if (indexEnd > mapping->Size() ||
+            Checksum(base + sizeof(PackHeader), static_cast<size_t>(indexEnd - sizeof(PackHeader))) != header.indexChecksum) {
+            return;
+        }
+
+        // Every blob lies after the index and inside the file, and keys
+        // strictly increase, so lookups need no further checks
+        const auto* index = reinterpret_cast<const IndexEntry*>(base + sizeof(PackHeader));
+        for (std::uint32_t i = 0; i < header.entryCount; ++i) {
+            const IndexEntry& entry = index[i];
+            const bool inside =
+                entry.bytecodeOffset >= indexEnd && entry.bytecodeOffset <= mapping->Size() &&
+                entry.bytecodeSize <= mapping->Size() - entry.bytecodeOffset &&
+                entry.reflectionOffset >= indexEnd && entry.reflectionOffset <= mapping->Size() &&
+                entry.reflectionSize <= mapping->Size() - entry.reflectionOffset;
+            if (!inside || (i > 0 && !(index[i - 1].key < entry.key))) {
+                return;
+            }
+        }
+
+        auto pack = std::make_shared<PackFile>();
+        pack->mapping = std::move(mapping);
+        pack->index = index;
+        pack->count = header.entryCount;
+        pack_ = std::move(pack);
+    }
+
+    void ShaderPack::ReplayJournal() {
+        const std::filesystem::path journalPath = GetJournalPath();
+        std::ifstream file(journalPath, std::ios::binary);
+        if (!file.is_open()) {
+            return;
+        }
+        const std::vector<std::uint8_t> journal((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        file.close();
+
+        JournalHeader header{};
+        if (journal.size() >= sizeof(header)) {
+            std::memcpy(&header, journal.data(), sizeof(header));
+        }
+        std::error_code error;
+        if (journal.size() < sizeof(header) || header.magic != JOURNAL_MAGIC || header.version != PACK_VERSION ||
+            header.compilerRevision != options_.compilerRevision || header.engineRevision != options_.engineRevision) {
+            // Written for another revision, so nothing in it can be used
+            std::filesystem::remove(journalPath, error);
+            return;
+        }
+
+        size_t position = sizeof(header);
+        while (journal.size() - position >= sizeof(RecordHeader)) {
+            RecordHeader record;
+            std::memcpy(&record, journal.data() + position, sizeof(record));
+            const size_t payload = size_t{ record.bytecodeSize } + record.reflectionSize;
+            if (payload > journal.size() - position - sizeof(record)) {
+                break;
+            }
+
+            // A record counts only with its padding, so the next one appended starts aligned
+            const std::uint64_t end = Align(position + sizeof(record) + payload, 8);
+            if (end > journal.size()) {
+                break;
+            }
+
+            const std::uint8_t* bytes = journal.data() + position + sizeof(record);
+            const std::span<const std::uint8_t> bytecode(bytes, record.bytecodeSize);
+            const std::span<const std::uint8_t> reflection(bytes + record.bytecodeSize, record.reflectionSize);
+            if (RecordChecksum(record, bytecode, reflection) != record.checksum) {
+                break;
+            }
+
+            auto entry = std::make_shared<PendingEntry>();
+            entry->bytecode.assign(bytecode.begin(), bytecode.end());
+            entry->reflection.assign(reflection.begin(), reflection.end());
+            entry->sourceHash = record.sourceHash;
+            pending_[record.key] = std::move(entry);
+
+            position = static_cast<size_t>(end);
+        }
+
+        // Cut off a record torn by a crash, so new records follow whole ones
+        if (position != journal.size()) {
+            std::filesystem::resize_file(journalPath, position, error);
+        }
+        journalStarted_ = !error;
+    }
+
+    ShaderPackEntry ShaderPack::FindPacked(const ShaderKey& key) const {
+        ShaderPackEntry result;
+        if (!pack_) {
+            return result;
+        }
+        if (const IndexEntry* entry = pack_->Find(key)) {
+            result.owner_ = pack_;
+            result.bytecode_ = pack_->Bytes(entry->bytecodeOffset, entry->bytecodeSize);
+            result.reflection_ = pack_->Bytes(entry->reflectionOffset, entry->reflectionSize);
+            result.sourceHash_ = entry->sourceHash;
+        }
+        return result;
+    }
+
+    ShaderPackEntry ShaderPack::Find(const ShaderKey& key) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        if (!pending_.empty()) {
+            const auto it = pending_.find(key);
+            if (it != pending_.end()) {
+                ShaderPackEntry result;
+                result.owner_ = it->second;
+                result.bytecode_ = it->second->bytecode;
+                result.reflection_ = it->second->reflection;
+                result.sourceHash_ = it->second->sourceHash;
+                return result;
+            }
+        }
+        return FindPacked(key);
+    }
+
+    bool ShaderPack::Add(const ShaderKey& key, std::uint64_t sourceHash, std::span<const std::uint8_t> bytecode,
+        const ShaderReflectionData* reflection) {
+        auto entry = std::make_shared<PendingEntry>();
+        entry->bytecode.assign(bytecode.begin(), bytecode.end());
+        if (reflection) {
+            entry->reflection = SerializeReflection(*reflection);
+        }
+        entry->sourceHash = sourceHash;
+
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        const bool written = AppendToJournal(key, *entry);
+        pending_[key] = std::move(entry);
+
+        if (written && options_.compactAfter != 0 && pending_.size() >= std::max<size_t>(options_.compactAfter, compactRetryAt_)) {
+            if (!CompactLocked()) {
+                compactRetryAt_ = pending_.size() + options_.compactAfter;
+            }
+        }
+        return written;
+    }
+
+    bool ShaderPack::AppendToJournal(const ShaderKey& key, const PendingEntry& entry) {
+        const std::filesystem::path journalPath = GetJournalPath();
+        std::error_code error;
+        if (options_.path.has_parent_path()) {
+            std::filesystem::create_directories(options_.path.parent_path(), error);
+        }
+
+        std::ofstream file(journalPath, std::ios::binary | (journalStarted_ ? std::ios::app : std::ios::trunc));
+        if (!file.is_open()) {
+            return false;
+        }
+        if (!journalStarted_) {
+            JournalHeader header{};
+            header.magic = JOURNAL_MAGIC;
+            header.version = PACK_VERSION;
+            header.compilerRevision = options_.compilerRevision;
+            header.engineRevision = options_.engineRevision;
+            if (!WriteBytes(file, &header, sizeof(header))) {
+                return false;
+            }
+            journalStarted_ = true;
+        }
+
+        RecordHeader record{};
+        record.key = key;
+        record.sourceHash = entry.sourceHash;
+        record.bytecodeSize = static_cast<std::uint32_t>(entry.bytecode.size());
+        record.reflectionSize = static_cast<std::uint32_t>(entry.reflection.size());
+        record.checksum = RecordChecksum(record, entry.bytecode, entry.reflection);
+
+        const std::uint64_t size = sizeof(record) + entry.bytecode.size() + entry.reflection.size();
+        const bool written = WriteBytes(file, &record, sizeof(record)) &&
+            WriteBytes(file, entry.bytecode.data(), entry.bytecode.size()) &&
+            WriteBytes(file, entry.reflection.data(), entry.reflection.size()) &&
+            WritePadding(file, Align(size, 8) - size);
+        file.flush();
+        return written && file.good();
+    }
+
+    bool ShaderPack::Compact() {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        return CompactLocked();
+    }
+
+    bool ShaderPack::CompactLocked() {
+        struct Source {
+            ShaderKey key;
+            std::uint64_t sourceHash;
+            std::span<const std::uint8_t> bytecode;
+            std::span<const std::uint8_t> reflection;
+        };
+
+        std::vector<Source> sources;
+        sources.reserve((pack_ ? pack_->count : 0) + pending_.size());
+        if (pack_) {
+            for (std::uint32_t i = 0; i < pack_->count; ++i) {
+                const IndexEntry& entry = pack_->index[i];
+                if (!pending_.contains(entry.key)) {
+                    sources.push_back({ entry.key, entry.sourceHash,
+                        pack_->Bytes(entry.bytecodeOffset, entry.bytecodeSize),
+                        pack_->Bytes(entry.reflectionOffset, entry.reflectionSize) });
+                }
+            }
+        }
+        for (const auto& [key, entry] : pending_) {
+            sources.push_back({ key, entry->sourceHash, entry->bytecode, entry->reflection });
+        }
+        std::sort(sources.begin(), sources.end(), [](const Source& a, const Source& b) { return a.key < b.key; });
+
+        // Lay out the blobs before writing, so the header and index go first
+        std::vector<IndexEntry> index(sources.size());
+        std::uint64_t offset = Align(sizeof(PackHeader) + sources.size() * sizeof(IndexEntry), BLOB_ALIGNMENT);
+        for (size_t i = 0; i < sources.size(); ++i) {
+            index[i].key = sources[i].key;
+            index[i].sourceHash = sources[i].sourceHash;
+            index[i].bytecodeSize = static_cast<std::uint32_t>(sources[i].bytecode.size());
+            index[i].reflectionSize = static_cast<std::uint32_t>(sources[i].reflection.size());
+            index[i].bytecodeOffset = offset;
+            offset = Align(offset + index[i].bytecodeSize, BLOB_ALIGNMENT);
+            index[i].reflectionOffset = offset;
+            offset = Align(offset + index[i].reflectionSize, BLOB_ALIGNMENT);
+        }
+
+        PackHeader header{};
+        header.magic = PACK_MAGIC;
+        header.version = PACK_VERSION;
+        header.entryCount = static_cast<std::uint32_t>(index.size());
+        header.compilerRevision = options_.compilerRevision;
+        header.engineRevision = options_.engineRevision;
+        header.fileSize = offset;
+        header.indexChecksum = Checksum(index.data(), index.size() * sizeof(IndexEntry));
+
+        std::error_code error;
+        if (options_.path.has_parent_path()) {
+            std::filesystem::create_directories(options_.path.parent_path(), error);
+        }
+        const std::filesystem::path temporaryPath = std::filesystem::path(options_.path) += ".tmp";
+        {
+            std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+            bool written = file.is_open() &&
+                WriteBytes(file, &header, sizeof(header)) &&
+                WriteBytes(file, index.data(), index.size() * sizeof(IndexEntry));
+            std::uint64_t position = sizeof(PackHeader) + index.size() * sizeof(IndexEntry);
+            for (size_t i = 0; i < sources.size() && written; ++i) {
+                written = WritePadding(file, index[i].bytecodeOffset - position) &&
+                    WriteBytes(file, sources[i].bytecode.data(), sources[i].bytecode.size()) &&
+                    WritePadding(file, index[i].reflectionOffset - (index[i].bytecodeOffset + index[i].bytecodeSize)) &&
+                    WriteBytes(file, sources[i].reflection.data(), sources[i].reflection.size());
+                position = index[i].reflectionOffset + index[i].reflectionSize;
+            }
+            written = written && WritePadding(file, offset - position);
+            file.close();
+            if (!written || file.fail()) {
+                std::filesystem::remove(temporaryPath, error);
+                return false;
+            }
+        }
+
+        // The old mapping has to go first where a mapped file cannot be replaced
+        sources.clear();
+        pack_.reset();
+        std::filesystem::rename(temporaryPath, options_.path, error);
+        if (error) {
+            std::filesystem::remove(temporaryPath, error);
+            OpenPack();
+            return false;
+        }
+
+        pending_.clear();
+        std::filesystem::remove(GetJournalPath(), error);
+        journalStarted_ = false;
+        compactRetryAt_ = 0;
+        OpenPack();
+        return true;
+    }
+
+    void ShaderPack::Clear() {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        pack_.reset();
+        pending_.clear();
+        journalStarted_ = false;
+        compactRetryAt_ = 0;
+
+        std::error_code error;
+        std::filesystem::remove(options_.path, error);
+        std::filesystem::remove(GetJournalPath(), error);
+    }
+
+    size_t ShaderPack::GetEntryCount() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        size_t count = pack_ ? pack_->count : 0;
+        for (const auto& [key, entry] : pending_) {
+            if (!pack_ || !pack_->Find(key)) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    size_t ShaderPack::GetJournalEntryCount() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return pending_.size();
+    }
+
+    std::uint64_t ShaderPack::GetBytecodeSize() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        std::uint64_t size = 0;
+        if (pack_) {
+            for (std::uint32_t i = 0; i < pack_->count; ++i) {
+                if (!pending_.contains(pack_->index[i].key)) {
+                    size += pack_->index[i].bytecodeSize;
+                }
+            }
+        }
+        for (const auto& [key, entry] : pending_) {
+            size += entry->bytecode.size();
+        }
+        return size;
+    }
+
+    bool ShaderPack::IsMapped() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return pack_ != nullptr;
+    }
+
+    // FNV-1a over the files one after another, so a shader without includes
+    // hashes as its source file alone. A flag byte before each include keeps
+    // a missing include apart from an empty one.
+    std::uint64_t HashShaderSources(const std::filesystem::path& sourcePath, std::span<const std::string> includedFiles) {
+        std::string content;
+        if (!ReadWholeFile(sourcePath, content)) {
+            return 0;
+        }
+
+        std::uint64_t hash = Checksum(content.data(), content.size());
+        for (const std::string& includedFile : includedFiles) {
+            const std::uint8_t found = ReadWholeFile(includedFile, content) ? 1 : 0;
+            hash = Checksum(&found, sizeof(found), hash);
+            hash = Checksum(content.data(), content.size(), hash);
+        }
+        return hash;
+    }
+
+    // ============================================================================
+    // Reflection Serialization
+    // ============================================================================
+
+    // The compilation time is a steady clock reading, which means nothing in
+    // another process, so it is not stored and reads back as the load time
+    std::vector<std::uint8_t> ShaderPack::SerializeReflection(const ShaderReflectionData& reflection) {
+        std::vector<std::uint8_t> data;
+        BlobWriter writer(data);
+        const auto putResources = [&](const std::vector<ShaderResource>& resources) {
+            writer.PutList(resources, [&](const ShaderResource& resource) { PutResource(writer, resource); });
+        };
+        const auto putParameters = [&](const std::vector<ShaderParameter>& parameters) {
+            writer.PutList(parameters, [&](const ShaderParameter& parameter) { PutParameter(writer, parameter); });
+        };
+
+        writer.PutString(reflection.shaderName);
+        writer.Put(reflection.stage);
+        writer.PutString(reflection.entryPoint);
+        writer.PutString(reflection.shaderModel);
+        writer.PutString(reflection.targetProfile);
+
+        putResources(reflection.constantBuffers);
+        putResources(reflection.shaderResources);
+        putResources(reflection.unorderedAccessViews);
+        putResources(reflection.samplers);
+        putResources(reflection.rootConstants);
+        putParameters(reflection.inputSignature);
+        putParameters(reflection.outputSignature);
+
+        writer.Put(reflection.threadGroupSizeX);
+        writer.Put(reflection.threadGroupSizeY);
+        writer.Put(reflection.threadGroupSizeZ);
+        writer.Put(reflection.instructionCount);
+        writer.Put(reflection.tempRegisterCount);
+        writer.Put(reflection.constantBufferCount);
+        writer.Put(reflection.textureCount);
+        writer.Put(reflection.samplerCount);
+        writer.Put(reflection.rootSignatureHash);
+
+        writer.Put(reflection.sourceCodeHash);
+        writer.PutStrings(reflection.includedFiles);
+        writer.PutList(reflection.dependencies, [&](const ShaderReflectionData::IncludeDependency& dependency) {
+            writer.PutPath(dependency.filePath);
+            writer.Put(dependency.fileHash);
+            writer.Put(static_cast<std::int64_t>(dependency.modificationTime.time_since_epoch().count()));
+            writer.Put(dependency.isSystemInclude);
+        });
+
+        writer.PutStrings(reflection.detectedFeatures);
+        writer.PutStrings(reflection.requiredExtensions);
+        writer.PutStrings(reflection.conditionalDefines);
+        writer.PutStrings(reflection.availableEntryPoints);
+        writer.Put(reflection.usesStandardRegisterLayout);
+        writer.PutStrings(reflection.registerLayoutWarnings);
+        writer.PutList(reflection.performanceHints, [&](const ShaderReflectionData::PerformanceHint& hint) {
+            writer.PutString(hint.message);
+            writer.Put(hint.severity);
+            writer.Put(hint.line);
+            writer.Put(hint.column);
+        });
+
+        writer.Put(reflection.estimatedGPUCost);
+        writer.Put(reflection.estimatedMemoryUsage);
+        writer.Put(reflection.isDynamicallyUniform);
+        writer.PutString(reflection.compilerVersion);
+        writer.PutStrings(reflection.compilerFlags);
+        writer.Put(static_cast<std::int64_t>(reflection.compilationDuration.count()));
+        return data;
+    }
+
+    std::unique_ptr<ShaderReflectionData> ShaderPack::DeserializeReflection(std::span<const std::uint8_t> data) {
+        BlobReader reader(data);
+        auto reflection = std::make_unique<ShaderReflectionData>();
+        const auto getResources = [&](std::vector<ShaderResource>& resources) {
+            reader.GetList(resources, sizeof(std::uint32_t), [&] { return GetResource(reader); });
+        };
+        const auto getParameters = [&](std::vector<ShaderParameter>& parameters) {
+            reader.GetList(parameters, sizeof(std::uint32_t), [&] { return GetParameter(reader); });
+        };
+
+        reflection->shaderName = reader.GetString();
+        reflection->stage = reader.Get<ShaderStage>();
+        reflection->entryPoint = reader.GetString();
+        reflection->shaderModel = reader.GetString();
+        reflection->targetProfile = reader.GetString();
+
+        getResources(reflection->constantBuffers);
+        getResources(reflection->shaderResources);
+        getResources(reflection->unorderedAccessViews);
+        getResources(reflection->samplers);
+        getResources(reflection->rootConstants);
+        getParameters(reflection->inputSignature);
+        getParameters(reflection->outputSignature);
+
+        reflection->threadGroupSizeX = reader.Get<std::uint32_t>();
+        reflection->threadGroupSizeY = reader.Get<std::uint32_t>();
+        reflection->threadGroupSizeZ = reader.Get<std::uint32_t>();
+        reflection->instructionCount = reader.Get<std::uint32_t>();
+        reflection->tempRegisterCount = reader.Get<std::uint32_t>();
+        reflection->constantBufferCount = reader.Get<std::uint32_t>();
+        reflection->textureCount = reader.Get<std::uint32_t>();
+        reflection->samplerCount = reader.Get<std::uint32_t>();
+        reflection->rootSignatureHash = reader.Get<std::uint64_t>();
+
+        reflection->compilationTime = std::chrono::steady_clock::now();
+        reflection->sourceCodeHash = reader.Get<std::uint64_t>();
+        reader.GetStrings(reflection->includedFiles);
+        reader.GetList(reflection->dependencies, sizeof(std::uint32_t), [&] {
+            ShaderReflectionData::IncludeDependency dependency;
+            dependency.filePath = reader.GetPath();
+            dependency.fileHash = reader.Get<std::uint64_t>();
+            dependency.modificationTime = std::filesystem::file_time_type(
+                std::filesystem::file_time_type::duration(reader.Get<std::int64_t>()));
+            dependency.isSystemInclude = reader.Get<bool>();
+            return dependency;
+        });
+
+        reader.GetStrings(reflection->detectedFeatures);
+        reader.GetStrings(reflection->requiredExtensions);
+        reader.GetStrings(reflection->conditionalDefines);
+        reader.GetStrings(reflection->availableEntryPoints);
+        reflection->usesStandardRegisterLayout = reader.Get<bool>();
+        reader.GetStrings(reflection->registerLayoutWarnings);
+        reader.GetList(reflection->performanceHints, sizeof(std::uint32_t), [&] {
+            ShaderReflectionData::PerformanceHint hint;
+            hint.message = reader.GetString();
+            hint.severity = reader.Get<decltype(hint.severity)>();
+            hint.line = reader.Get<std::uint32_t>();
+            hint.column = reader.Get<std::uint32_t>();
+            return hint;
+        });
+
+        reflection->estimatedGPUCost = reader.Get<float>();
+        reflection->estimatedMemoryUsage = reader.Get<std::uint32_t>();
+        reflection->isDynamicallyUniform = reader.Get<bool>();
+        reflection->compilerVersion = reader.GetString();
+        reader.GetStrings(reflection->compilerFlags);
+        reflection->compilationDuration = std::chrono::milliseconds(reader.Get<std::int64_t>());
+
+        if (!reader.IsValid() || !reader.IsAtEnd()) {
+            return nullptr;
+        }
+        return reflection;
+    }
+
+} // namespace Akhanda::Shaders
@@ -0,0 +1,127 @@
+// Engine/Renderer/Shaders/ShaderPack.ixx
+// Akhanda Game Engine - Persistent Shader Pack Cache
+// Copyright (c) 2025 Aditya Vennelakanti. All rights reserved.
+
+module;
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+export module Akhanda.Engine.Shaders.Pack;
+
+import Akhanda.Engine.Shaders;
+export import Akhanda.Engine.Shaders.Key;
+
+export namespace Akhanda::Shaders {
+
+    // ============================================================================
+    // Shader Pack Entry
+    // ============================================================================
+
+    // One cached shader. The spans point into the mapped pack, or into the
+    // entry's own copy for shaders added since the pack was last written,
+    // and stay valid while the entry is held.
+    class ShaderPackEntry {
+    public:
+        ShaderPackEntry() = default;
+
+        std::span<const std::uint8_t> GetBytecode() const noexcept { return bytecode_; }
+        std::span<const std::uint8_t> GetReflectionData() const noexcept { return reflection_; }
+        std::uint64_t GetSourceHash() const noexcept { return sourceHash_; }
+
+        // Null when the entry has no reflection or it cannot be read
+        std::unique_ptr<ShaderReflectionData> ReadReflection() const;
+
+        explicit operator bool() const noexcept { return owner_ != nullptr; }
+
+    private:
+        friend class ShaderPack;
+
+        std::shared_ptr<const void> owner_;
+        std::span<const std::uint8_t> bytecode_;
+        std::span<const std::uint8_t> reflection_;
+        std::uint64_t sourceHash_ = 0;
+    };
+
+    // ============================================================================
+    // Shader Pack
+    // ============================================================================
+
+    // Compiled shaders kept across runs in two files: the pack, sorted by key
+    // and mapped read-only, and a journal beside it that each newly compiled
+    // shader is appended to. Once the journal holds enough entries, both are
+    // merged into a new pack written to a temporary file and renamed over the
+    // old one, so a crash at any point leaves a readable cache. Files written
+    // for another compiler or engine revision are ignored and replaced.
+    class ShaderPack {
+    public:
+        struct Options {
+            std::filesystem::path path;             // The journal is this path with ".log" appended
+            std::uint64_t compilerRevision = 0;     // Identifies the compiler and its settings
+            std::uint64_t engineRevision = 0;       // Bumped when engine-side shader inputs change
+            std::uint32_t compactAfter = 64;        // Journal entries that trigger compaction; 0 never does
+        };
+
+        explicit ShaderPack(Options options);
+        ~ShaderPack();
+
+        ShaderPack(const ShaderPack&) = delete;
+        ShaderPack& operator=(const ShaderPack&) = delete;
+
+        // An empty entry when the key is not cached
+        ShaderPackEntry Find(const ShaderKey& key) const;
+
+        // Replaces any entry with the same key. Returns false when the
+        // journal could not be written; the shader is still cached for this run.
+        bool Add(const ShaderKey& key, std::uint64_t sourceHash, std::span<const std::uint8_t> bytecode,
+            const ShaderReflectionData* reflection = nullptr);
+
+        // Writes every entry into a new pack and empties the journal. Returns
+        // false and keeps both files when the new pack cannot replace the old,
+        // as on Windows while an entry from the old mapping is still held.
+        bool Compact();
+
+        // Forgets every entry and deletes both files
+        void Clear();
+
+        size_t GetEntryCount() const;
+        size_t GetJournalEntryCount() const;
+        std::uint64_t GetBytecodeSize() const;
+        bool IsMapped() const;
+
+        const std::filesystem::path& GetPath() const noexcept { return options_.path; }
+        std::filesystem::path GetJournalPath() const;
+
+        static std::vector<std::uint8_t> SerializeReflection(const ShaderReflectionData& reflection);
+        static std::unique_ptr<ShaderReflectionData> DeserializeReflection(std::span<const std::uint8_t> data);
+
+    private:
+        struct PackFile;
+        struct PendingEntry;
+
+        void OpenPack();
+        void ReplayJournal();
+        bool AppendToJournal(const ShaderKey& key, const PendingEntry& entry);
+        ShaderPackEntry FindPacked(const ShaderKey& key) const;
+        bool CompactLocked();
+
+        Options options_;
+        mutable std::shared_mutex mutex_;
+        std::shared_ptr<const PackFile> pack_;
+        std::unordered_map<ShaderKey, std::shared_ptr<const PendingEntry>, ShaderKeyHash> pending_;
+        bool journalStarted_ = false;
+        size_t compactRetryAt_ = 0;     // After a failed compaction, Add waits for compactAfter more entries
+    };
+
+    // Hash of a shader's source file and then each file it included, in
+    // order; 0 when the source cannot be read. Stored as an entry's source
+    // hash, so editing an include invalidates the entry too.
+    std::uint64_t HashShaderSources(const std::filesystem::path& sourcePath, std::span<const std::string> includedFiles);
+
+} // namespace Akhanda::Shaders
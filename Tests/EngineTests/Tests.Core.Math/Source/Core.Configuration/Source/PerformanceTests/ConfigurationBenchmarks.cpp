@@ -0,0 +1,409 @@
+// Tests/Core.Configuration/Source/PerformanceTests/ConfigurationBenchmarks.cpp
+// Benchmarks for configuration reads: parsing a large config into a mutable
+// JsonValue against the flat JsonDocument, nested lookups through each,
+// loading a section from a view, startup from the JSON file against its
+// binary snapshot, reading a published section against locked and
+// reference-counted alternatives, and streaming a large data file against
+// parsing it whole. Results are printed and, with
+// --benchmark=record|compare, stored in or checked against
+// Data/BenchmarkData.json like the math benchmarks.
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+import Akhanda.Core.Configuration;
+import Akhanda.Core.Configuration.Rendering;
+import Akhanda.Core.Configuration.Publisher;
+#include "Core/Configuration/JsonWrapper.hpp"
+#include "Core/Configuration/JsonView.hpp"
+#include "Core/Configuration/JsonReader.hpp"
+#include "../../../Core.Math/Source/Utils/PerformanceTestUtils.hpp"
+#include "../../../Core.Logging/Source/Fixtures/LoggingTestFixtures.hpp"
+
+using namespace Akhanda::Tests::Math;
+using namespace Akhanda::Configuration;
+
+namespace {
+
+    constexpr int SECTIONS = 64;
+    constexpr int MEMBERS = 32;
+
+    // A rendering section plus SECTIONS sections of MEMBERS numbers, strings
+    // and small arrays each, about 64 KB of text
+    std::string MakeLargeConfig() {
+        std::string json = R"({"rendering":{"renderingAPI":"D3D12","resolution":{"width":2560,"height":1440},)"
+            R"("vsync":false,"msaaSamples":"4x","maxFPS":144,"shaders":{"shaderSourcePath":"Content/Shaders/",)"
+            R"("includePaths":["Shaders/Common/","Shaders/Lighting/"],"globalDefines":["USE_PBR=1"]}},"sections":{)";
+        for (int s = 0; s < SECTIONS; ++s) {
+            json += (s ? ",\"" : "\"") + std::string("section") + std::to_string(s) + "\":{";
+            for (int m = 0; m < MEMBERS; ++m) {
+                const std::string key = "\"value" + std::to_string(m) + "\":";
+                json += (m ? "," : "") + key;
+                switch (m % 4) {
+                case 0: json += std::to_string(m * 31 + s); break;
+                case 1: json += std::to_string(m * 0.25 + s); break;
+                case 2: json += "\"Assets/Section" + std::to_string(s) + "/Item" + std::to_string(m) + ".asset\""; break;
+                default: json += "[1,2,3,{\"enabled\":true,\"weight\":0.5}]"; break;
+                }
+            }
+            json += "}";
+        }
+        return json + "}}";
+    }
+
+    class ConfigurationBenchmarks : public ::testing::Test {
+    protected:
+        static void Report(const std::vector<BenchmarkResult>& results) {
+            for (const std::string& failure : ProcessBenchmarkResults(results)) {
+                ADD_FAILURE() << failure;
+            }
+        }
+    };
+
+    // ============================================================================
+    // Parsing
+    // ============================================================================
+
+    TEST_F(ConfigurationBenchmarks, Parse) {
+        const std::string text = MakeLargeConfig();
+
+        std::vector<BenchmarkResult> results;
+        results.push_back(RunBenchmark("Config/Parse/JsonValue", text.size(), [&] {
+            DoNotOptimize(JsonValue::Parse(text));
+        }));
+        results.push_back(RunBenchmark("Config/Parse/JsonDocument", text.size(), [&] {
+            DoNotOptimize(JsonDocument::Parse(text));
+        }));
+
+        const JsonDocument document = JsonDocument::Parse(text);
+        std::cout << "[PERF] Config text: " << text.size() << " bytes, document: "
+            << document.GetMemoryUsage() << " bytes" << std::endl;
+        EXPECT_EQ(document.Root()["sections"].Size(), static_cast<size_t>(SECTIONS));
+
+        Report(results);
+    }
+
+    // ============================================================================
+    // Reads
+    // ============================================================================
+
+    TEST_F(ConfigurationBenchmarks, Lookup) {
+        const std::string text = MakeLargeConfig();
+        const JsonValue value = JsonValue::Parse(text);
+        const JsonDocument document = JsonDocument::Parse(text);
+        const JsonView root = document.Root();
+        uint32_t next = 0;
+
+        // Each JsonValue::operator[] copies the subtree it returns
+        std::vector<BenchmarkResult> results;
+        results.push_back(RunBenchmark("Config/Lookup/JsonValue", 1, [&] {
+            const std::string section = "section" + std::to_string(next++ % SECTIONS);
+            DoNotOptimize(value["sections"][section]["value8"].GetValue<int>());
+        }));
+        results.push_back(RunBenchmark("Config/Lookup/JsonView", 1, [&] {
+            const std::string section = "section" + std::to_string(next++ % SECTIONS);
+            DoNotOptimize(root["sections"][section]["value8"].GetValue<int>());
+        }));
+        results.push_back(RunBenchmark("Config/Lookup/JsonViewPath", 1, [&] {
+            DoNotOptimize(root.AtPath("rendering.shaders.includePaths.1").GetString());
+        }));
+
+        EXPECT_EQ(root.AtPath("sections.section3.value8").GetValue<int>(), 8 * 31 + 3);
+        Report(results);
+    }
+
+    TEST_F(ConfigurationBenchmarks, LoadSection) {
+        const JsonDocument document = JsonDocument::Parse(MakeLargeConfig());
+        const JsonView rendering = document.Root()["rendering"];
+        RenderingConfig config;
+
+        std::vector<BenchmarkResult> results;
+        results.push_back(RunBenchmark("Config/LoadSection/Rendering", 1, [&] {
+            DoNotOptimize(config.LoadFromJson(rendering));
+        }));
+
+        EXPECT_EQ(config.GetMaxFPS(), 144u);
+        Report(results);
+    }
+
+    // ============================================================================
+    // Startup
+    // ============================================================================
+
+    // Reading the main config and loading a section, as ConfigManager does on
+    // startup, from the JSON text or from a matching snapshot
+    TEST_F(ConfigurationBenchmarks, Startup) {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "AkhandaConfigBenchmarks";
+        std::filesystem::create_directories(directory);
+        const auto jsonPath = directory / "engine.json";
+        const auto snapshotPath = directory / "engine.snapshot";
+        const std::string text = MakeLargeConfig();
+        {
+            std::ofstream file(jsonPath, std::ios::binary | std::ios::trunc);
+            file << text;
+        }
+        std::filesystem::remove(snapshotPath);
+        RenderingConfig config;
+
+        std::vector<BenchmarkResult> results;
+        results.push_back(RunBenchmark("Config/Startup/JsonValue", text.size(), [&] {
+            DoNotOptimize(JsonValue::FromFile(jsonPath));
+        }));
+        results.push_back(RunBenchmark("Config/Startup/Json", text.size(), [&] {
+            const JsonDocument document = JsonDocument::FromFile(jsonPath);
+            DoNotOptimize(config.LoadFromJson(document.Root()["rendering"]));
+        }));
+        results.push_back(RunBenchmark("Config/Startup/Snapshot", text.size(), [&] {
+            const JsonDocument document = JsonDocument::FromFileWithSnapshot(jsonPath, snapshotPath);
+            DoNotOptimize(config.LoadFromJson(document.Root()["rendering"]));
+        }));
+
+        const JsonDocument mapped = JsonDocument::FromFileWithSnapshot(jsonPath, snapshotPath);
+        std::cout << "[PERF] Config text: " << text.size() << " bytes, snapshot: "
+            << std::filesystem::file_size(snapshotPath) << " bytes" << std::endl;
+        EXPECT_TRUE(mapped.IsMapped());
+        EXPECT_EQ(config.GetMaxFPS(), 144u);
+
+        std::filesystem::remove_all(directory);
+        Report(results);
+    }
+
+    // ============================================================================
+    // Concurrent Reads
+    // ============================================================================
+
+    // The cost of one read of a section that another thread may replace
+    TEST_F(ConfigurationBenchmarks, Read) {
+        RenderingConfig initial;
+        initial.SetMaxFPS(144);
+
+        ConfigPublisher<RenderingConfig> publisher(initial);
+        std::shared_mutex mutex;
+        const RenderingConfig locked = initial;
+        std::atomic<std::shared_ptr<const RenderingConfig>> shared(std::make_shared<const RenderingConfig>(initial));
+
+        std::vector<BenchmarkResult> results;
+        results.push_back(RunBenchmark("Config/Read/Unsynchronized", 1, [&] {
+            DoNotOptimize(locked.GetMaxFPS());
+        }));
+        results.push_back(RunBenchmark("Config/Read/Publisher", 1, [&] {
+            DoNotOptimize(publisher.Read()->GetMaxFPS());
+        }));
+        results.push_back(RunBenchmark("Config/Read/SharedMutex", 1, [&] {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            DoNotOptimize(locked.GetMaxFPS());
+        }));
+        results.push_back(RunBenchmark("Config/Read/AtomicSharedPtr", 1, [&] {
+            DoNotOptimize(shared.load()->GetMaxFPS());
+        }));
+
+        // With a writer publishing a new version every 100 us
+        std::atomic<bool> done{ false };
+        std::thread writer([&] {
+            while (!done.load(std::memory_order_relaxed)) {
+                publisher.Update([](RenderingConfig& config) { config.SetMaxFPS(144); });
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        });
+        results.push_back(RunBenchmark("Config/Read/PublisherDuringReload", 1, [&] {
+            DoNotOptimize(publisher.Read()->GetMaxFPS());
+        }));
+        done = true;
+        writer.join();
+
+        std::cout << "[PERF] Published versions: " << publisher.GetVersion() << ", reader slots: "
+            << EpochReclaimer::GetSlotCount() << std::endl;
+        EXPECT_EQ(publisher.Read()->GetMaxFPS(), 144u);
+        Report(results);
+    }
+
+    // ============================================================================
+    // Streaming
+    // ============================================================================
+
+    struct LevelEntry {
+        std::string name;
+        std::uint32_t id = 0;
+        float weight = 0.0f;
+        bool streamed = false;
+        std::vector<std::string> tags;
+    };
+
+    // A level manifest of about the given size, written in pieces so large
+    // files never sit in memory whole. Returns the number of levels.
+    size_t WriteLevelManifest(const std::filesystem::path& path, size_t bytes) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << "{\"version\":1,\"levels\":[\n";
+        size_t written = 0;
+        size_t levels = 0;
+        std::string entry;
+        while (written < bytes) {
+            entry = levels ? ",\n  " : "  ";
+            entry += "{\"name\":\"Levels/Region" + std::to_string(levels % 97) + "/Level" + std::to_string(levels) +
+                "\",\"id\":" + std::to_string(levels) + ",\"weight\":" + std::to_string((levels % 8) * 0.125) +
+                ",\"streamed\":" + (levels % 3 ? "true" : "false") +
+                ",\"tags\":[\"outdoor\",\"night\",\"boss\"],\"spawn\":{\"x\":12.5,\"y\":-3,\"z\":0.25}}";
+            file << entry;
+            written += entry.size();
+            ++levels;
+        }
+        file << "\n]}";
+        return levels;
+    }
+
+    // Counts events, the least a handler can do
+    class CountingHandler : public JsonHandler {
+    public:
+        size_t events = 0;
+
+        bool Null() override { return Count(); }
+        bool Bool(bool) override { return Count(); }
+        bool Int(std::int64_t) override { return Count(); }
+        bool UInt(std::uint64_t) override { return Count(); }
+        bool Float(double) override { return Count(); }
+        bool String(std::string_view) override { return Count(); }
+        bool Key(std::string_view) override { return Count(); }
+        bool StartObject() override { return Count(); }
+        bool EndObject() override { return Count(); }
+        bool StartArray() override { return Count(); }
+        bool EndArray() override { return Count(); }
+
+    private:
+        bool Count() {
+            ++events;
+            return true;
+        }
+    };
+
+    class StreamBenchmarks {
+    public:
+        explicit StreamBenchmarks(const std::filesystem::path& path) : path_(path) {
+            binding_.Field("name", &LevelEntry::name)
+                .Field("id", &LevelEntry::id)
+                .Field("weight", &LevelEntry::weight)
+                .Field("streamed", &LevelEntry::streamed)
+                .Field("tags", &LevelEntry::tags);
+        }
+
+        void JsonValueParse() { DoNotOptimize(JsonValue::FromFile(path_)); }
+        void JsonDocumentParse() { DoNotOptimize(JsonDocument::FromFile(path_)); }
+
+        void Reader() {
+            CountingHandler handler;
+            JsonReader::ParseFile(path_, handler);
+            DoNotOptimize(handler.events);
+        }
+
+        void Mapped() {
+            CountingHandler handler;
+            JsonReader::ParseMappedFile(path_, handler);
+            DoNotOptimize(handler.events);
+        }
+
+        size_t Bind() {
+            std::uint64_t idSum = 0;
+            JsonElementReader<LevelEntry> reader(binding_, "levels", [&](LevelEntry&& level) {
+                idSum += level.id + level.tags.size();
+                return true;
+            });
+            JsonReader::ParseFile(path_, reader);
+            DoNotOptimize(idSum);
+            return reader.GetElementCount();
+        }
+
+    private:
+        std::filesystem::path path_;
+        JsonBinding<LevelEntry> binding_;
+    };
+
+    // Peak heap use of fn, counted by the test binary's operator new. Parsing
+    // runs on the calling thread, which is the one counted.
+    template<typename Fn>
+    size_t MeasurePeakBytes(Fn&& fn) {
+        Akhanda::Tests::Logging::BeginCountingAllocations();
+        fn();
+        Akhanda::Tests::Logging::EndCountingAllocations();
+        return Akhanda::Tests::Logging::GetPeakAllocatedBytes();
+    }
+
+    void PrintPeakMemory(const std::string& label, StreamBenchmarks& stream) {
+        const auto megabytes = [](size_t bytes) { return static_cast<double>(bytes) / (1024.0 * 1024.0); };
+        std::cout << "[PERF] " << label << " peak heap MB: JsonValue "
+            << megabytes(MeasurePeakBytes([&] { stream.JsonValueParse(); })) << ", JsonDocument "
+            << megabytes(MeasurePeakBytes([&] { stream.JsonDocumentParse(); })) << ", Reader "
+            << megabytes(MeasurePeakBytes([&] { stream.Reader(); })) << ", Mapped "
+            << megabytes(MeasurePeakBytes([&] { stream.Mapped(); })) << ", Bind "
+            << megabytes(MeasurePeakBytes([&] { stream.Bind(); })) << std::endl;
+    }
+
+    // Reading a whole level manifest from disk: into a JsonValue, into a
+    // JsonDocument, as events through the read buffer and through a mapping,
+    // and bound element by element to a struct. Elements are bytes of text.
+    TEST_F(ConfigurationBenchmarks, Stream) {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "AkhandaConfigBenchmarks";
+        std::filesystem::create_directories(directory);
+        const auto path = directory / "levels.json";
+
+        std::vector<BenchmarkResult> results;
+        for (const size_t megabytes : { size_t{ 1 }, size_t{ 8 } }) {
+            const size_t levels = WriteLevelManifest(path, megabytes << 20);
+            const size_t bytes = std::filesystem::file_size(path);
+            const std::string suffix = "/" + std::to_string(megabytes) + "MB";
+            StreamBenchmarks stream(path);
+
+            results.push_back(RunBenchmark("Config/Stream/JsonValue" + suffix, bytes, [&] { stream.JsonValueParse(); }));
+            results.push_back(RunBenchmark("Config/Stream/JsonDocument" + suffix, bytes, [&] { stream.JsonDocumentParse(); }));
+            results.push_back(RunBenchmark("Config/Stream/Reader" + suffix, bytes, [&] { stream.Reader(); }));
+            results.push_back(RunBenchmark("Config/Stream/Mapped" + suffix, bytes, [&] { stream.Mapped(); }));
+            results.push_back(RunBenchmark("Config/Stream/Bind" + suffix, bytes, [&] { stream.Bind(); }));
+
+            PrintPeakMemory(std::to_string(megabytes) + " MB manifest", stream);
+            EXPECT_EQ(stream.Bind(), levels);
+        }
+
+        std::filesystem::remove_all(directory);
+        Report(results);
+    }
+
+    // The same comparison on files up to 512 MB, timed once each. Needs a few
+    // GB of memory for the JsonValue parse of the largest file, so run it by
+    // name with --gtest_also_run_disabled_tests.
+    TEST_F(ConfigurationBenchmarks, DISABLED_StreamLargeFiles) {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "AkhandaConfigBenchmarks";
+        std::filesystem::create_directories(directory);
+        const auto path = directory / "levels.json";
+
+        for (const size_t megabytes : { size_t{ 64 }, size_t{ 128 }, size_t{ 256 }, size_t{ 512 } }) {
+            WriteLevelManifest(path, megabytes << 20);
+            const double bytes = static_cast<double>(std::filesystem::file_size(path));
+            StreamBenchmarks stream(path);
+
+            const auto throughput = [&](auto&& fn) {
+                const auto start = std::chrono::steady_clock::now();
+                fn();
+                const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+                return bytes / (1024.0 * 1024.0) / elapsed.count();
+            };
+            std::cout << "[PERF] " << megabytes << " MB manifest MB/s: JsonValue "
+                << throughput([&] { stream.JsonValueParse(); }) << ", JsonDocument "
+                << throughput([&] { stream.JsonDocumentParse(); }) << ", Reader "
+                << throughput([&] { stream.Reader(); }) << ", Mapped "
+                << throughput([&] { stream.Mapped(); }) << ", Bind "
+                << throughput([&] { stream.Bind(); }) << std::endl;
+            PrintPeakMemory(std::to_string(megabytes) + " MB manifest", stream);
+        }
+
+        std::filesystem::remove_all(directory);
+    }
+
+}
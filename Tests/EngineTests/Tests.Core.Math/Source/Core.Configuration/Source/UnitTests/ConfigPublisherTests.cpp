@@ -0,0 +1,273 @@
+// Tests/Core.Configuration/Source/UnitTests/ConfigPublisherTests.cpp
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+import Akhanda.Core.Configuration;
+import Akhanda.Core.Configuration.Rendering;
+import Akhanda.Core.Configuration.Manager;
+import Akhanda.Core.Configuration.Publisher;
+
+using namespace Akhanda::Configuration;
+
+namespace {
+
+    // Counts live copies, so tests can tell which versions were freed
+    struct Tracked {
+        static inline std::atomic<int> live{ 0 };
+
+        std::uint64_t sequence = 0;
+        std::uint64_t tripled = 0;
+        std::vector<std::uint64_t> values;
+
+        Tracked() { ++live; }
+        Tracked(const Tracked& other) : sequence(other.sequence), tripled(other.tripled), values(other.values) { ++live; }
+        Tracked(Tracked&& other) noexcept
+            : sequence(other.sequence), tripled(other.tripled), values(std::move(other.values)) { ++live; }
+        ~Tracked() { --live; }
+
+        void Advance() {
+            ++sequence;
+            tripled = sequence * 3;
+            values.assign(sequence % 32, sequence);
+        }
+
+        bool IsConsistent() const {
+            if (tripled != sequence * 3 || values.size() != sequence % 32) return false;
+            for (std::uint64_t value : values) {
+                if (value != sequence) return false;
+            }
+            return true;
+        }
+    };
+
+    // ============================================================================
+    // Publishing
+    // ============================================================================
+
+    TEST(ConfigPublisherTests, Read_SeesTheInitialVersion) {
+        ConfigPublisher<std::string> publisher("initial");
+        const auto snapshot = publisher.Read();
+        ASSERT_TRUE(snapshot);
+        EXPECT_EQ(*snapshot, "initial");
+        EXPECT_EQ(snapshot.GetVersion(), 1u);
+        EXPECT_EQ(publisher.GetVersion(), 1u);
+    }
+
+    TEST(ConfigPublisherTests, Publish_ReplacesTheVersionForLaterReads) {
+        ConfigPublisher<std::string> publisher("first");
+        const auto before = publisher.Read();
+
+        EXPECT_EQ(publisher.Publish("second"), 2u);
+        const auto after = publisher.Read();
+        EXPECT_EQ(*before, "first");
+        EXPECT_EQ(*after, "second");
+        EXPECT_EQ(after.GetVersion(), 2u);
+    }
+
+    TEST(ConfigPublisherTests, Update_EditsACopyOfTheCurrentVersion) {
+        ConfigPublisher<Tracked> publisher;
+        const auto before = publisher.Read();
+
+        publisher.Update([](Tracked& value) { value.Advance(); });
+        EXPECT_EQ(before->sequence, 0u);
+        EXPECT_EQ(publisher.Read()->sequence, 1u);
+        EXPECT_TRUE(publisher.Read()->IsConsistent());
+    }
+
+    // ============================================================================
+    // Reclamation
+    // ============================================================================
+
+    TEST(ConfigPublisherTests, HeldSnapshot_KeepsItsVersionAlive) {
+        const int liveBefore = Tracked::live;
+        {
+            ConfigPublisher<Tracked> publisher;
+            auto held = publisher.Read();
+            publisher.Update([](Tracked& value) { value.Advance(); });
+            publisher.Update([](Tracked& value) { value.Advance(); });
+
+            // Every version is still pending while the oldest is held
+            EXPECT_EQ(Tracked::live - liveBefore, 3);
+            EXPECT_EQ(held->sequence, 0u);
+
+            held.Reset();
+            EpochReclaimer::Reclaim();
+            EXPECT_EQ(Tracked::live - liveBefore, 1);
+        }
+        EXPECT_EQ(Tracked::live, liveBefore);
+    }
+
+    TEST(ConfigPublisherTests, NestedReads_KeepTheOuterVersionAlive) {
+        const int liveBefore = Tracked::live;
+        ConfigPublisher<Tracked> publisher;
+        auto outer = publisher.Read();
+        {
+            const auto inner = publisher.Read();
+            publisher.Update([](Tracked& value) { value.Advance(); });
+        }
+
+        // Leaving the inner read must not end the outer one
+        EpochReclaimer::Reclaim();
+        EXPECT_EQ(Tracked::live - liveBefore, 2);
+        EXPECT_TRUE(outer->IsConsistent());
+
+        outer.Reset();
+        EpochReclaimer::Reclaim();
+        EXPECT_EQ(Tracked::live - liveBefore, 1);
+    }
+
+    TEST(ConfigPublisherTests, ExitedThreads_ReturnTheirSlots) {
+        ConfigPublisher<int> publisher(7);
+        std::thread([&] { EXPECT_EQ(*publisher.Read(), 7); }).join();
+        const size_t slots = EpochReclaimer::GetSlotCount();
+
+        for (int i = 0; i < 4; ++i) {
+            std::thread([&] { EXPECT_EQ(*publisher.Read(), 7); }).join();
+        }
+        EXPECT_EQ(EpochReclaimer::GetSlotCount(), slots);
+    }
+
+    // ============================================================================
+    // Concurrency
+    // ============================================================================
+
+    TEST(ConfigPublisherTests, ConcurrentReload_ReadersSeeWholeVersions) {
+        constexpr int READERS = 4;
+        constexpr std::uint64_t VERSIONS = 2000;
+        const int liveBefore = Tracked::live;
+        {
+            ConfigPublisher<Tracked> publisher;
+            std::atomic<bool> done{ false };
+            std::atomic<int> failures{ 0 };
+            std::atomic<std::uint64_t> reads{ 0 };
+
+            std::vector<std::thread> readers;
+            for (int r = 0; r < READERS; ++r) {
+                readers.emplace_back([&] {
+                    std::uint64_t lastVersion = 0;
+                    while (!done.load(std::memory_order_acquire)) {
+                        const auto snapshot = publisher.Read();
+                        if (!snapshot->IsConsistent() || snapshot->sequence + 1 != snapshot.GetVersion() ||
+                            snapshot.GetVersion() < lastVersion) {
+                            ++failures;
+                        }
+                        lastVersion = snapshot.GetVersion();
+                        reads.fetch_add(1, std::memory_order_relaxed);
+                    }
+                });
+            }
+
+            for (std::uint64_t i = 0; i < VERSIONS; ++i) {
+                publisher.Update([](Tracked& value) { value.Advance(); });
+                if (i % 64 == 0) {
+                    std::this_thread::yield();
+                }
+            }
+            done = true;
+            for (std::thread& reader : readers) {
+                reader.join();
+            }
+
+            EXPECT_EQ(failures, 0);
+            EXPECT_GT(reads, 0u);
+            EXPECT_EQ(publisher.GetVersion(), VERSIONS + 1);
+
+            EpochReclaimer::Reclaim();
+            EXPECT_EQ(Tracked::live - liveBefore, 1);
+        }
+        EXPECT_EQ(Tracked::live, liveBefore);
+    }
+
+    // ============================================================================
+    // ConfigManager
+    // ============================================================================
+
+    TEST(ConfigPublisherTests, Manager_PublishesReloadedSections) {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "AkhandaConfigPublisher";
+        std::filesystem::create_directories(directory);
+        const auto writeConfig = [&](std::uint32_t fps) {
+            std::ofstream file(directory / "engine.json", std::ios::trunc);
+            file << R"({ "rendering": { "maxFPS": )" << fps << R"(, "resolution": { "width": )" << fps * 10
+                << R"(, "height": 720 } } })";
+        };
+        writeConfig(60);
+
+        ConfigManager::InitializationOptions options;
+        options.configDirectory = directory;
+        options.snapshotFile.clear();
+        ASSERT_TRUE(ConfigManager::Initialize(options));
+        ConfigManager::GetOrCreateSection<RenderingConfig>();
+        EXPECT_EQ(ConfigManager::Read<RenderingConfig>()->GetMaxFPS(), 60u);
+
+        // Every read pairs the frame rate with the width from the same file
+        std::atomic<bool> done{ false };
+        std::atomic<int> failures{ 0 };
+        std::thread reader([&] {
+            while (!done.load(std::memory_order_acquire)) {
+                const auto rendering = ConfigManager::Read<RenderingConfig>();
+                if (rendering->GetMaxFPS() * 10 != rendering->GetResolution().width) {
+                    ++failures;
+                }
+            }
+        });
+
+        for (std::uint32_t fps = 61; fps <= 80; ++fps) {
+            writeConfig(fps);
+            ASSERT_TRUE(ConfigManager::LoadAllSections());
+        }
+        done = true;
+        reader.join();
+        EXPECT_EQ(failures, 0);
+        EXPECT_EQ(ConfigManager::Read<RenderingConfig>()->GetMaxFPS(), 80u);
+
+        ConfigManager::Update<RenderingConfig>([](RenderingConfig& rendering) { rendering.SetMaxFPS(144); });
+        EXPECT_EQ(ConfigManager::Read<RenderingConfig>()->GetMaxFPS(), 144u);
+
+        ConfigManager::Shutdown();
+        std::filesystem::remove_all(directory);
+    }
+
+    TEST(ConfigPublisherTests, Manager_ConcurrentUpdatesAreNotLost) {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "AkhandaConfigPublisher";
+        std::filesystem::create_directories(directory);
+        {
+            std::ofstream file(directory / "engine.json", std::ios::trunc);
+            file << R"({ "rendering": { "maxFPS": 10 } })";
+        }
+
+        ConfigManager::InitializationOptions options;
+        options.configDirectory = directory;
+        options.snapshotFile.clear();
+        ASSERT_TRUE(ConfigManager::Initialize(options));
+        ConfigManager::GetOrCreateSection<RenderingConfig>();
+
+        constexpr int THREADS = 4;
+        constexpr int UPDATES = 500;
+        std::vector<std::thread> writers;
+        for (int t = 0; t < THREADS; ++t) {
+            writers.emplace_back([] {
+                for (int i = 0; i < UPDATES; ++i) {
+                    ConfigManager::Update<RenderingConfig>([](RenderingConfig& rendering) {
+                        rendering.SetMaxFPS(rendering.GetMaxFPS() + 1);
+                    });
+                }
+            });
+        }
+        for (auto& writer : writers) {
+            writer.join();
+        }
+
+        EXPECT_EQ(ConfigManager::Read<RenderingConfig>()->GetMaxFPS(), static_cast<std::uint32_t>(10 + THREADS * UPDATES));
+        EXPECT_EQ(ConfigManager::GetOrCreateSection<RenderingConfig>()->GetMaxFPS(), static_cast<std::uint32_t>(10 + THREADS * UPDATES));
+
+        ConfigManager::Shutdown();
+        std::filesystem::remove_all(directory);
+    }
+
+}
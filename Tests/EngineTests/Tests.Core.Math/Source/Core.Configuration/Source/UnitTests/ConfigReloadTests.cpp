@@ -0,0 +1,279 @@
+// Tests/Core.Configuration/Source/UnitTests/ConfigReloadTests.cpp
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+import Akhanda.Core.Configuration;
+import Akhanda.Core.Configuration.Manager;
+#include "Core/Configuration/JsonWrapper.hpp"
+#include "Core/Configuration/JsonView.hpp"
+
+using namespace Akhanda::Configuration;
+
+namespace {
+
+    // A section whose values and reloads tests can watch
+    template<const char* Name>
+    class RecordingSection : public IConfigSection {
+    public:
+        ConfigValue<std::uint32_t> rate{ 48000 };
+        ConfigValue<std::string> device{ "Default" };
+        ConfigValue<std::vector<std::string>> channels;
+        std::vector<ConfigChangeSet> reloads;
+        bool failLoads = false;     // Fails after the values are set, like a late validation error
+
+        const char* GetSectionName() const noexcept override { return Name; }
+
+        ConfigResult_t<bool> LoadFromJson(const JsonView& sectionJson) override {
+            rate.Set(GetConfigValue<std::uint32_t>(sectionJson, "rate", 48000));
+            device.Set(GetConfigValue<std::string>(sectionJson, "device", "Default"));
+            channels.Set(GetConfigValue<std::vector<std::string>>(sectionJson, "channels"));
+            if (failLoads) {
+                return ConfigError(ConfigResult::ValidationError, "Rejected by the test");
+            }
+            return true;
+        }
+
+        JsonValue SaveToJson() const override {
+            auto j = ConfigJson::CreateObject();
+            SetConfigValue(j, "rate", rate.Get());
+            SetConfigValue(j, "device", device.Get());
+            SetConfigValue(j, "channels", channels.Get());
+            return j;
+        }
+
+        ConfigResult_t<bool> Validate() const override { return true; }
+        std::vector<std::string> GetValidationErrors() const override { return {}; }
+        void ResetToDefaults() override {}
+
+        void OnReloaded(const ConfigChangeSet& changes) override { reloads.push_back(changes); }
+    };
+
+    constexpr char AUDIO[] = "audio";
+    constexpr char INPUT[] = "input";
+    using AudioConfig = RecordingSection<AUDIO>;
+    using InputConfig = RecordingSection<INPUT>;
+
+    std::vector<std::string> Diff(std::string_view before, std::string_view after) {
+        return DiffJson(JsonDocument::Parse(before).Root(), JsonDocument::Parse(after).Root());
+    }
+
+    // ============================================================================
+    // Diff
+    // ============================================================================
+
+    TEST(ConfigReloadTests, Diff_ListsTheInnermostChanges) {
+        const auto changes = Diff(
+            R"({ "a": { "x": 1, "y": [1, 2, 3], "gone": true }, "b": "same", "c": [1] })",
+            R"({ "a": { "x": 2, "y": [1, 5, 3], "new": null }, "b": "same", "c": [1, 2] })");
+        EXPECT_EQ(changes, (std::vector<std::string>{ "a.gone", "a.new", "a.x", "a.y.1", "c" }));
+    }
+
+    TEST(ConfigReloadTests, Diff_EqualDocumentsGiveNothing) {
+        EXPECT_TRUE(Diff(R"({ "a": 1, "b": { "c": [true] } })", R"({"b":{"c":[true]},"a":1.0})").empty());
+        EXPECT_EQ(Diff("1", "2"), (std::vector<std::string>{ "" }));
+        EXPECT_EQ(Diff(R"({ "a": 1 })", R"({ "a": "1" })"), (std::vector<std::string>{ "a" }));
+    }
+
+    TEST(ConfigReloadTests, Diff_MissingMemberIsNotNull) {
+        EXPECT_EQ(Diff(R"({ "a": null })", "{}"), (std::vector<std::string>{ "a" }));
+        EXPECT_EQ(Diff("{}", R"({ "a": null })"), (std::vector<std::string>{ "a" }));
+        EXPECT_EQ(Diff(R"({ "s": { "a": null, "b": 1 } })", R"({ "s": { "b": 1, "c": 1 } })"),
+            (std::vector<std::string>{ "s.a", "s.c" }));
+    }
+
+    TEST(ConfigReloadTests, ChangeSet_MatchesPathsAndTheirParents) {
+        const ConfigChangeSet changes({ "audio.device", "rendering" });
+        EXPECT_TRUE(changes.Affects("audio"));
+        EXPECT_TRUE(changes.Affects("audio.device"));
+        EXPECT_FALSE(changes.Affects("audio.dev"));
+        EXPECT_FALSE(changes.Affects("audio.rate"));
+        EXPECT_TRUE(changes.Affects("rendering.vsync"));
+        EXPECT_FALSE(changes.Affects("input"));
+
+        EXPECT_EQ(changes.Under("audio").GetPaths(), (std::vector<std::string>{ "device" }));
+        EXPECT_EQ(changes.Under("rendering").GetPaths(), (std::vector<std::string>{ "" }));
+        EXPECT_TRUE(changes.Under("input").IsEmpty());
+    }
+
+    // ============================================================================
+    // Values
+    // ============================================================================
+
+    TEST(ConfigReloadTests, Value_SettingTheSameValueDoesNotNotify) {
+        ConfigValue<std::uint32_t> value{ 5 };
+        int calls = 0;
+        value.OnChange([&](const std::uint32_t&, const std::uint32_t&) { ++calls; });
+
+        value.Set(5);
+        EXPECT_EQ(calls, 0);
+        value.Set(6);
+        EXPECT_EQ(calls, 1);
+    }
+
+    TEST(ConfigReloadTests, Value_TransactionDefersCallbacks) {
+        ConfigValue<std::uint32_t> first{ 1 };
+        ConfigValue<std::uint32_t> second{ 1 };
+        std::vector<std::uint32_t> seen;
+        first.OnChange([&](const std::uint32_t& oldValue, const std::uint32_t& newValue) {
+            EXPECT_EQ(oldValue, 1u);
+            EXPECT_EQ(newValue, 2u);
+            seen.push_back(second.Get());
+        });
+        {
+            ConfigTransaction transaction;
+            {
+                ConfigTransaction nested;
+                first.Set(2);
+            }
+            EXPECT_TRUE(seen.empty());
+            second.Set(3);
+        }
+        EXPECT_EQ(seen, (std::vector<std::uint32_t>{ 3 }));
+    }
+
+    // ============================================================================
+    // ConfigManager
+    // ============================================================================
+
+    class ConfigReloadManagerTests : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            directory_ = std::filesystem::temp_directory_path() / "AkhandaConfigReload";
+            std::filesystem::remove_all(directory_);
+            std::filesystem::create_directories(directory_);
+            Write(R"({ "audio": { "rate": 48000, "device": "Speakers", "channels": ["L", "R"] },
+                       "input": { "rate": 120, "device": "Gamepad" } })");
+
+            ConfigManager::InitializationOptions options;
+            options.configDirectory = directory_;
+            ASSERT_TRUE(ConfigManager::Initialize(options));
+            audio_ = ConfigManager::GetOrCreateSection<AudioConfig>();
+            input_ = ConfigManager::GetOrCreateSection<InputConfig>();
+            ConfigManager::OnReload([this](const ConfigChangeSet& changes) { reloads_.push_back(changes.GetPaths()); });
+
+            Record(audio_->rate, "audio.rate");
+            Record(audio_->device, "audio.device");
+            Record(audio_->channels, "audio.channels");
+            Record(input_->rate, "input.rate");
+            Record(input_->device, "input.device");
+            Record(input_->channels, "input.channels");
+        }
+
+        void TearDown() override {
+            ConfigManager::Shutdown();
+            std::filesystem::remove_all(directory_);
+        }
+
+        void Write(std::string_view text) {
+            std::ofstream file(directory_ / "engine.json", std::ios::binary | std::ios::trunc);
+            file << text;
+        }
+
+        template<typename T>
+        void Record(ConfigValue<T>& value, std::string name) {
+            value.OnChange([this, name](const T&, const T&) { fired_.push_back(name); });
+        }
+
+        std::filesystem::path directory_;
+        std::shared_ptr<AudioConfig> audio_;
+        std::shared_ptr<InputConfig> input_;
+        std::vector<std::string> fired_;
+        std::vector<std::vector<std::string>> reloads_;
+    };
+
+    TEST_F(ConfigReloadManagerTests, OneEdit_NotifiesOnlyThatValue) {
+        Write(R"({ "audio": { "rate": 44100, "device": "Speakers", "channels": ["L", "R"] },
+                   "input": { "rate": 120, "device": "Gamepad" } })");
+        ASSERT_TRUE(ConfigManager::LoadAllSections());
+
+        EXPECT_EQ(fired_, (std::vector<std::string>{ "audio.rate" }));
+        EXPECT_EQ(audio_->rate.Get(), 44100u);
+        ASSERT_EQ(audio_->reloads.size(), 1u);
+        EXPECT_EQ(audio_->reloads[0].GetPaths(), (std::vector<std::string>{ "rate" }));
+        EXPECT_TRUE(input_->reloads.empty());
+        EXPECT_EQ(reloads_, (std::vector<std::vector<std::string>>{ { "audio.rate" } }));
+    }
+
+    TEST_F(ConfigReloadManagerTests, UnchangedValues_DoNotNotify) {
+        // Reformatted and reordered, but the same values
+        Write(R"({"input":{"device":"Gamepad","rate":120.0},"audio":{"channels":["L","R"],"device":"Speakers","rate":48000}})");
+        ASSERT_TRUE(ConfigManager::LoadAllSections());
+
+        EXPECT_TRUE(fired_.empty());
+        EXPECT_TRUE(audio_->reloads.empty());
+        EXPECT_TRUE(input_->reloads.empty());
+        EXPECT_TRUE(reloads_.empty());
+    }
+
+    TEST_F(ConfigReloadManagerTests, EditsAcrossSections_NotifyAfterAllAreApplied) {
+        std::vector<std::string> seen;
+        audio_->device.OnChange([&](const std::string&, const std::string&) { seen.push_back(input_->device.Get()); });
+        input_->device.OnChange([&](const std::string&, const std::string&) { seen.push_back(audio_->device.Get()); });
+
+        Write(R"({ "audio": { "rate": 48000, "device": "Headset", "channels": ["L", "R"] },
+                   "input": { "rate": 120, "device": "Keyboard" }, "unused": 1 })");
+        ASSERT_TRUE(ConfigManager::LoadAllSections());
+
+        // Whichever callback ran first already saw the other section's change
+        std::sort(seen.begin(), seen.end());
+        EXPECT_EQ(seen, (std::vector<std::string>{ "Headset", "Keyboard" }));
+        std::sort(fired_.begin(), fired_.end());
+        EXPECT_EQ(fired_, (std::vector<std::string>{ "audio.device", "input.device" }));
+        EXPECT_EQ(reloads_, (std::vector<std::vector<std::string>>{ { "audio.device", "input.device", "unused" } }));
+    }
+
+    TEST_F(ConfigReloadManagerTests, ArrayEdit_NotifiesTheArrayValue) {
+        Write(R"({ "audio": { "rate": 48000, "device": "Speakers", "channels": ["L", "R", "C"] },
+                   "input": { "rate": 120, "device": "Gamepad" } })");
+        ASSERT_TRUE(ConfigManager::LoadAllSections());
+
+        EXPECT_EQ(fired_, (std::vector<std::string>{ "audio.channels" }));
+        EXPECT_EQ(audio_->channels.Get().size(), 3u);
+    }
+
+    TEST_F(ConfigReloadManagerTests, FailedSection_LeavesEverySectionAsItWas) {
+        // Whichever section loads first, one of them fails
+        input_->failLoads = true;
+        Write(R"({ "audio": { "rate": 44100, "device": "Headset", "channels": ["L", "R"] },
+                   "input": { "rate": 60, "device": "Keyboard" } })");
+        EXPECT_FALSE(ConfigManager::LoadAllSections());
+
+        EXPECT_EQ(audio_->rate.Get(), 48000u);
+        EXPECT_EQ(audio_->device.Get(), "Speakers");
+        EXPECT_EQ(input_->rate.Get(), 120u);
+        EXPECT_EQ(input_->device.Get(), "Gamepad");
+        EXPECT_EQ(ConfigManager::Read<AudioConfig>()->rate.Get(), 48000u);
+        EXPECT_EQ(ConfigManager::Read<InputConfig>()->rate.Get(), 120u);
+        EXPECT_TRUE(fired_.empty());
+        EXPECT_TRUE(audio_->reloads.empty());
+        EXPECT_TRUE(input_->reloads.empty());
+        EXPECT_TRUE(reloads_.empty());
+
+        // The failed file did not become the previous one, so it applies in full once accepted
+        input_->failLoads = false;
+        ASSERT_TRUE(ConfigManager::LoadAllSections());
+        EXPECT_EQ(audio_->rate.Get(), 44100u);
+        EXPECT_EQ(input_->device.Get(), "Keyboard");
+        EXPECT_EQ(ConfigManager::Read<InputConfig>()->rate.Get(), 60u);
+        std::sort(fired_.begin(), fired_.end());
+        EXPECT_EQ(fired_, (std::vector<std::string>{ "audio.device", "audio.rate", "input.device", "input.rate" }));
+    }
+
+    TEST_F(ConfigReloadManagerTests, RemovedSection_KeepsItsValues) {
+        Write(R"({ "input": { "rate": 120, "device": "Gamepad" } })");
+        ASSERT_TRUE(ConfigManager::LoadAllSections());
+
+        EXPECT_TRUE(fired_.empty());
+        EXPECT_TRUE(audio_->reloads.empty());
+        EXPECT_EQ(audio_->device.Get(), "Speakers");
+        EXPECT_EQ(reloads_, (std::vector<std::vector<std::string>>{ { "audio" } }));
+    }
+
+}
@@ -0,0 +1,331 @@
+// Tests/Core.Configuration/Source/UnitTests/ConfigWatchServiceTests.cpp
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+import Akhanda.Core.Configuration;
+import Akhanda.Core.Configuration.FileHandler;
+
+using namespace Akhanda::Configuration;
+using namespace std::chrono_literals;
+
+namespace {
+
+    // Records every callback so tests can wait for and count them
+    class ChangeRecorder {
+    public:
+        ConfigWatchService::ChangeCallback Callback() {
+            return [this](const std::filesystem::path& path) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                paths_.push_back(path);
+                changed_.notify_all();
+            };
+        }
+
+        bool WaitFor(size_t count, std::chrono::milliseconds timeout = 5s) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            return changed_.wait_for(lock, timeout, [&] { return paths_.size() >= count; });
+        }
+
+        std::vector<std::filesystem::path> Paths() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return paths_;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable changed_;
+        std::vector<std::filesystem::path> paths_;
+    };
+
+    // Runs every test against the platform's event backend and against polling
+    class ConfigWatchServiceTests : public ::testing::TestWithParam<bool> {
+    protected:
+        static constexpr auto DEBOUNCE = 100ms;
+
+        void SetUp() override {
+            const auto* test = ::testing::UnitTest::GetInstance()->current_test_info();
+            std::string name = test->name();
+            std::replace(name.begin(), name.end(), '/', '_');
+            directory_ = std::filesystem::temp_directory_path() / "AkhandaConfigWatch" / name;
+            std::filesystem::remove_all(directory_);
+            std::filesystem::create_directories(directory_);
+
+            ConfigWatchService::Options options;
+            options.debounce = DEBOUNCE;
+            options.pollInterval = 20ms;
+            options.forcePolling = GetParam();
+            service_ = std::make_unique<ConfigWatchService>(options);
+        }
+
+        void TearDown() override {
+            service_.reset();
+            std::filesystem::remove_all(directory_);
+        }
+
+        static void Write(const std::filesystem::path& path, const std::string& text) {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file << text;
+        }
+
+        // Long enough for a further, unexpected callback to arrive
+        static void Settle() {
+            std::this_thread::sleep_for(DEBOUNCE * 4);
+        }
+
+        std::filesystem::path directory_;
+        std::unique_ptr<ConfigWatchService> service_;
+    };
+
+    // ============================================================================
+    // Watching
+    // ============================================================================
+
+    TEST_P(ConfigWatchServiceTests, Backend_MatchesTheRequest) {
+        if (GetParam()) {
+            EXPECT_FALSE(service_->IsEventDriven());
+        }
+#if defined(_WIN32) || defined(__linux__)
+        else {
+            EXPECT_TRUE(service_->IsEventDriven());
+        }
+#endif
+    }
+
+    TEST_P(ConfigWatchServiceTests, Watch_ReportsAnEdit) {
+        const auto path = directory_ / "engine.json";
+        Write(path, "{}");
+
+        ChangeRecorder recorder;
+        ASSERT_NE(service_->Watch(path, recorder.Callback()), ConfigWatchService::INVALID_WATCH_ID);
+
+        Write(path, R"({ "rendering": {} })");
+        ASSERT_TRUE(recorder.WaitFor(1));
+        Settle();
+
+        const auto paths = recorder.Paths();
+        ASSERT_EQ(paths.size(), 1u);
+        EXPECT_EQ(paths[0].filename(), "engine.json");
+    }
+
+    TEST_P(ConfigWatchServiceTests, Watch_FailsForAMissingDirectory) {
+        ChangeRecorder recorder;
+        EXPECT_EQ(service_->Watch(directory_ / "Missing" / "engine.json", recorder.Callback()),
+            ConfigWatchService::INVALID_WATCH_ID);
+        EXPECT_EQ(service_->GetWatchedFileCount(), 0u);
+    }
+
+    TEST_P(ConfigWatchServiceTests, Watch_ReportsAFileCreatedLater) {
+        const auto path = directory_ / "late.json";
+        ChangeRecorder recorder;
+        ASSERT_NE(service_->Watch(path, recorder.Callback()), ConfigWatchService::INVALID_WATCH_ID);
+
+        Write(path, "{}");
+        EXPECT_TRUE(recorder.WaitFor(1));
+    }
+
+    TEST_P(ConfigWatchServiceTests, AtomicRenameSave_ReportsOnce) {
+        const auto path = directory_ / "engine.json";
+        Write(path, "{}");
+
+        ChangeRecorder recorder;
+        ASSERT_NE(service_->Watch(path, recorder.Callback()), ConfigWatchService::INVALID_WATCH_ID);
+
+        // What ConfigFileHandler::SaveJsonFile does with atomicWrite
+        auto temporary = path;
+        temporary += ".tmp";
+        Write(temporary, R"({ "rendering": { "vsync": false } })");
+        std::filesystem::rename(temporary, path);
+
+        ASSERT_TRUE(recorder.WaitFor(1));
+        Settle();
+        EXPECT_EQ(recorder.Paths().size(), 1u);
+    }
+
+    TEST_P(ConfigWatchServiceTests, RapidEdits_AreDebounced) {
+        const auto path = directory_ / "engine.json";
+        Write(path, "{}");
+
+        ChangeRecorder recorder;
+        ASSERT_NE(service_->Watch(path, recorder.Callback()), ConfigWatchService::INVALID_WATCH_ID);
+
+        for (int i = 0; i < 10; ++i) {
+            Write(path, "{ \"edit\": " + std::to_string(i) + " }");
+            std::this_thread::sleep_for(5ms);
+        }
+
+        ASSERT_TRUE(recorder.WaitFor(1));
+        Settle();
+        EXPECT_EQ(recorder.Paths().size(), 1u);
+    }
+
+    TEST_P(ConfigWatchServiceTests, OtherFilesInTheDirectory_AreIgnored) {
+        const auto path = directory_ / "engine.json";
+        Write(path, "{}");
+
+        ChangeRecorder recorder;
+        ASSERT_NE(service_->Watch(path, recorder.Callback()), ConfigWatchService::INVALID_WATCH_ID);
+
+        Write(directory_ / "other.json", "{}");
+        Write(directory_ / "engine.json.bak", "{}");
+        Settle();
+        EXPECT_TRUE(recorder.Paths().empty());
+    }
+
+    // ============================================================================
+    // Sharing
+    // ============================================================================
+
+    TEST_P(ConfigWatchServiceTests, FilesInOneDirectory_ShareItsWatch) {
+        const auto engine = directory_ / "engine.json";
+        const auto input = directory_ / "input.json";
+        Write(engine, "{}");
+        Write(input, "{}");
+
+        ChangeRecorder engineRecorder;
+        ChangeRecorder inputRecorder;
+        ChangeRecorder secondEngineRecorder;
+        ASSERT_NE(service_->Watch(engine, engineRecorder.Callback()), ConfigWatchService::INVALID_WATCH_ID);
+        ASSERT_NE(service_->Watch(input, inputRecorder.Callback()), ConfigWatchService::INVALID_WATCH_ID);
+        ASSERT_NE(service_->Watch(engine, secondEngineRecorder.Callback()), ConfigWatchService::INVALID_WATCH_ID);
+        EXPECT_EQ(service_->GetWatchedFileCount(), 2u);
+        EXPECT_EQ(service_->GetWatchedDirectoryCount(), 1u);
+
+        Write(engine, R"({ "changed": true })");
+        ASSERT_TRUE(engineRecorder.WaitFor(1));
+        ASSERT_TRUE(secondEngineRecorder.WaitFor(1));
+        Settle();
+        EXPECT_TRUE(inputRecorder.Paths().empty());
+    }
+
+    TEST_P(ConfigWatchServiceTests, Unwatch_StopsCallbacks) {
+        const auto path = directory_ / "engine.json";
+        Write(path, "{}");
+
+        ChangeRecorder recorder;
+        const auto id = service_->Watch(path, recorder.Callback());
+        ASSERT_NE(id, ConfigWatchService::INVALID_WATCH_ID);
+        service_->Unwatch(id);
+        EXPECT_EQ(service_->GetWatchedFileCount(), 0u);
+        EXPECT_EQ(service_->GetWatchedDirectoryCount(), 0u);
+
+        Write(path, R"({ "changed": true })");
+        Settle();
+        EXPECT_TRUE(recorder.Paths().empty());
+    }
+
+    TEST_P(ConfigWatchServiceTests, Unwatch_WaitsForARunningCallback) {
+        const auto path = directory_ / "engine.json";
+        Write(path, "{}");
+
+        std::mutex mutex;
+        std::condition_variable changed;
+        bool entered = false;
+        bool released = false;
+        std::atomic<bool> finished{ false };
+        const auto id = service_->Watch(path, [&](const std::filesystem::path&) {
+            std::unique_lock<std::mutex> lock(mutex);
+            entered = true;
+            changed.notify_all();
+            changed.wait(lock, [&] { return released; });
+            finished = true;
+        });
+        ASSERT_NE(id, ConfigWatchService::INVALID_WATCH_ID);
+
+        Write(path, R"({ "changed": true })");
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            ASSERT_TRUE(changed.wait_for(lock, 5s, [&] { return entered; }));
+        }
+
+        std::atomic<bool> unwatched{ false };
+        bool finishedWhenUnwatched = false;
+        std::thread unwatcher([&] {
+            service_->Unwatch(id);
+            finishedWhenUnwatched = finished;
+            unwatched = true;
+        });
+        std::this_thread::sleep_for(DEBOUNCE);
+        EXPECT_FALSE(unwatched);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            released = true;
+        }
+        changed.notify_all();
+        unwatcher.join();
+        EXPECT_TRUE(finishedWhenUnwatched);
+    }
+
+    TEST_P(ConfigWatchServiceTests, Callback_CanUnwatchItself) {
+        const auto path = directory_ / "engine.json";
+        Write(path, "{}");
+
+        ChangeRecorder recorder;
+        std::atomic<ConfigWatchService::WatchId> id{ ConfigWatchService::INVALID_WATCH_ID };
+        const auto callback = recorder.Callback();
+        id = service_->Watch(path, [&, callback](const std::filesystem::path& changedPath) {
+            service_->Unwatch(id);
+            callback(changedPath);
+        });
+        ASSERT_NE(id, ConfigWatchService::INVALID_WATCH_ID);
+
+        Write(path, R"({ "changed": true })");
+        ASSERT_TRUE(recorder.WaitFor(1));
+        EXPECT_EQ(service_->GetWatchedFileCount(), 0u);
+
+        Write(path, R"({ "changed": "again" })");
+        Settle();
+        EXPECT_EQ(recorder.Paths().size(), 1u);
+    }
+
+    INSTANTIATE_TEST_SUITE_P(
+        Backends,
+        ConfigWatchServiceTests,
+        ::testing::Values(false, true),
+        [](const ::testing::TestParamInfo<bool>& info) { return info.param ? "Polling" : "Events"; }
+    );
+
+    // ============================================================================
+    // ConfigFileWatcher
+    // ============================================================================
+
+    TEST(ConfigFileWatcherTests, UsesTheSharedService) {
+        const auto directory = std::filesystem::temp_directory_path() / "AkhandaConfigFileWatcher";
+        std::filesystem::create_directories(directory);
+        const auto path = directory / "engine.json";
+        {
+            std::ofstream file(path);
+            file << "{}";
+        }
+
+        ChangeRecorder recorder;
+        ConfigFileWatcher first;
+        ConfigFileWatcher second;
+        ASSERT_TRUE(first.Start(path, recorder.Callback()));
+        ASSERT_TRUE(second.Start(directory / "input.json", [](const std::filesystem::path&) {}));
+        EXPECT_TRUE(first.IsWatching());
+        EXPECT_EQ(ConfigWatchService::Shared()->GetWatchedDirectoryCount(), 1u);
+
+        {
+            std::ofstream file(path, std::ios::trunc);
+            file << R"({ "changed": true })";
+        }
+        EXPECT_TRUE(recorder.WaitFor(1));
+
+        first.Stop();
+        second.Stop();
+        EXPECT_FALSE(first.IsWatching());
+        EXPECT_EQ(ConfigWatchService::Shared()->GetWatchedFileCount(), 0u);
+        std::filesystem::remove_all(directory);
+    }
+
+}
@@ -0,0 +1,296 @@
+// Tests/Core.Configuration/Source/UnitTests/JsonReaderTests.cpp
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Core/Configuration/JsonView.hpp"
+#include "Core/Configuration/JsonReader.hpp"
+
+using namespace Akhanda::Configuration;
+
+namespace {
+
+    constexpr std::string_view SAMPLE = R"({
+        "name": "Akhanda",
+        "enabled": true,
+        "disabled": false,
+        "negative": -7,
+        "big": 18446744073709551615,
+        "scale": 1.5e2,
+        "nothing": null,
+        "paths": ["Shaders/", 3, "Cache/", [], {}],
+        "nested": { "inner": { "value": 9, "list": [10, 20, 30] } },
+        "escaped": "tab\there \"quoted\" \u00e9 \ud83d\ude00"
+    })";
+
+    // Writes each event as a short token, so a whole parse compares as one string
+    class RecordingHandler : public JsonHandler {
+    public:
+        std::string events;
+        size_t stopAfter = SIZE_MAX;
+
+        bool Null() override { return Add("null"); }
+        bool Bool(bool value) override { return Add(value ? "true" : "false"); }
+        bool Int(std::int64_t value) override { return Add("i:" + std::to_string(value)); }
+        bool UInt(std::uint64_t value) override { return Add("u:" + std::to_string(value)); }
+        bool Float(double value) override { return Add("f:" + std::to_string(value)); }
+        bool String(std::string_view value) override { return Add("s:" + std::string(value)); }
+        bool Key(std::string_view key) override { return Add("k:" + std::string(key)); }
+        bool StartObject() override { return Add("{"); }
+        bool EndObject() override { return Add("}"); }
+        bool StartArray() override { return Add("["); }
+        bool EndArray() override { return Add("]"); }
+
+    private:
+        bool Add(const std::string& event) {
+            if (!events.empty()) events += ' ';
+            events += event;
+            return --stopAfter != 0;
+        }
+    };
+
+    // The events a parse of the same text should produce, from the document
+    void Replay(const JsonView& view, RecordingHandler& handler) {
+        if (view.IsObject()) {
+            handler.StartObject();
+            for (const JsonView member : view) {
+                handler.Key(member.Key());
+                Replay(member, handler);
+            }
+            handler.EndObject();
+        }
+        else if (view.IsArray()) {
+            handler.StartArray();
+            for (const JsonView element : view) {
+                Replay(element, handler);
+            }
+            handler.EndArray();
+        }
+        else if (view.IsString()) handler.String(view.GetString());
+        else if (view.IsBool()) handler.Bool(view.GetValue<bool>());
+        else if (view.IsInteger()) {
+            if (view.GetValue<double>() < 0.0) handler.Int(view.GetValue<std::int64_t>());
+            else handler.UInt(view.GetValue<std::uint64_t>());
+        }
+        else if (view.IsNumber()) handler.Float(view.GetValue<double>());
+        else handler.Null();
+    }
+
+    std::string Events(std::string_view text) {
+        RecordingHandler handler;
+        EXPECT_TRUE(JsonReader::Parse(text, handler));
+        return handler.events;
+    }
+
+    class JsonReaderFileTests : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            directory_ = std::filesystem::temp_directory_path() / "AkhandaJsonReader";
+            std::filesystem::create_directories(directory_);
+            path_ = directory_ / (std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) + ".json");
+        }
+
+        void TearDown() override {
+            std::filesystem::remove(path_);
+        }
+
+        void Write(std::string_view text) {
+            std::ofstream file(path_, std::ios::binary | std::ios::trunc);
+            file << text;
+        }
+
+        std::filesystem::path directory_;
+        std::filesystem::path path_;
+    };
+
+    // ============================================================================
+    // Events
+    // ============================================================================
+
+    TEST(JsonReaderTests, Parse_EmitsEventsInDocumentOrder) {
+        EXPECT_EQ(Events(R"({ "a": [1, -2, 2.5, "x", true, null], "b": {} })"),
+            "{ k:a [ u:1 i:-2 f:2.500000 s:x true null ] k:b { } }");
+        EXPECT_EQ(Events("  42  "), "u:42");
+        EXPECT_EQ(Events("[[[]]]"), "[ [ [ ] ] ]");
+    }
+
+    TEST(JsonReaderTests, Parse_DecodesEscapes) {
+        EXPECT_EQ(Events(R"(["a\"b\\c\/d\b\f\n\r\t", "\u0041\u00e9\u20ac", "\ud83d\ude00"])"),
+            "[ s:a\"b\\c/d\b\f\n\r\t s:A\xC3\xA9\xE2\x82\xAC s:\xF0\x9F\x98\x80 ]");
+    }
+
+    TEST(JsonReaderTests, Parse_ClassifiesNumbers) {
+        EXPECT_EQ(Events("[0, -0, 9223372036854775807, -9223372036854775808, 18446744073709551615]"),
+            "[ u:0 i:0 u:9223372036854775807 i:-9223372036854775808 u:18446744073709551615 ]");
+        // Integers beyond 64 bits fall back to doubles, as do fractions and exponents
+        EXPECT_EQ(Events("[18446744073709551616, 1e2, 1E-2, 0.5, 1e-400]"),
+            "[ f:18446744073709551616.000000 f:100.000000 f:0.010000 f:0.500000 f:0.000000 ]");
+    }
+
+    TEST(JsonReaderTests, Parse_MatchesTheDocumentParser) {
+        RecordingHandler expected;
+        Replay(JsonDocument::Parse(SAMPLE).Root(), expected);
+        EXPECT_EQ(Events(SAMPLE), expected.events);
+    }
+
+    TEST(JsonReaderTests, Parse_RejectsInvalidJson) {
+        RecordingHandler handler;
+        for (const std::string_view text : {
+            "", "   ", "{", "[1,]", "{\"a\" 1}", "{\"a\":1,}", "{1:2}", "[1 2]", "01", "1.", "-", "1e", "+1",
+            "tru", "nul", "\"unterminated", "\"bad\\q\"", "\"\\u12\"", "\"\\ud800\"", "\"\\udc00\"",
+            "\"line\nbreak\"", "1e400", "{} {}", "[1]x" }) {
+            EXPECT_THROW(JsonReader::Parse(text, handler), std::runtime_error) << text;
+        }
+    }
+
+    TEST(JsonReaderTests, Parse_ErrorNamesTheByteOffset) {
+        RecordingHandler handler;
+        try {
+            JsonReader::Parse(R"({ "a": [1, 2 3] })", handler);
+            FAIL() << "Expected a parse error";
+        }
+        catch (const std::runtime_error& error) {
+            EXPECT_NE(std::string(error.what()).find("at byte 13"), std::string::npos) << error.what();
+        }
+    }
+
+    TEST(JsonReaderTests, Parse_StopsWhenTheHandlerDoes) {
+        RecordingHandler handler;
+        handler.stopAfter = 3;
+        EXPECT_FALSE(JsonReader::Parse(R"({ "a": 1, "b": [2, 3] })", handler));
+        EXPECT_EQ(handler.events, "{ k:a u:1");
+    }
+
+    // ============================================================================
+    // Files
+    // ============================================================================
+
+    TEST_F(JsonReaderFileTests, SmallBuffer_KeepsTokensWholeAcrossRefills) {
+        Write(SAMPLE);
+        const std::string expected = Events(SAMPLE);
+
+        // Every token longer than the buffer forces it to grow
+        for (const size_t bufferSize : { size_t{ 1 }, size_t{ 7 }, size_t{ 16 }, size_t{ 4096 } }) {
+            RecordingHandler handler;
+            EXPECT_TRUE(JsonReader::ParseFile(path_, handler, bufferSize));
+            EXPECT_EQ(handler.events, expected) << bufferSize;
+        }
+    }
+
+    TEST_F(JsonReaderFileTests, NumberEndingTheFile_IsReadWhole) {
+        Write("1234567890");
+        for (const size_t bufferSize : { size_t{ 3 }, size_t{ 10 }, size_t{ 11 } }) {
+            RecordingHandler handler;
+            EXPECT_TRUE(JsonReader::ParseFile(path_, handler, bufferSize));
+            EXPECT_EQ(handler.events, "u:1234567890") << bufferSize;
+        }
+    }
+
+    TEST_F(JsonReaderFileTests, MappedFile_MatchesReading) {
+        Write(SAMPLE);
+        RecordingHandler mapped;
+        EXPECT_TRUE(JsonReader::ParseMappedFile(path_, mapped));
+        EXPECT_EQ(mapped.events, Events(SAMPLE));
+    }
+
+    TEST_F(JsonReaderFileTests, ErrorsInLaterChunks_CountFromTheStartOfTheFile) {
+        Write(std::string(100, ' ') + "[1, 2, ]");
+        RecordingHandler handler;
+        try {
+            JsonReader::ParseFile(path_, handler, 8);
+            FAIL() << "Expected a parse error";
+        }
+        catch (const std::runtime_error& error) {
+            EXPECT_NE(std::string(error.what()).find("at byte 107"), std::string::npos) << error.what();
+        }
+    }
+
+    TEST_F(JsonReaderFileTests, MissingOrEmptyFiles_Throw) {
+        RecordingHandler handler;
+        EXPECT_THROW(JsonReader::ParseFile(path_, handler), std::runtime_error);
+        EXPECT_THROW(JsonReader::ParseMappedFile(path_, handler), std::runtime_error);
+
+        Write("");
+        EXPECT_THROW(JsonReader::ParseFile(path_, handler), std::runtime_error);
+        EXPECT_THROW(JsonReader::ParseMappedFile(path_, handler), std::runtime_error);
+    }
+
+    // ============================================================================
+    // Binding
+    // ============================================================================
+
+    struct LevelEntry {
+        std::string name;
+        std::uint32_t id = 0;
+        float weight = 1.0f;
+        bool streamed = false;
+        std::vector<std::string> tags;
+    };
+
+    JsonBinding<LevelEntry> LevelBinding() {
+        JsonBinding<LevelEntry> binding;
+        binding.Field("name", &LevelEntry::name)
+            .Field("id", &LevelEntry::id)
+            .Field("weight", &LevelEntry::weight)
+            .Field("streamed", &LevelEntry::streamed)
+            .Field("tags", &LevelEntry::tags);
+        return binding;
+    }
+
+    TEST(JsonReaderTests, ElementReader_BindsEachElementOfTheNamedArray) {
+        constexpr std::string_view MANIFEST = R"({
+            "levels": [{ "name": "decoy" }],
+            "world": {
+                "version": 3,
+                "levels": [
+                    { "name": "Intro", "id": 1, "tags": ["tutorial", "short"], "spawn": { "id": 99, "tags": ["x"] } },
+                    { "id": 2, "weight": 0.5, "streamed": true, "name": "Caves", "unknown": [1, { "name": "no" }] },
+                    42,
+                    { "name": 7, "tags": "none", "id": "three" }
+                ],
+                "after": { "levels": [{ "name": "decoy" }] }
+            }
+        })";
+
+        const JsonBinding<LevelEntry> binding = LevelBinding();
+        std::vector<LevelEntry> levels;
+        JsonElementReader<LevelEntry> reader(binding, "world.levels", [&](LevelEntry&& level) {
+            levels.push_back(std::move(level));
+            return true;
+        });
+        EXPECT_TRUE(JsonReader::Parse(MANIFEST, reader));
+
+        ASSERT_EQ(levels.size(), 3u);
+        EXPECT_EQ(reader.GetElementCount(), 3u);
+        EXPECT_EQ(levels[0].name, "Intro");
+        EXPECT_EQ(levels[0].id, 1u);
+        EXPECT_EQ(levels[0].tags, (std::vector<std::string>{ "tutorial", "short" }));
+        EXPECT_FLOAT_EQ(levels[0].weight, 1.0f);
+        EXPECT_EQ(levels[1].name, "Caves");
+        EXPECT_EQ(levels[1].id, 2u);
+        EXPECT_FLOAT_EQ(levels[1].weight, 0.5f);
+        EXPECT_TRUE(levels[1].streamed);
+        EXPECT_TRUE(levels[1].tags.empty());
+
+        // Values of the wrong kind leave the defaults
+        EXPECT_TRUE(levels[2].name.empty());
+        EXPECT_EQ(levels[2].id, 0u);
+        EXPECT_TRUE(levels[2].tags.empty());
+    }
+
+    TEST(JsonReaderTests, ElementReader_ReadsRootArraysAndCanStop) {
+        const JsonBinding<LevelEntry> binding = LevelBinding();
+        std::vector<std::string> names;
+        JsonElementReader<LevelEntry> reader(binding, "", [&](LevelEntry&& level) {
+            names.push_back(level.name);
+            return names.size() < 2;
+        });
+        EXPECT_FALSE(JsonReader::Parse(R"([{ "name": "a" }, { "name": "b" }, { "name": "c" }])", reader));
+        EXPECT_EQ(names, (std::vector<std::string>{ "a", "b" }));
+    }
+
+}
@@ -0,0 +1,160 @@
+// Tests/Core.Configuration/Source/UnitTests/JsonSnapshotTests.cpp
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+import Akhanda.Core.Configuration;
+import Akhanda.Core.Configuration.Rendering;
+import Akhanda.Core.Configuration.Manager;
+#include "Core/Configuration/JsonView.hpp"
+
+using namespace Akhanda::Configuration;
+
+namespace {
+
+    constexpr std::string_view SAMPLE = R"({
+        "name": "Akhanda",
+        "enabled": true,
+        "negative": -7,
+        "big": 18446744073709551615,
+        "scale": 1.5,
+        "nothing": null,
+        "paths": ["Shaders/", 3, "Cache/"],
+        "nested": { "inner": { "value": 9, "list": [10, 20, 30] } },
+        "members": { "k0": 0, "k1": 1, "k2": 2, "k3": 3, "k4": 4, "k5": 5, "k6": 6, "k7": 7,
+                     "k8": 8, "k9": 9, "k10": 10, "k11": 11, "k12": 12, "k13": 13, "k14": 14, "k15": 15 }
+    })";
+
+    class JsonSnapshotTests : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            directory_ = std::filesystem::temp_directory_path() / "AkhandaJsonSnapshot" /
+                ::testing::UnitTest::GetInstance()->current_test_info()->name();
+            std::filesystem::remove_all(directory_);
+            std::filesystem::create_directories(directory_);
+            jsonPath_ = directory_ / "engine.json";
+            snapshotPath_ = directory_ / "engine.snapshot";
+        }
+
+        void TearDown() override {
+            std::filesystem::remove_all(directory_);
+        }
+
+        static void Write(const std::filesystem::path& path, std::string_view text) {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file << text;
+        }
+
+        std::filesystem::path directory_;
+        std::filesystem::path jsonPath_;
+        std::filesystem::path snapshotPath_;
+    };
+
+    // ============================================================================
+    // Snapshots
+    // ============================================================================
+
+    TEST_F(JsonSnapshotTests, RoundTrip_MapsTheSameDocument) {
+        const JsonDocument parsed = JsonDocument::Parse(SAMPLE);
+        const std::uint64_t hash = JsonDocument::HashSource(SAMPLE);
+        ASSERT_TRUE(parsed.WriteSnapshot(snapshotPath_, hash));
+        EXPECT_FALSE(std::filesystem::exists(directory_ / "engine.snapshot.tmp"));
+
+        const auto mapped = JsonDocument::FromSnapshot(snapshotPath_, hash);
+        ASSERT_TRUE(mapped.has_value());
+        EXPECT_TRUE(mapped->IsMapped());
+        EXPECT_FALSE(parsed.IsMapped());
+        EXPECT_EQ(mapped->Root(), parsed.Root());
+        EXPECT_EQ(mapped->Root()["big"].GetValue<std::uint64_t>(), UINT64_MAX);
+        EXPECT_EQ(mapped->Root().AtPath("nested.inner.list.2").GetValue<int>(), 30);
+        EXPECT_EQ(mapped->Root().AtPath("members.k12").GetValue<int>(), 12);
+        EXPECT_EQ(mapped->GetMemoryUsage(), std::filesystem::file_size(snapshotPath_));
+    }
+
+    TEST_F(JsonSnapshotTests, FromSnapshot_RejectsOtherSourceText) {
+        ASSERT_TRUE(JsonDocument::Parse(SAMPLE).WriteSnapshot(snapshotPath_, JsonDocument::HashSource(SAMPLE)));
+        EXPECT_FALSE(JsonDocument::FromSnapshot(snapshotPath_, JsonDocument::HashSource("{}")).has_value());
+        EXPECT_FALSE(JsonDocument::FromSnapshot(directory_ / "missing.snapshot", 0).has_value());
+    }
+
+    TEST_F(JsonSnapshotTests, FromSnapshot_RejectsDamagedFiles) {
+        const std::uint64_t hash = JsonDocument::HashSource(SAMPLE);
+        ASSERT_TRUE(JsonDocument::Parse(SAMPLE).WriteSnapshot(snapshotPath_, hash));
+        const auto size = std::filesystem::file_size(snapshotPath_);
+
+        // Truncated
+        std::filesystem::resize_file(snapshotPath_, size - 1);
+        EXPECT_FALSE(JsonDocument::FromSnapshot(snapshotPath_, hash).has_value());
+
+        // Node table overwritten so child and string ranges point anywhere
+        ASSERT_TRUE(JsonDocument::Parse(SAMPLE).WriteSnapshot(snapshotPath_, hash));
+        {
+            std::fstream file(snapshotPath_, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(48);
+            const std::string garbage(size / 2, '\x7f');
+            file.write(garbage.data(), static_cast<std::streamsize>(garbage.size()));
+        }
+        EXPECT_FALSE(JsonDocument::FromSnapshot(snapshotPath_, hash).has_value());
+
+        // Not a snapshot at all
+        Write(snapshotPath_, SAMPLE);
+        EXPECT_FALSE(JsonDocument::FromSnapshot(snapshotPath_, hash).has_value());
+    }
+
+    TEST_F(JsonSnapshotTests, FromFileWithSnapshot_BuildsThenReusesTheSnapshot) {
+        Write(jsonPath_, SAMPLE);
+
+        const JsonDocument first = JsonDocument::FromFileWithSnapshot(jsonPath_, snapshotPath_);
+        EXPECT_FALSE(first.IsMapped());
+        ASSERT_TRUE(std::filesystem::exists(snapshotPath_));
+
+        const JsonDocument second = JsonDocument::FromFileWithSnapshot(jsonPath_, snapshotPath_);
+        EXPECT_TRUE(second.IsMapped());
+        EXPECT_EQ(second.Root(), first.Root());
+    }
+
+    TEST_F(JsonSnapshotTests, FromFileWithSnapshot_RebuildsAfterAnEdit) {
+        Write(jsonPath_, SAMPLE);
+        JsonDocument::FromFileWithSnapshot(jsonPath_, snapshotPath_);
+
+        Write(jsonPath_, R"({ "name": "Edited" })");
+        const JsonDocument edited = JsonDocument::FromFileWithSnapshot(jsonPath_, snapshotPath_);
+        EXPECT_FALSE(edited.IsMapped());
+        EXPECT_EQ(edited.Root()["name"].GetString(), "Edited");
+
+        const JsonDocument reused = JsonDocument::FromFileWithSnapshot(jsonPath_, snapshotPath_);
+        EXPECT_TRUE(reused.IsMapped());
+        EXPECT_EQ(reused.Root()["name"].GetString(), "Edited");
+    }
+
+    TEST_F(JsonSnapshotTests, FromFileWithSnapshot_InvalidJsonThrowsAndWritesNothing) {
+        Write(jsonPath_, R"({ "name": )");
+        EXPECT_THROW(JsonDocument::FromFileWithSnapshot(jsonPath_, snapshotPath_), std::runtime_error);
+        EXPECT_FALSE(std::filesystem::exists(snapshotPath_));
+    }
+
+    // ============================================================================
+    // ConfigManager
+    // ============================================================================
+
+    TEST_F(JsonSnapshotTests, Manager_LoadsThroughTheSnapshot) {
+        Write(jsonPath_, R"({ "rendering": { "maxFPS": 90 } })");
+
+        ConfigManager::InitializationOptions options;
+        options.configDirectory = directory_;
+        ASSERT_TRUE(ConfigManager::Initialize(options));
+        EXPECT_TRUE(std::filesystem::exists(snapshotPath_));
+        auto rendering = ConfigManager::GetOrCreateSection<RenderingConfig>();
+        EXPECT_EQ(rendering->GetMaxFPS(), 90u);
+
+        // An edit outside the engine wins over the stale snapshot
+        Write(jsonPath_, R"({ "rendering": { "maxFPS": 75 } })");
+        ASSERT_TRUE(ConfigManager::LoadAllSections());
+        EXPECT_EQ(rendering->GetMaxFPS(), 75u);
+        ConfigManager::Shutdown();
+    }
+
+}
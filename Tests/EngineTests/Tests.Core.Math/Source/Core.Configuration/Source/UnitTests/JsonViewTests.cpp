@@ -0,0 +1,284 @@
+// Tests/Core.Configuration/Source/UnitTests/JsonViewTests.cpp
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+import Akhanda.Core.Configuration;
+import Akhanda.Core.Configuration.Rendering;
+import Akhanda.Core.Configuration.Manager;
+#include "Core/Configuration/JsonWrapper.hpp"
+#include "Core/Configuration/JsonView.hpp"
+
+using namespace Akhanda::Configuration;
+
+namespace {
+
+    constexpr std::string_view SAMPLE = R"({
+        "name": "Akhanda",
+        "enabled": true,
+        "count": 42,
+        "negative": -7,
+        "big": 18446744073709551615,
+        "scale": 1.5,
+        "nothing": null,
+        "paths": ["Shaders/", 3, "Cache/"],
+        "nested": { "inner": { "value": 9, "list": [10, 20, 30] } },
+        "empty": {}
+    })";
+
+    // Sixteen members, enough for the sorted member index
+    std::string LargeObject(std::string_view duplicate = {}) {
+        std::string json = "{";
+        for (int i = 0; i < 16; ++i) {
+            json += "\"key" + std::to_string(15 - i) + "\":" + std::to_string(i) + ",";
+        }
+        json += duplicate.empty() ? std::string("\"last\":0") : std::string(duplicate);
+        return json + "}";
+    }
+
+    // ============================================================================
+    // Values
+    // ============================================================================
+
+    TEST(JsonViewTests, Values_ReadWithTheirTypes) {
+        const JsonDocument document = JsonDocument::Parse(SAMPLE);
+        const JsonView root = document.Root();
+
+        ASSERT_TRUE(root.IsObject());
+        EXPECT_EQ(root.Size(), 10u);
+        EXPECT_EQ(root["name"].GetString(), "Akhanda");
+        EXPECT_EQ(root["name"].GetValue<std::string>(), "Akhanda");
+        EXPECT_TRUE(root["enabled"].GetValue<bool>());
+        EXPECT_EQ(root["count"].GetValue<int>(), 42);
+        EXPECT_EQ(root["count"].GetValue<float>(), 42.0f);
+        EXPECT_EQ(root["negative"].GetValue<std::int64_t>(), -7);
+        EXPECT_EQ(root["big"].GetValue<std::uint64_t>(), UINT64_MAX);
+        EXPECT_DOUBLE_EQ(root["scale"].GetValue<double>(), 1.5);
+        EXPECT_TRUE(root["nothing"].Exists());
+        EXPECT_TRUE(root["nothing"].IsNull());
+        EXPECT_TRUE(root["empty"].IsObject());
+        EXPECT_EQ(root["empty"].Size(), 0u);
+    }
+
+    TEST(JsonViewTests, Values_WrongTypeThrowsOrGivesTheDefault) {
+        const JsonDocument document = JsonDocument::Parse(SAMPLE);
+        const JsonView root = document.Root();
+
+        EXPECT_THROW(root["name"].GetValue<int>(), std::runtime_error);
+        EXPECT_THROW(root["count"].GetValue<bool>(), std::runtime_error);
+        EXPECT_EQ(root["name"].GetValueOr(5), 5);
+        EXPECT_EQ(root["count"].GetValueOr(std::string("none")), "none");
+    }
+
+    TEST(JsonViewTests, Values_MissingKeysGiveDefaults) {
+        const JsonDocument document = JsonDocument::Parse(SAMPLE);
+        const JsonView root = document.Root();
+
+        EXPECT_FALSE(root.Contains("missing"));
+        EXPECT_FALSE(root["missing"].Exists());
+        EXPECT_FALSE(root["missing"]["deeper"].Exists());
+        EXPECT_FALSE(root["count"]["notAnObject"].Exists());
+        EXPECT_EQ(GetConfigValue<std::uint32_t>(root, "missing", 1920u), 1920u);
+        EXPECT_EQ(GetConfigValue<std::string>(root, "missing", "Shaders/"), "Shaders/");
+        EXPECT_EQ(GetConfigValue<std::uint32_t>(root, "count", 1920u), 42u);
+    }
+
+    TEST(JsonViewTests, Values_StringArraysSkipOtherElements) {
+        const JsonDocument document = JsonDocument::Parse(SAMPLE);
+
+        const auto paths = document.Root()["paths"].GetValue<std::vector<std::string>>();
+        EXPECT_EQ(paths, (std::vector<std::string>{ "Shaders/", "Cache/" }));
+    }
+
+    TEST(JsonViewTests, Values_DefaultDocumentIsNull) {
+        const JsonDocument document;
+        EXPECT_TRUE(document.Root().Exists());
+        EXPECT_TRUE(document.Root().IsNull());
+        EXPECT_FALSE(document.Root().Contains("rendering"));
+    }
+
+    // ============================================================================
+    // Lookup and Iteration
+    // ============================================================================
+
+    TEST(JsonViewTests, Lookup_LastDuplicateKeyWins) {
+        const JsonDocument small = JsonDocument::Parse(R"({"a":1,"b":2,"a":3})");
+        EXPECT_EQ(small.Root()["a"].GetValue<int>(), 3);
+
+        const JsonDocument large = JsonDocument::Parse(LargeObject("\"key4\":100"));
+        EXPECT_EQ(large.Root()["key4"].GetValue<int>(), 100);
+    }
+
+    TEST(JsonViewTests, Lookup_FindsEveryMemberOfLargeObjects) {
+        const JsonDocument document = JsonDocument::Parse(LargeObject());
+        const JsonView root = document.Root();
+
+        ASSERT_EQ(root.Size(), 17u);
+        for (int i = 0; i < 16; ++i) {
+            EXPECT_EQ(root["key" + std::to_string(15 - i)].GetValue<int>(), i);
+        }
+        EXPECT_TRUE(root.Contains("last"));
+        EXPECT_FALSE(root.Contains("key16"));
+        EXPECT_FALSE(root.Contains(""));
+    }
+
+    TEST(JsonViewTests, Iteration_KeepsDocumentOrder) {
+        const JsonDocument document = JsonDocument::Parse(SAMPLE);
+
+        std::vector<std::string_view> keys;
+        for (const JsonView member : document.Root()) {
+            keys.push_back(member.Key());
+        }
+        const std::vector<std::string_view> expected = {
+            "name", "enabled", "count", "negative", "big", "scale", "nothing", "paths", "nested", "empty"
+        };
+        EXPECT_EQ(keys, expected);
+
+        std::vector<int> list;
+        for (const JsonView element : document.Root().AtPath("nested.inner.list")) {
+            list.push_back(element.GetValue<int>());
+        }
+        EXPECT_EQ(list, (std::vector<int>{ 10, 20, 30 }));
+    }
+
+    TEST(JsonViewTests, Path_WalksObjectsAndArrays) {
+        const JsonDocument document = JsonDocument::Parse(SAMPLE);
+        const JsonView root = document.Root();
+
+        EXPECT_EQ(root.AtPath("nested.inner.value").GetValue<int>(), 9);
+        EXPECT_EQ(root.AtPath("nested.inner.list.2").GetValue<int>(), 30);
+        EXPECT_EQ(root.AtPath("paths.0").GetString(), "Shaders/");
+        EXPECT_EQ(root.AtPath(""), root);
+        EXPECT_FALSE(root.AtPath("nested.inner.list.3").Exists());
+        EXPECT_FALSE(root.AtPath("nested.missing.value").Exists());
+        EXPECT_FALSE(root.AtPath("paths.x").Exists());
+    }
+
+    // ============================================================================
+    // Documents
+    // ============================================================================
+
+    TEST(JsonViewTests, Parse_InvalidInputThrows) {
+        EXPECT_THROW(JsonDocument::Parse(R"({"a": )"), std::runtime_error);
+        EXPECT_THROW(JsonDocument::Parse("[1, 2"), std::runtime_error);
+        EXPECT_THROW(JsonDocument::Parse(""), std::runtime_error);
+        EXPECT_THROW(JsonDocument::FromFile("DoesNotExist/engine.json"), std::runtime_error);
+    }
+
+    TEST(JsonViewTests, Views_OutliveTheirDocumentCopy) {
+        JsonView name;
+        JsonDocument kept;
+        {
+            const JsonDocument document = JsonDocument::Parse(SAMPLE);
+            kept = document;
+            name = document.Root()["name"];
+        }
+        EXPECT_EQ(name.GetString(), "Akhanda");
+        EXPECT_GT(kept.GetMemoryUsage(), 0u);
+    }
+
+    TEST(JsonViewTests, Value_RoundTripsThroughJsonValue) {
+        const JsonDocument document = JsonDocument::Parse(SAMPLE);
+        const JsonValue value = document.Root().ToValue();
+
+        EXPECT_EQ(value["name"].GetValue<std::string>(), "Akhanda");
+        EXPECT_EQ(value["nested"]["inner"]["value"].GetValue<int>(), 9);
+
+        const JsonDocument copy = JsonDocument::FromValue(value);
+        EXPECT_EQ(copy.Root(), document.Root());
+        EXPECT_EQ(JsonDocument::Parse(value.ToString()).Root(), document.Root());
+        EXPECT_NE(copy.Root()["nested"], document.Root()["paths"]);
+    }
+
+    TEST(JsonViewTests, Equality_ComparesMembersByName) {
+        const JsonDocument a = JsonDocument::Parse(R"({"x":1,"y":[true,"s"]})");
+        const JsonDocument b = JsonDocument::Parse(R"({"y":[true,"s"],"x":1.0})");
+        const JsonDocument c = JsonDocument::Parse(R"({"y":[true,"t"],"x":1})");
+
+        EXPECT_EQ(a.Root(), b.Root());
+        EXPECT_NE(a.Root(), c.Root());
+    }
+
+    TEST(JsonViewTests, Equality_MissingMemberIsNotNull) {
+        const JsonDocument withNull = JsonDocument::Parse(R"({"a":null})");
+        const JsonDocument empty = JsonDocument::Parse("{}");
+        const JsonDocument nullAndOne = JsonDocument::Parse(R"({"a":null,"b":1})");
+        const JsonDocument oneAndOther = JsonDocument::Parse(R"({"b":1,"c":1})");
+
+        EXPECT_NE(withNull.Root(), empty.Root());
+        EXPECT_NE(empty.Root(), withNull.Root());
+        EXPECT_NE(nullAndOne.Root(), oneAndOther.Root());
+        EXPECT_NE(oneAndOther.Root(), nullAndOne.Root());
+        EXPECT_EQ(withNull.Root(), JsonDocument::Parse(R"({ "a": null })").Root());
+    }
+
+    // ============================================================================
+    // Sections
+    // ============================================================================
+
+    TEST(JsonViewTests, Sections_LoadFromAView) {
+        const JsonDocument document = JsonDocument::Parse(R"({
+            "rendering": {
+                "renderingAPI": "D3D12",
+                "resolution": { "width": 2560, "height": 1440 },
+                "vsync": false,
+                "msaaSamples": "4x",
+                "shaders": { "shaderSourcePath": "Content/Shaders/", "hotReloadCheckIntervalMs": 250 }
+            }
+        })");
+
+        RenderingConfig config;
+        ASSERT_TRUE(config.LoadFromJson(document.Root()["rendering"]));
+        EXPECT_EQ(config.GetResolution().width, 2560u);
+        EXPECT_EQ(config.GetResolution().height, 1440u);
+        EXPECT_FALSE(config.GetVsync());
+        EXPECT_EQ(config.GetMsaaSamples(), MSAASamples::MSAA4x);
+        EXPECT_EQ(config.GetShaderConfig().GetShaderSourcePath(), "Content/Shaders/");
+        EXPECT_EQ(config.GetShaderConfig().GetHotReloadCheckIntervalMs(), 250u);
+    }
+
+    TEST(JsonViewTests, Sections_SavedValuesLoadBack) {
+        RenderingConfig original;
+        original.SetResolution(Resolution{ 3840, 2160 });
+        original.SetMaxFPS(144);
+        original.SetHdrEnabled(true);
+
+        const JsonDocument document = JsonDocument::FromValue(original.SaveToJson());
+        RenderingConfig loaded;
+        ASSERT_TRUE(loaded.LoadFromJson(document.Root()));
+        EXPECT_EQ(loaded.GetResolution().width, 3840u);
+        EXPECT_EQ(loaded.GetMaxFPS(), 144u);
+        EXPECT_TRUE(loaded.GetHdrEnabled());
+    }
+
+    TEST(JsonViewTests, Sections_ManagerLoadsAndSavesThroughTheDocument) {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "AkhandaJsonViewConfig";
+        std::filesystem::create_directories(directory);
+        {
+            std::ofstream file(directory / "engine.json");
+            file << R"({ "game": { "title": "Kept" }, "rendering": { "maxFPS": 90 } })";
+        }
+
+        ConfigManager::InitializationOptions options;
+        options.configDirectory = directory;
+        ASSERT_TRUE(ConfigManager::Initialize(options));
+        auto rendering = ConfigManager::GetOrCreateSection<RenderingConfig>();
+        EXPECT_EQ(rendering->GetMaxFPS(), 90u);
+
+        rendering->SetMaxFPS(120);
+        ASSERT_TRUE(ConfigManager::SaveAllSections());
+        ConfigManager::Shutdown();
+
+        // Sections nobody registered survive the save
+        const JsonDocument saved = JsonDocument::FromFile(directory / "engine.json");
+        EXPECT_EQ(saved.Root().AtPath("rendering.maxFPS").GetValue<int>(), 120);
+        EXPECT_EQ(saved.Root().AtPath("game.title").GetString(), "Kept");
+        std::filesystem::remove_all(directory);
+    }
+
+}
@@ -0,0 +1,68 @@
+// Tests/Core.Logging/Source/Fixtures/AllocationCounter.cpp
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <malloc.h>
+#include <new>
+
+#include "LoggingTestFixtures.hpp"
+
+namespace {
+    thread_local bool t_counting = false;
+    thread_local size_t t_allocations = 0;
+    thread_local std::int64_t t_allocatedBytes = 0;
+    thread_local std::int64_t t_peakAllocatedBytes = 0;
+
+    size_t AllocationSize(void* memory) noexcept {
+#ifdef _WIN32
+        return _msize(memory);
+#else
+        return malloc_usable_size(memory);
+#endif
+    }
+}
+
+void* operator new(std::size_t size) {
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        if (t_counting) {
+            ++t_allocations;
+            t_allocatedBytes += static_cast<std::int64_t>(AllocationSize(memory));
+            if (t_allocatedBytes > t_peakAllocatedBytes) {
+                t_peakAllocatedBytes = t_allocatedBytes;
+            }
+        }
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    if (memory && t_counting) {
+        t_allocatedBytes -= static_cast<std::int64_t>(AllocationSize(memory));
+    }
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    operator delete(memory);
+}
+
+namespace Akhanda::Tests::Logging {
+
+    void BeginCountingAllocations() noexcept {
+        t_allocations = 0;
+        t_allocatedBytes = 0;
+        t_peakAllocatedBytes = 0;
+        t_counting = true;
+    }
+
+    size_t EndCountingAllocations() noexcept {
+        t_counting = false;
+        return t_allocations;
+    }
+
+    size_t GetPeakAllocatedBytes() noexcept {
+        return static_cast<size_t>(t_peakAllocatedBytes);
+    }
+
+}
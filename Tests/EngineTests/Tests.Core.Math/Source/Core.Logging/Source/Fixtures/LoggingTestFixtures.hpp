@@ -0,0 +1,204 @@
+// Tests/Core.Logging/Source/Fixtures/LoggingTestFixtures.hpp
+#pragma once
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+import Akhanda.Core.Logging;
+
+namespace Akhanda::Tests::Logging {
+
+    // ============================================================================
+    // Capture Sink
+    // ============================================================================
+
+    // Records the message text and full line of every entry. LogManager owns the sink, so
+    // the captured lines live in a shared block the test keeps a handle to.
+    class CaptureSink : public Akhanda::Logging::ILogSink {
+    public:
+        struct Captured {
+            std::mutex mutex;
+            std::vector<std::string> messages;
+            std::vector<std::string> lines;
+            std::vector<Akhanda::Logging::LogLevel> levels;
+            std::vector<std::chrono::high_resolution_clock::time_point> timestamps;
+        };
+
+        explicit CaptureSink(std::shared_ptr<Captured> captured)
+            : captured_(std::move(captured)) {
+        }
+
+        void Write(const Akhanda::Logging::LogEntry& entry) override {
+            std::lock_guard<std::mutex> lock(captured_->mutex);
+            captured_->messages.emplace_back(StripPattern(entry.message));
+            captured_->lines.emplace_back(entry.message);
+            captured_->levels.push_back(entry.level);
+            captured_->timestamps.push_back(entry.timestamp);
+        }
+
+        void Flush() override {}
+        void SetLevel(Akhanda::Logging::LogLevel level) override { level_ = level; }
+        Akhanda::Logging::LogLevel GetLevel() const override { return level_; }
+        std::string_view GetName() const override { return "Capture"; }
+
+        // The sink wrapper renders spdlog's default pattern
+        // "[time] [channel] [level] [file:line] text\n"; keep only the text
+        static std::string StripPattern(std::string_view line) {
+            if (!line.empty() && line.back() == '\n') line.remove_suffix(1);
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+            size_t offset = 0;
+            for (int field = 0; field < 4; ++field) {
+                if (field == 3 && (offset >= line.size() || line[offset] != '[')) break;
+                const size_t close = line.find("] ", offset);
+                if (close == std::string_view::npos) return std::string(line);
+                offset = close + 2;
+            }
+            return std::string(line.substr(offset));
+        }
+
+    private:
+        std::shared_ptr<Captured> captured_;
+        Akhanda::Logging::LogLevel level_ = Akhanda::Logging::LogLevel::Trace;
+    };
+
+    // ============================================================================
+    // Gate Sink
+    // ============================================================================
+
+    // Holds the backend thread inside Write until the gate opens, so tests can
+    // fill producer rings deterministically
+    class GateSink : public Akhanda::Logging::ILogSink {
+    public:
+        struct Gate {
+            std::mutex mutex;
+            std::condition_variable changed;
+            bool open = false;
+            bool entered = false;
+
+            void Open() {
+                { std::lock_guard<std::mutex> lock(mutex); open = true; }
+                changed.notify_all();
+            }
+
+            void WaitUntilEntered() {
+                std::unique_lock<std::mutex> lock(mutex);
+                changed.wait(lock, [this] { return entered; });
+            }
+        };
+
+        explicit GateSink(std::shared_ptr<Gate> gate)
+            : gate_(std::move(gate)) {
+        }
+
+        void Write(const Akhanda::Logging::LogEntry&) override {
+            std::unique_lock<std::mutex> lock(gate_->mutex);
+            gate_->entered = true;
+            gate_->changed.notify_all();
+            gate_->changed.wait(lock, [this] { return gate_->open; });
+        }
+
+        void Flush() override {}
+        void SetLevel(Akhanda::Logging::LogLevel level) override { level_ = level; }
+        Akhanda::Logging::LogLevel GetLevel() const override { return level_; }
+        std::string_view GetName() const override { return "Gate"; }
+
+    private:
+        std::shared_ptr<Gate> gate_;
+        Akhanda::Logging::LogLevel level_ = Akhanda::Logging::LogLevel::Trace;
+    };
+
+    // ============================================================================
+    // Base Logging Test Fixture
+    // ============================================================================
+
+    // Initializes LogManager without console output and attaches a capture sink
+    class LoggingTestFixture : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            auto& manager = Akhanda::Logging::LogManager::Instance();
+            manager.SetDefaultSinksEnabled(false);
+            manager.Initialize();
+            manager.SetDeferredFormatting(true);
+
+            captured_ = std::make_shared<CaptureSink::Captured>();
+            auto sink = std::make_unique<CaptureSink>(captured_);
+            sink_ = sink.get();
+            manager.AddSink(std::move(sink));
+        }
+
+        void TearDown() override {
+            auto& manager = Akhanda::Logging::LogManager::Instance();
+            manager.Flush();
+            manager.RemoveSink(sink_);
+            manager.SetDeferredFormatting(true);
+            manager.SetRingPolicy(Akhanda::Logging::LogRingPolicy::Block);
+            manager.SetRingCapacity(Akhanda::Logging::DEFAULT_LOG_RING_CAPACITY);
+        }
+
+        std::vector<std::string> CapturedMessages() {
+            Akhanda::Logging::LogManager::Instance().Flush();
+            std::lock_guard<std::mutex> lock(captured_->mutex);
+            return captured_->messages;
+        }
+
+        std::vector<std::string> CapturedLines() {
+            Akhanda::Logging::LogManager::Instance().Flush();
+            std::lock_guard<std::mutex> lock(captured_->mutex);
+            return captured_->lines;
+        }
+
+        // spdlog's async flush does not wait for its queue, so messages logged
+        // with deferred formatting off can arrive after Flush returns
+        void WaitForCaptured(size_t count) {
+            Akhanda::Logging::LogManager::Instance().Flush();
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (std::chrono::steady_clock::now() < deadline) {
+                {
+                    std::lock_guard<std::mutex> lock(captured_->mutex);
+                    if (captured_->messages.size() >= count) return;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+        std::vector<std::chrono::high_resolution_clock::time_point> CapturedTimestamps() {
+            Akhanda::Logging::LogManager::Instance().Flush();
+            std::lock_guard<std::mutex> lock(captured_->mutex);
+            return captured_->timestamps;
+        }
+
+        void ClearCaptured() {
+            Akhanda::Logging::LogManager::Instance().Flush();
+            std::lock_guard<std::mutex> lock(captured_->mutex);
+            captured_->messages.clear();
+            captured_->lines.clear();
+            captured_->levels.clear();
+            captured_->timestamps.clear();
+        }
+
+        std::shared_ptr<CaptureSink::Captured> captured_;
+        CaptureSink* sink_ = nullptr;
+    };
+
+    // ============================================================================
+    // Allocation Counting
+    // ============================================================================
+
+    // Counts heap allocations made by the calling thread between the two
+    // calls. AllocationCounter.cpp replaces operator new for the whole test
+    // binary; other threads are never counted.
+    void BeginCountingAllocations() noexcept;
+    size_t EndCountingAllocations() noexcept;
+
+    // Heap bytes the calling thread held at the busiest point of its last
+    // counting window, beyond those held when the window began
+    size_t GetPeakAllocatedBytes() noexcept;
+
+}
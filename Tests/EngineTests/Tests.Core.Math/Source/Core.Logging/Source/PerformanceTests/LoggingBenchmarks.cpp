@@ -0,0 +1,477 @@
+// Tests/Core.Logging/Source/PerformanceTests/LoggingBenchmarks.cpp
+// Benchmarks for the logging hot paths: the caller's cost per statement,
+// per-call latency percentiles, sustained throughput by producer count, a
+// channel's cost beside a rate-limited runaway site, the CPU each sink type
+// costs the backend and the editor log store's indexed search against a scan. Results are printed and, with
+// --benchmark=record|compare, stored in or checked against
+// Data/BenchmarkData.json like the math benchmarks.
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Every level is compiled in, whatever the configuration
+#define AKH_LOG_COMPILE_LEVEL 0
+
+import Akhanda.Core.Logging;
+#include "Core/Logging/Core.Logging.hpp"
+#include "Core/Logging/EditorLogStore.hpp"
+#include "Core/Logging/EditorSink.hpp"
+#include "../Fixtures/LoggingTestFixtures.hpp"
+#include "../../../Core.Math/Source/Utils/PerformanceTestUtils.hpp"
+
+using namespace Akhanda::Tests::Math;
+using namespace Akhanda::Logging;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    // Counts and discards, so the numbers show the logging path and not I/O
+    class CountingSink : public ILogSink {
+    public:
+        void Write(const LogEntry&) override { written_.fetch_add(1, std::memory_order_relaxed); }
+        void Flush() override {}
+        void SetLevel(LogLevel level) override { level_ = level; }
+        LogLevel GetLevel() const override { return level_; }
+        std::string_view GetName() const override { return "Counting"; }
+
+        uint64_t Written() const { return written_.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<uint64_t> written_{ 0 };
+        LogLevel level_ = LogLevel::Trace;
+    };
+
+    class LoggingBenchmarks : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            auto& manager = LogManager::Instance();
+            manager.SetDefaultSinksEnabled(false);
+            manager.Initialize();
+
+            auto sink = std::make_unique<CountingSink>();
+            sink_ = sink.get();
+            manager.AddSink(std::move(sink));
+
+            channel_ = &manager.GetChannel("LoggingBenchmarks");
+            channel_->SetLevel(LogLevel::Trace);
+        }
+
+        void TearDown() override {
+            auto& manager = LogManager::Instance();
+            manager.Flush();
+            if (sink_) {
+                manager.RemoveSink(sink_);
+            }
+            channel_->SetLevel(LogLevel::Debug);
+            manager.SetDeferredFormatting(true);
+            manager.SetRingPolicy(LogRingPolicy::Block);
+            manager.SetRingCapacity(DEFAULT_LOG_RING_CAPACITY);
+        }
+
+        static void Report(const std::vector<BenchmarkResult>& results) {
+            for (const std::string& failure : ProcessBenchmarkResults(results)) {
+                ADD_FAILURE() << failure;
+            }
+        }
+
+        // The statement every throughput and backend run logs
+        void LogAsset(uint32_t frame) const {
+            channel_->LogFormat(LogLevel::Info, "Streamed {} in {:.2f} ms (frame {}, {} bytes)",
+                std::string_view("Characters/Hero/Body_Albedo.dds"), 1.25f, frame, uint64_t(4194304));
+        }
+
+        // Heap allocations the calling thread makes per call, after a warmup
+        // that lets rings and thread-local buffers reach their steady size
+        template<typename Func>
+        static double AllocationsPerCall(Func&& func) {
+            constexpr int CALLS = 1000;
+            for (int i = 0; i < CALLS; ++i) {
+                func();
+            }
+            LogManager::Instance().Flush();
+
+            Akhanda::Tests::Logging::BeginCountingAllocations();
+            for (int i = 0; i < CALLS; ++i) {
+                func();
+            }
+            const size_t allocations = Akhanda::Tests::Logging::EndCountingAllocations();
+            LogManager::Instance().Flush();
+            return static_cast<double>(allocations) / CALLS;
+        }
+
+        // Waits until `delivered` reports every record, since spdlog's async
+        // flush does not wait for its queue
+        static void WaitForDelivery(const std::function<uint64_t()>& delivered, uint64_t expected) {
+            LogManager::Instance().Flush();
+            const auto start = Clock::now();
+            while (delivered() < expected && Clock::now() - start < std::chrono::seconds(10)) {
+                std::this_thread::yield();
+            }
+            EXPECT_GE(delivered(), expected);
+        }
+
+        CountingSink* sink_ = nullptr;
+        LogChannel* channel_ = nullptr;
+    };
+
+    // ============================================================================
+    // Caller-Side Cost
+    // ============================================================================
+
+    TEST_F(LoggingBenchmarks, CallerCost) {
+        auto& manager = LogManager::Instance();
+        const ChannelHandle disabled = manager.RegisterChannel("LoggingBenchmarksDisabled");
+        disabled.Get().SetLevel(LogLevel::Fatal);
+        uint32_t frame = 0;
+
+        // The body is passed straight to RunBenchmark, so disabled statements
+        // are not measured behind an indirect call
+        std::vector<BenchmarkResult> results;
+        const auto measure = [&](const char* name, bool deferred, bool allocationFree, auto&& call) {
+            manager.SetDeferredFormatting(deferred);
+            manager.SetRingPolicy(LogRingPolicy::Block);
+            const double allocations = AllocationsPerCall(call);
+
+            // Growing rings keep the backend's formatting off the measured path
+            manager.SetRingPolicy(LogRingPolicy::Grow);
+            results.push_back(RunBenchmark(name, 1, call));
+            manager.Flush();
+
+            std::cout << "[PERF] " << name << ": " << allocations << " allocations/call" << std::endl;
+            if (allocationFree) {
+                EXPECT_EQ(allocations, 0.0) << name;
+            }
+        };
+
+        measure("Logging/Disabled/Channel", true, true, [&] { LOG_ERROR_FORMAT(disabled.Get(), "Frame {} late", frame++); });
+        measure("Logging/Disabled/Handle", true, true, [&] { LOG_ERROR_FORMAT(disabled, "Frame {} late", frame++); });
+        measure("Logging/ChannelLookup", true, false, [&] { DoNotOptimize(manager.GetChannel("LoggingBenchmarks")); });
+        measure("Logging/Log/Deferred", true, true, [&] { channel_->Log(LogLevel::Info, "Frame submitted to the render queue"); });
+        measure("Logging/Log/Immediate", false, false, [&] { channel_->Log(LogLevel::Info, "Frame submitted to the render queue"); });
+        measure("Logging/LogFormat/Deferred", true, true, [&] { LogAsset(frame++); });
+        measure("Logging/LogFormat/Immediate", false, false, [&] { LogAsset(frame++); });
+        measure("Logging/Event/Deferred", true, true, [&] {
+            channel_->Log(LogLevel::Info, "FrameEnd", Field("frame", frame++), Field("ms", 16.5), Field("pass", "shadow"));
+        });
+
+        Report(results);
+    }
+
+    // ============================================================================
+    // Latency Percentiles
+    // ============================================================================
+
+    TEST_F(LoggingBenchmarks, CallerLatency) {
+        constexpr size_t CALLS = 100000;
+        auto& manager = LogManager::Instance();
+        manager.SetRingPolicy(LogRingPolicy::Block);
+
+        std::vector<BenchmarkResult> results;
+        for (const bool deferred : { true, false }) {
+            manager.SetDeferredFormatting(deferred);
+            for (uint32_t i = 0; i < 1000; ++i) {
+                LogAsset(i);
+            }
+            manager.Flush();
+
+            // One sample per call, so the tail shows ring waits and contention
+            std::vector<double> sampleNs;
+            std::vector<double> sampleTicks;
+            sampleNs.reserve(CALLS);
+            sampleTicks.reserve(CALLS);
+            for (size_t i = 0; i < CALLS; ++i) {
+                const auto start = Clock::now();
+                const uint64_t startTicks = ReadTimestampCounter();
+                LogAsset(static_cast<uint32_t>(i));
+                const uint64_t endTicks = ReadTimestampCounter();
+                sampleNs.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+                sampleTicks.push_back(static_cast<double>(endTicks - startTicks));
+            }
+            manager.Flush();
+
+            std::vector<double> sorted = sampleNs;
+            std::sort(sorted.begin(), sorted.end());
+            const auto percentile = [&sorted](double rank) {
+                return sorted[std::min(sorted.size() - 1, static_cast<size_t>(rank * sorted.size()))];
+            };
+
+            const char* name = deferred ? "Logging/Latency/Deferred" : "Logging/Latency/Immediate";
+            results.push_back(SummarizeSamples(name, 1, 1, std::move(sampleNs), std::move(sampleTicks)));
+            std::cout << std::fixed << std::setprecision(0) << "[PERF] " << name << ": p50 " << percentile(0.50)
+                << " ns, p99 " << percentile(0.99) << " ns, p99.9 " << percentile(0.999) << " ns, max "
+                << sorted.back() << " ns" << std::defaultfloat << std::endl;
+        }
+
+        Report(results);
+    }
+
+    // ============================================================================
+    // Throughput
+    // ============================================================================
+
+    TEST_F(LoggingBenchmarks, Throughput) {
+        constexpr int RECORDS_PER_THREAD = 20000;
+        constexpr int RUNS = 5;
+        auto& manager = LogManager::Instance();
+        manager.SetRingPolicy(LogRingPolicy::Block);
+
+        std::vector<BenchmarkResult> results;
+        for (const int threadCount : { 1, 2, 4, 8 }) {
+            const uint64_t records = uint64_t(threadCount) * RECORDS_PER_THREAD;
+
+            // Wall time per record, from the first call until the sink saw the last
+            std::vector<double> sampleNs;
+            for (int run = 0; run < RUNS; ++run) {
+                std::atomic<int> ready{ 0 };
+                std::atomic<bool> go{ false };
+                const uint64_t writtenBefore = sink_->Written();
+
+                std::vector<std::thread> threads;
+                for (int t = 0; t < threadCount; ++t) {
+                    threads.emplace_back([&] {
+                        ready.fetch_add(1);
+                        while (!go.load(std::memory_order_acquire)) {
+                            std::this_thread::yield();
+                        }
+                        for (int i = 0; i < RECORDS_PER_THREAD; ++i) {
+                            LogAsset(static_cast<uint32_t>(i));
+                        }
+                    });
+                }
+                while (ready.load() != threadCount) {
+                    std::this_thread::yield();
+                }
+
+                const auto start = Clock::now();
+                go.store(true, std::memory_order_release);
+                for (std::thread& thread : threads) {
+                    thread.join();
+                }
+                WaitForDelivery([&] { return sink_->Written() - writtenBefore; }, records);
+                sampleNs.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count() / static_cast<double>(records));
+            }
+
+            const BenchmarkResult result = SummarizeSamples("Logging/Throughput/" + std::to_string(threadCount) + "T", 1, 1, sampleNs, {});
+            std::cout << std::fixed << std::setprecision(0) << "[PERF] " << result.name << ": "
+                << 1e9 / result.medianNs << " messages/s" << std::defaultfloat << std::endl;
+            results.push_back(result);
+        }
+
+        Report(results);
+    }
+
+    // ============================================================================
+    // Rate Limiting
+    // ============================================================================
+
+    TEST_F(LoggingBenchmarks, SteadyChannelBesideRunawaySite) {
+        constexpr int RECORDS = 20000;
+        constexpr int RUNS = 5;
+        auto& manager = LogManager::Instance();
+        manager.SetDeferredFormatting(true);
+        manager.SetRingPolicy(LogRingPolicy::Block);
+        LogChannel& runaway = manager.GetChannel("LoggingBenchmarksRunaway");
+        runaway.SetRateLimit(LogLevel::Warning, { 10, 5 });
+
+        // CPU time of this thread per record, so time the spinner spends on
+        // the core is not counted
+        const auto steadyNs = [&](bool spin) {
+            std::vector<double> sampleNs;
+            for (int run = 0; run < RUNS; ++run) {
+                std::atomic<bool> stop{ false };
+                std::atomic<uint64_t> calls{ 0 };
+                std::thread spinner;
+                if (spin) {
+                    spinner = std::thread([&] {
+                        while (!stop.load(std::memory_order_relaxed)) {
+                            LOG_WARNING_FORMAT(runaway, "Texture {} missing, using fallback", 42);
+                            calls.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    });
+                    while (calls.load() < 1000) {
+                        std::this_thread::yield();
+                    }
+                }
+
+                const double start = ThreadCpuTimeNs();
+                for (int i = 0; i < RECORDS; ++i) {
+                    LogAsset(static_cast<uint32_t>(i));
+                }
+                sampleNs.push_back((ThreadCpuTimeNs() - start) / RECORDS);
+                stop.store(true);
+                if (spinner.joinable()) spinner.join();
+                manager.Flush();
+            }
+            return sampleNs;
+        };
+
+        steadyNs(false); // Warms the ring and the backend
+        std::vector<BenchmarkResult> results;
+        results.push_back(SummarizeSamples("Logging/RateLimit/SteadyAlone", 1, 1, steadyNs(false), {}));
+        results.push_back(SummarizeSamples("Logging/RateLimit/SteadyBesideRunaway", 1, 1, steadyNs(true), {}));
+        runaway.SetRateLimit(LogLevel::Warning, LogRateLimit{});
+
+        for (const BenchmarkResult& result : results) {
+            std::cout << std::fixed << std::setprecision(1) << "[PERF] " << result.name << ": "
+                << result.medianNs << " caller CPU ns/record" << std::defaultfloat << std::endl;
+        }
+        Report(results);
+    }
+
+    // ============================================================================
+    // Backend Cost per Sink
+    // ============================================================================
+
+    TEST_F(LoggingBenchmarks, BackendCpuPerSink) {
+        constexpr uint64_t RECORDS = 20000;
+        constexpr int RUNS = 5;
+        auto& manager = LogManager::Instance();
+        manager.SetDeferredFormatting(true);
+        manager.SetRingPolicy(LogRingPolicy::Block);
+        const std::filesystem::path directory = std::filesystem::temp_directory_path();
+
+        // CPU the rest of the process spent per record: every thread's time
+        // minus the caller's, until the records reached their sink. Without
+        // `delivered`, Flush returning is enough.
+        const auto backendNs = [&](const std::function<uint64_t()>& delivered) {
+            std::vector<double> sampleNs;
+            for (int run = 0; run < RUNS; ++run) {
+                const uint64_t before = delivered ? delivered() : 0;
+                const double processStart = ProcessCpuTimeNs();
+                const double callerStart = ThreadCpuTimeNs();
+                for (uint64_t i = 0; i < RECORDS; ++i) {
+                    LogAsset(static_cast<uint32_t>(i));
+                }
+                if (delivered) {
+                    WaitForDelivery([&] { return delivered() - before; }, RECORDS);
+                }
+                else {
+                    manager.Flush();
+                }
+                const double callerNs = ThreadCpuTimeNs() - callerStart;
+                const double processNs = ProcessCpuTimeNs() - processStart;
+                sampleNs.push_back(std::max(0.0, processNs - callerNs) / static_cast<double>(RECORDS));
+            }
+            return sampleNs;
+        };
+
+        std::vector<BenchmarkResult> results;
+        const auto addResult = [&](const char* name, std::vector<double> sampleNs) {
+            results.push_back(SummarizeSamples(name, 1, 1, std::move(sampleNs), {}));
+            std::cout << std::fixed << std::setprecision(1) << "[PERF] " << name << ": " << results.back().medianNs
+                << " backend CPU ns/record" << std::defaultfloat << std::endl;
+        };
+
+        // Text sinks sit behind spdlog; the counting sink is always attached
+        // and shows when the queue has drained, so Null is their floor
+        addResult("Logging/Backend/Null", backendNs([&] { return sink_->Written(); }));
+
+        {
+            auto mapped = std::make_unique<MappedLogSink>(directory / "AkhandaLoggingBenchmarks.akhring");
+            ASSERT_TRUE(mapped->IsOpen());
+            MappedLogSink* mappedSink = mapped.get();
+            manager.AddSink(std::move(mapped));
+            addResult("Logging/Backend/Mapped", backendNs([&] { return mappedSink->GetSequence(); }));
+            manager.RemoveSink(mappedSink);
+            std::filesystem::remove(directory / "AkhandaLoggingBenchmarks.akhring");
+        }
+
+        {
+            AdvancedEditorSink::Config config;
+            config.asyncProcessing = false;
+            config.enableCollapsing = false;
+            config.maxMessages = RECORDS * RUNS;
+            AdvancedEditorSink editor(config);
+            editor.RegisterWithLogManager();
+            addResult("Logging/Backend/Editor", backendNs([&] { return uint64_t(editor.GetMessageCount()); }));
+            editor.UnregisterFromLogManager();
+        }
+
+        // Without text sinks the backend hands records over unformatted
+        manager.RemoveSink(sink_);
+        sink_ = nullptr;
+        const auto recordSinkNs = [&](const char* name, std::unique_ptr<ILogRecordSink> sink, const std::filesystem::path& path) {
+            ILogRecordSink* recordSink = sink.get();
+            manager.AddRecordSink(std::move(sink));
+            addResult(name, backendNs(nullptr));
+            manager.RemoveRecordSink(recordSink);
+            std::filesystem::remove(path);
+        };
+        const std::filesystem::path binaryPath = directory / "AkhandaLoggingBenchmarks.akhlog";
+        const std::filesystem::path jsonPath = directory / "AkhandaLoggingBenchmarks.jsonl";
+        recordSinkNs("Logging/Backend/Binary", std::make_unique<BinaryLogSink>(binaryPath), binaryPath);
+        recordSinkNs("Logging/Backend/Json", std::make_unique<JsonLogSink>(jsonPath), jsonPath);
+
+        Report(results);
+    }
+
+    // ============================================================================
+    // Editor Log Store
+    // ============================================================================
+
+    TEST_F(LoggingBenchmarks, EditorStoreSearch) {
+        constexpr size_t MESSAGES = 100000;
+
+        // One asset in a hundred is the one being searched for
+        std::vector<EditorLogMessage> messages(MESSAGES);
+        for (size_t i = 0; i < MESSAGES; ++i) {
+            messages[i].level = static_cast<LogLevel>(i % 5 + 1);
+            messages[i].channel = i % 3 == 0 ? "Renderer" : "Streaming";
+            messages[i].message = std::format("Streamed Characters/{}/Body_Albedo.dds in {:.2f} ms (frame {})",
+                i % 100 == 0 ? "Boss" : "Npc" + std::to_string(i % 97), 1.25f, i);
+        }
+
+        EditorLogStore store(MESSAGES);
+        for (const EditorLogMessage& message : messages) {
+            store.Add(message, message.level <= LogLevel::Info);
+        }
+
+        // A ring a quarter of the size, so every add evicts a message and
+        // none collapses into one still stored
+        std::vector<BenchmarkResult> results;
+        EditorLogStore ring(MESSAGES / 4);
+        size_t next = 0;
+        results.push_back(RunBenchmark("Logging/EditorStore/Add", 1, [&] {
+            const EditorLogMessage& message = messages[next];
+            next = (next + 1) % MESSAGES;
+            DoNotOptimize(ring.Add(message, message.level <= LogLevel::Info));
+        }));
+
+        // Two different searches per call, so neither narrows the other's view
+        EditorLogStore::Filter other;
+        other.text = "Npc42/Body";
+        EditorLogStore::Filter search;
+        search.text = "Boss/Body";
+        results.push_back(RunBenchmark("Logging/EditorStore/IndexedSearch", 2, [&] {
+            store.SetFilter(other);
+            store.SetFilter(search);
+        }));
+
+        // What filtering every stored message costs
+        size_t scanned = 0;
+        results.push_back(RunBenchmark("Logging/EditorStore/Scan", 1, [&] {
+            scanned = 0;
+            for (const EditorLogMessage& message : messages) {
+                scanned += message.message.find(search.text) != std::string::npos;
+            }
+            DoNotOptimize(scanned);
+        }));
+
+        EXPECT_EQ(store.GetVisibleCount(), scanned);
+        Report(results);
+    }
+
+}
@@ -0,0 +1,384 @@
+// Tests/Core.Logging/Source/PerformanceTests/LoggingPerformanceTests.cpp
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+import Akhanda.Core.Logging;
+#include "Core/Logging/Core.Logging.hpp"
+#include "../../../Core.Math/Source/Utils/PerformanceTestUtils.hpp"
+
+using namespace Akhanda::Tests::Math;
+using namespace Akhanda::Logging;
+
+namespace {
+
+    // Discards everything, so the numbers show the logging path and not I/O
+    class NullSink : public ILogSink {
+    public:
+        void Write(const LogEntry&) override { written_.fetch_add(1, std::memory_order_relaxed); }
+        void Flush() override {}
+        void SetLevel(LogLevel level) override { level_ = level; }
+        LogLevel GetLevel() const override { return level_; }
+        std::string_view GetName() const override { return "Null"; }
+
+        uint64_t Written() const { return written_.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<uint64_t> written_{ 0 };
+        LogLevel level_ = LogLevel::Trace;
+    };
+
+    class LoggingPerformanceTests : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            auto& manager = LogManager::Instance();
+            manager.SetDefaultSinksEnabled(false);
+            manager.Initialize();
+
+            auto sink = std::make_unique<NullSink>();
+            sink_ = sink.get();
+            manager.AddSink(std::move(sink));
+        }
+
+        void TearDown() override {
+            auto& manager = LogManager::Instance();
+            manager.Flush();
+            manager.RemoveSink(sink_);
+            manager.SetDeferredFormatting(true);
+            manager.SetRingPolicy(LogRingPolicy::Block);
+            manager.SetRingCapacity(DEFAULT_LOG_RING_CAPACITY);
+        }
+
+        static void PrintResult(const BenchmarkResult& result) {
+            std::cout << "[PERF] " << result.name << ": median " << result.medianNs << " ns/call, p95 "
+                << result.p95Ns << " ns/call" << std::endl;
+        }
+
+        struct ProducerRun {
+            double recordsPerSecond = 0.0;
+            double p50Ns = 0.0;
+            double p99Ns = 0.0;
+            double p999Ns = 0.0;
+        };
+
+        // Every thread logs the same number of records; latency is per call on
+        // the producer, throughput is until the sinks have seen every record
+        ProducerRun RunProducers(const LogChannel& channel, int threadCount, int recordsPerThread) {
+            using Clock = std::chrono::steady_clock;
+            std::vector<std::vector<float>> latencies(threadCount);
+            std::atomic<int> ready{ 0 };
+            std::atomic<bool> go{ false };
+            const uint64_t writtenBefore = sink_->Written();
+
+            std::vector<std::thread> threads;
+            for (int t = 0; t < threadCount; ++t) {
+                threads.emplace_back([&, t] {
+                    std::vector<float>& samples = latencies[t];
+                    samples.reserve(recordsPerThread);
+                    ready.fetch_add(1);
+                    while (!go.load(std::memory_order_acquire)) {
+                        std::this_thread::yield();
+                    }
+
+                    for (int i = 0; i < recordsPerThread; ++i) {
+                        const auto start = Clock::now();
+                        channel.LogFormat(LogLevel::Info, "Job {} finished batch {} ({:.1f} us)", t, i, 12.5f);
+                        samples.push_back(std::chrono::duration<float, std::nano>(Clock::now() - start).count());
+                    }
+                });
+            }
+
+            while (ready.load() != threadCount) {
+                std::this_thread::yield();
+            }
+            const auto start = Clock::now();
+            go.store(true, std::memory_order_release);
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+            LogManager::Instance().Flush();
+
+            // spdlog's async flush does not wait for its queue, so wait for the sink
+            const uint64_t expected = uint64_t(threadCount) * recordsPerThread;
+            while (sink_->Written() - writtenBefore < expected && Clock::now() - start < std::chrono::seconds(10)) {
+                std::this_thread::yield();
+            }
+            const double elapsedSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+            std::vector<float> all;
+            for (const std::vector<float>& samples : latencies) {
+                all.insert(all.end(), samples.begin(), samples.end());
+            }
+            std::sort(all.begin(), all.end());
+            const auto percentile = [&all](double rank) {
+                return static_cast<double>(all[std::min(all.size() - 1, static_cast<size_t>(rank * all.size()))]);
+            };
+
+            EXPECT_EQ(sink_->Written() - writtenBefore, expected);
+
+            ProducerRun run;
+            run.recordsPerSecond = static_cast<double>(all.size()) / elapsedSeconds;
+            run.p50Ns = percentile(0.50);
+            run.p99Ns = percentile(0.99);
+            run.p999Ns = percentile(0.999);
+            return run;
+        }
+
+        NullSink* sink_ = nullptr;
+    };
+
+    // ============================================================================
+    // Caller-Side Cost
+    // ============================================================================
+
+    // Printed for comparison only. One timing comparison flakes on a shared
+    // machine; LoggingBenchmarks times both paths for --benchmark=record|compare.
+    TEST_F(LoggingPerformanceTests, LogFormat_CallerCost_DeferredVsImmediate) {
+        auto& manager = LogManager::Instance();
+        const LogChannel& channel = manager.GetChannel("LoggingPerformance");
+        const std::string assetName = "Characters/Hero/Body_Albedo.dds";
+        uint32_t frame = 0;
+
+        auto logCall = [&] {
+            channel.LogFormat(LogLevel::Info, "Streamed {} in {:.2f} ms (frame {}, {} bytes)", assetName, 1.25f, frame++, uint64_t(4194304));
+        };
+
+        manager.SetDeferredFormatting(false);
+        const BenchmarkResult immediate = RunBenchmark("LogFormat/Immediate", 1, logCall);
+        manager.Flush();
+
+        // Growing rings keep the backend's formatting off the measured path;
+        // sustained rates are measured by the producer scaling benchmark
+        manager.SetDeferredFormatting(true);
+        manager.SetRingPolicy(LogRingPolicy::Grow);
+        const BenchmarkResult deferred = RunBenchmark("LogFormat/Deferred", 1, logCall);
+        manager.Flush();
+
+        PrintResult(immediate);
+        PrintResult(deferred);
+        std::cout << "[PERF] Deferred formatting speedup on the caller: " << immediate.medianNs / deferred.medianNs << "x" << std::endl;
+    }
+
+    TEST_F(LoggingPerformanceTests, Log_CallerCost_DeferredVsImmediate) {
+        auto& manager = LogManager::Instance();
+        const LogChannel& channel = manager.GetChannel("LoggingPerformance");
+
+        auto logCall = [&] {
+            channel.Log(LogLevel::Info, "Frame submitted to the render queue");
+        };
+
+        manager.SetDeferredFormatting(false);
+        const BenchmarkResult immediate = RunBenchmark("Log/Immediate", 1, logCall);
+        manager.Flush();
+
+        manager.SetDeferredFormatting(true);
+        manager.SetRingPolicy(LogRingPolicy::Grow);
+        const BenchmarkResult deferred = RunBenchmark("Log/Deferred", 1, logCall);
+        manager.Flush();
+
+        PrintResult(immediate);
+        PrintResult(deferred);
+    }
+
+    // ============================================================================
+    // Disabled Statements
+    // ============================================================================
+
+    // Printed only, as above; see Logging/Disabled/* in LoggingBenchmarks
+    TEST_F(LoggingPerformanceTests, DisabledStatement_HandleVsNameLookup) {
+        auto& manager = LogManager::Instance();
+        const ChannelHandle handle = manager.RegisterChannel("LoggingPerformanceDisabled");
+        handle.Get().SetLevel(LogLevel::Fatal);
+        uint32_t frame = 0;
+
+        const BenchmarkResult empty = RunBenchmark("Disabled/Empty", 1, [&] {
+            DoNotOptimize(++frame);
+        });
+        const BenchmarkResult viaHandle = RunBenchmark("Disabled/Handle", 1, [&] {
+            LOG_ERROR_FORMAT(handle, "Frame {} late", frame);
+            DoNotOptimize(++frame);
+        });
+        const BenchmarkResult viaLookup = RunBenchmark("Disabled/NameLookup", 1, [&] {
+            LOG_ERROR_FORMAT(manager.GetChannel("LoggingPerformanceDisabled"), "Frame {} late", frame);
+            DoNotOptimize(++frame);
+        });
+
+        PrintResult(empty);
+        PrintResult(viaHandle);
+        PrintResult(viaLookup);
+        std::cout << "[PERF] Disabled statement through a handle: " << viaHandle.medianNs - empty.medianNs
+            << " ns over an empty loop" << std::endl;
+    }
+
+    // ============================================================================
+    // Binary Log Sink
+    // ============================================================================
+
+    TEST_F(LoggingPerformanceTests, BinarySink_BytesAndCostVsText) {
+        auto& manager = LogManager::Instance();
+        const LogChannel& channel = manager.GetChannel("LoggingPerformance");
+        const std::string assetName = "Characters/Hero/Body_Albedo.dds";
+        constexpr int RECORDS = 50000;
+        manager.SetRingPolicy(LogRingPolicy::Grow);
+
+        // Caller and backend together, until every record reached its sink
+        const auto nsPerRecord = [&] {
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < RECORDS; ++i) {
+                channel.LogFormat(LogLevel::Info, "Streamed {} in {:.2f} ms (frame {}, {} bytes)", assetName, 1.25f, i, uint64_t(4194304));
+            }
+            manager.Flush();
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / RECORDS;
+        };
+
+        const uint64_t textBytesBefore = manager.GetStatistics().bytesWritten.load();
+        const double textNs = nsPerRecord();
+        const double textBytes = static_cast<double>(manager.GetStatistics().bytesWritten.load() - textBytesBefore) / RECORDS;
+
+        // Without text sinks the backend never formats
+        manager.RemoveSink(sink_);
+        sink_ = nullptr;
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "AkhandaLoggingPerformance.akhlog";
+        auto binary = std::make_unique<BinaryLogSink>(path);
+        BinaryLogSink* binarySink = binary.get();
+        manager.AddRecordSink(std::move(binary));
+
+        const double binaryNs = nsPerRecord();
+        const double binaryBytes = static_cast<double>(binarySink->GetBytesWritten()) / RECORDS;
+        manager.RemoveRecordSink(binarySink);
+        std::filesystem::remove(path);
+
+        std::cout << std::fixed << std::setprecision(1)
+            << "[PERF] Text sink:   " << textNs << " ns/record, " << textBytes << " message bytes/record (before timestamp and prefix)" << std::endl
+            << "[PERF] Binary sink: " << binaryNs << " ns/record, " << binaryBytes << " file bytes/record" << std::endl
+            << std::defaultfloat;
+
+        // The times are printed only; Logging/Backend/* in LoggingBenchmarks
+        // times each sink for --benchmark=record|compare
+        EXPECT_LT(binaryBytes, textBytes);
+    }
+
+    // ============================================================================
+    // Rate Limiting
+    // ============================================================================
+
+    TEST_F(LoggingPerformanceTests, RateLimit_RunawaySiteVsOtherChannels) {
+        auto& manager = LogManager::Instance();
+        LogChannel& runaway = manager.GetChannel("Runaway");
+        const LogChannel& steady = manager.GetChannel("Steady");
+        constexpr int STEADY_RECORDS = 20000;
+        constexpr int RUNS = 5;
+
+        struct Run {
+            double steadyNs = 0.0;
+            uint64_t runawayCalls = 0;
+            uint64_t written = 0;
+        };
+
+        // This thread logs a fixed amount on one channel, optionally while
+        // another spins on a single statement. The steady cost is CPU time of
+        // this thread, so time the spinner spends on the core is not counted.
+        const auto runOnce = [&](bool spin) {
+            std::atomic<bool> stop{ false };
+            std::atomic<uint64_t> calls{ 0 };
+            const uint64_t writtenBefore = sink_->Written();
+            std::thread spinner;
+            if (spin) {
+                spinner = std::thread([&] {
+                    while (!stop.load(std::memory_order_relaxed)) {
+                        LOG_WARNING_FORMAT(runaway, "Texture {} missing, using fallback", 42);
+                        calls.fetch_add(1, std::memory_order_relaxed);
+                    }
+                });
+                while (calls.load() < 1000) {
+                    std::this_thread::yield();
+                }
+            }
+
+            const double start = ThreadCpuTimeNs();
+            for (int i = 0; i < STEADY_RECORDS; ++i) {
+                LOG_WARNING_FORMAT(steady, "Frame {} took {:.2f} ms", i, 16.6f);
+            }
+            Run result;
+            result.steadyNs = (ThreadCpuTimeNs() - start) / STEADY_RECORDS;
+            stop.store(true);
+            if (spinner.joinable()) spinner.join();
+            manager.Flush();
+            result.runawayCalls = calls.load();
+            result.written = sink_->Written() - writtenBefore;
+            return result;
+        };
+
+        // Median steady cost over several runs; counts come from the last
+        const auto run = [&](bool spin) {
+            std::vector<double> costs;
+            Run result;
+            for (int i = 0; i < RUNS; ++i) {
+                result = runOnce(spin);
+                costs.push_back(result.steadyNs);
+            }
+            std::sort(costs.begin(), costs.end());
+            result.steadyNs = costs[RUNS / 2];
+            return result;
+        };
+
+        runOnce(false); // Warms the ring and the backend
+        const Run alone = run(false);
+        const Run unlimited = run(true);
+        runaway.SetRateLimit(LogLevel::Warning, { 10, 5 });
+        const Run limited = run(true);
+        runaway.SetRateLimit(LogLevel::Warning, LogRateLimit{});
+
+        // The limited runaway statement reaches the sinks a handful of times
+        const auto perCall = [](const Run& run) { return static_cast<double>(run.written) / (run.runawayCalls + STEADY_RECORDS); };
+        std::cout << std::fixed << std::setprecision(1)
+            << "[PERF] Steady channel beside a runaway site: alone " << alone.steadyNs << " ns/call, unlimited "
+            << unlimited.steadyNs << " ns/call (" << unlimited.runawayCalls << " runaway calls, " << std::setprecision(2)
+            << perCall(unlimited) << " written/call), limited " << std::setprecision(1) << limited.steadyNs << " ns/call ("
+            << limited.runawayCalls << " runaway calls, " << std::setprecision(2) << perCall(limited) << " written/call)"
+            << std::endl << std::defaultfloat;
+
+        EXPECT_LT(limited.written, STEADY_RECORDS + 100u);
+        EXPECT_GT(limited.runawayCalls, limited.written - STEADY_RECORDS);
+
+        // The steady channel loses nothing. Its cost is only printed here;
+        // LoggingBenchmarks times it for --benchmark=record|compare.
+        EXPECT_GE(limited.written, static_cast<uint64_t>(STEADY_RECORDS));
+    }
+
+    // ============================================================================
+    // Producer Scaling
+    // ============================================================================
+
+    TEST_F(LoggingPerformanceTests, Producers_ThroughputAndTailLatency) {
+        auto& manager = LogManager::Instance();
+        const LogChannel& channel = manager.GetChannel("LoggingPerformance");
+        constexpr int RECORDS_PER_THREAD = 2000;
+
+        for (const int threads : { 1, 2, 4, 8, 16, 32 }) {
+            manager.SetDeferredFormatting(false);
+            const ProducerRun immediate = RunProducers(channel, threads, RECORDS_PER_THREAD);
+
+            manager.SetDeferredFormatting(true);
+            const ProducerRun rings = RunProducers(channel, threads, RECORDS_PER_THREAD);
+
+            for (const auto& [label, run] : { std::pair{ "Immediate", immediate }, std::pair{ "Rings", rings } }) {
+                std::cout << "[PERF] Producers/" << std::setw(2) << threads << " " << std::left << std::setw(9) << label << std::right
+                    << std::fixed << std::setprecision(0) << std::setw(10) << run.recordsPerSecond << " records/s"
+                    << "  p50 " << std::setw(7) << run.p50Ns << " ns  p99 " << std::setw(8) << run.p99Ns
+                    << " ns  p99.9 " << std::setw(9) << run.p999Ns << " ns" << std::defaultfloat << std::endl;
+            }
+        }
+    }
+
+}
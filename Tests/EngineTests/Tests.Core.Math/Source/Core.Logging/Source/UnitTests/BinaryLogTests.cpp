@@ -0,0 +1,318 @@
+// Tests/Core.Logging/Source/UnitTests/BinaryLogTests.cpp
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+import Akhanda.Core.Logging;
+#include "../Fixtures/LoggingTestFixtures.hpp"
+
+using namespace Akhanda::Tests::Logging;
+using namespace Akhanda::Logging;
+
+namespace {
+
+    struct DecodedRecord {
+        std::string message;
+        std::string channel;
+        LogLevel level;
+        uint32_t line;
+    };
+
+    class BinaryLogTests : public LoggingTestFixture {
+    protected:
+        void SetUp() override {
+            LoggingTestFixture::SetUp();
+            const auto* test = ::testing::UnitTest::GetInstance()->current_test_info();
+            path_ = std::filesystem::temp_directory_path() / (std::string("AkhandaBinaryLog_") + test->name() + ".akhlog");
+            channel_ = &LogManager::Instance().GetChannel("BinaryLogTest");
+        }
+
+        void TearDown() override {
+            CloseBinaryLog();
+            LoggingTestFixture::TearDown();
+            std::filesystem::remove(path_);
+        }
+
+        void OpenBinaryLog(const BinaryLogOptions& options = {}) {
+            auto sink = std::make_unique<BinaryLogSink>(path_, options);
+            ASSERT_TRUE(sink->IsOpen());
+            binarySink_ = sink.get();
+            LogManager::Instance().AddRecordSink(std::move(sink));
+        }
+
+        // Removing the sink destroys it, which writes the last block
+        void CloseBinaryLog() {
+            if (binarySink_) {
+                LogManager::Instance().RemoveRecordSink(binarySink_);
+                binarySink_ = nullptr;
+            }
+        }
+
+        std::vector<DecodedRecord> ReadBack(const BinaryLogFilter& filter = {}) {
+            CloseBinaryLog();
+            BinaryLogReader reader(path_, filter);
+            EXPECT_TRUE(reader.IsOpen()) << reader.GetError();
+
+            std::vector<DecodedRecord> records;
+            BinaryLogRecord record;
+            while (reader.Next(record)) {
+                records.push_back({ std::string(record.message), std::string(record.channel), record.level, record.line });
+            }
+            EXPECT_EQ(reader.GetError(), "");
+            return records;
+        }
+
+        static std::vector<std::string> Messages(const std::vector<DecodedRecord>& records) {
+            std::vector<std::string> messages;
+            for (const DecodedRecord& record : records) {
+                messages.push_back(record.message);
+            }
+            return messages;
+        }
+
+        std::filesystem::path path_;
+        LogChannel* channel_ = nullptr;
+        BinaryLogSink* binarySink_ = nullptr;
+    };
+
+    // ============================================================================
+    // Block Compression
+    // ============================================================================
+
+    TEST(BinaryLogCompressionTests, RoundTrip_MatchesInput) {
+        std::mt19937 random(1234);
+        std::vector<std::vector<std::byte>> inputs;
+
+        inputs.emplace_back();
+        inputs.emplace_back(13, std::byte{ 'a' });
+        inputs.emplace_back(100000, std::byte{ 0 });
+
+        std::vector<std::byte> text;
+        const std::string_view line = "[Renderer] Streamed Characters/Hero/Body_Albedo.dds in 1.25 ms\n";
+        for (int i = 0; i < 400; ++i) {
+            for (const char c : line) text.push_back(static_cast<std::byte>(c));
+            text.push_back(static_cast<std::byte>(random() & 0xFF));
+        }
+        inputs.push_back(text);
+
+        std::vector<std::byte> mixed(70000);
+        for (size_t i = 0; i < mixed.size(); ++i) {
+            mixed[i] = static_cast<std::byte>((i / 300) % 2 ? random() & 0xFF : i & 0x0F);
+        }
+        inputs.push_back(mixed);
+
+        std::vector<std::byte> compressed;
+        std::vector<std::byte> decompressed;
+        for (const std::vector<std::byte>& input : inputs) {
+            const size_t size = Detail::CompressLogBlock(input, compressed);
+            if (input.size() < 16) {
+                EXPECT_EQ(size, 0u);
+                continue;
+            }
+            ASSERT_GT(size, 0u) << input.size();
+            EXPECT_LT(size, input.size());
+            ASSERT_TRUE(Detail::DecompressLogBlock(std::span(compressed.data(), size), input.size(), decompressed));
+            EXPECT_EQ(decompressed, input);
+        }
+    }
+
+    TEST(BinaryLogCompressionTests, IncompressibleInput_ReportsNoGain) {
+        std::mt19937 random(99);
+        std::vector<std::byte> input(4096);
+        for (std::byte& value : input) {
+            value = static_cast<std::byte>(random() & 0xFF);
+        }
+
+        std::vector<std::byte> compressed;
+        EXPECT_EQ(Detail::CompressLogBlock(input, compressed), 0u);
+    }
+
+    TEST(BinaryLogCompressionTests, Decompress_RejectsCorruptInput) {
+        std::vector<std::byte> output;
+
+        // A match reaching back before the start of the output
+        const std::vector<std::byte> badOffset = { std::byte{ 0x10 }, std::byte{ 'a' }, std::byte{ 0x05 }, std::byte{ 0x00 } };
+        EXPECT_FALSE(Detail::DecompressLogBlock(badOffset, 5, output));
+
+        // Literals running past the end of the input
+        const std::vector<std::byte> truncated = { std::byte{ 0x50 }, std::byte{ 'a' }, std::byte{ 'b' } };
+        EXPECT_FALSE(Detail::DecompressLogBlock(truncated, 5, output));
+
+        // Output shorter than promised
+        const std::vector<std::byte> shortOutput = { std::byte{ 0x20 }, std::byte{ 'a' }, std::byte{ 'b' } };
+        EXPECT_FALSE(Detail::DecompressLogBlock(shortOutput, 3, output));
+        EXPECT_TRUE(Detail::DecompressLogBlock(shortOutput, 2, output));
+    }
+
+    // ============================================================================
+    // Round Trip
+    // ============================================================================
+
+    TEST_F(BinaryLogTests, RoundTrip_RendersOriginalText) {
+        OpenBinaryLog();
+        const std::string name = "Body_Albedo.dds";
+        const char* stage = "Upload";
+        const std::string_view pass = "Shadow";
+        const void* address = reinterpret_cast<const void*>(uintptr_t(0x1234));
+
+        const auto logAll = [&] {
+            channel_->LogFormat(LogLevel::Info, "{} {} {} {}", int8_t(-5), int16_t(-300), -70000, std::numeric_limits<int64_t>::min());
+            channel_->LogFormat(LogLevel::Info, "{} {} {} {}", uint8_t(200), uint16_t(60000), std::numeric_limits<uint32_t>::max(), std::numeric_limits<uint64_t>::max());
+            channel_->LogFormat(LogLevel::Warning, "{} {:.3f} {:>8.2f}|{:e}", 1.25f, 3.14159, 2.5, 1e-7);
+            channel_->LogFormat(LogLevel::Debug, "{} {} {:c}{} {}", true, 'x', 'y', stage, pass);
+            channel_->LogFormat(LogLevel::Error, "{:#x} {:08b} {:+} {:^7}|", 255u, uint8_t(5), 42, name);
+            channel_->LogFormat(LogLevel::Info, "{1} before {0} {{literal}}", 1, 2);
+            channel_->LogFormat(LogLevel::Info, "address {}", address);
+            channel_->LogFormat(LogLevel::Info, "took {}", std::chrono::milliseconds(5));
+            channel_->LogFormat(LogLevel::Info, "no arguments");
+            channel_->Warning("plain message");
+        };
+
+        logAll();
+        LogManager::Instance().Flush();
+        LogManager::Instance().SetDeferredFormatting(false);
+        logAll();
+
+        WaitForCaptured(20);
+        const std::vector<std::string> expected = CapturedMessages();
+        ASSERT_EQ(expected.size(), 20u);
+        const std::vector<DecodedRecord> records = ReadBack();
+        EXPECT_EQ(Messages(records), expected);
+
+        ASSERT_EQ(records.size(), 20u);
+        EXPECT_EQ(records[2].level, LogLevel::Warning);
+        EXPECT_EQ(records[3].level, LogLevel::Debug);
+        EXPECT_EQ(records[0].channel, "BinaryLogTest");
+        EXPECT_GT(records[0].line, 0u);
+        EXPECT_EQ(records[0].line, records[10].line);
+    }
+
+    TEST_F(BinaryLogTests, Uncompressed_RoundTrips) {
+        BinaryLogOptions options;
+        options.compress = false;
+        options.blockSize = 256;
+        OpenBinaryLog(options);
+
+        for (int i = 0; i < 100; ++i) {
+            channel_->LogFormat(LogLevel::Info, "frame {} took {:.2f} ms", i, i * 0.5);
+        }
+
+        EXPECT_EQ(Messages(ReadBack()), CapturedMessages());
+    }
+
+    TEST_F(BinaryLogTests, FormattedLine_MatchesTextLayout) {
+        OpenBinaryLog();
+        channel_->LogFormat(LogLevel::Error, "code {}", 7);
+
+        BinaryLogReader reader((CloseBinaryLog(), path_));
+        BinaryLogRecord record;
+        ASSERT_TRUE(reader.Next(record));
+        const std::string line = FormatBinaryLogRecord(record);
+        EXPECT_NE(line.find("] [BinaryLogTest] [ERROR] [BinaryLogTests.cpp:"), std::string::npos) << line;
+        EXPECT_TRUE(line.ends_with("] code 7")) << line;
+        EXPECT_EQ(line.front(), '[');
+    }
+
+    // ============================================================================
+    // Filters
+    // ============================================================================
+
+    TEST_F(BinaryLogTests, Filter_ByChannelLevelAndTime) {
+        OpenBinaryLog();
+        const LogChannel& other = LogManager::Instance().GetChannel("BinaryLogTestOther");
+
+        channel_->LogFormat(LogLevel::Warning, "early {}", 1);
+        LogManager::Instance().Flush();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        const auto middle = std::chrono::system_clock::now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        channel_->LogFormat(LogLevel::Info, "info {}", 2);
+        channel_->LogFormat(LogLevel::Error, "error {}", 3);
+        other.LogFormat(LogLevel::Error, "other {}", 4);
+
+        BinaryLogFilter byChannel;
+        byChannel.channels = { "BinaryLogTestOther" };
+        EXPECT_EQ(Messages(ReadBack(byChannel)), std::vector<std::string>{ "other 4" });
+
+        BinaryLogFilter byLevel;
+        byLevel.minimumLevel = LogLevel::Warning;
+        byLevel.channels = { "BinaryLogTest" };
+        EXPECT_EQ(Messages(ReadBack(byLevel)), (std::vector<std::string>{ "early 1", "error 3" }));
+
+        BinaryLogFilter byTime;
+        byTime.from = middle;
+        EXPECT_EQ(Messages(ReadBack(byTime)), (std::vector<std::string>{ "info 2", "error 3", "other 4" }));
+
+        byTime.from = {};
+        byTime.to = middle;
+        EXPECT_EQ(Messages(ReadBack(byTime)), std::vector<std::string>{ "early 1" });
+    }
+
+    // ============================================================================
+    // Size
+    // ============================================================================
+
+    TEST_F(BinaryLogTests, TypicalMessages_AreSeveralTimesSmallerThanText) {
+        OpenBinaryLog();
+        const std::vector<std::string> assets = { "Characters/Hero/Body_Albedo.dds", "Props/Crate_Normal.dds", "Levels/Temple/Lightmap_03.dds" };
+
+        for (int frame = 0; frame < 2000; ++frame) {
+            channel_->LogFormat(LogLevel::Debug, "Frame {} submitted {} draw calls in {:.2f} ms", frame, 1200 + frame % 50, 4.0 + (frame % 7) * 0.25);
+            if (frame % 3 == 0) {
+                channel_->LogFormat(LogLevel::Info, "Streamed {} ({} bytes)", assets[frame % assets.size()], 4194304 + frame);
+            }
+            if (frame % 10 == 0) {
+                channel_->LogFormat(LogLevel::Warning, "Job {} waited {} us for worker {}", frame * 3, frame % 97, frame % 8);
+            }
+        }
+
+        size_t textBytes = 0;
+        for (const std::string& line : CapturedLines()) {
+            textBytes += line.size();
+        }
+        CloseBinaryLog();
+        const size_t binaryBytes = static_cast<size_t>(std::filesystem::file_size(path_));
+
+        const double ratio = static_cast<double>(textBytes) / static_cast<double>(binaryBytes);
+        RecordProperty("TextBytes", std::to_string(textBytes));
+        RecordProperty("BinaryBytes", std::to_string(binaryBytes));
+        EXPECT_GE(ratio, 5.0) << textBytes << " text bytes, " << binaryBytes << " binary bytes";
+    }
+
+    // ============================================================================
+    // Damaged Files
+    // ============================================================================
+
+    TEST_F(BinaryLogTests, Reader_RejectsForeignAndTruncatedFiles) {
+        {
+            std::ofstream file(path_, std::ios::binary);
+            file << "this is a text log, not a binary one";
+        }
+        EXPECT_FALSE(BinaryLogReader(path_).IsOpen());
+
+        OpenBinaryLog();
+        for (int i = 0; i < 50; ++i) {
+            channel_->LogFormat(LogLevel::Info, "record {}", i);
+        }
+        CloseBinaryLog();
+        std::filesystem::resize_file(path_, std::filesystem::file_size(path_) - 3);
+
+        BinaryLogReader reader(path_);
+        ASSERT_TRUE(reader.IsOpen());
+        BinaryLogRecord record;
+        while (reader.Next(record)) {
+        }
+        EXPECT_NE(reader.GetError(), "");
+    }
+
+}
@@ -0,0 +1,131 @@
+// Tests/Core.Logging/Source/UnitTests/ChannelHandleTests.cpp
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+// Every level is compiled in, whatever the configuration
+#define AKH_LOG_COMPILE_LEVEL 0
+
+import Akhanda.Core.Logging;
+#include "Core/Logging/Core.Logging.hpp"
+#include "../Fixtures/LoggingTestFixtures.hpp"
+
+using namespace Akhanda::Tests::Logging;
+using namespace Akhanda::Logging;
+
+namespace {
+
+    class ChannelHandleTests : public LoggingTestFixture {
+    protected:
+        void TearDown() override {
+            LoggingTestFixture::TearDown();
+            LogManager::Instance().SetGlobalLevel(LogLevel::Debug);
+        }
+    };
+
+    // ============================================================================
+    // Registration
+    // ============================================================================
+
+    TEST_F(ChannelHandleTests, Register_SameNameSameHandle) {
+        auto& manager = LogManager::Instance();
+        const ChannelHandle first = manager.RegisterChannel("HandleTest");
+        const ChannelHandle second = manager.RegisterChannel("HandleTest");
+        const ChannelHandle other = manager.RegisterChannel("HandleTestOther");
+
+        ASSERT_TRUE(first.IsValid());
+        EXPECT_EQ(first.index, second.index);
+        EXPECT_NE(first.index, other.index);
+        EXPECT_EQ(&first.Get(), &manager.GetChannel("HandleTest"));
+        EXPECT_EQ(first.Get().GetName(), "HandleTest");
+    }
+
+    TEST_F(ChannelHandleTests, PredefinedChannels_MatchNameLookup) {
+        auto& manager = LogManager::Instance();
+        EXPECT_EQ(&Channels::Engine(), &manager.GetChannel("Engine"));
+        EXPECT_EQ(&ChannelHandles::Renderer().Get(), &manager.GetChannel("Renderer"));
+        EXPECT_EQ(ChannelHandles::Physics().index, manager.RegisterChannel("Physics").index);
+    }
+
+    TEST_F(ChannelHandleTests, RemovedChannel_KeepsSlotWhenRecreated) {
+        auto& manager = LogManager::Instance();
+        const ChannelHandle handle = manager.RegisterChannel("HandleTestRemoved");
+        manager.RemoveChannel("HandleTestRemoved");
+
+        EXPECT_EQ(handle.TryGet(), nullptr);
+        EXPECT_FALSE(handle.ShouldLog(LogLevel::Fatal));
+
+        LogChannel& recreated = manager.GetChannel("HandleTestRemoved");
+        EXPECT_EQ(&handle.Get(), &recreated);
+        EXPECT_EQ(manager.RegisterChannel("HandleTestRemoved").index, handle.index);
+        EXPECT_TRUE(handle.ShouldLog(LogLevel::Info));
+    }
+
+    TEST_F(ChannelHandleTests, InvalidHandle_NeverLogs) {
+        const ChannelHandle invalid;
+        EXPECT_FALSE(invalid.IsValid());
+        EXPECT_EQ(invalid.TryGet(), nullptr);
+        for (uint8_t level = 0; level < static_cast<uint8_t>(LogLevel::Count); ++level) {
+            EXPECT_FALSE(invalid.ShouldLog(static_cast<LogLevel>(level)));
+        }
+    }
+
+    // ============================================================================
+    // Level Checks
+    // ============================================================================
+
+    TEST_F(ChannelHandleTests, Levels_FollowChannelAndGlobalLevel) {
+        auto& manager = LogManager::Instance();
+        const ChannelHandle handle = manager.RegisterChannel("HandleTestLevels");
+        LogChannel& channel = handle.Get();
+
+        channel.SetLevel(LogLevel::Warning);
+        EXPECT_FALSE(handle.ShouldLog(LogLevel::Info));
+        EXPECT_TRUE(handle.ShouldLog(LogLevel::Warning));
+        EXPECT_TRUE(handle.ShouldLog(LogLevel::Fatal));
+        EXPECT_EQ(handle.ShouldLog(LogLevel::Info), channel.ShouldLog(LogLevel::Info));
+
+        manager.SetGlobalLevel(LogLevel::Error);
+        EXPECT_FALSE(handle.ShouldLog(LogLevel::Warning));
+        EXPECT_TRUE(handle.ShouldLog(LogLevel::Error));
+
+        channel.SetLevel(LogLevel::Debug);
+        EXPECT_TRUE(handle.ShouldLog(LogLevel::Debug));
+        EXPECT_FALSE(handle.ShouldLog(LogLevel::Trace));
+    }
+
+    TEST_F(ChannelHandleTests, Macros_AcceptHandles) {
+        const ChannelHandle handle = LogManager::Instance().RegisterChannel("HandleTestMacros");
+        handle.Get().SetLevel(LogLevel::Warning);
+
+        LOG_WARNING(handle, "warning through a handle");
+        LOG_ERROR_FORMAT(handle, "error {} through a handle", 2);
+        LOG_WARNING_IF(false, handle, "skipped");
+
+        // Below the channel level; the arguments are never evaluated
+        int evaluated = 0;
+        LOG_INFO_FORMAT(handle, "{}", ++evaluated);
+        EXPECT_EQ(evaluated, 0);
+
+        const std::vector<std::string> expected = { "warning through a handle", "error 2 through a handle" };
+        EXPECT_EQ(CapturedMessages(), expected);
+    }
+
+    TEST_F(ChannelHandleTests, FastMacros_SkipHandlesWithoutAChannel) {
+        auto& manager = LogManager::Instance();
+        const ChannelHandle invalid;
+        const ChannelHandle removed = manager.RegisterChannel("HandleTestFastRemoved");
+        manager.RemoveChannel("HandleTestFastRemoved");
+
+        LOG_ERROR_FAST(invalid, "invalid handle");
+        LOG_ERROR_FORMAT_FAST(invalid, "invalid handle {}", 1);
+        LOG_ERROR_FAST(removed, "removed channel");
+        LOG_ERROR_FORMAT_FAST(removed, "removed channel {}", 2);
+
+        const ChannelHandle live = manager.RegisterChannel("HandleTestFast");
+        LOG_ERROR_FAST(live, "live channel");
+        WaitForCaptured(1);
+        EXPECT_EQ(CapturedMessages(), std::vector<std::string>{ "live channel" });
+    }
+
+}
@@ -0,0 +1,183 @@
+// Tests/Core.Logging/Source/UnitTests/DeferredFormattingTests.cpp
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+import Akhanda.Core.Logging;
+#include "../Fixtures/LoggingTestFixtures.hpp"
+
+using namespace Akhanda::Tests::Logging;
+using namespace Akhanda::Logging;
+
+namespace {
+
+    // Encodes the arguments the way LogFormat does and formats them back
+    template<typename... Args>
+    std::string RoundTrip(std::string_view format, const Args&... args) {
+        std::vector<std::byte> buffer(EncodedLogArgumentsSize<std::decay_t<Args>...>(args...));
+        std::byte* end = EncodeLogArguments<std::decay_t<Args>...>(buffer.data(), args...);
+        EXPECT_EQ(end, buffer.data() + buffer.size());
+
+        std::string output;
+        FormatLogRecord<std::decay_t<Args>...>(format, buffer.data(), output);
+        return output;
+    }
+
+    class DeferredFormattingTests : public LoggingTestFixture {
+    protected:
+        void LogSampleMessages(const LogChannel& channel) {
+            const std::string name = "Texture_Albedo";
+            const std::string_view view = "view";
+            const char* pointer = "pointer";
+            channel.LogFormat(LogLevel::Info, "Loaded {} in {:.3f} ms ({} bytes)", name, 12.34567f, uint64_t(1) << 40);
+            channel.LogFormat(LogLevel::Warning, "{:>8}|{:<6}|{:^7}|", 42, "left", 'c');
+            channel.LogFormat(LogLevel::Error, "{} {} {} {}", view, pointer, true, -7);
+            channel.LogFormat(LogLevel::Info, "{0} {1} {0}", 1.5, int16_t(-3));
+            channel.Log(LogLevel::Info, "plain message");
+            channel.LogFormat(LogLevel::Info, "hex {:#x} sci {:e}", 255u, 1234.5);
+        }
+
+        static std::vector<std::string> ExpectedSampleMessages() {
+            const std::string name = "Texture_Albedo";
+            return {
+                std::format("Loaded {} in {:.3f} ms ({} bytes)", name, 12.34567f, uint64_t(1) << 40),
+                std::format("{:>8}|{:<6}|{:^7}|", 42, "left", 'c'),
+                std::format("{} {} {} {}", std::string_view("view"), "pointer", true, -7),
+                std::format("{0} {1} {0}", 1.5, int16_t(-3)),
+                "plain message",
+                std::format("hex {:#x} sci {:e}", 255u, 1234.5)
+            };
+        }
+    };
+
+    // ============================================================================
+    // Argument Encoding
+    // ============================================================================
+
+    TEST_F(DeferredFormattingTests, RoundTrip_MatchesStdFormat) {
+        const std::string text = "string";
+        const char* cString = "c-string";
+        char buffer[] = "mutable";
+
+        EXPECT_EQ(RoundTrip("{} {} {}", 1, -2LL, 3u), std::format("{} {} {}", 1, -2LL, 3u));
+        EXPECT_EQ(RoundTrip("{:.2f} {:e} {}", 3.14159f, 2.5e-8, 0.1), std::format("{:.2f} {:e} {}", 3.14159f, 2.5e-8, 0.1));
+        EXPECT_EQ(RoundTrip("[{}] [{}] [{}]", text, cString, "literal"), std::format("[{}] [{}] [{}]", text, cString, "literal"));
+        EXPECT_EQ(RoundTrip("{:>10}|{:.3}", std::string_view("right"), text), std::format("{:>10}|{:.3}", std::string_view("right"), text));
+        EXPECT_EQ(RoundTrip("{} {}", buffer, 'x'), std::format("{} {}", buffer, 'x'));
+        EXPECT_EQ(RoundTrip("{} {:d}", false, true), std::format("{} {:d}", false, true));
+        EXPECT_EQ(RoundTrip("{}", std::string()), "");
+        EXPECT_EQ(RoundTrip("no arguments"), "no arguments");
+
+        const void* address = &text;
+        EXPECT_EQ(RoundTrip("{}", address), std::format("{}", address));
+    }
+
+    TEST_F(DeferredFormattingTests, RoundTrip_NullCStringIsEmpty) {
+        const char* nothing = nullptr;
+        EXPECT_EQ(RoundTrip("[{}]", nothing), "[]");
+    }
+
+    TEST_F(DeferredFormattingTests, Encoding_StringsAreInline) {
+        const std::string text = "abc";
+        EXPECT_EQ(EncodedLogArgumentsSize<std::string>(text), sizeof(uint32_t) + 3);
+        EXPECT_EQ((EncodedLogArgumentsSize<int, double>(1, 2.0)), sizeof(int) + sizeof(double));
+
+        static_assert(IsDeferrableLogArgument<int>);
+        static_assert(IsDeferrableLogArgument<const char*>);
+        static_assert(IsDeferrableLogArgument<std::string>);
+        static_assert(!IsDeferrableLogArgument<std::vector<int>>);
+        static_assert(!IsDeferrableLogArgument<std::string_view*>);
+    }
+
+    // ============================================================================
+    // End to End
+    // ============================================================================
+
+    TEST_F(DeferredFormattingTests, Output_MatchesImmediateFormatting) {
+        auto& manager = LogManager::Instance();
+        const LogChannel& channel = manager.GetChannel("DeferredFormattingTest");
+        const std::vector<std::string> expected = ExpectedSampleMessages();
+
+        ASSERT_TRUE(manager.IsDeferredFormatting());
+        LogSampleMessages(channel);
+        const std::vector<std::string> deferred = CapturedMessages();
+
+        ClearCaptured();
+        manager.SetDeferredFormatting(false);
+        ASSERT_FALSE(manager.IsDeferredFormatting());
+        LogSampleMessages(channel);
+        WaitForCaptured(expected.size());
+        const std::vector<std::string> immediate = CapturedMessages();
+
+        EXPECT_EQ(deferred, expected);
+        EXPECT_EQ(immediate, expected);
+    }
+
+    TEST_F(DeferredFormattingTests, Strings_AreCopiedAtCallTime) {
+        const LogChannel& channel = LogManager::Instance().GetChannel("DeferredFormattingTest");
+        {
+            std::string temporary = "before";
+            channel.LogFormat(LogLevel::Info, "value={}", temporary);
+            temporary = "after - long enough to reallocate the buffer";
+        }
+
+        const std::vector<std::string> messages = CapturedMessages();
+        ASSERT_EQ(messages.size(), 1u);
+        EXPECT_EQ(messages[0], "value=before");
+    }
+
+    TEST_F(DeferredFormattingTests, NonDeferrableArguments_FormatOnCaller) {
+        const LogChannel& channel = LogManager::Instance().GetChannel("DeferredFormattingTest");
+        const std::vector<int> values = { 1, 2, 3 };
+        channel.LogFormat(LogLevel::Info, "first");
+        channel.LogFormat(LogLevel::Info, "values={}", values);
+        channel.LogFormat(LogLevel::Info, "last {}", 3);
+
+        const std::vector<std::string> messages = CapturedMessages();
+        ASSERT_EQ(messages.size(), 3u);
+        EXPECT_EQ(messages[0], "first");
+        EXPECT_EQ(messages[1], std::format("values={}", values));
+        EXPECT_EQ(messages[2], "last 3");
+    }
+
+    TEST_F(DeferredFormattingTests, Order_IsKeptPerThread) {
+        const LogChannel& channel = LogManager::Instance().GetChannel("DeferredFormattingTest");
+        constexpr int THREADS = 4;
+        constexpr int MESSAGES = 500;
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < THREADS; ++t) {
+            threads.emplace_back([&channel, t] {
+                for (int i = 0; i < MESSAGES; ++i) {
+                    if (i % 2 == 0) {
+                        channel.LogFormat(LogLevel::Info, "{} {}", t, i);
+                    }
+                    else {
+                        channel.Log(LogLevel::Info, std::format("{} {}", t, i));
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        const std::vector<std::string> messages = CapturedMessages();
+        ASSERT_EQ(messages.size(), size_t(THREADS * MESSAGES));
+
+        std::vector<int> next(THREADS, 0);
+        for (const std::string& message : messages) {
+            const size_t space = message.find(' ');
+            const int thread = std::stoi(message.substr(0, space));
+            const int index = std::stoi(message.substr(space + 1));
+            ASSERT_EQ(index, next[thread]) << "Thread " << thread;
+            ++next[thread];
+        }
+    }
+
+}
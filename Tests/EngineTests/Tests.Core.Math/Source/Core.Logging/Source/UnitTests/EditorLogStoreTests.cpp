@@ -0,0 +1,215 @@
+// Tests/Core.Logging/Source/UnitTests/EditorLogStoreTests.cpp
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+import Akhanda.Core.Logging;
+#include "Core/Logging/EditorLogStore.hpp"
+
+using namespace Akhanda::Logging;
+
+namespace {
+
+    class EditorLogStoreTests : public ::testing::Test {
+    protected:
+        static EditorLogMessage Message(LogLevel level, const std::string& channel, const std::string& text) {
+            EditorLogMessage message;
+            message.level = level;
+            message.channel = channel;
+            message.message = text;
+            message.category = channel;
+            return message;
+        }
+
+        static std::vector<std::string> Texts(const std::vector<EditorLogMessage>& messages) {
+            std::vector<std::string> texts;
+            for (const EditorLogMessage& message : messages) {
+                texts.push_back(message.message);
+            }
+            return texts;
+        }
+
+        // What the view should show, by scanning every stored message
+        static std::vector<std::string> ScanFilter(const EditorLogStore& store) {
+            const EditorLogStore::Filter& filter = store.GetFilter();
+            std::vector<std::string> texts;
+            for (const EditorLogMessage& message : store.GetAll()) {
+                const bool channelShown = filter.channels.empty()
+                    || std::find(filter.channels.begin(), filter.channels.end(), message.channel) != filter.channels.end();
+                if (message.level >= filter.minLevel && channelShown && message.message.find(filter.text) != std::string::npos) {
+                    texts.push_back(message.message);
+                }
+            }
+            return texts;
+        }
+
+        static std::vector<std::string> Visible(const EditorLogStore& store) {
+            return Texts(store.GetVisible(0, SIZE_MAX));
+        }
+
+        // Random messages from a small vocabulary, so searches hit and miss
+        static void AddRandom(EditorLogStore& store, std::mt19937& random, int count) {
+            static const std::vector<std::string> channels = { "Renderer", "Physics", "Audio", "Editor" };
+            static const std::vector<std::string> words = { "texture", "mesh", "shader", "body", "frame", "late", "ab", "abc", "abcd" };
+            for (int i = 0; i < count; ++i) {
+                std::string text = std::to_string(random() % 50);
+                for (uint32_t w = random() % 4 + 1; w > 0; --w) {
+                    text += " " + words[random() % words.size()];
+                }
+                const LogLevel level = static_cast<LogLevel>(random() % static_cast<uint32_t>(LogLevel::Count));
+                store.Add(Message(level, channels[random() % channels.size()], text), random() % 2 == 0);
+            }
+        }
+    };
+
+    // ============================================================================
+    // Storage
+    // ============================================================================
+
+    TEST_F(EditorLogStoreTests, Add_KeepsOrderAndInternedFields) {
+        EditorLogStore store(16);
+        EditorLogMessage message = Message(LogLevel::Warning, "Renderer", "first");
+        message.fileName = "Renderer.cpp";
+        message.lineNumber = 42;
+        store.Add(message, false);
+        store.Add(Message(LogLevel::Info, "Physics", "second"), false);
+
+        ASSERT_EQ(store.GetSize(), 2u);
+        const std::vector<EditorLogMessage> all = store.GetAll();
+        EXPECT_EQ(Texts(all), (std::vector<std::string>{ "first", "second" }));
+        EXPECT_EQ(all[0].channel, "Renderer");
+        EXPECT_EQ(all[0].fileName, "Renderer.cpp");
+        EXPECT_EQ(all[0].lineNumber, 42u);
+        EXPECT_EQ(all[0].level, LogLevel::Warning);
+        EXPECT_EQ(all[1].channel, "Physics");
+    }
+
+    TEST_F(EditorLogStoreTests, Wraparound_DropsTheOldest) {
+        EditorLogStore store(8);
+        for (int i = 0; i < 20; ++i) {
+            store.Add(Message(LogLevel::Info, "Engine", "message " + std::to_string(i)), false);
+        }
+
+        EXPECT_EQ(store.GetSize(), 8u);
+        EXPECT_EQ(store.GetVisibleCount(), 8u);
+        EXPECT_EQ(Visible(store).front(), "message 12");
+        EXPECT_EQ(Visible(store).back(), "message 19");
+    }
+
+    TEST_F(EditorLogStoreTests, SetCapacity_KeepsTheNewest) {
+        EditorLogStore store(8);
+        for (int i = 0; i < 8; ++i) {
+            store.Add(Message(LogLevel::Info, "Engine", "message " + std::to_string(i)), false);
+        }
+
+        store.SetCapacity(3);
+        EXPECT_EQ(Visible(store), (std::vector<std::string>{ "message 5", "message 6", "message 7" }));
+
+        store.SetCapacity(16);
+        store.Add(Message(LogLevel::Info, "Engine", "message 8"), false);
+        EXPECT_EQ(store.GetSize(), 4u);
+        EXPECT_EQ(Visible(store).back(), "message 8");
+    }
+
+    TEST_F(EditorLogStoreTests, Clear_EmptiesStoreAndIndexes) {
+        EditorLogStore store(8);
+        store.Add(Message(LogLevel::Info, "Engine", "repeated"), true);
+        store.Clear();
+
+        EXPECT_EQ(store.GetSize(), 0u);
+        EXPECT_EQ(store.GetVisibleCount(), 0u);
+        EXPECT_FALSE(store.Add(Message(LogLevel::Info, "Engine", "repeated"), true).collapsed);
+
+        EditorLogStore::Filter filter;
+        filter.text = "repeated";
+        store.SetFilter(filter);
+        EXPECT_EQ(store.GetVisibleCount(), 1u);
+    }
+
+    // ============================================================================
+    // Collapsing
+    // ============================================================================
+
+    TEST_F(EditorLogStoreTests, Collapse_CountsRepeatsOnTheStoredCopy) {
+        EditorLogStore store(4);
+        const auto first = store.Add(Message(LogLevel::Info, "Engine", "tick"), true);
+        EXPECT_FALSE(first.collapsed);
+        EXPECT_TRUE(store.Add(Message(LogLevel::Info, "Engine", "tick"), true).collapsed);
+        EXPECT_TRUE(store.Add(Message(LogLevel::Info, "Engine", "tick"), true).collapsed);
+
+        // Same text on another channel, or not collapsible, is a new message
+        EXPECT_FALSE(store.Add(Message(LogLevel::Info, "Editor", "tick"), true).collapsed);
+        EXPECT_FALSE(store.Add(Message(LogLevel::Error, "Engine", "tick"), false).collapsed);
+
+        EXPECT_EQ(store.GetSize(), 3u);
+        EXPECT_EQ(store.Get(first.sequence).collapseCount, 3u);
+    }
+
+    TEST_F(EditorLogStoreTests, Collapse_StopsOnceTheCopyIsOverwritten) {
+        EditorLogStore store(2);
+        store.Add(Message(LogLevel::Info, "Engine", "tick"), true);
+        store.Add(Message(LogLevel::Info, "Engine", "a"), false);
+        store.Add(Message(LogLevel::Info, "Engine", "b"), false);
+
+        const auto repeat = store.Add(Message(LogLevel::Info, "Engine", "tick"), true);
+        EXPECT_FALSE(repeat.collapsed);
+        EXPECT_EQ(store.Get(repeat.sequence).collapseCount, 1u);
+    }
+
+    // ============================================================================
+    // Filtered View
+    // ============================================================================
+
+    TEST_F(EditorLogStoreTests, Filters_MatchAFullScan) {
+        std::mt19937 random(1234);
+        EditorLogStore store(256);
+        AddRandom(store, random, 1000);
+
+        std::vector<EditorLogStore::Filter> filters(6);
+        filters[1].minLevel = LogLevel::Warning;
+        filters[2].channels = { "Renderer", "Audio" };
+        filters[3].text = "ab";
+        filters[4].text = "shader body";
+        filters[4].minLevel = LogLevel::Debug;
+        filters[5].text = "no such text";
+
+        for (const EditorLogStore::Filter& filter : filters) {
+            store.SetFilter(filter);
+            EXPECT_EQ(Visible(store), ScanFilter(store)) << "filter '" << filter.text << "'";
+
+            // The view follows messages coming in and the oldest going out
+            AddRandom(store, random, 300);
+            EXPECT_EQ(Visible(store), ScanFilter(store)) << "filter '" << filter.text << "' after adding";
+        }
+    }
+
+    TEST_F(EditorLogStoreTests, Search_NarrowsAsItGrows) {
+        std::mt19937 random(99);
+        EditorLogStore store(128);
+        AddRandom(store, random, 500);
+
+        EditorLogStore::Filter filter;
+        filter.channels = { "Physics" };
+        for (const char* text : { "a", "ab", "abc", "abcd", "abc" }) {
+            filter.text = text;
+            store.SetFilter(filter);
+            EXPECT_EQ(Visible(store), ScanFilter(store)) << "search '" << text << "'";
+        }
+    }
+
+    TEST_F(EditorLogStoreTests, NewChannel_FollowsTheChannelFilter) {
+        EditorLogStore store(8);
+        EditorLogStore::Filter filter;
+        filter.channels = { "Late" };
+        store.SetFilter(filter);
+
+        const auto hidden = store.Add(Message(LogLevel::Info, "Early", "hidden"), false);
+        const auto shown = store.Add(Message(LogLevel::Info, "Late", "shown"), false);
+        EXPECT_FALSE(hidden.visible);
+        EXPECT_TRUE(shown.visible);
+        EXPECT_EQ(Visible(store), std::vector<std::string>{ "shown" });
+    }
+
+}
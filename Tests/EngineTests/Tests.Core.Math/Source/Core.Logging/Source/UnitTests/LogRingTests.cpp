@@ -0,0 +1,218 @@
+// Tests/Core.Logging/Source/UnitTests/LogRingTests.cpp
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+import Akhanda.Core.Logging;
+#include "../Fixtures/LoggingTestFixtures.hpp"
+
+using namespace Akhanda::Tests::Logging;
+using namespace Akhanda::Logging;
+
+namespace {
+
+    constexpr int RECORDS = 1000;
+    constexpr size_t SMALL_RING = 4096;
+
+    class LogRingTests : public LoggingTestFixture {
+    protected:
+        void TearDown() override {
+            if (gate_) {
+                gate_->Open();
+            }
+            LoggingTestFixture::TearDown();
+            if (gateSink_) {
+                LogManager::Instance().RemoveSink(gateSink_);
+            }
+        }
+
+        // Parks the backend thread inside a sink. New threads log into rings
+        // the backend has not looked at yet, so nothing of theirs is consumed
+        // until ReleaseBackend().
+        void HoldBackend(const LogChannel& channel) {
+            gate_ = std::make_shared<GateSink::Gate>();
+            auto sink = std::make_unique<GateSink>(gate_);
+            gateSink_ = sink.get();
+            LogManager::Instance().AddSink(std::move(sink));
+
+            channel.Log(LogLevel::Info, "hold");
+            gate_->WaitUntilEntered();
+        }
+
+        void ReleaseBackend() {
+            gate_->Open();
+        }
+
+        static void LogSequence(const LogChannel& channel, int count) {
+            for (int i = 0; i < count; ++i) {
+                channel.LogFormat(LogLevel::Info, "{}", i);
+            }
+        }
+
+        // The numbers logged by LogSequence, in delivery order
+        std::vector<int> CapturedSequence() {
+            std::vector<int> values;
+            for (const std::string& message : CapturedMessages()) {
+                if (message != "hold") {
+                    values.push_back(std::stoi(message));
+                }
+            }
+            return values;
+        }
+
+        static std::vector<int> Iota(int count) {
+            std::vector<int> values(count);
+            std::iota(values.begin(), values.end(), 0);
+            return values;
+        }
+
+        std::shared_ptr<GateSink::Gate> gate_;
+        GateSink* gateSink_ = nullptr;
+    };
+
+    // ============================================================================
+    // Configuration
+    // ============================================================================
+
+    TEST_F(LogRingTests, Capacity_RoundsUpToPowerOfTwo) {
+        auto& manager = LogManager::Instance();
+        EXPECT_EQ(manager.GetRingCapacity(), DEFAULT_LOG_RING_CAPACITY);
+        EXPECT_EQ(manager.GetRingPolicy(), LogRingPolicy::Block);
+
+        manager.SetRingCapacity(5000);
+        EXPECT_EQ(manager.GetRingCapacity(), 8192u);
+
+        manager.SetRingCapacity(1);
+        EXPECT_GE(manager.GetRingCapacity(), 1024u);
+        EXPECT_EQ(manager.GetRingCapacity() & (manager.GetRingCapacity() - 1), 0u);
+    }
+
+    // ============================================================================
+    // Full Ring Policies
+    // ============================================================================
+
+    TEST_F(LogRingTests, DropAndCount_KeepsOldestAndCountsTheRest) {
+        auto& manager = LogManager::Instance();
+        const LogChannel& channel = manager.GetChannel("LogRingTest");
+        manager.SetRingCapacity(SMALL_RING);
+        manager.SetRingPolicy(LogRingPolicy::DropAndCount);
+
+        HoldBackend(channel);
+        const uint64_t droppedBefore = manager.GetStatistics().messagesDropped.load();
+        std::thread([&channel] { LogSequence(channel, RECORDS); }).join();
+        const uint64_t dropped = manager.GetStatistics().messagesDropped.load() - droppedBefore;
+        ReleaseBackend();
+
+        const std::vector<int> values = CapturedSequence();
+        EXPECT_GT(dropped, 0u);
+        EXPECT_EQ(values.size() + dropped, size_t(RECORDS));
+        EXPECT_EQ(values, Iota(static_cast<int>(values.size())));
+    }
+
+    TEST_F(LogRingTests, Grow_KeepsEveryRecord) {
+        auto& manager = LogManager::Instance();
+        const LogChannel& channel = manager.GetChannel("LogRingTest");
+        manager.SetRingCapacity(SMALL_RING);
+        manager.SetRingPolicy(LogRingPolicy::Grow);
+
+        HoldBackend(channel);
+        const uint64_t droppedBefore = manager.GetStatistics().messagesDropped.load();
+        std::thread([&channel] { LogSequence(channel, RECORDS); }).join();
+        ReleaseBackend();
+
+        EXPECT_EQ(CapturedSequence(), Iota(RECORDS));
+        EXPECT_EQ(manager.GetStatistics().messagesDropped.load(), droppedBefore);
+    }
+
+    TEST_F(LogRingTests, Block_WaitsForRoom) {
+        auto& manager = LogManager::Instance();
+        const LogChannel& channel = manager.GetChannel("LogRingTest");
+        manager.SetRingCapacity(SMALL_RING);
+        manager.SetRingPolicy(LogRingPolicy::Block);
+
+        HoldBackend(channel);
+        std::atomic<bool> finished{ false };
+        std::thread producer([&] {
+            LogSequence(channel, RECORDS);
+            finished.store(true);
+        });
+
+        // A 4 KB ring cannot take every record while the backend is held
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_FALSE(finished.load());
+
+        ReleaseBackend();
+        producer.join();
+        EXPECT_EQ(CapturedSequence(), Iota(RECORDS));
+    }
+
+    TEST_F(LogRingTests, Block_RecordLargerThanRing_FormatsOnCaller) {
+        auto& manager = LogManager::Instance();
+        const LogChannel& channel = manager.GetChannel("LogRingTest");
+        manager.SetRingCapacity(SMALL_RING);
+
+        const std::string large(SMALL_RING * 2, 'x');
+        std::thread([&] { channel.LogFormat(LogLevel::Info, "{}", large); }).join();
+
+        const std::vector<std::string> messages = CapturedMessages();
+        ASSERT_EQ(messages.size(), 1u);
+        EXPECT_EQ(messages[0], large);
+    }
+
+    // ============================================================================
+    // Backend Merge
+    // ============================================================================
+
+    TEST_F(LogRingTests, Merge_DeliversInTimestampOrder) {
+        auto& manager = LogManager::Instance();
+        const LogChannel& channel = manager.GetChannel("LogRingTest");
+        manager.SetRingPolicy(LogRingPolicy::Grow);
+        constexpr int THREADS = 8;
+        constexpr int PER_THREAD = 200;
+
+        HoldBackend(channel);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < THREADS; ++t) {
+            threads.emplace_back([&channel, t] {
+                for (int i = 0; i < PER_THREAD; ++i) {
+                    channel.LogFormat(LogLevel::Info, "{}", t * PER_THREAD + i);
+                    if (i % 16 == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        ReleaseBackend();
+
+        // Everything the threads logged was waiting at once, so one pass merges it all
+        const auto timestamps = CapturedTimestamps();
+        ASSERT_EQ(timestamps.size(), size_t(THREADS * PER_THREAD + 1));
+        EXPECT_TRUE(std::is_sorted(timestamps.begin() + 1, timestamps.end()));
+
+        std::vector<int> values = CapturedSequence();
+        std::sort(values.begin(), values.end());
+        EXPECT_EQ(values, Iota(THREADS * PER_THREAD));
+    }
+
+    TEST_F(LogRingTests, ExitedThreads_RecordsAreDelivered) {
+        const LogChannel& channel = LogManager::Instance().GetChannel("LogRingTest");
+        constexpr int THREADS = 64;
+
+        for (int t = 0; t < THREADS; ++t) {
+            std::thread([&channel, t] { channel.LogFormat(LogLevel::Info, "{}", t); }).join();
+        }
+
+        EXPECT_EQ(CapturedSequence(), Iota(THREADS));
+    }
+
+}
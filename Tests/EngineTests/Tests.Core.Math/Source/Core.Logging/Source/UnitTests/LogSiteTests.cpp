@@ -0,0 +1,166 @@
+// Tests/Core.Logging/Source/UnitTests/LogSiteTests.cpp
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Trace statements are compiled out of this file only
+#define AKH_LOG_COMPILE_LEVEL 1
+
+import Akhanda.Core.Logging;
+#include "Core/Logging/Core.Logging.hpp"
+#include "../Fixtures/LoggingTestFixtures.hpp"
+
+using namespace Akhanda::Tests::Logging;
+using namespace Akhanda::Logging;
+
+namespace {
+
+    constexpr std::string_view THIS_FILE = "LogSiteTests.cpp";
+
+    class LogSiteTests : public LoggingTestFixture {
+    protected:
+        void SetUp() override {
+            LoggingTestFixture::SetUp();
+            channel_ = &LogManager::Instance().GetChannel("LogSiteTest");
+            channel_->SetLevel(LogLevel::Trace);
+        }
+
+        void TearDown() override {
+            channel_->SetLevel(LogLevel::Debug);
+            LoggingTestFixture::TearDown();
+        }
+
+        static bool HasSite(uint32_t line) {
+            bool found = false;
+            LogManager::Instance().ForEachLogSite([&](LogSite& site) {
+                found |= site.GetLocation().line() == line && std::string_view(site.GetLocation().file_name()).ends_with(THIS_FILE);
+            });
+            return found;
+        }
+
+        // Whether some captured line was stamped with this file and line
+        bool CapturedAt(uint32_t line) {
+            const std::string location = std::string(THIS_FILE) + ":" + std::to_string(line) + "]";
+            for (const std::string& captured : CapturedLines()) {
+                if (captured.find(location) != std::string::npos) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        LogChannel* channel_ = nullptr;
+    };
+
+    // ============================================================================
+    // Compile-Time Threshold
+    // ============================================================================
+
+    TEST_F(LogSiteTests, CompileLevel_StripsStatementsBelowThreshold) {
+        int evaluated = 0;
+        const uint32_t traceLine = __LINE__ + 1;
+        LOG_TRACE_FORMAT(*channel_, "trace {}", ++evaluated);
+        const uint32_t debugLine = __LINE__ + 1;
+        LOG_DEBUG_FORMAT(*channel_, "debug {}", ++evaluated);
+
+        EXPECT_EQ(evaluated, 1);
+        EXPECT_EQ(CapturedMessages(), std::vector<std::string>{ "debug 1" });
+        EXPECT_FALSE(HasSite(traceLine));
+        EXPECT_TRUE(HasSite(debugLine));
+    }
+
+    TEST_F(LogSiteTests, RuntimeLevel_SkipsArgumentEvaluation) {
+        channel_->SetLevel(LogLevel::Error);
+
+        int evaluated = 0;
+        LOG_WARNING_FORMAT(*channel_, "{}", ++evaluated);
+        LOG_ERROR_FORMAT(*channel_, "{}", ++evaluated);
+
+        EXPECT_EQ(evaluated, 1);
+        EXPECT_EQ(CapturedMessages(), std::vector<std::string>{ "1" });
+    }
+
+    TEST_F(LogSiteTests, ChannelArgument_IsEvaluatedOnce) {
+        int resolved = 0;
+        const auto channel = [&]() -> LogChannel& {
+            ++resolved;
+            return *channel_;
+        };
+        LOG_INFO(channel(), "once");
+        EXPECT_EQ(resolved, 1);
+
+        channel_->SetLevel(LogLevel::Error);
+        LOG_INFO(channel(), "filtered");
+        EXPECT_EQ(resolved, 2);
+        EXPECT_EQ(CapturedMessages(), std::vector<std::string>{ "once" });
+    }
+
+    // ============================================================================
+    // Per-Site Switches
+    // ============================================================================
+
+    TEST_F(LogSiteTests, SetLogSitesEnabled_TogglesOneSite) {
+        auto& manager = LogManager::Instance();
+        int evaluated = 0;
+        const uint32_t siteLine = __LINE__ + 1;
+        const auto logAtSite = [&](int value) { LOG_INFO_FORMAT(*channel_, "site {} {}", value, ++evaluated); };
+        const auto logElsewhere = [&](int value) { LOG_INFO_FORMAT(*channel_, "other {}", value); };
+
+        logAtSite(1);
+        manager.SetLogSitesEnabled(THIS_FILE, siteLine, false);
+        logAtSite(2);
+        logElsewhere(2);
+        manager.SetLogSitesEnabled(THIS_FILE, siteLine, true);
+        logAtSite(3);
+
+        const std::vector<std::string> expected = { "site 1 1", "other 2", "site 3 2" };
+        EXPECT_EQ(CapturedMessages(), expected);
+        EXPECT_EQ(evaluated, 2);
+    }
+
+    TEST_F(LogSiteTests, SetLogSitesEnabled_AppliesToSitesThatRunLater) {
+        auto& manager = LogManager::Instance();
+        const uint32_t siteLine = __LINE__ + 2;
+        manager.SetLogSitesEnabled(THIS_FILE, siteLine, false);
+        const auto logAtSite = [&](int value) { LOG_WARNING_FORMAT(*channel_, "late {}", value); };
+
+        logAtSite(1);
+        EXPECT_TRUE(HasSite(siteLine));
+        manager.SetLogSitesEnabled(THIS_FILE, siteLine, true);
+        logAtSite(2);
+
+        EXPECT_EQ(CapturedMessages(), std::vector<std::string>{ "late 2" });
+    }
+
+    // ============================================================================
+    // Source Locations
+    // ============================================================================
+
+    TEST_F(LogSiteTests, Location_IsTheCallSite) {
+        const uint32_t macroLine = __LINE__ + 1;
+        LOG_INFO_FORMAT(*channel_, "macro {}", 1);
+        const uint32_t directLine = __LINE__ + 1;
+        channel_->LogFormat(LogLevel::Info, "direct {}", 2);
+        const uint32_t helperLine = __LINE__ + 1;
+        channel_->WarningFormat("helper {}", 3);
+        const uint32_t plainLine = __LINE__ + 1;
+        LOG_INFO(*channel_, "plain");
+
+        EXPECT_TRUE(CapturedAt(macroLine));
+        EXPECT_TRUE(CapturedAt(directLine));
+        EXPECT_TRUE(CapturedAt(helperLine));
+        EXPECT_TRUE(CapturedAt(plainLine));
+    }
+
+    TEST_F(LogSiteTests, Location_IsTheCallSite_Immediate) {
+        LogManager::Instance().SetDeferredFormatting(false);
+        const uint32_t directLine = __LINE__ + 1;
+        channel_->LogFormat(LogLevel::Info, "direct {}", 1);
+
+        WaitForCaptured(1);
+        EXPECT_TRUE(CapturedAt(directLine));
+    }
+
+}
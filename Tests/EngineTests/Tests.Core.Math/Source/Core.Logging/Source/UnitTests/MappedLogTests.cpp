@@ -0,0 +1,220 @@
+// Tests/Core.Logging/Source/UnitTests/MappedLogTests.cpp
+#include <gtest/gtest.h>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+import Akhanda.Core.Logging;
+#include "../Fixtures/LoggingTestFixtures.hpp"
+
+using namespace Akhanda::Tests::Logging;
+using namespace Akhanda::Logging;
+
+namespace {
+
+    class MappedLogTests : public LoggingTestFixture {
+    protected:
+        void SetUp() override {
+            LoggingTestFixture::SetUp();
+            const auto* test = ::testing::UnitTest::GetInstance()->current_test_info();
+            path_ = std::filesystem::temp_directory_path() / (std::string("AkhandaMappedLog_") + test->name() + ".akhring");
+            std::filesystem::remove(path_);
+
+            // Children re-run the test binary instead of forking a process
+            // that already has logging threads. The flag is process-wide, so
+            // TearDown puts back what other suites expect.
+            savedDeathTestStyle_ = GTEST_FLAG_GET(death_test_style);
+            GTEST_FLAG_SET(death_test_style, "threadsafe");
+        }
+
+        void TearDown() override {
+            GTEST_FLAG_SET(death_test_style, savedDeathTestStyle_);
+            LoggingTestFixture::TearDown();
+            std::filesystem::remove(path_);
+        }
+
+        static void WriteLine(MappedLogSink& sink, const std::string& text) {
+            sink.Write(LogEntry(LogLevel::Info, "MappedLogTest", text));
+        }
+
+        static std::string Line(uint64_t index) {
+            // Varying lengths so frames land at every alignment
+            return "line " + std::to_string(index) + " " + std::string(index % 37, '.');
+        }
+
+        // Every entry is the line for its sequence number, oldest first
+        static void ExpectContiguous(const MappedLogRecovery& recovery) {
+            for (size_t i = 0; i < recovery.entries.size(); ++i) {
+                ASSERT_EQ(recovery.entries[i], Line(recovery.firstSequence + i));
+            }
+        }
+
+        std::filesystem::path path_;
+        std::string savedDeathTestStyle_;
+    };
+
+    // ============================================================================
+    // Clean Shutdown
+    // ============================================================================
+
+    TEST_F(MappedLogTests, Close_RecoversEveryLine) {
+        {
+            MappedLogSink sink(path_);
+            ASSERT_TRUE(sink.IsOpen());
+            for (uint64_t i = 0; i < 100; ++i) {
+                WriteLine(sink, Line(i) + "\n");
+            }
+            EXPECT_EQ(sink.GetSequence(), 100u);
+        }
+
+        const MappedLogRecovery recovery = RecoverMappedLog(path_);
+        EXPECT_TRUE(recovery.error.empty()) << recovery.error;
+        EXPECT_EQ(recovery.state, MappedLogState::Closed);
+        EXPECT_EQ(recovery.firstSequence, 0u);
+        ASSERT_EQ(recovery.entries.size(), 100u);
+        ExpectContiguous(recovery);
+    }
+
+    TEST_F(MappedLogTests, Wraparound_KeepsTheNewestLines) {
+        MappedLogOptions options;
+        options.capacity = 16 * 1024;
+        constexpr uint64_t LINES = 5000;
+        {
+            MappedLogSink sink(path_, options);
+            for (uint64_t i = 0; i < LINES; ++i) {
+                WriteLine(sink, Line(i));
+            }
+        }
+
+        const MappedLogRecovery recovery = RecoverMappedLog(path_);
+        EXPECT_TRUE(recovery.error.empty()) << recovery.error;
+        ASSERT_FALSE(recovery.entries.empty());
+        EXPECT_GT(recovery.firstSequence, 0u);
+        EXPECT_EQ(recovery.firstSequence + recovery.entries.size(), LINES);
+        ExpectContiguous(recovery);
+    }
+
+    TEST_F(MappedLogTests, AsLogManagerSink_StoresFormattedLines) {
+        auto& manager = LogManager::Instance();
+        auto sink = std::make_unique<MappedLogSink>(path_);
+        MappedLogSink* mapped = sink.get();
+        manager.AddSink(std::move(sink));
+
+        const LogChannel& channel = manager.GetChannel("MappedLogTest");
+        for (int i = 0; i < 10; ++i) {
+            channel.LogFormat(LogLevel::Info, "managed {}", i);
+        }
+        manager.Flush();
+
+        // spdlog's async flush does not wait for its queue
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (mapped->GetSequence() < 10 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+        manager.RemoveSink(mapped);
+
+        const MappedLogRecovery recovery = RecoverMappedLog(path_);
+        ASSERT_EQ(recovery.entries.size(), 10u);
+        EXPECT_NE(recovery.entries.back().find("[MappedLogTest]"), std::string::npos);
+        EXPECT_TRUE(recovery.entries.back().ends_with("managed 9"));
+    }
+
+    // ============================================================================
+    // Abnormal Exit
+    // ============================================================================
+
+    TEST_F(MappedLogTests, ChildKilledMidLogging_RecoversCompletedLines) {
+        constexpr uint64_t LINES_BEFORE_KILL = 20000;
+
+        // The child exits from under a writer thread with no handlers,
+        // destructors or flushes, as if it had been killed
+        EXPECT_EXIT({
+            MappedLogOptions options;
+            options.capacity = 64 * 1024;
+            MappedLogSink sink(path_, options);
+            std::thread writer([&sink] {
+                for (uint64_t i = 0; ; ++i) {
+                    WriteLine(sink, Line(i));
+                }
+            });
+            while (sink.GetSequence() < LINES_BEFORE_KILL) {
+                std::this_thread::yield();
+            }
+            std::_Exit(7);
+        }, ::testing::ExitedWithCode(7), "");
+
+        const MappedLogRecovery recovery = RecoverMappedLog(path_);
+        EXPECT_TRUE(recovery.error.empty()) << recovery.error;
+        EXPECT_EQ(recovery.state, MappedLogState::Open);
+        ASSERT_FALSE(recovery.entries.empty());
+        EXPECT_GE(recovery.firstSequence + recovery.entries.size(), LINES_BEFORE_KILL);
+        ExpectContiguous(recovery);
+    }
+
+    TEST_F(MappedLogTests, ChildAborts_HandlerFinalizesHeader) {
+        constexpr uint64_t LINES = 1000;
+
+        EXPECT_EXIT({
+            MappedLogOptions options;
+            options.checkpointInterval = 4096;
+            MappedLogSink sink(path_, options);
+            for (uint64_t i = 0; i < LINES; ++i) {
+                WriteLine(sink, Line(i));
+            }
+            std::abort();
+        }, [](int) { return true; }, "");
+
+        const MappedLogRecovery recovery = RecoverMappedLog(path_);
+        EXPECT_TRUE(recovery.error.empty()) << recovery.error;
+        EXPECT_EQ(recovery.state, MappedLogState::Crashed);
+        EXPECT_EQ(recovery.crashCode, SIGABRT);
+        EXPECT_EQ(recovery.firstSequence, 0u);
+        ASSERT_EQ(recovery.entries.size(), LINES);
+        ExpectContiguous(recovery);
+    }
+
+    TEST_F(MappedLogTests, Recover_RejectsForeignAndTruncatedFiles) {
+        EXPECT_FALSE(RecoverMappedLog(path_).error.empty());
+
+        {
+            std::ofstream file(path_, std::ios::binary);
+            file << "definitely not a log ring";
+        }
+        EXPECT_FALSE(RecoverMappedLog(path_).error.empty());
+
+        {
+            MappedLogSink sink(path_);
+            WriteLine(sink, Line(0));
+        }
+        std::filesystem::resize_file(path_, 4096 + 100);
+        EXPECT_FALSE(RecoverMappedLog(path_).error.empty());
+    }
+
+    TEST_F(MappedLogTests, Recover_RejectsCapacityLargerThanTheFile) {
+        {
+            MappedLogSink sink(path_);
+            WriteLine(sink, Line(0));
+        }
+
+        // Capacity sits after the 8-byte magic and two 32-bit fields
+        for (const uint64_t capacity : {uint64_t(1) << 60, uint64_t(1) << 40, uint64_t(4096 + 4)}) {
+            {
+                std::fstream file(path_, std::ios::binary | std::ios::in | std::ios::out);
+                file.seekp(16);
+                file.write(reinterpret_cast<const char*>(&capacity), sizeof(capacity));
+            }
+            MappedLogRecovery recovery;
+            EXPECT_NO_THROW(recovery = RecoverMappedLog(path_));
+            EXPECT_FALSE(recovery.error.empty()) << capacity;
+            EXPECT_TRUE(recovery.entries.empty()) << capacity;
+        }
+    }
+
+}
@@ -0,0 +1,213 @@
+// Tests/Core.Logging/Source/UnitTests/RateLimitTests.cpp
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Every level is compiled in, whatever the configuration
+#define AKH_LOG_COMPILE_LEVEL 0
+
+import Akhanda.Core.Logging;
+#include "Core/Logging/Core.Logging.hpp"
+#include "../Fixtures/LoggingTestFixtures.hpp"
+
+using namespace Akhanda::Tests::Logging;
+using namespace Akhanda::Logging;
+
+namespace {
+
+    class RateLimitTests : public LoggingTestFixture {
+    protected:
+        void SetUp() override {
+            LoggingTestFixture::SetUp();
+            channel_ = &LogManager::Instance().GetChannel("RateLimitTest");
+            other_ = &LogManager::Instance().GetChannel("RateLimitOther");
+            channel_->SetLevel(LogLevel::Trace);
+            other_->SetLevel(LogLevel::Trace);
+        }
+
+        void TearDown() override {
+            auto& manager = LogManager::Instance();
+            manager.SetSuppressionReportInterval(DEFAULT_SUPPRESSION_REPORT_INTERVAL);
+            for (size_t level = 0; level < static_cast<size_t>(LogLevel::Count); ++level) {
+                manager.SetRateLimit(static_cast<LogLevel>(level), LogRateLimit{});
+            }
+            channel_->SetLevel(LogLevel::Debug);
+            other_->SetLevel(LogLevel::Debug);
+            LoggingTestFixture::TearDown();
+        }
+
+        static std::vector<std::string> Numbered(const std::string& prefix, int first, int last) {
+            std::vector<std::string> messages;
+            for (int i = first; i <= last; ++i) {
+                messages.push_back(prefix + " " + std::to_string(i));
+            }
+            return messages;
+        }
+
+        // One second per message, so nothing refills while a test runs
+        static constexpr LogRateLimit SLOW = { 1, 3 };
+
+        LogChannel* channel_ = nullptr;
+        LogChannel* other_ = nullptr;
+    };
+
+    // ============================================================================
+    // Limits
+    // ============================================================================
+
+    TEST_F(RateLimitTests, NoLimit_AdmitsEverything) {
+        EXPECT_EQ(channel_->GetRateLimit(LogLevel::Info).messagesPerSecond, 0u);
+        for (int i = 0; i < 100; ++i) {
+            LOG_INFO_FORMAT(*channel_, "open {}", i);
+        }
+
+        EXPECT_EQ(CapturedMessages().size(), 100u);
+    }
+
+    TEST_F(RateLimitTests, Burst_ThenSuppressedWithSummaryOnFlush) {
+        channel_->SetRateLimit(LogLevel::Warning, SLOW);
+        int evaluated = 0;
+        for (int i = 0; i < 10; ++i) {
+            LOG_WARNING_FORMAT(*channel_, "burst {} {}", i, ++evaluated);
+        }
+
+        // Dropped statements do not evaluate their arguments either
+        EXPECT_EQ(evaluated, 3);
+        std::vector<std::string> expected = { "burst 0 1", "burst 1 2", "burst 2 3" };
+        expected.push_back("Suppressed 7 messages from this call site");
+        EXPECT_EQ(CapturedMessages(), expected);
+
+        // The summary is logged once
+        LogManager::Instance().Flush();
+        EXPECT_EQ(CapturedMessages().size(), 4u);
+    }
+
+    TEST_F(RateLimitTests, QuietSite_SummaryLoggedWithoutFlush) {
+        LogManager::Instance().SetSuppressionReportInterval(std::chrono::milliseconds(20));
+        channel_->SetRateLimit(LogLevel::Warning, SLOW);
+        for (int i = 0; i < 10; ++i) {
+            LOG_WARNING_FORMAT(*channel_, "quiet {}", i);
+        }
+
+        // The site never logs again; the backend reports on its own
+        const std::string summary = "Suppressed 7 messages from this call site";
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        bool reported = false;
+        while (!reported && std::chrono::steady_clock::now() < deadline) {
+            {
+                std::lock_guard<std::mutex> lock(captured_->mutex);
+                reported = std::find(captured_->messages.begin(), captured_->messages.end(), summary) != captured_->messages.end();
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        EXPECT_TRUE(reported);
+
+        std::vector<std::string> expected = Numbered("quiet", 0, 2);
+        expected.push_back(summary);
+        EXPECT_EQ(CapturedMessages(), expected);
+    }
+
+    TEST_F(RateLimitTests, Refill_SummaryPrecedesTheNextMessage) {
+        channel_->SetRateLimit(LogLevel::Info, { 20, 1 });
+        const auto logAtSite = [&](int value) { LOG_INFO_FORMAT(*channel_, "refill {}", value); };
+
+        logAtSite(0);
+        logAtSite(1);
+        logAtSite(2);
+        std::this_thread::sleep_for(std::chrono::milliseconds(120));
+        logAtSite(3);
+
+        const std::vector<std::string> expected = { "refill 0", "Suppressed 2 messages from this call site", "refill 3" };
+        EXPECT_EQ(CapturedMessages(), expected);
+    }
+
+    TEST_F(RateLimitTests, Limits_ArePerLevelAndPerChannel) {
+        channel_->SetRateLimit(LogLevel::Debug, { 1, 1 });
+        const auto logDebug = [](LogChannel& channel, int value) { LOG_DEBUG_FORMAT(channel, "debug {}", value); };
+        const auto logInfo = [](LogChannel& channel, int value) { LOG_INFO_FORMAT(channel, "info {}", value); };
+
+        for (int i = 0; i < 5; ++i) {
+            logDebug(*channel_, i);
+            logInfo(*channel_, i);
+        }
+        const std::vector<std::string> messages = CapturedMessages();
+        EXPECT_EQ(std::count_if(messages.begin(), messages.end(), [](const std::string& m) { return m.starts_with("debug"); }), 1);
+        EXPECT_EQ(std::count_if(messages.begin(), messages.end(), [](const std::string& m) { return m.starts_with("info"); }), 5);
+
+        // The same statement on an unlimited channel is not held back
+        ClearCaptured();
+        for (int i = 0; i < 5; ++i) {
+            logDebug(*other_, i);
+        }
+        EXPECT_EQ(CapturedMessages(), Numbered("debug", 0, 4));
+    }
+
+    TEST_F(RateLimitTests, Sites_HaveTheirOwnBuckets) {
+        channel_->SetRateLimit(LogLevel::Error, SLOW);
+        const auto runaway = [&](int value) { LOG_ERROR_FORMAT(*channel_, "runaway {}", value); };
+        const auto quiet = [&](int value) { LOG_ERROR_FORMAT(*channel_, "quiet {}", value); };
+
+        for (int i = 0; i < 50; ++i) {
+            runaway(i);
+        }
+        quiet(0);
+        quiet(1);
+
+        std::vector<std::string> expected = Numbered("runaway", 0, 2);
+        expected.push_back("quiet 0");
+        expected.push_back("quiet 1");
+        expected.push_back("Suppressed 47 messages from this call site");
+        EXPECT_EQ(CapturedMessages(), expected);
+    }
+
+    TEST_F(RateLimitTests, ManagerLimit_ReachesExistingAndNewChannels) {
+        auto& manager = LogManager::Instance();
+        manager.SetRateLimit(LogLevel::Info, { 5, 2 });
+
+        EXPECT_EQ(channel_->GetRateLimit(LogLevel::Info).messagesPerSecond, 5u);
+        EXPECT_EQ(channel_->GetRateLimit(LogLevel::Info).burst, 2u);
+        EXPECT_EQ(manager.GetChannel("RateLimitCreatedLater").GetRateLimit(LogLevel::Info).messagesPerSecond, 5u);
+        EXPECT_EQ(channel_->GetRateLimit(LogLevel::Warning).messagesPerSecond, 0u);
+
+        // A channel can still opt out
+        channel_->SetRateLimit(LogLevel::Info, LogRateLimit{});
+        for (int i = 0; i < 10; ++i) {
+            LOG_INFO_FORMAT(*channel_, "opted out {}", i);
+        }
+        EXPECT_EQ(CapturedMessages().size(), 10u);
+    }
+
+    TEST_F(RateLimitTests, RemoveChannel_WhileSummariesAreReported) {
+        auto& manager = LogManager::Instance();
+        std::atomic<bool> stop{ false };
+        std::thread reporter([&] {
+            while (!stop.load(std::memory_order_relaxed)) {
+                manager.ReportSuppressedMessages();
+            }
+        });
+
+        // A sanitizer build catches a report that reads a removed channel
+        for (int i = 0; i < 200; ++i) {
+            LogChannel& transient = manager.GetChannel("RateLimitTransient");
+            transient.SetLevel(LogLevel::Trace);
+            transient.SetRateLimit(LogLevel::Warning, SLOW);
+            for (int j = 0; j < 5; ++j) {
+                LOG_WARNING_FORMAT(transient, "transient {}", j);
+            }
+            manager.RemoveChannel("RateLimitTransient");
+        }
+        stop.store(true, std::memory_order_relaxed);
+        reporter.join();
+
+        for (const std::string& message : CapturedMessages()) {
+            EXPECT_TRUE(message.starts_with("transient ") || message.starts_with("Suppressed ")) << message;
+        }
+    }
+
+}
@@ -0,0 +1,176 @@
+// Tests/Core.Logging/Source/UnitTests/StructuredLoggingTests.cpp
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Every level is compiled in, whatever the configuration
+#define AKH_LOG_COMPILE_LEVEL 0
+
+import Akhanda.Core.Logging;
+#include "Core/Logging/Core.Logging.hpp"
+#include "../Fixtures/LoggingTestFixtures.hpp"
+
+using namespace Akhanda::Tests::Logging;
+using namespace Akhanda::Logging;
+
+namespace {
+
+    enum class PassKind : uint8_t { Depth, Shadow, Lighting };
+
+    class StructuredLoggingTests : public LoggingTestFixture {
+    protected:
+        void SetUp() override {
+            LoggingTestFixture::SetUp();
+            const auto* test = ::testing::UnitTest::GetInstance()->current_test_info();
+            path_ = std::filesystem::temp_directory_path() / (std::string("AkhandaStructured_") + test->name());
+            channel_ = &LogManager::Instance().GetChannel("StructuredTest");
+            channel_->SetLevel(LogLevel::Trace);
+        }
+
+        void TearDown() override {
+            RemoveRecordSink();
+            channel_->SetLevel(LogLevel::Debug);
+            LoggingTestFixture::TearDown();
+            std::filesystem::remove(path_);
+        }
+
+        template<typename Sink>
+        void AddRecordSink() {
+            auto sink = std::make_unique<Sink>(path_);
+            ASSERT_TRUE(sink->IsOpen());
+            recordSink_ = sink.get();
+            LogManager::Instance().AddRecordSink(std::move(sink));
+        }
+
+        // Removing the sink destroys it, which flushes the file
+        void RemoveRecordSink() {
+            if (recordSink_) {
+                LogManager::Instance().Flush();
+                LogManager::Instance().RemoveRecordSink(recordSink_);
+                recordSink_ = nullptr;
+            }
+        }
+
+        std::vector<std::string> ReadLines() {
+            RemoveRecordSink();
+            std::vector<std::string> lines;
+            std::ifstream file(path_);
+            for (std::string line; std::getline(file, line);) {
+                lines.push_back(line);
+            }
+            return lines;
+        }
+
+        void LogFrame(int frame) {
+            channel_->Log(LogLevel::Info, "FrameEnd", Field("frame", frame), Field("ms", 16.5), Field("pass", "shadow"));
+        }
+
+        std::filesystem::path path_;
+        LogChannel* channel_ = nullptr;
+        ILogRecordSink* recordSink_ = nullptr;
+    };
+
+    // ============================================================================
+    // Text
+    // ============================================================================
+
+    TEST_F(StructuredLoggingTests, Text_RendersEventAndFields) {
+        LogFrame(12);
+        channel_->Log(LogLevel::Warning, "PassSkipped", Field("kind", PassKind::Shadow), Field("culled", true),
+            Field("id", uint64_t(1) << 40), Field("tag", 'x'));
+
+        const std::vector<std::string> expected = {
+            "FrameEnd frame=12 ms=16.5 pass=\"shadow\"",
+            "PassSkipped kind=1 culled=true id=1099511627776 tag=x"
+        };
+        EXPECT_EQ(CapturedMessages(), expected);
+    }
+
+    TEST_F(StructuredLoggingTests, Text_SameWithoutDeferredFormatting) {
+        LogManager::Instance().SetDeferredFormatting(false);
+        const std::string name = "a runtime string";
+        channel_->Log(LogLevel::Info, "Loaded", Field("name", name), Field("bytes", 4096u));
+
+        WaitForCaptured(1);
+        EXPECT_EQ(CapturedMessages(), std::vector<std::string>{ "Loaded name=\"a runtime string\" bytes=4096" });
+    }
+
+    TEST_F(StructuredLoggingTests, Macro_SkipsFieldsBelowTheChannelLevel) {
+        channel_->SetLevel(LogLevel::Warning);
+        int evaluated = 0;
+        LOG_INFO_EVENT(*channel_, "Hidden", Field("count", ++evaluated));
+        LOG_WARNING_EVENT(*channel_, "Shown", Field("count", ++evaluated));
+
+        EXPECT_EQ(evaluated, 1);
+        EXPECT_EQ(CapturedMessages(), std::vector<std::string>{ "Shown count=1" });
+    }
+
+    // ============================================================================
+    // Record Sinks
+    // ============================================================================
+
+    TEST_F(StructuredLoggingTests, Json_KeepsFieldTypes) {
+        AddRecordSink<JsonLogSink>();
+        LogFrame(7);
+        channel_->Log(LogLevel::Error, "Bad \"asset\"", Field("path", "C:\\Assets\\a.dds"), Field("ok", false));
+        channel_->InfoFormat("plain {}", 3);
+
+        const std::vector<std::string> lines = ReadLines();
+        ASSERT_EQ(lines.size(), 3u);
+        EXPECT_TRUE(lines[0].starts_with("{\"time\":")) << lines[0];
+        EXPECT_NE(lines[0].find("\"level\":\"INFO\",\"channel\":\"StructuredTest\""), std::string::npos) << lines[0];
+        EXPECT_TRUE(lines[0].ends_with(",\"event\":\"FrameEnd\",\"frame\":7,\"ms\":16.5,\"pass\":\"shadow\"}")) << lines[0];
+        EXPECT_TRUE(lines[1].ends_with(",\"event\":\"Bad \\\"asset\\\"\",\"path\":\"C:\\\\Assets\\\\a.dds\",\"ok\":false}")) << lines[1];
+        EXPECT_TRUE(lines[2].ends_with(",\"message\":\"plain 3\"}")) << lines[2];
+    }
+
+    TEST_F(StructuredLoggingTests, Binary_ReadsBackAsText) {
+        AddRecordSink<BinaryLogSink>();
+        LogFrame(1);
+        LogFrame(2);
+        channel_->Log(LogLevel::Info, "Braces {}", Field("n", -3));
+        RemoveRecordSink();
+
+        BinaryLogReader reader(path_);
+        ASSERT_TRUE(reader.IsOpen()) << reader.GetError();
+        std::vector<std::string> messages;
+        BinaryLogRecord record;
+        while (reader.Next(record)) {
+            messages.emplace_back(record.message);
+        }
+
+        const std::vector<std::string> expected = {
+            "FrameEnd frame=1 ms=16.5 pass=\"shadow\"",
+            "FrameEnd frame=2 ms=16.5 pass=\"shadow\"",
+            "Braces {} n=-3"
+        };
+        EXPECT_EQ(messages, expected);
+    }
+
+    // ============================================================================
+    // Allocations
+    // ============================================================================
+
+    TEST_F(StructuredLoggingTests, SteadyState_DoesNotAllocate) {
+        // The first record from a thread creates its ring
+        for (int i = 0; i < 16; ++i) {
+            LogFrame(i);
+        }
+        LogManager::Instance().Flush();
+
+        BeginCountingAllocations();
+        for (int i = 0; i < 1000; ++i) {
+            LogFrame(i);
+            LOG_INFO_EVENT(*channel_, "Tick", Field("frame", i), Field("pass", PassKind::Lighting));
+        }
+        const size_t allocations = EndCountingAllocations();
+
+        EXPECT_EQ(allocations, 0u);
+        EXPECT_EQ(CapturedMessages().size(), 16u + 2000u);
+    }
+
+}
@@ -0,0 +1,355 @@
+// Tests/Core.Math/Source/PerformanceTests/BoundingVolumePerformanceTests.cpp
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+import Akhanda.Core.Math;
+#include "../Fixtures/MathTestFixtures.hpp"
+#include "../TestConstants.hpp"
+
+using namespace Akhanda::Tests::Math;
+using namespace Akhanda::Math;
+
+namespace {
+
+    class BoundingVolumePerformanceTests : public PerformanceTestFixture {
+    protected:
+        static constexpr size_t BOX_COUNT = 10000;
+        static constexpr size_t POINT_COUNT = 100000;
+
+        void SetUp() override {
+            PerformanceTestFixture::SetUp();
+
+            localBounds.resize(BOX_COUNT);
+            transforms.resize(BOX_COUNT);
+            matrices.resize(BOX_COUNT);
+            worldBounds.resize(BOX_COUNT);
+            for (size_t i = 0; i < BOX_COUNT; ++i) {
+                const Vector3 center = RandomVector3(-5.0f, 5.0f);
+                const Vector3 halfSize(RandomFloat(0.1f, 3.0f), RandomFloat(0.1f, 3.0f), RandomFloat(0.1f, 3.0f));
+                localBounds[i] = AABB(center - halfSize, center + halfSize);
+                transforms[i] = Transform(RandomVector3(-500.0f, 500.0f),
+                    FromAxisAngle(RandomNormalizedVector3(), RandomFloat(0.0f, TWO_PI)), Vector3(RandomFloat(0.5f, 2.0f)));
+                matrices[i] = transforms[i].ToMatrix();
+            }
+        }
+
+        // The eight-corner transform TransformAABB used before Arvo's method
+        static AABB TransformCorners(const AABB& box, const Matrix4& matrix) {
+            AABB result;
+            for (int corner = 0; corner < 8; ++corner) {
+                const Vector3 point = matrix.TransformPoint(Vector3(
+                    (corner & 1) ? box.max.x : box.min.x,
+                    (corner & 2) ? box.max.y : box.min.y,
+                    (corner & 4) ? box.max.z : box.min.z));
+                if (corner == 0) {
+                    result.min = result.max = point;
+                }
+                else {
+                    result.Expand(point);
+                }
+            }
+            return result;
+        }
+
+        // Classic Ritter: farthest point from an arbitrary point, then the
+        // farthest from that, then one growing pass
+        static Sphere RitterSphere(const std::vector<Vector3>& points) {
+            auto farthestFrom = [&](const Vector3& origin) {
+                size_t best = 0;
+                float bestDistance = -1.0f;
+                for (size_t i = 0; i < points.size(); ++i) {
+                    const float distance = DistanceSquared(origin, points[i]);
+                    if (distance > bestDistance) {
+                        bestDistance = distance;
+                        best = i;
+                    }
+                }
+                return points[best];
+            };
+
+            const Vector3 a = farthestFrom(points[0]);
+            const Vector3 b = farthestFrom(a);
+            Vector3 center = (a + b) * 0.5f;
+            float radius = Distance(a, b) * 0.5f;
+            for (const Vector3& point : points) {
+                const float distance = Distance(center, point);
+                if (distance > radius) {
+                    const float newRadius = (radius + distance) * 0.5f;
+                    center = center + (point - center) * ((newRadius - radius) / distance);
+                    radius = newRadius;
+                }
+            }
+            return Sphere(center, radius);
+        }
+
+        OBB RandomOBB(float spread) {
+            return OBB(RandomVector3(-spread, spread),
+                Vector3(RandomFloat(0.2f, 3.0f), RandomFloat(0.2f, 3.0f), RandomFloat(0.2f, 3.0f)),
+                ToMatrix3(FromAxisAngle(RandomNormalizedVector3(), RandomFloat(0.0f, TWO_PI))));
+        }
+
+        // The previous scalar OBB::Intersects: 15 explicit, normalized axes
+        static bool ScalarOBBIntersects(const OBB& a, const OBB& b) {
+            auto column = [](const Matrix3& m, int c) { return Vector3(m.m[c * 3], m.m[c * 3 + 1], m.m[c * 3 + 2]); };
+            const Vector3 axesA[3] = { column(a.rotation, 0), column(a.rotation, 1), column(a.rotation, 2) };
+            const Vector3 axesB[3] = { column(b.rotation, 0), column(b.rotation, 1), column(b.rotation, 2) };
+            const Vector3 translation = b.center - a.center;
+
+            auto separates = [&](const Vector3& axis) {
+                float radius = 0.0f;
+                for (int k = 0; k < 3; ++k) {
+                    radius += a.extents[k] * std::fabs(Dot(axis, axesA[k])) + b.extents[k] * std::fabs(Dot(axis, axesB[k]));
+                }
+                return std::fabs(Dot(translation, axis)) > radius;
+            };
+
+            for (int i = 0; i < 3; ++i) {
+                if (separates(axesA[i]) || separates(axesB[i])) {
+                    return false;
+                }
+            }
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    const Vector3 cross = Cross(axesA[i], axesB[j]);
+                    if (LengthSquared(cross) >= EPSILON && separates(Normalize(cross))) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        std::vector<AABB> localBounds;
+        std::vector<Transform> transforms;
+        std::vector<Matrix4> matrices;
+        std::vector<AABB> worldBounds;
+    };
+
+    // ============================================================================
+    // Box Transforms
+    // ============================================================================
+
+    TEST_F(BoundingVolumePerformanceTests, TransformAABBs_BatchVsPerBox) {
+        const double cornerTime = BenchmarkFunction([&]() {
+            for (size_t i = 0; i < BOX_COUNT; ++i) {
+                worldBounds[i] = TransformCorners(localBounds[i], matrices[i]);
+            }
+        }, 50);
+
+        const double scalarTime = BenchmarkFunction([&]() {
+            for (size_t i = 0; i < BOX_COUNT; ++i) {
+                worldBounds[i] = TransformAABB(localBounds[i], matrices[i]);
+            }
+        }, 50);
+
+        const double batchTime = BenchmarkFunction([&]() {
+            TransformAABBs(localBounds.data(), matrices.data(), worldBounds.data(), BOX_COUNT);
+        }, 50);
+
+        const double transformTime = BenchmarkFunction([&]() {
+            TransformAABBs(localBounds.data(), transforms.data(), worldBounds.data(), BOX_COUNT);
+        }, 50);
+
+        std::cout << "[PERF] TransformAABB " << BOX_COUNT << " boxes - 8 corners: " << cornerTime / BOX_COUNT << " ns/box" << std::endl;
+        std::cout << "[PERF] TransformAABB " << BOX_COUNT << " boxes - Arvo scalar: " << scalarTime / BOX_COUNT << " ns/box" << std::endl;
+        std::cout << "[PERF] TransformAABB " << BOX_COUNT << " boxes - Arvo SoA batch: " << batchTime / BOX_COUNT << " ns/box ("
+            << cornerTime / batchTime << "x over corners)" << std::endl;
+        std::cout << "[PERF] TransformAABB " << BOX_COUNT << " boxes - batch from Transform: " << transformTime / BOX_COUNT << " ns/box" << std::endl;
+    }
+
+    TEST_F(BoundingVolumePerformanceTests, UpdateHierarchyBounds_Throughput) {
+        std::vector<int32_t> parents(BOX_COUNT);
+        for (size_t i = 0; i < BOX_COUNT; ++i) {
+            parents[i] = i == 0 ? -1 : RandomInt(0, static_cast<int>(i) - 1);
+        }
+        std::vector<AABB> subtreeBounds(BOX_COUNT);
+
+        const double time = BenchmarkFunction([&]() {
+            UpdateHierarchyBounds(localBounds.data(), matrices.data(), parents.data(),
+                worldBounds.data(), subtreeBounds.data(), BOX_COUNT);
+        }, 50);
+
+        std::cout << "[PERF] UpdateHierarchyBounds " << BOX_COUNT << " nodes: " << time / 1.0e3 << " us ("
+            << time / BOX_COUNT << " ns/node)" << std::endl;
+        EXPECT_TRUE(subtreeBounds[0].Contains(worldBounds[BOX_COUNT - 1].Center()));
+    }
+
+    // ============================================================================
+    // Merging and Construction
+    // ============================================================================
+
+    TEST_F(BoundingVolumePerformanceTests, MergeAABBs_VsUnionLoop) {
+        TransformAABBs(localBounds.data(), matrices.data(), worldBounds.data(), BOX_COUNT);
+
+        AABB scalarResult;
+        const double scalarTime = BenchmarkFunction([&]() {
+            AABB merged = worldBounds[0];
+            for (size_t i = 1; i < BOX_COUNT; ++i) {
+                merged = merged.Union(worldBounds[i]);
+            }
+            scalarResult = merged;
+        }, 200);
+
+        AABB batchResult;
+        const double batchTime = BenchmarkFunction([&]() {
+            batchResult = MergeAABBs(worldBounds.data(), BOX_COUNT);
+        }, 200);
+
+        std::cout << "[PERF] MergeAABBs " << BOX_COUNT << " boxes - Union loop: " << scalarTime / BOX_COUNT << " ns/box" << std::endl;
+        std::cout << "[PERF] MergeAABBs " << BOX_COUNT << " boxes - SSE reduction: " << batchTime / BOX_COUNT << " ns/box ("
+            << scalarTime / batchTime << "x)" << std::endl;
+
+        EXPECT_EQ(batchResult.min.x, scalarResult.min.x);
+        EXPECT_EQ(batchResult.max.z, scalarResult.max.z);
+    }
+
+    TEST_F(BoundingVolumePerformanceTests, ComputeAABB_VsExpandLoop) {
+        std::vector<Vector3> points(POINT_COUNT);
+        for (Vector3& point : points) {
+            point = RandomVector3(-1000.0f, 1000.0f);
+        }
+
+        AABB scalarResult;
+        const double scalarTime = BenchmarkFunction([&]() {
+            AABB box(points[0], points[0]);
+            for (size_t i = 1; i < POINT_COUNT; ++i) {
+                box.Expand(points[i]);
+            }
+            scalarResult = box;
+        }, 50);
+
+        AABB batchResult;
+        const double batchTime = BenchmarkFunction([&]() {
+            batchResult = ComputeAABB(points.data(), POINT_COUNT);
+        }, 50);
+
+        std::cout << "[PERF] ComputeAABB " << POINT_COUNT << " points - Expand loop: " << scalarTime / POINT_COUNT << " ns/point" << std::endl;
+        std::cout << "[PERF] ComputeAABB " << POINT_COUNT << " points - SSE: " << batchTime / POINT_COUNT << " ns/point ("
+            << scalarTime / batchTime << "x)" << std::endl;
+
+        EXPECT_EQ(batchResult.min.y, scalarResult.min.y);
+        EXPECT_EQ(batchResult.max.x, scalarResult.max.x);
+    }
+
+    TEST_F(BoundingVolumePerformanceTests, ComputeBoundingSphere_VsRitter) {
+        // Points on an ellipsoid: Ritter's farthest-point seed is often poor here
+        std::vector<Vector3> points(POINT_COUNT);
+        for (Vector3& point : points) {
+            const Vector3 direction = RandomNormalizedVector3();
+            point = Vector3(direction.x * 40.0f, direction.y * 25.0f, direction.z * 10.0f);
+        }
+
+        Sphere ritter;
+        const double ritterTime = BenchmarkFunction([&]() { ritter = RitterSphere(points); }, 20);
+
+        Sphere epos;
+        const double eposTime = BenchmarkFunction([&]() { epos = ComputeBoundingSphere(points.data(), POINT_COUNT); }, 20);
+
+        std::cout << "[PERF] BoundingSphere " << POINT_COUNT << " points - Ritter: " << ritterTime / 1.0e3 << " us, radius "
+            << ritter.radius << std::endl;
+        std::cout << "[PERF] BoundingSphere " << POINT_COUNT << " points - EPOS-14 + SSE: " << eposTime / 1.0e3 << " us, radius "
+            << epos.radius << " (" << ritterTime / eposTime << "x)" << std::endl;
+
+        // The minimum enclosing sphere has the ellipsoid's major semi-axis as radius
+        EXPECT_LE(epos.radius, 40.0f * 1.05f);
+    }
+
+
+    // ============================================================================
+    // Oriented Boxes
+    // ============================================================================
+
+    TEST_F(BoundingVolumePerformanceTests, OBBIntersects_SimdVsScalar) {
+        const OBB query = RandomOBB(1.0f);
+        std::vector<OBB> others(BOX_COUNT);
+        for (OBB& box : others) {
+            box = RandomOBB(12.0f);
+        }
+        std::vector<uint8_t> scalarResults(BOX_COUNT);
+        std::vector<uint8_t> simdResults(BOX_COUNT);
+        std::unique_ptr<bool[]> batchResults(new bool[BOX_COUNT]);
+
+        const double scalarTime = BenchmarkFunction([&]() {
+            for (size_t i = 0; i < BOX_COUNT; ++i) {
+                scalarResults[i] = ScalarOBBIntersects(query, others[i]);
+            }
+        }, 50);
+
+        const double simdTime = BenchmarkFunction([&]() {
+            for (size_t i = 0; i < BOX_COUNT; ++i) {
+                simdResults[i] = query.Intersects(others[i]);
+            }
+        }, 50);
+
+        size_t hits = 0;
+        const double batchTime = BenchmarkFunction([&]() {
+            hits = IntersectOBBs(query, others.data(), batchResults.get(), BOX_COUNT);
+        }, 50);
+
+        size_t disagreements = 0;
+        for (size_t i = 0; i < BOX_COUNT; ++i) {
+            disagreements += (scalarResults[i] != 0) != batchResults[i] ? 1 : 0;
+        }
+
+        std::cout << "[PERF] OBB SAT " << BOX_COUNT << " pairs (" << hits << " overlaps) - scalar 15 axes: "
+            << scalarTime / BOX_COUNT << " ns/pair" << std::endl;
+        std::cout << "[PERF] OBB SAT " << BOX_COUNT << " pairs - SSE lanes: " << simdTime / BOX_COUNT << " ns/pair ("
+            << scalarTime / simdTime << "x)" << std::endl;
+        std::cout << "[PERF] OBB SAT " << BOX_COUNT << " pairs - IntersectOBBs batch: " << batchTime / BOX_COUNT << " ns/pair ("
+            << scalarTime / batchTime << "x)" << std::endl;
+
+        EXPECT_EQ(disagreements, 0u);
+    }
+
+    TEST_F(BoundingVolumePerformanceTests, CullOBBs_VsPerBoxAndAABB) {
+        // Camera at the origin looking down +Z
+        Frustum frustum;
+        frustum.planes[0] = Plane(Normalize(Vector3(1.0f, 0.0f, 0.6f)), 0.0f);
+        frustum.planes[1] = Plane(Normalize(Vector3(-1.0f, 0.0f, 0.6f)), 0.0f);
+        frustum.planes[2] = Plane(Normalize(Vector3(0.0f, 1.0f, 0.8f)), 0.0f);
+        frustum.planes[3] = Plane(Normalize(Vector3(0.0f, -1.0f, 0.8f)), 0.0f);
+        frustum.planes[4] = Plane(Vector3::UNIT_Z, 0.5f);
+        frustum.planes[5] = Plane(-Vector3::UNIT_Z, -200.0f);
+
+        std::vector<OBB> boxes(BOX_COUNT);
+        std::vector<AABB> enclosing(BOX_COUNT);
+        for (size_t i = 0; i < BOX_COUNT; ++i) {
+            // Long thin boxes are where the OBB test culls more than their AABBs
+            boxes[i] = RandomOBB(100.0f);
+            boxes[i].extents.x *= 4.0f;
+            enclosing[i] = boxes[i].ToAABB();
+        }
+        std::unique_ptr<bool[]> visible(new bool[BOX_COUNT]);
+
+        size_t singleVisible = 0;
+        const double singleTime = BenchmarkFunction([&]() {
+            singleVisible = 0;
+            for (size_t i = 0; i < BOX_COUNT; ++i) {
+                singleVisible += frustum.Intersects(boxes[i]) ? 1 : 0;
+            }
+        }, 50);
+
+        size_t batchVisible = 0;
+        const double batchTime = BenchmarkFunction([&]() {
+            batchVisible = CullOBBs(frustum, boxes.data(), visible.get(), BOX_COUNT);
+        }, 50);
+
+        size_t aabbVisible = 0;
+        for (size_t i = 0; i < BOX_COUNT; ++i) {
+            aabbVisible += frustum.Intersects(enclosing[i]) ? 1 : 0;
+        }
+
+        std::cout << "[PERF] OBB frustum cull " << BOX_COUNT << " boxes - per box: " << singleTime / BOX_COUNT << " ns/box" << std::endl;
+        std::cout << "[PERF] OBB frustum cull " << BOX_COUNT << " boxes - CullOBBs: " << batchTime / BOX_COUNT << " ns/box ("
+            << singleTime / batchTime << "x)" << std::endl;
+        std::cout << "[PERF] OBB frustum cull visible: " << batchVisible << " OBBs vs " << aabbVisible << " enclosing AABBs" << std::endl;
+
+        EXPECT_EQ(batchVisible, singleVisible);
+        EXPECT_LE(batchVisible, aabbVisible);
+    }
+
+}
@@ -0,0 +1,518 @@
+// Tests/Core.Math/Source/PerformanceTests/MathBenchmarks.cpp
+// Microbenchmarks for the public hot paths. Each body processes COUNT
+// elements; results are printed and, with --benchmark=record|compare,
+// stored in or checked against Data/BenchmarkData.json.
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+import Akhanda.Core.Math;
+#include "../Fixtures/MathTestFixtures.hpp"
+#include "../TestConstants.hpp"
+#include "../Utils/PerformanceTestUtils.hpp"
+
+using namespace Akhanda::Tests::Math;
+using namespace Akhanda::Math;
+
+namespace {
+
+    constexpr size_t COUNT = 4096;
+
+    class MathBenchmarks : public MathTestFixture {
+    protected:
+        void SetUp() override {
+            MathTestFixture::SetUp();
+
+            vectorsA_.resize(COUNT);
+            vectorsB_.resize(COUNT);
+            vectorsOut_.resize(COUNT);
+            for (size_t i = 0; i < COUNT; ++i) {
+                vectorsA_[i] = RandomVector3(-100.0f, 100.0f);
+                vectorsB_[i] = RandomVector3(-100.0f, 100.0f);
+            }
+
+            floatsA_.resize(COUNT * 4);
+            floatsB_.resize(COUNT * 4);
+            floatsOut_.resize(COUNT * 4);
+            for (size_t i = 0; i < floatsA_.size(); ++i) {
+                floatsA_[i] = RandomFloat(-100.0f, 100.0f);
+                floatsB_[i] = RandomFloat(-100.0f, 100.0f);
+            }
+
+            quaternionsA_.resize(COUNT);
+            quaternionsB_.resize(COUNT);
+            axes_.resize(COUNT);
+            angles_.resize(COUNT);
+            for (size_t i = 0; i < COUNT; ++i) {
+                axes_[i] = RandomNormalizedVector3();
+                angles_[i] = RandomFloat(0.0f, TWO_PI);
+                quaternionsA_[i] = FromAxisAngle(axes_[i], angles_[i]);
+                quaternionsB_[i] = FromAxisAngle(RandomNormalizedVector3(), RandomFloat(0.0f, TWO_PI));
+            }
+        }
+
+        Matrix4 RandomTransformMatrix() {
+            const Transform transform(RandomVector3(-50.0f, 50.0f),
+                FromAxisAngle(RandomNormalizedVector3(), RandomFloat(0.0f, TWO_PI)),
+                Vector3(RandomFloat(0.5f, 2.0f), RandomFloat(0.5f, 2.0f), RandomFloat(0.5f, 2.0f)));
+            return transform.ToMatrix();
+        }
+
+        OBB RandomOBB(float spread) {
+            return OBB(RandomVector3(-spread, spread),
+                Vector3(RandomFloat(0.2f, 3.0f), RandomFloat(0.2f, 3.0f), RandomFloat(0.2f, 3.0f)),
+                ToMatrix3(FromAxisAngle(RandomNormalizedVector3(), RandomFloat(0.0f, TWO_PI))));
+        }
+
+        AABB RandomAABB(float spread) {
+            const Vector3 center = RandomVector3(-spread, spread);
+            const Vector3 extents(RandomFloat(0.2f, 3.0f), RandomFloat(0.2f, 3.0f), RandomFloat(0.2f, 3.0f));
+            return AABB(center - extents, center + extents);
+        }
+
+        static Frustum TestFrustum() {
+            return Frustum(Perspective(HALF_PI, 16.0f / 9.0f, 0.1f, 100.0f) *
+                LookAt(Vector3(0.0f, 0.0f, -60.0f), Vector3::ZERO, Vector3::UNIT_Y));
+        }
+
+        static void Report(const std::vector<BenchmarkResult>& results) {
+            for (const std::string& failure : ProcessBenchmarkResults(results)) {
+                ADD_FAILURE() << failure;
+            }
+        }
+
+        std::vector<Vector3> vectorsA_;
+        std::vector<Vector3> vectorsB_;
+        std::vector<Vector3> vectorsOut_;
+        std::vector<float> floatsA_;
+        std::vector<float> floatsB_;
+        std::vector<float> floatsOut_;
+        std::vector<Quaternion> quaternionsA_;
+        std::vector<Quaternion> quaternionsB_;
+        std::vector<Vector3> axes_;
+        std::vector<float> angles_;
+    };
+
+    // ============================================================================
+    // Harness
+    // ============================================================================
+
+    TEST_F(MathBenchmarks, Harness_Statistics) {
+        // Per-call samples 1..20: median of an even count averages the middle pair
+        std::vector<double> samples;
+        std::vector<double> ticks;
+        for (int i = 20; i >= 1; --i) {
+            samples.push_back(static_cast<double>(i));
+            ticks.push_back(static_cast<double>(i) * 3.0);
+        }
+
+        const BenchmarkResult result = SummarizeSamples("Stats", 4, 8, samples, ticks);
+        EXPECT_DOUBLE_EQ(result.medianNs, 10.5);
+        EXPECT_DOUBLE_EQ(result.p95Ns, 19.0);
+        EXPECT_DOUBLE_EQ(result.minNs, 1.0);
+        EXPECT_DOUBLE_EQ(result.nsPerElement, 10.5 / 4.0);
+        EXPECT_DOUBLE_EQ(result.cyclesPerElement, 31.5 / 4.0);
+        EXPECT_EQ(result.samples, 20u);
+        EXPECT_EQ(result.callsPerSample, 8u);
+    }
+
+    TEST_F(MathBenchmarks, Harness_BaselineRoundTripAndCompare) {
+        BenchmarkBaseline baseline;
+        baseline.SetEnvironment(DescribeBenchmarkEnvironment());
+        baseline.Record(SummarizeSamples("Fast", 1, 1, { 100.0 }, { 300.0 }));
+        baseline.Record(SummarizeSamples("Slow", 1, 1, { 100.0 }, { 300.0 }));
+
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "AkhandaBenchmarkBaseline.json";
+        ASSERT_TRUE(baseline.Save(path));
+
+        BenchmarkBaseline loaded;
+        ASSERT_TRUE(loaded.Load(path));
+        std::filesystem::remove(path);
+
+        EXPECT_EQ(loaded.GetCount(), 2u);
+        EXPECT_EQ(loaded.GetEnvironment(), baseline.GetEnvironment());
+        ASSERT_NE(loaded.Find("Fast"), nullptr);
+        EXPECT_DOUBLE_EQ(loaded.Find("Fast")->medianNs, 100.0);
+        EXPECT_EQ(loaded.Find("Missing"), nullptr);
+
+        // 5% slower passes a 10% threshold, 25% slower fails; unknown names are ignored
+        const std::vector<BenchmarkResult> current = {
+            SummarizeSamples("Fast", 1, 1, { 105.0 }, {}),
+            SummarizeSamples("Slow", 1, 1, { 125.0 }, {}),
+            SummarizeSamples("New", 1, 1, { 1000.0 }, {})
+        };
+        const std::vector<BenchmarkRegression> regressions = loaded.Compare(current, 0.10);
+        ASSERT_EQ(regressions.size(), 1u);
+        EXPECT_EQ(regressions[0].name, "Slow");
+        EXPECT_NEAR(regressions[0].change, 0.25, 1e-9);
+    }
+
+    // ============================================================================
+    // Vector Operations
+    // ============================================================================
+
+    TEST_F(MathBenchmarks, VectorOps) {
+        std::vector<BenchmarkResult> results;
+
+        results.push_back(RunBenchmark("Vector3/Dot", COUNT, [&] {
+            float sum = 0.0f;
+            for (size_t i = 0; i < COUNT; ++i) {
+                sum += Dot(vectorsA_[i], vectorsB_[i]);
+            }
+            DoNotOptimize(sum);
+        }));
+
+        results.push_back(RunBenchmark("Vector3/Cross", COUNT, [&] {
+            for (size_t i = 0; i < COUNT; ++i) {
+                vectorsOut_[i] = Cross(vectorsA_[i], vectorsB_[i]);
+            }
+            DoNotOptimize(vectorsOut_[COUNT - 1]);
+        }));
+
+        results.push_back(RunBenchmark("Vector3/Normalize", COUNT, [&] {
+            for (size_t i = 0; i < COUNT; ++i) {
+                vectorsOut_[i] = Normalize(vectorsA_[i]);
+            }
+            DoNotOptimize(vectorsOut_[COUNT - 1]);
+        }));
+
+        results.push_back(RunBenchmark("Vector3/Length", COUNT, [&] {
+            float sum = 0.0f;
+            for (size_t i = 0; i < COUNT; ++i) {
+                sum += Length(vectorsA_[i]);
+            }
+            DoNotOptimize(sum);
+        }));
+
+        results.push_back(RunBenchmark("Vector3/Add", COUNT, [&] {
+            for (size_t i = 0; i < COUNT; ++i) {
+                vectorsOut_[i] = vectorsA_[i] + vectorsB_[i];
+            }
+            DoNotOptimize(vectorsOut_[COUNT - 1]);
+        }));
+
+        results.push_back(RunBenchmark("Vector3/Lerp", COUNT, [&] {
+            for (size_t i = 0; i < COUNT; ++i) {
+                vectorsOut_[i] = LerpV3(vectorsA_[i], vectorsB_[i], 0.25f);
+            }
+            DoNotOptimize(vectorsOut_[COUNT - 1]);
+        }));
+
+        results.push_back(RunBenchmark("SIMD/VectorAdd", floatsA_.size(), [&] {
+            SIMD::VectorAdd(floatsA_.data(), floatsB_.data(), floatsOut_.data(), floatsA_.size());
+            DoNotOptimize(floatsOut_.back());
+        }));
+
+        results.push_back(RunBenchmark("SIMD/VectorScale", floatsA_.size(), [&] {
+            SIMD::VectorScale(floatsA_.data(), 1.5f, floatsOut_.data(), floatsA_.size());
+            DoNotOptimize(floatsOut_.back());
+        }));
+
+        Report(results);
+    }
+
+    // ============================================================================
+    // Matrix Operations
+    // ============================================================================
+
+    TEST_F(MathBenchmarks, MatrixOps) {
+        constexpr size_t MATRIX_COUNT = 1024;
+        std::vector<Matrix4> matricesA(MATRIX_COUNT);
+        std::vector<Matrix4> matricesB(MATRIX_COUNT);
+        std::vector<Matrix4> matricesOut(MATRIX_COUNT);
+        for (size_t i = 0; i < MATRIX_COUNT; ++i) {
+            matricesA[i] = RandomTransformMatrix();
+            matricesB[i] = RandomTransformMatrix();
+        }
+
+        std::vector<BenchmarkResult> results;
+
+        results.push_back(RunBenchmark("Matrix4/Multiply", MATRIX_COUNT, [&] {
+            for (size_t i = 0; i < MATRIX_COUNT; ++i) {
+                matricesOut[i] = matricesA[i] * matricesB[i];
+            }
+            DoNotOptimize(matricesOut[MATRIX_COUNT - 1]);
+        }));
+
+        results.push_back(RunBenchmark("Matrix4/Inverse", MATRIX_COUNT, [&] {
+            for (size_t i = 0; i < MATRIX_COUNT; ++i) {
+                matricesOut[i] = Inverse(matricesA[i]);
+            }
+            DoNotOptimize(matricesOut[MATRIX_COUNT - 1]);
+        }));
+
+        results.push_back(RunBenchmark("Matrix4/Transpose", MATRIX_COUNT, [&] {
+            for (size_t i = 0; i < MATRIX_COUNT; ++i) {
+                matricesOut[i] = Transpose(matricesA[i]);
+            }
+            DoNotOptimize(matricesOut[MATRIX_COUNT - 1]);
+        }));
+
+        results.push_back(RunBenchmark("Matrix4/TransformPoint", COUNT, [&] {
+            const Matrix4& matrix = matricesA[0];
+            for (size_t i = 0; i < COUNT; ++i) {
+                vectorsOut_[i] = matrix.TransformPoint(vectorsA_[i]);
+            }
+            DoNotOptimize(vectorsOut_[COUNT - 1]);
+        }));
+
+        results.push_back(RunBenchmark("SIMD/MatrixMultiply4x4", MATRIX_COUNT, [&] {
+            for (size_t i = 0; i < MATRIX_COUNT; ++i) {
+                SIMD::MatrixMultiply4x4(matricesA[i].m, matricesB[i].m, matricesOut[i].m);
+            }
+            DoNotOptimize(matricesOut[MATRIX_COUNT - 1]);
+        }));
+
+        Report(results);
+    }
+
+    // ============================================================================
+    // Quaternion Operations
+    // ============================================================================
+
+    TEST_F(MathBenchmarks, QuaternionOps) {
+        std::vector<Quaternion> quaternionsOut(COUNT);
+        std::vector<Matrix3> matricesOut(COUNT);
+        std::vector<BenchmarkResult> results;
+
+        results.push_back(RunBenchmark("Quaternion/Multiply", COUNT, [&] {
+            for (size_t i = 0; i < COUNT; ++i) {
+                quaternionsOut[i] = quaternionsA_[i] * quaternionsB_[i];
+            }
+            DoNotOptimize(quaternionsOut[COUNT - 1]);
+        }));
+
+        results.push_back(RunBenchmark("Quaternion/Normalize", COUNT, [&] {
+            for (size_t i = 0; i < COUNT; ++i) {
+                quaternionsOut[i] = Normalize(quaternionsA_[i]);
+            }
+            DoNotOptimize(quaternionsOut[COUNT - 1]);
+        }));
+
+        results.push_back(RunBenchmark("Quaternion/Slerp", COUNT, [&] {
+            for (size_t i = 0; i < COUNT; ++i) {
+                quaternionsOut[i] = Slerp(quaternionsA_[i], quaternionsB_[i], 0.3f);
+            }
+            DoNotOptimize(quaternionsOut[COUNT - 1]);
+        }));
+
+        results.push_back(RunBenchmark("Quaternion/RotateVector", COUNT, [&] {
+            for (size_t i = 0; i < COUNT; ++i) {
+                vectorsOut_[i] = quaternionsA_[i] * vectorsA_[i];
+            }
+            DoNotOptimize(vectorsOut_[COUNT - 1]);
+        }));
+
+        results.push_back(RunBenchmark("Quaternion/ToMatrix3", COUNT, [&] {
+            for (size_t i = 0; i < COUNT; ++i) {
+                matricesOut[i] = ToMatrix3(quaternionsA_[i]);
+            }
+            DoNotOptimize(matricesOut[COUNT - 1]);
+        }));
+
+        results.push_back(RunBenchmark("Quaternion/FromAxisAngle", COUNT, [&] {
+            for (size_t i = 0; i < COUNT; ++i) {
+                quaternionsOut[i] = FromAxisAngle(axes_[i], angles_[i]);
+            }
+            DoNotOptimize(quaternionsOut[COUNT - 1]);
+        }));
+
+        Report(results);
+    }
+
+    // ============================================================================
+    // Intersection Tests
+    // ============================================================================
+
+    TEST_F(MathBenchmarks, IntersectionTests) {
+        std::vector<Ray> rays;
+        std::vector<Sphere> spheres;
+        std::vector<AABB> boxes;
+        std::vector<OBB> orientedBoxes;
+        for (size_t i = 0; i < COUNT; ++i) {
+            rays.emplace_back(RandomVector3(-50.0f, 50.0f), RandomNormalizedVector3());
+            spheres.emplace_back(RandomVector3(-50.0f, 50.0f), RandomFloat(0.5f, 5.0f));
+            boxes.push_back(RandomAABB(50.0f));
+            orientedBoxes.push_back(RandomOBB(50.0f));
+        }
+
+        const Frustum frustum = TestFrustum();
+        const OBB queryBox = RandomOBB(5.0f);
+        std::vector<Matrix4> matrices(COUNT);
+        for (Matrix4& matrix : matrices) {
+            matrix = RandomTransformMatrix();
+        }
+        std::vector<AABB> boxesOut(COUNT);
+        auto flagData = std::make_unique<bool[]>(COUNT);
+        std::vector<BenchmarkResult> results;
+
+        results.push_back(RunBenchmark("Intersection/RayAABB", COUNT, [&] {
+            size_t hits = 0;
+            for (size_t i = 0; i < COUNT; ++i) {
+                float tMin;
+                float tMax;
+                hits += RayAABBIntersection(rays[i], boxes[i], tMin, tMax) ? 1 : 0;
+            }
+            DoNotOptimize(hits);
+        }));
+
+        results.push_back(RunBenchmark("Intersection/RaySphere", COUNT, [&] {
+            size_t hits = 0;
+            for (size_t i = 0; i < COUNT; ++i) {
+                float t1;
+                float t2;
+                hits += RaySphereIntersection(rays[i], spheres[i], t1, t2) ? 1 : 0;
+            }
+            DoNotOptimize(hits);
+        }));
+
+        results.push_back(RunBenchmark("Intersection/SphereAABB", COUNT, [&] {
+            size_t hits = 0;
+            for (size_t i = 0; i < COUNT; ++i) {
+                hits += SphereAABBIntersection(spheres[i], boxes[i]) ? 1 : 0;
+            }
+            DoNotOptimize(hits);
+        }));
+
+        results.push_back(RunBenchmark("Intersection/AABBAABB", COUNT, [&] {
+            size_t hits = 0;
+            for (size_t i = 0; i < COUNT; ++i) {
+                hits += AABBAABBIntersection(boxes[i], boxes[COUNT - 1 - i]) ? 1 : 0;
+            }
+            DoNotOptimize(hits);
+        }));
+
+        results.push_back(RunBenchmark("Intersection/OBBOBB", COUNT, [&] {
+            size_t hits = 0;
+            for (size_t i = 0; i < COUNT; ++i) {
+                hits += queryBox.Intersects(orientedBoxes[i]) ? 1 : 0;
+            }
+            DoNotOptimize(hits);
+        }));
+
+        results.push_back(RunBenchmark("Intersection/IntersectOBBs", COUNT, [&] {
+            DoNotOptimize(IntersectOBBs(queryBox, orientedBoxes.data(), flagData.get(), COUNT));
+        }));
+
+        results.push_back(RunBenchmark("Frustum/Sphere", COUNT, [&] {
+            size_t visible = 0;
+            for (size_t i = 0; i < COUNT; ++i) {
+                visible += frustum.Intersects(spheres[i]) ? 1 : 0;
+            }
+            DoNotOptimize(visible);
+        }));
+
+        results.push_back(RunBenchmark("Frustum/AABB", COUNT, [&] {
+            size_t visible = 0;
+            for (size_t i = 0; i < COUNT; ++i) {
+                visible += frustum.Intersects(boxes[i]) ? 1 : 0;
+            }
+            DoNotOptimize(visible);
+        }));
+
+        results.push_back(RunBenchmark("Frustum/OBB", COUNT, [&] {
+            size_t visible = 0;
+            for (size_t i = 0; i < COUNT; ++i) {
+                visible += frustum.Intersects(orientedBoxes[i]) ? 1 : 0;
+            }
+            DoNotOptimize(visible);
+        }));
+
+        results.push_back(RunBenchmark("Frustum/CullOBBs", COUNT, [&] {
+            DoNotOptimize(CullOBBs(frustum, orientedBoxes.data(), flagData.get(), COUNT));
+        }));
+
+        results.push_back(RunBenchmark("Bounds/TransformAABBs", COUNT, [&] {
+            TransformAABBs(boxes.data(), matrices.data(), boxesOut.data(), COUNT);
+            DoNotOptimize(boxesOut[COUNT - 1]);
+        }));
+
+        results.push_back(RunBenchmark("Bounds/MergeAABBs", COUNT, [&] {
+            DoNotOptimize(MergeAABBs(boxes.data(), COUNT));
+        }));
+
+        Report(results);
+    }
+
+    // ============================================================================
+    // Noise
+    // ============================================================================
+
+    TEST_F(MathBenchmarks, Noise) {
+        std::vector<BenchmarkResult> results;
+
+        auto noise2D = [&](const char* name, float (*function)(float, float)) {
+            results.push_back(RunBenchmark(name, COUNT, [&] {
+                float sum = 0.0f;
+                for (size_t i = 0; i < COUNT; ++i) {
+                    sum += function(vectorsA_[i].x * 0.1f, vectorsA_[i].y * 0.1f);
+                }
+                DoNotOptimize(sum);
+            }));
+        };
+
+        auto noise3D = [&](const char* name, float (*function)(float, float, float)) {
+            results.push_back(RunBenchmark(name, COUNT, [&] {
+                float sum = 0.0f;
+                for (size_t i = 0; i < COUNT; ++i) {
+                    sum += function(vectorsA_[i].x * 0.1f, vectorsA_[i].y * 0.1f, vectorsA_[i].z * 0.1f);
+                }
+                DoNotOptimize(sum);
+            }));
+        };
+
+        noise2D("Noise/Perlin2D", PerlinNoise2D);
+        noise2D("Noise/Simplex2D", SimplexNoise2D);
+        noise2D("Noise/Cellular2D", CellularNoise2D);
+        noise3D("Noise/Perlin3D", PerlinNoise3D);
+        noise3D("Noise/Simplex3D", SimplexNoise3D);
+
+        results.push_back(RunBenchmark("Noise/Fractal2D", COUNT, [&] {
+            float sum = 0.0f;
+            for (size_t i = 0; i < COUNT; ++i) {
+                sum += FractalNoise2D(vectorsA_[i].x * 0.1f, vectorsA_[i].y * 0.1f);
+            }
+            DoNotOptimize(sum);
+        }));
+
+        Report(results);
+    }
+
+    // ============================================================================
+    // Random
+    // ============================================================================
+
+    TEST_F(MathBenchmarks, Random) {
+        RandomStream stream(42);
+        std::vector<BenchmarkResult> results;
+
+        results.push_back(RunBenchmark("Random/NextFloat", COUNT, [&] {
+            float sum = 0.0f;
+            for (size_t i = 0; i < COUNT; ++i) {
+                sum += stream.NextFloat();
+            }
+            DoNotOptimize(sum);
+        }));
+
+        results.push_back(RunBenchmark("Random/FillFloat", COUNT, [&] {
+            stream.FillFloat(floatsOut_.data(), COUNT, -1.0f, 1.0f);
+            DoNotOptimize(floatsOut_[COUNT - 1]);
+        }));
+
+        results.push_back(RunBenchmark("Random/FillGaussian", COUNT, [&] {
+            stream.FillGaussian(floatsOut_.data(), COUNT);
+            DoNotOptimize(floatsOut_[COUNT - 1]);
+        }));
+
+        results.push_back(RunBenchmark("Random/FillUnitVector3", COUNT, [&] {
+            stream.FillUnitVector3(vectorsOut_.data(), COUNT);
+            DoNotOptimize(vectorsOut_[COUNT - 1]);
+        }));
+
+        Report(results);
+    }
+
+}
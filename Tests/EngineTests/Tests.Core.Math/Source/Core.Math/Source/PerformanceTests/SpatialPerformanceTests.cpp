@@ -0,0 +1,472 @@
+// Tests/Core.Math/Source/PerformanceTests/SpatialPerformanceTests.cpp
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <set>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+import Akhanda.Core.Math;
+#include "../Fixtures/MathTestFixtures.hpp"
+#include "../TestConstants.hpp"
+
+using namespace Akhanda::Tests::Math;
+using namespace Akhanda::Math;
+
+namespace {
+
+    // ============================================================================
+    // Moving Object Scene
+    // ============================================================================
+
+    // Objects move with constant velocity inside a cube whose volume grows with
+    // the object count, so density (and therefore pairs per object) stays constant.
+    struct MovingScene {
+        static constexpr float VOLUME_PER_OBJECT = 64.0f;
+        static constexpr float MAX_HALF_SIZE = 1.0f;
+        static constexpr float MAX_SPEED = 0.25f;
+
+        std::vector<Vector3> centers;
+        std::vector<Vector3> halfSizes;
+        std::vector<Vector3> velocities;
+        float extent = 0.0f;
+
+        void Generate(size_t count, RandomStream& random) {
+            extent = std::cbrt(static_cast<float>(count) * VOLUME_PER_OBJECT);
+            centers.resize(count);
+            halfSizes.resize(count);
+            velocities.resize(count);
+            for (size_t i = 0; i < count; ++i) {
+                centers[i] = Vector3(random.NextFloat(0.0f, extent), random.NextFloat(0.0f, extent), random.NextFloat(0.0f, extent));
+                halfSizes[i] = Vector3(random.NextFloat(0.25f, MAX_HALF_SIZE), random.NextFloat(0.25f, MAX_HALF_SIZE), random.NextFloat(0.25f, MAX_HALF_SIZE));
+                velocities[i] = Vector3(random.NextFloat(-MAX_SPEED, MAX_SPEED), random.NextFloat(-MAX_SPEED, MAX_SPEED), random.NextFloat(-MAX_SPEED, MAX_SPEED));
+            }
+        }
+
+        void Step() {
+            for (size_t i = 0; i < centers.size(); ++i) {
+                Vector3& c = centers[i];
+                Vector3& v = velocities[i];
+                c = c + v;
+                if (c.x < 0.0f || c.x > extent) { v.x = -v.x; }
+                if (c.y < 0.0f || c.y > extent) { v.y = -v.y; }
+                if (c.z < 0.0f || c.z > extent) { v.z = -v.z; }
+            }
+        }
+
+        AABB Bounds(size_t i) const {
+            return AABB(centers[i] - halfSizes[i], centers[i] + halfSizes[i]);
+        }
+    };
+
+    bool Overlaps(const AABB& a, const AABB& b) {
+        return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+            a.min.y <= b.max.y && a.max.y >= b.min.y &&
+            a.min.z <= b.max.z && a.max.z >= b.min.z;
+    }
+
+    // ============================================================================
+    // Reference Uniform Grid
+    // ============================================================================
+
+    // Dense grid rebuilt from scratch each frame. Objects are binned into every
+    // cell they touch; a pair is reported only from the cell containing the
+    // minimum corner of the pair's intersection so each pair is emitted once.
+    class UniformGrid {
+    public:
+        void Build(const MovingScene& scene, float cellSize) {
+            cellSize_ = cellSize;
+            invCellSize_ = 1.0f / cellSize;
+            origin_ = Vector3(-2.0f * MovingScene::MAX_HALF_SIZE);
+            dim_ = static_cast<int32_t>(std::ceil((scene.extent + 4.0f * MovingScene::MAX_HALF_SIZE) * invCellSize_)) + 1;
+
+            const size_t cellCount = static_cast<size_t>(dim_) * dim_ * dim_;
+            cellStart_.assign(cellCount + 1, 0);
+            bounds_.resize(scene.centers.size());
+
+            // Counting sort: count, prefix sum, scatter
+            for (size_t i = 0; i < scene.centers.size(); ++i) {
+                bounds_[i] = scene.Bounds(i);
+                ForEachCell(bounds_[i], [&](size_t cell) { ++cellStart_[cell + 1]; });
+            }
+            for (size_t c = 0; c < cellCount; ++c) {
+                cellStart_[c + 1] += cellStart_[c];
+            }
+            entries_.resize(cellStart_[cellCount]);
+            cursor_.assign(cellStart_.begin(), cellStart_.end() - 1);
+            for (size_t i = 0; i < scene.centers.size(); ++i) {
+                ForEachCell(bounds_[i], [&](size_t cell) { entries_[cursor_[cell]++] = static_cast<uint32_t>(i); });
+            }
+        }
+
+        template<typename Callback>
+        void QueryPairs(Callback&& callback) const {
+            const size_t cellCount = cellStart_.size() - 1;
+            for (size_t c = 0; c < cellCount; ++c) {
+                for (uint32_t i = cellStart_[c]; i < cellStart_[c + 1]; ++i) {
+                    for (uint32_t j = i + 1; j < cellStart_[c + 1]; ++j) {
+                        const AABB& a = bounds_[entries_[i]];
+                        const AABB& b = bounds_[entries_[j]];
+                        if (!Overlaps(a, b)) {
+                            continue;
+                        }
+                        const Vector3 corner(std::max(a.min.x, b.min.x), std::max(a.min.y, b.min.y), std::max(a.min.z, b.min.z));
+                        if (CellIndex(corner) == c) {
+                            callback(entries_[i], entries_[j]);
+                        }
+                    }
+                }
+            }
+        }
+
+    private:
+        int32_t Coord(float v, float o) const {
+            return std::clamp(static_cast<int32_t>((v - o) * invCellSize_), 0, dim_ - 1);
+        }
+
+        size_t CellIndex(const Vector3& p) const {
+            return (static_cast<size_t>(Coord(p.z, origin_.z)) * dim_ + Coord(p.y, origin_.y)) * dim_ + Coord(p.x, origin_.x);
+        }
+
+        template<typename Fn>
+        void ForEachCell(const AABB& box, Fn&& fn) const {
+            const int32_t x0 = Coord(box.min.x, origin_.x), x1 = Coord(box.max.x, origin_.x);
+            const int32_t y0 = Coord(box.min.y, origin_.y), y1 = Coord(box.max.y, origin_.y);
+            const int32_t z0 = Coord(box.min.z, origin_.z), z1 = Coord(box.max.z, origin_.z);
+            for (int32_t z = z0; z <= z1; ++z) {
+                for (int32_t y = y0; y <= y1; ++y) {
+                    for (int32_t x = x0; x <= x1; ++x) {
+                        fn((static_cast<size_t>(z) * dim_ + y) * dim_ + x);
+                    }
+                }
+            }
+        }
+
+        float cellSize_ = 1.0f;
+        float invCellSize_ = 1.0f;
+        Vector3 origin_;
+        int32_t dim_ = 0;
+        std::vector<uint32_t> cellStart_;
+        std::vector<uint32_t> cursor_;
+        std::vector<uint32_t> entries_;
+        std::vector<AABB> bounds_;
+    };
+
+    // ============================================================================
+    // Neighbor Query Data
+    // ============================================================================
+
+    enum class Distribution { Uniform, Clustered };
+
+    // Same density as MovingScene; clustered data packs the points into a few
+    // Gaussian blobs so most cells are empty and a handful are crowded
+    std::vector<Vector3> GeneratePoints(size_t count, Distribution distribution, RandomStream& random) {
+        const float extent = std::cbrt(static_cast<float>(count) * MovingScene::VOLUME_PER_OBJECT);
+        std::vector<Vector3> points(count);
+        if (distribution == Distribution::Uniform) {
+            for (Vector3& p : points) {
+                p = Vector3(random.NextFloat(0.0f, extent), random.NextFloat(0.0f, extent), random.NextFloat(0.0f, extent));
+            }
+            return points;
+        }
+
+        constexpr size_t CLUSTER_COUNT = 32;
+        Vector3 centers[CLUSTER_COUNT];
+        for (Vector3& c : centers) {
+            c = Vector3(random.NextFloat(0.0f, extent), random.NextFloat(0.0f, extent), random.NextFloat(0.0f, extent));
+        }
+        std::vector<float> offsets(count * 3);
+        random.FillGaussian(offsets.data(), offsets.size(), 0.0f, extent / 40.0f);
+        for (size_t i = 0; i < count; ++i) {
+            points[i] = centers[i % CLUSTER_COUNT] + Vector3(offsets[i * 3], offsets[i * 3 + 1], offsets[i * 3 + 2]);
+        }
+        return points;
+    }
+
+    // Stand-in for JobSystem::ParallelFor so the benchmark does not need the scheduler
+    template<typename Task>
+    void ThreadParallelFor(uint32_t taskCount, const Task& task) {
+        std::vector<std::thread> threads;
+        for (uint32_t i = 1; i < taskCount; ++i) {
+            threads.emplace_back([&task, i]() { task(i); });
+        }
+        task(0);
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    // ============================================================================
+    // Spatial Performance Test Fixture
+    // ============================================================================
+
+    class SpatialPerformanceTests : public PerformanceTestFixture {
+    protected:
+        static constexpr float GRID_CELL_SIZE = 4.0f * MovingScene::MAX_HALF_SIZE;
+
+        size_t TreeFrame(MovingScene& scene, DynamicAABBTree& tree, const std::vector<int32_t>& proxies) {
+            scene.Step();
+            for (size_t i = 0; i < proxies.size(); ++i) {
+                tree.MoveProxy(proxies[i], scene.Bounds(i), scene.velocities[i]);
+            }
+
+            size_t pairs = 0;
+            tree.QueryOverlapPairs([&](int32_t a, int32_t b) {
+                pairs += Overlaps(scene.Bounds(tree.GetUserData(a)), scene.Bounds(tree.GetUserData(b))) ? 1 : 0;
+                return true;
+            });
+            return pairs;
+        }
+
+        size_t GridFrame(MovingScene& scene, UniformGrid& grid) {
+            scene.Step();
+            grid.Build(scene, GRID_CELL_SIZE);
+
+            size_t pairs = 0;
+            grid.QueryPairs([&](uint32_t, uint32_t) { ++pairs; });
+            return pairs;
+        }
+
+        static size_t BruteForceFrame(MovingScene& scene) {
+            scene.Step();
+
+            size_t pairs = 0;
+            const size_t count = scene.centers.size();
+            for (size_t i = 0; i < count; ++i) {
+                const AABB a = scene.Bounds(i);
+                for (size_t j = i + 1; j < count; ++j) {
+                    pairs += Overlaps(a, scene.Bounds(j)) ? 1 : 0;
+                }
+            }
+            return pairs;
+        }
+
+        void RunBroadphaseBenchmark(size_t objectCount, size_t frames, bool includeBruteForce) {
+            RandomStream random(0x5eed0000u + objectCount);
+            MovingScene scene;
+            scene.Generate(objectCount, random);
+
+            DynamicAABBTree tree;
+            std::vector<int32_t> proxies(objectCount);
+            const auto buildStart = std::chrono::high_resolution_clock::now();
+            for (size_t i = 0; i < objectCount; ++i) {
+                proxies[i] = tree.CreateProxy(scene.Bounds(i), static_cast<uint32_t>(i));
+            }
+            const auto buildEnd = std::chrono::high_resolution_clock::now();
+
+            MovingScene treeScene = scene;
+            MovingScene gridScene = scene;
+            UniformGrid grid;
+
+            size_t treePairs = 0;
+            size_t gridPairs = 0;
+            const double treeTime = BenchmarkFunction([&]() { treePairs = TreeFrame(treeScene, tree, proxies); }, frames);
+            const double gridTime = BenchmarkFunction([&]() { gridPairs = GridFrame(gridScene, grid); }, frames);
+
+            const double buildMs = std::chrono::duration<double, std::milli>(buildEnd - buildStart).count();
+            std::cout << "[PERF] Broadphase " << objectCount << " objects - tree build: " << buildMs << " ms" << std::endl;
+            std::cout << "[PERF] Broadphase " << objectCount << " objects - DynamicAABBTree: " << treeTime / 1.0e6 << " ms/frame ("
+                << treePairs << " pairs, height " << tree.GetHeight() << ", area ratio " << tree.GetAreaRatio() << ")" << std::endl;
+            std::cout << "[PERF] Broadphase " << objectCount << " objects - UniformGrid: " << gridTime / 1.0e6 << " ms/frame ("
+                << gridPairs << " pairs)" << std::endl;
+
+            // Both scenes advanced the same number of steps from the same start
+            EXPECT_EQ(treePairs, gridPairs);
+            EXPECT_TRUE(tree.Validate());
+
+            if (includeBruteForce) {
+                MovingScene bruteScene = scene;
+                size_t brutePairs = 0;
+                const double bruteTime = BenchmarkFunction([&]() { brutePairs = BruteForceFrame(bruteScene); }, frames);
+
+                std::cout << "[PERF] Broadphase " << objectCount << " objects - BruteForce: " << bruteTime / 1.0e6 << " ms/frame ("
+                    << brutePairs << " pairs)" << std::endl;
+                std::cout << "[PERF] Tree speedup over brute force: " << bruteTime / treeTime << "x" << std::endl;
+
+                EXPECT_EQ(treePairs, brutePairs);
+                if (objectCount >= 10000) {
+                    EXPECT_GT(bruteTime / treeTime, 2.0) << "Tree should comfortably beat O(n^2) at this scale";
+                }
+            }
+        }
+
+        void RunNeighborBenchmark(Distribution distribution, const char* label) {
+            constexpr size_t POINT_COUNT = 100000;
+            constexpr size_t QUERY_COUNT = 1000;
+            constexpr float QUERY_RADIUS = 4.0f;
+
+            RandomStream random(distribution == Distribution::Uniform ? 0xA11CEu : 0xB0B0u);
+            const std::vector<Vector3> points = GeneratePoints(POINT_COUNT, distribution, random);
+            std::vector<AABB> boxes(POINT_COUNT);
+            for (size_t i = 0; i < POINT_COUNT; ++i) {
+                boxes[i] = AABB(points[i] - Vector3(0.5f), points[i] + Vector3(0.5f));
+            }
+            std::vector<Vector3> queries(QUERY_COUNT);
+            for (Vector3& q : queries) {
+                q = points[static_cast<size_t>(random.NextInt(0, static_cast<int32_t>(POINT_COUNT) - 1))];
+            }
+
+            const uint32_t taskCount = std::max(1u, std::thread::hardware_concurrency());
+            const auto parallelFor = [](uint32_t count, const auto& task) { ThreadParallelFor(count, task); };
+
+            AABB world(points[0], points[0]);
+            for (const Vector3& p : points) {
+                world.Expand(p);
+            }
+
+            SpatialHashGrid grid(QUERY_RADIUS);
+            LooseOctree octree(world, 8);
+            const double gridBuild = BenchmarkFunction([&]() { grid.Build(points); }, 20);
+            const double gridParallelBuild = BenchmarkFunction([&]() { grid.Build(points, taskCount, parallelFor); }, 20);
+            const double octreeBuild = BenchmarkFunction([&]() { octree.Build(boxes); }, 20);
+            const double octreeParallelBuild = BenchmarkFunction([&]() { octree.Build(boxes, taskCount, parallelFor); }, 20);
+
+            std::vector<uint32_t> buffer(POINT_COUNT);
+            size_t gridHits = 0;
+            const double gridQuery = BenchmarkFunction([&]() {
+                gridHits = 0;
+                for (const Vector3& q : queries) {
+                    gridHits += grid.QueryRadius(q, QUERY_RADIUS, buffer).size();
+                }
+                }, 20);
+
+            size_t octreeHits = 0;
+            const double octreeQuery = BenchmarkFunction([&]() {
+                octreeHits = 0;
+                for (const Vector3& q : queries) {
+                    octreeHits += octree.QuerySphere(Sphere(q, QUERY_RADIUS), buffer).size();
+                }
+                }, 20);
+
+            size_t bruteHits = 0;
+            const double bruteQuery = BenchmarkFunction([&]() {
+                bruteHits = 0;
+                for (const Vector3& q : queries) {
+                    for (const Vector3& p : points) {
+                        const Vector3 d = p - q;
+                        bruteHits += (d.x * d.x + d.y * d.y + d.z * d.z <= QUERY_RADIUS * QUERY_RADIUS) ? 1 : 0;
+                    }
+                }
+                }, 2);
+
+            std::cout << "[PERF] " << label << " 100K points - SpatialHashGrid build: " << gridBuild / 1.0e6 << " ms ("
+                << grid.GetCellCount() << " cells), parallel x" << taskCount << ": " << gridParallelBuild / 1.0e6 << " ms" << std::endl;
+            std::cout << "[PERF] " << label << " 100K points - LooseOctree build: " << octreeBuild / 1.0e6 << " ms ("
+                << octree.GetNodeCount() << " nodes), parallel x" << taskCount << ": " << octreeParallelBuild / 1.0e6 << " ms" << std::endl;
+            std::cout << "[PERF] " << label << " 1000 radius queries - SpatialHashGrid: " << gridQuery / 1.0e3 << " us ("
+                << gridHits << " hits)" << std::endl;
+            std::cout << "[PERF] " << label << " 1000 radius queries - LooseOctree: " << octreeQuery / 1.0e3 << " us ("
+                << octreeHits << " hits)" << std::endl;
+            std::cout << "[PERF] " << label << " 1000 radius queries - BruteForce: " << bruteQuery / 1.0e3 << " us" << std::endl;
+
+            EXPECT_EQ(gridHits, bruteHits);
+            // Octree stores unit boxes around the points, so it can only find more
+            EXPECT_GE(octreeHits, gridHits);
+            EXPECT_GT(bruteQuery / gridQuery, 10.0);
+            EXPECT_GT(bruteQuery / octreeQuery, 4.0);
+        }
+    };
+
+    // ============================================================================
+    // Broadphase Benchmarks
+    // ============================================================================
+
+    TEST_F(SpatialPerformanceTests, Broadphase_1K_MovingObjects) {
+        RunBroadphaseBenchmark(1000, 50, true);
+    }
+
+    TEST_F(SpatialPerformanceTests, Broadphase_10K_MovingObjects) {
+        RunBroadphaseBenchmark(10000, 10, true);
+    }
+
+    TEST_F(SpatialPerformanceTests, Broadphase_100K_MovingObjects) {
+        // Brute force is ~5e9 box tests per frame at this size; skipped
+        RunBroadphaseBenchmark(100000, 5, false);
+    }
+
+    TEST_F(SpatialPerformanceTests, GridPairs_MatchBruteForce) {
+        RandomStream random(0x5eed1234u);
+        MovingScene scene;
+        scene.Generate(2000, random);
+
+        UniformGrid grid;
+        grid.Build(scene, GRID_CELL_SIZE);
+
+        std::set<std::pair<uint32_t, uint32_t>> fromGrid;
+        grid.QueryPairs([&](uint32_t a, uint32_t b) {
+            EXPECT_TRUE(fromGrid.emplace(std::min(a, b), std::max(a, b)).second) << "Duplicate pair";
+        });
+
+        std::set<std::pair<uint32_t, uint32_t>> expected;
+        for (uint32_t i = 0; i < 2000; ++i) {
+            for (uint32_t j = i + 1; j < 2000; ++j) {
+                if (Overlaps(scene.Bounds(i), scene.Bounds(j))) {
+                    expected.emplace(i, j);
+                }
+            }
+        }
+
+        EXPECT_EQ(fromGrid, expected);
+    }
+
+    TEST_F(SpatialPerformanceTests, TreeQuery_VsBruteForce) {
+        RandomStream random(0x5eed4321u);
+        MovingScene scene;
+        scene.Generate(10000, random);
+
+        DynamicAABBTree tree;
+        for (size_t i = 0; i < scene.centers.size(); ++i) {
+            tree.CreateProxy(scene.Bounds(i), static_cast<uint32_t>(i));
+        }
+
+        std::vector<AABB> regions(256);
+        for (AABB& region : regions) {
+            const Vector3 c(random.NextFloat(0.0f, scene.extent), random.NextFloat(0.0f, scene.extent), random.NextFloat(0.0f, scene.extent));
+            region = AABB(c - Vector3(5.0f), c + Vector3(5.0f));
+        }
+
+        size_t treeHits = 0;
+        const double treeTime = BenchmarkFunction([&]() {
+            treeHits = 0;
+            for (const AABB& region : regions) {
+                tree.Query(region, [&](int32_t) { ++treeHits; return true; });
+            }
+            }, 20);
+
+        size_t bruteHits = 0;
+        const double bruteTime = BenchmarkFunction([&]() {
+            bruteHits = 0;
+            for (const AABB& region : regions) {
+                for (size_t i = 0; i < scene.centers.size(); ++i) {
+                    bruteHits += Overlaps(scene.Bounds(i), region) ? 1 : 0;
+                }
+            }
+            }, 20);
+
+        std::cout << "[PERF] AABB query x256 (tree, 10K): " << treeTime / 1.0e3 << " us" << std::endl;
+        std::cout << "[PERF] AABB query x256 (brute force, 10K): " << bruteTime / 1.0e3 << " us" << std::endl;
+        std::cout << "[PERF] Tree query speedup: " << bruteTime / treeTime << "x" << std::endl;
+
+        // Fat bounds can only add hits
+        EXPECT_GE(treeHits, bruteHits);
+        EXPECT_GT(bruteTime / treeTime, 2.0);
+    }
+
+    // ============================================================================
+    // Neighbor Query Benchmarks
+    // ============================================================================
+
+    TEST_F(SpatialPerformanceTests, NeighborQueries_Uniform) {
+        RunNeighborBenchmark(Distribution::Uniform, "Uniform");
+    }
+
+    TEST_F(SpatialPerformanceTests, NeighborQueries_Clustered) {
+        RunNeighborBenchmark(Distribution::Clustered, "Clustered");
+    }
+
+}
@@ -0,0 +1,310 @@
+// Tests/Core.Math/Source/UnitTests/BoundingVolumeTests.cpp
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+import Akhanda.Core.Math;
+#include "../Fixtures/MathTestFixtures.hpp"
+#include "../TestConstants.hpp"
+
+using namespace Akhanda::Tests::Math;
+using namespace Akhanda::Math;
+
+namespace {
+
+    class BoundingVolumeTests : public MathTestFixture {
+    protected:
+        AABB RandomBox() {
+            const Vector3 center = RandomVector3(-20.0f, 20.0f);
+            const Vector3 halfSize(RandomFloat(0.1f, 5.0f), RandomFloat(0.1f, 5.0f), RandomFloat(0.1f, 5.0f));
+            return AABB(center - halfSize, center + halfSize);
+        }
+
+        Transform RandomTransform() {
+            return Transform(RandomVector3(-50.0f, 50.0f),
+                FromAxisAngle(RandomNormalizedVector3(), RandomFloat(0.0f, TWO_PI)),
+                Vector3(RandomFloat(0.25f, 4.0f), RandomFloat(0.25f, 4.0f), RandomFloat(0.25f, 4.0f)));
+        }
+
+        // Reference: bounds of all eight transformed corners
+        static AABB TransformCorners(const AABB& box, const Matrix4& matrix) {
+            AABB result = EMPTY_AABB;
+            for (int corner = 0; corner < 8; ++corner) {
+                const Vector3 point(
+                    (corner & 1) ? box.max.x : box.min.x,
+                    (corner & 2) ? box.max.y : box.min.y,
+                    (corner & 4) ? box.max.z : box.min.z);
+                result = Union(result, matrix.TransformPoint(point));
+            }
+            return result;
+        }
+
+        static AABB Union(const AABB& box, const Vector3& point) {
+            return AABB(
+                Vector3(std::fmin(box.min.x, point.x), std::fmin(box.min.y, point.y), std::fmin(box.min.z, point.z)),
+                Vector3(std::fmax(box.max.x, point.x), std::fmax(box.max.y, point.y), std::fmax(box.max.z, point.z)));
+        }
+
+        static AABB Union(const AABB& a, const AABB& b) {
+            return Union(Union(a, b.min), b.max);
+        }
+
+        static bool IsEmpty(const AABB& box) {
+            return box.min.x > box.max.x;
+        }
+
+        static bool BitwiseEqual(const AABB& a, const AABB& b) {
+            return std::memcmp(&a, &b, sizeof(AABB)) == 0;
+        }
+
+        static void ExpectBoxNear(const AABB& actual, const AABB& expected, float tolerance) {
+            EXPECT_NEAR(actual.min.x, expected.min.x, tolerance);
+            EXPECT_NEAR(actual.min.y, expected.min.y, tolerance);
+            EXPECT_NEAR(actual.min.z, expected.min.z, tolerance);
+            EXPECT_NEAR(actual.max.x, expected.max.x, tolerance);
+            EXPECT_NEAR(actual.max.y, expected.max.y, tolerance);
+            EXPECT_NEAR(actual.max.z, expected.max.z, tolerance);
+        }
+
+        static float MaxDistance(const Sphere& sphere, const std::vector<Vector3>& points) {
+            float result = 0.0f;
+            for (const Vector3& point : points) {
+                result = std::fmax(result, Distance(sphere.center, point));
+            }
+            return result;
+        }
+    };
+
+    // ============================================================================
+    // Box Transforms
+    // ============================================================================
+
+    TEST_F(BoundingVolumeTests, TransformAABB_MatchesTransformedCorners) {
+        for (int i = 0; i < 200; ++i) {
+            const AABB box = RandomBox();
+            const Matrix4 matrix = RandomTransform().ToMatrix();
+
+            // Arvo's box is the exact bound of the corners, not just a superset
+            ExpectBoxNear(TransformAABB(box, matrix), TransformCorners(box, matrix), 1e-3f);
+        }
+    }
+
+    TEST_F(BoundingVolumeTests, TransformAABB_TransformOverloadMatchesMatrix) {
+        for (int i = 0; i < 50; ++i) {
+            const AABB box = RandomBox();
+            const Transform transform = RandomTransform();
+            EXPECT_TRUE(BitwiseEqual(TransformAABB(box, transform), TransformAABB(box, transform.ToMatrix())));
+        }
+    }
+
+    TEST_F(BoundingVolumeTests, TransformAABB_AxisRotationSwapsExtents) {
+        const AABB box(Vector3(-1.0f, -2.0f, -3.0f), Vector3(1.0f, 2.0f, 3.0f));
+        const Matrix4 matrix = Transform(Vector3(10.0f, 0.0f, 0.0f), FromAxisAngle(Vector3::UNIT_Z, HALF_PI)).ToMatrix();
+
+        const AABB result = TransformAABB(box, matrix);
+        ExpectBoxNear(result, AABB(Vector3(8.0f, -1.0f, -3.0f), Vector3(12.0f, 1.0f, 3.0f)), 1e-5f);
+    }
+
+    TEST_F(BoundingVolumeTests, TransformAABB_EmptyStaysEmpty) {
+        const AABB result = TransformAABB(EMPTY_AABB, RandomTransform().ToMatrix());
+        EXPECT_TRUE(IsEmpty(result));
+        EXPECT_TRUE(BitwiseEqual(result, EMPTY_AABB));
+    }
+
+    TEST_F(BoundingVolumeTests, TransformAABBs_BatchMatchesScalarExactly) {
+        // An odd count exercises the scalar tail; empty boxes are mixed in
+        constexpr size_t COUNT = 103;
+        std::vector<AABB> local(COUNT);
+        std::vector<Matrix4> matrices(COUNT);
+        std::vector<Transform> transforms(COUNT);
+        for (size_t i = 0; i < COUNT; ++i) {
+            local[i] = (i % 17 == 5) ? AABB(Vector3(1.0f), Vector3(-1.0f)) : RandomBox();
+            transforms[i] = RandomTransform();
+            matrices[i] = transforms[i].ToMatrix();
+        }
+
+        std::vector<AABB> fromMatrices(COUNT);
+        std::vector<AABB> fromTransforms(COUNT);
+        TransformAABBs(local.data(), matrices.data(), fromMatrices.data(), COUNT);
+        TransformAABBs(local.data(), transforms.data(), fromTransforms.data(), COUNT);
+
+        for (size_t i = 0; i < COUNT; ++i) {
+            const AABB expected = TransformAABB(local[i], matrices[i]);
+            EXPECT_TRUE(BitwiseEqual(fromMatrices[i], expected)) << "Box " << i;
+            EXPECT_TRUE(BitwiseEqual(fromTransforms[i], expected)) << "Box " << i;
+        }
+        EXPECT_TRUE(IsEmpty(fromMatrices[5]));
+    }
+
+    TEST_F(BoundingVolumeTests, TransformAABBs_InPlaceAndNoOverrun) {
+        constexpr size_t COUNT = 9;
+        std::vector<AABB> boxes(COUNT + 1);
+        std::vector<Matrix4> matrices(COUNT);
+        for (size_t i = 0; i < COUNT; ++i) {
+            boxes[i] = RandomBox();
+            matrices[i] = RandomTransform().ToMatrix();
+        }
+        const AABB sentinel(Vector3(123.0f), Vector3(456.0f));
+        boxes[COUNT] = sentinel;
+        const std::vector<AABB> original = boxes;
+
+        TransformAABBs(boxes.data(), matrices.data(), boxes.data(), COUNT);
+
+        for (size_t i = 0; i < COUNT; ++i) {
+            EXPECT_TRUE(BitwiseEqual(boxes[i], TransformAABB(original[i], matrices[i]))) << "Box " << i;
+        }
+        EXPECT_TRUE(BitwiseEqual(boxes[COUNT], sentinel));
+    }
+
+    // ============================================================================
+    // Merging and Construction
+    // ============================================================================
+
+    TEST_F(BoundingVolumeTests, MergeAABBs_MatchesScalarUnion) {
+        for (size_t count : { size_t(1), size_t(2), size_t(3), size_t(64), size_t(257) }) {
+            std::vector<AABB> boxes(count);
+            AABB expected = EMPTY_AABB;
+            for (size_t i = 0; i < count; ++i) {
+                boxes[i] = RandomBox();
+                expected = Union(expected, boxes[i]);
+            }
+
+            const AABB merged = MergeAABBs(boxes.data(), count);
+            EXPECT_TRUE(BitwiseEqual(merged, expected)) << "Count " << count;
+        }
+    }
+
+    TEST_F(BoundingVolumeTests, MergeAABBs_SkipsEmptyBoxes) {
+        const std::vector<AABB> boxes = {
+            AABB(Vector3(5.0f), Vector3(-5.0f)),
+            AABB(Vector3(0.0f), Vector3(1.0f)),
+            EMPTY_AABB,
+            AABB(Vector3(2.0f, -1.0f, 0.5f), Vector3(3.0f, 0.0f, 0.75f)) };
+
+        const AABB merged = MergeAABBs(boxes.data(), boxes.size());
+        EXPECT_TRUE(BitwiseEqual(merged, AABB(Vector3(0.0f, -1.0f, 0.0f), Vector3(3.0f, 1.0f, 1.0f))));
+
+        EXPECT_TRUE(BitwiseEqual(MergeAABBs(boxes.data(), 0), EMPTY_AABB));
+        EXPECT_TRUE(IsEmpty(MergeAABBs(boxes.data(), 1)));
+    }
+
+    TEST_F(BoundingVolumeTests, ComputeAABB_IsExactForAllTailLengths) {
+        for (size_t count = 1; count <= 23; ++count) {
+            std::vector<Vector3> points(count);
+            AABB expected = EMPTY_AABB;
+            for (size_t i = 0; i < count; ++i) {
+                points[i] = RandomVector3(-100.0f, 100.0f);
+                expected = Union(expected, points[i]);
+            }
+
+            EXPECT_TRUE(BitwiseEqual(ComputeAABB(points.data(), count), expected)) << "Count " << count;
+        }
+
+        EXPECT_TRUE(BitwiseEqual(ComputeAABB(nullptr, 0), EMPTY_AABB));
+    }
+
+    TEST_F(BoundingVolumeTests, ComputeBoundingSphere_ContainsAllPoints) {
+        for (size_t count : { size_t(1), size_t(2), size_t(5), size_t(100), size_t(5000) }) {
+            std::vector<Vector3> points(count);
+            for (Vector3& point : points) {
+                point = RandomVector3(-30.0f, 30.0f);
+            }
+
+            const Sphere sphere = ComputeBoundingSphere(points.data(), count);
+            EXPECT_LE(MaxDistance(sphere, points), sphere.radius * (1.0f + 1e-5f) + 1e-6f) << "Count " << count;
+        }
+    }
+
+    TEST_F(BoundingVolumeTests, ComputeBoundingSphere_TrivialSets) {
+        const Vector3 single(3.0f, -2.0f, 7.0f);
+        const Sphere one = ComputeBoundingSphere(&single, 1);
+        EXPECT_TRUE(one.center.IsNearlyEqual(single));
+        EXPECT_FLOAT_EQ(one.radius, 0.0f);
+
+        const Vector3 pair[2] = { Vector3(-4.0f, 0.0f, 0.0f), Vector3(6.0f, 0.0f, 0.0f) };
+        const Sphere two = ComputeBoundingSphere(pair, 2);
+        EXPECT_TRUE(two.center.IsNearlyEqual(Vector3(1.0f, 0.0f, 0.0f)));
+        EXPECT_FLOAT_EQ(two.radius, 5.0f);
+
+        EXPECT_FLOAT_EQ(ComputeBoundingSphere(nullptr, 0).radius, 0.0f);
+    }
+
+    TEST_F(BoundingVolumeTests, ComputeBoundingSphere_NearOptimalForSpherePoints) {
+        // Points on a known sphere: the minimum enclosing sphere is that sphere
+        const Vector3 center(12.0f, -7.0f, 3.0f);
+        constexpr float RADIUS = 8.0f;
+        std::vector<Vector3> points(4000);
+        for (Vector3& point : points) {
+            point = center + RandomNormalizedVector3() * RADIUS;
+        }
+
+        const Sphere sphere = ComputeBoundingSphere(points.data(), points.size());
+        EXPECT_LE(sphere.radius, RADIUS * 1.05f);
+        EXPECT_GE(sphere.radius, RADIUS * 0.999f);
+        EXPECT_LT(Distance(sphere.center, center), RADIUS * 0.1f);
+    }
+
+    TEST_F(BoundingVolumeTests, ComputeBoundingSphere_NearOptimalForBoxPoints) {
+        // A filled box including its corners is bounded by the circumsphere
+        std::vector<Vector3> points;
+        for (int corner = 0; corner < 8; ++corner) {
+            points.emplace_back((corner & 1) ? 2.0f : -2.0f, (corner & 2) ? 1.0f : -1.0f, (corner & 4) ? 3.0f : -3.0f);
+        }
+        for (int i = 0; i < 3000; ++i) {
+            points.emplace_back(RandomFloat(-2.0f, 2.0f), RandomFloat(-1.0f, 1.0f), RandomFloat(-3.0f, 3.0f));
+        }
+
+        const float optimal = std::sqrt(4.0f + 1.0f + 9.0f);
+        const Sphere sphere = ComputeBoundingSphere(points.data(), points.size());
+        EXPECT_LE(sphere.radius, optimal * 1.05f);
+        EXPECT_LE(MaxDistance(sphere, points), sphere.radius * (1.0f + 1e-5f));
+    }
+
+    // ============================================================================
+    // Hierarchies
+    // ============================================================================
+
+    TEST_F(BoundingVolumeTests, UpdateHierarchyBounds_SubtreesEncloseDescendants) {
+        constexpr size_t COUNT = 300;
+        std::vector<AABB> local(COUNT);
+        std::vector<Matrix4> world(COUNT);
+        std::vector<int32_t> parents(COUNT);
+        for (size_t i = 0; i < COUNT; ++i) {
+            local[i] = (i % 23 == 7) ? EMPTY_AABB : RandomBox();
+            world[i] = RandomTransform().ToMatrix();
+            parents[i] = (i == 0 || RandomInt(0, 9) == 0) ? -1 : RandomInt(0, static_cast<int>(i) - 1);
+        }
+
+        std::vector<AABB> worldBounds(COUNT);
+        std::vector<AABB> subtreeBounds(COUNT);
+        UpdateHierarchyBounds(local.data(), world.data(), parents.data(), worldBounds.data(), subtreeBounds.data(), COUNT);
+
+        // Reference: fold every node's world box into itself and all ancestors
+        std::vector<AABB> expected(COUNT, EMPTY_AABB);
+        for (size_t i = 0; i < COUNT; ++i) {
+            EXPECT_TRUE(BitwiseEqual(worldBounds[i], TransformAABB(local[i], world[i]))) << "Node " << i;
+            for (int32_t node = static_cast<int32_t>(i); node >= 0; node = parents[node]) {
+                if (!IsEmpty(worldBounds[i])) {
+                    expected[node] = Union(expected[node], worldBounds[i]);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < COUNT; ++i) {
+            EXPECT_TRUE(BitwiseEqual(subtreeBounds[i], expected[i])) << "Node " << i;
+        }
+    }
+
+    TEST_F(BoundingVolumeTests, UpdateHierarchyBounds_SubtreeOptional) {
+        const AABB local[2] = { RandomBox(), RandomBox() };
+        const Matrix4 world[2] = { RandomTransform().ToMatrix(), RandomTransform().ToMatrix() };
+        const int32_t parents[2] = { -1, 0 };
+
+        AABB worldBounds[2];
+        UpdateHierarchyBounds(local, world, parents, worldBounds, nullptr, 2);
+        EXPECT_TRUE(BitwiseEqual(worldBounds[1], TransformAABB(local[1], world[1])));
+    }
+
+}
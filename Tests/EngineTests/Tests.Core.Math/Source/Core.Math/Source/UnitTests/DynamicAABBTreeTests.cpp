@@ -0,0 +1,294 @@
+// Tests/Core.Math/Source/UnitTests/DynamicAABBTreeTests.cpp
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+import Akhanda.Core.Math;
+#include "../Fixtures/MathTestFixtures.hpp"
+#include "../TestConstants.hpp"
+
+using namespace Akhanda::Tests::Math;
+using namespace Akhanda::Math;
+
+namespace {
+
+    class DynamicAABBTreeTests : public MathTestFixture {
+    protected:
+        static constexpr size_t OBJECT_COUNT = 500;
+
+        void SetUp() override {
+            MathTestFixture::SetUp();
+
+            boxes.resize(OBJECT_COUNT);
+            proxies.resize(OBJECT_COUNT);
+            for (size_t i = 0; i < OBJECT_COUNT; ++i) {
+                boxes[i] = RandomBox();
+                proxies[i] = tree.CreateProxy(boxes[i], static_cast<uint32_t>(i));
+            }
+        }
+
+        AABB RandomBox() {
+            const Vector3 center = RandomVector3(-50.0f, 50.0f);
+            const Vector3 halfSize(RandomFloat(0.2f, 2.0f), RandomFloat(0.2f, 2.0f), RandomFloat(0.2f, 2.0f));
+            return AABB(center - halfSize, center + halfSize);
+        }
+
+        static bool Overlaps(const AABB& a, const AABB& b) {
+            return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+                a.min.y <= b.max.y && a.max.y >= b.min.y &&
+                a.min.z <= b.max.z && a.max.z >= b.min.z;
+        }
+
+        static bool Contains(const AABB& outer, const AABB& inner) {
+            return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+                inner.max.x <= outer.max.x && inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+        }
+
+        std::vector<uint32_t> QueryTree(const AABB& bounds) const {
+            std::vector<uint32_t> result;
+            tree.Query(bounds, [&](int32_t proxyId) {
+                result.push_back(tree.GetUserData(proxyId));
+                return true;
+            });
+            std::sort(result.begin(), result.end());
+            return result;
+        }
+
+        std::vector<uint32_t> QueryBruteForce(const AABB& bounds) const {
+            std::vector<uint32_t> result;
+            for (size_t i = 0; i < proxies.size(); ++i) {
+                if (proxies[i] != DynamicAABBTree::NULL_NODE && Overlaps(tree.GetFatAABB(proxies[i]), bounds)) {
+                    result.push_back(static_cast<uint32_t>(i));
+                }
+            }
+            return result;
+        }
+
+        DynamicAABBTree tree{ 0.1f, 2.0f };
+        std::vector<AABB> boxes;
+        std::vector<int32_t> proxies;
+    };
+
+    // ============================================================================
+    // Structure
+    // ============================================================================
+
+    TEST_F(DynamicAABBTreeTests, Build_ProducesValidBalancedTree) {
+        EXPECT_TRUE(tree.Validate());
+        EXPECT_EQ(tree.GetProxyCount(), OBJECT_COUNT);
+
+        // An AVL-balanced tree of n leaves is at most ~1.44 log2(n) high
+        const float bound = 1.45f * std::log2(static_cast<float>(OBJECT_COUNT)) + 2.0f;
+        EXPECT_LE(static_cast<float>(tree.GetHeight()), bound);
+    }
+
+    TEST_F(DynamicAABBTreeTests, FatAABB_ContainsTightBounds) {
+        for (size_t i = 0; i < OBJECT_COUNT; ++i) {
+            EXPECT_TRUE(Contains(tree.GetFatAABB(proxies[i]), boxes[i])) << "Proxy " << i;
+            EXPECT_EQ(tree.GetUserData(proxies[i]), i);
+        }
+    }
+
+    TEST_F(DynamicAABBTreeTests, MoveProxy_OnlyReinsertsOutsideFatBounds) {
+        const Vector3 nudge(0.05f, 0.0f, 0.0f);
+        EXPECT_FALSE(tree.MoveProxy(proxies[0], AABB(boxes[0].min + nudge, boxes[0].max + nudge), nudge));
+
+        const Vector3 jump(10.0f, 0.0f, 0.0f);
+        const AABB moved(boxes[0].min + jump, boxes[0].max + jump);
+        EXPECT_TRUE(tree.MoveProxy(proxies[0], moved, jump));
+        EXPECT_TRUE(Contains(tree.GetFatAABB(proxies[0]), moved));
+        // Predicted motion extends the fat box ahead of the object
+        EXPECT_GT(tree.GetFatAABB(proxies[0]).max.x, moved.max.x + jump.x);
+        EXPECT_TRUE(tree.Validate());
+    }
+
+    TEST_F(DynamicAABBTreeTests, ManyMovesAndRemovals_KeepTreeValid) {
+        for (int frame = 0; frame < 20; ++frame) {
+            for (size_t i = 0; i < OBJECT_COUNT; ++i) {
+                if (proxies[i] == DynamicAABBTree::NULL_NODE) {
+                    continue;
+                }
+                const Vector3 displacement = RandomVector3(-1.0f, 1.0f);
+                boxes[i] = AABB(boxes[i].min + displacement, boxes[i].max + displacement);
+                tree.MoveProxy(proxies[i], boxes[i], displacement);
+            }
+
+            // Remove and re-add a few proxies each frame to cycle the free list
+            for (int j = 0; j < 10; ++j) {
+                const size_t victim = static_cast<size_t>(RandomInt(0, static_cast<int>(OBJECT_COUNT) - 1));
+                if (proxies[victim] != DynamicAABBTree::NULL_NODE) {
+                    tree.DestroyProxy(proxies[victim]);
+                    proxies[victim] = DynamicAABBTree::NULL_NODE;
+                }
+                else {
+                    boxes[victim] = RandomBox();
+                    proxies[victim] = tree.CreateProxy(boxes[victim], static_cast<uint32_t>(victim));
+                }
+            }
+
+            ASSERT_TRUE(tree.Validate()) << "Frame " << frame;
+        }
+
+        const float bound = 1.45f * std::log2(static_cast<float>(OBJECT_COUNT)) + 2.0f;
+        EXPECT_LE(static_cast<float>(tree.GetHeight()), bound);
+    }
+
+    TEST_F(DynamicAABBTreeTests, DestroyedNodes_AreReused) {
+        const AABB box = RandomBox();
+        const int32_t extra = tree.CreateProxy(box, 9999);
+        tree.DestroyProxy(extra);
+        const int32_t reused = tree.CreateProxy(box, 9999);
+
+        // The leaf and its parent return to the free list and are handed out again
+        EXPECT_TRUE(reused == extra || tree.GetUserData(reused) == 9999u);
+        EXPECT_TRUE(tree.Validate());
+    }
+
+    TEST_F(DynamicAABBTreeTests, Clear_EmptiesTree) {
+        tree.Clear();
+        EXPECT_EQ(tree.GetProxyCount(), 0u);
+        EXPECT_EQ(tree.GetHeight(), 0);
+        EXPECT_TRUE(tree.Validate());
+
+        size_t hits = 0;
+        tree.Query(AABB(Vector3(-100.0f), Vector3(100.0f)), [&](int32_t) { ++hits; return true; });
+        EXPECT_EQ(hits, 0u);
+    }
+
+    // ============================================================================
+    // Queries
+    // ============================================================================
+
+    TEST_F(DynamicAABBTreeTests, AABBQuery_MatchesBruteForce) {
+        for (int i = 0; i < 50; ++i) {
+            const Vector3 center = RandomVector3(-50.0f, 50.0f);
+            const Vector3 halfSize(RandomFloat(1.0f, 15.0f));
+            const AABB region(center - halfSize, center + halfSize);
+
+            EXPECT_EQ(QueryTree(region), QueryBruteForce(region)) << "Query " << i;
+        }
+    }
+
+    TEST_F(DynamicAABBTreeTests, AABBQuery_StopsWhenCallbackReturnsFalse) {
+        size_t hits = 0;
+        tree.Query(AABB(Vector3(-100.0f), Vector3(100.0f)), [&](int32_t) { ++hits; return hits < 3; });
+        EXPECT_EQ(hits, 3u);
+    }
+
+    TEST_F(DynamicAABBTreeTests, FrustumQuery_MatchesBruteForce) {
+        // A box-shaped frustum with one slanted side; planes face inward
+        Frustum frustum;
+        frustum.planes[0] = Plane(Vector3::UNIT_X, -20.0f);
+        frustum.planes[1] = Plane(-Vector3::UNIT_X, -10.0f);
+        frustum.planes[2] = Plane(Vector3::UNIT_Y, -30.0f);
+        frustum.planes[3] = Plane(-Vector3::UNIT_Y, -30.0f);
+        frustum.planes[4] = Plane(Normalize(Vector3(0.0f, 0.3f, 1.0f)), -25.0f);
+        frustum.planes[5] = Plane(-Vector3::UNIT_Z, -40.0f);
+
+        std::vector<uint32_t> fromTree;
+        tree.Query(frustum, [&](int32_t proxyId) {
+            fromTree.push_back(tree.GetUserData(proxyId));
+            return true;
+        });
+        std::sort(fromTree.begin(), fromTree.end());
+
+        std::vector<uint32_t> expected;
+        for (size_t i = 0; i < OBJECT_COUNT; ++i) {
+            if (frustum.Intersects(tree.GetFatAABB(proxies[i]))) {
+                expected.push_back(static_cast<uint32_t>(i));
+            }
+        }
+
+        EXPECT_FALSE(expected.empty());
+        EXPECT_EQ(fromTree, expected);
+    }
+
+    TEST_F(DynamicAABBTreeTests, RayCast_FindsClosestHit) {
+        for (int i = 0; i < 50; ++i) {
+            const Ray ray(Vector3(-80.0f, RandomFloat(-40.0f, 40.0f), RandomFloat(-40.0f, 40.0f)),
+                Normalize(Vector3(1.0f, RandomFloat(-0.3f, 0.3f), RandomFloat(-0.3f, 0.3f))));
+
+            int32_t closestProxy = DynamicAABBTree::NULL_NODE;
+            tree.RayCast(ray, 200.0f, [&](int32_t proxyId, const Ray& r, float maxT) {
+                float tMin, tMax;
+                const AABB& box = boxes[tree.GetUserData(proxyId)];
+                if (RayAABBIntersection(r, box, tMin, tMax) && tMin >= 0.0f && tMin < maxT) {
+                    closestProxy = proxyId;
+                    return tMin;    // Clip the ray to the new closest hit
+                }
+                return -1.0f;       // Ignore this proxy
+            });
+
+            float bestT = 200.0f;
+            int32_t expectedProxy = DynamicAABBTree::NULL_NODE;
+            for (size_t j = 0; j < OBJECT_COUNT; ++j) {
+                float tMin, tMax;
+                if (RayAABBIntersection(ray, boxes[j], tMin, tMax) && tMin >= 0.0f && tMin < bestT) {
+                    bestT = tMin;
+                    expectedProxy = proxies[j];
+                }
+            }
+
+            EXPECT_EQ(closestProxy, expectedProxy) << "Ray " << i;
+        }
+    }
+
+    TEST_F(DynamicAABBTreeTests, RayCast_AxisAlignedRayStartingOnFace) {
+        DynamicAABBTree single;
+        const int32_t proxy = single.CreateProxy(AABB(Vector3(0.0f), Vector3(1.0f)), 7);
+        const AABB fat = single.GetFatAABB(proxy);
+
+        // Each origin lies exactly on a face plane parallel to the ray, where
+        // the slab test multiplies 0 by an infinite inverse direction
+        const Ray onFaces[] = {
+            Ray(Vector3(fat.min.x, 0.5f, -5.0f), Vector3(0.0f, 0.0f, 1.0f)),
+            Ray(Vector3(fat.max.x, fat.min.y, -5.0f), Vector3(0.0f, 0.0f, 1.0f)),
+            Ray(Vector3(-5.0f, fat.max.y, fat.max.z), Vector3(1.0f, 0.0f, 0.0f)),
+            Ray(Vector3(fat.min.x, 0.5f, 0.5f), Vector3(1.0f, 0.0f, 0.0f)),
+        };
+        for (const Ray& ray : onFaces) {
+            int hits = 0;
+            single.RayCast(ray, 100.0f, [&](int32_t, const Ray&, float maxT) {
+                ++hits;
+                return maxT;
+            });
+            EXPECT_EQ(hits, 1) << "Origin " << ray.origin.x << ", " << ray.origin.y << ", " << ray.origin.z;
+        }
+
+        // Just outside a slab the ray still misses
+        int misses = 0;
+        single.RayCast(Ray(Vector3(fat.max.x + 0.01f, 0.5f, -5.0f), Vector3(0.0f, 0.0f, 1.0f)), 100.0f,
+            [&](int32_t, const Ray&, float maxT) {
+                ++misses;
+                return maxT;
+            });
+        EXPECT_EQ(misses, 0);
+    }
+
+    TEST_F(DynamicAABBTreeTests, OverlapPairs_MatchBruteForceOnFatBounds) {
+        std::vector<std::pair<uint32_t, uint32_t>> fromTree;
+        tree.QueryOverlapPairs([&](int32_t a, int32_t b) {
+            const uint32_t userA = tree.GetUserData(a);
+            const uint32_t userB = tree.GetUserData(b);
+            fromTree.emplace_back(std::min(userA, userB), std::max(userA, userB));
+            return true;
+        });
+        std::sort(fromTree.begin(), fromTree.end());
+
+        std::vector<std::pair<uint32_t, uint32_t>> expected;
+        for (uint32_t i = 0; i < OBJECT_COUNT; ++i) {
+            for (uint32_t j = i + 1; j < OBJECT_COUNT; ++j) {
+                if (Overlaps(tree.GetFatAABB(proxies[i]), tree.GetFatAABB(proxies[j]))) {
+                    expected.emplace_back(i, j);
+                }
+            }
+        }
+
+        EXPECT_FALSE(expected.empty());
+        EXPECT_EQ(fromTree, expected);
+    }
+
+}
@@ -0,0 +1,247 @@
+// Tests/Core.Math/Source/UnitTests/OBBIntersectionTests.cpp
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+import Akhanda.Core.Math;
+#include "../Fixtures/MathTestFixtures.hpp"
+#include "../TestConstants.hpp"
+
+using namespace Akhanda::Tests::Math;
+using namespace Akhanda::Math;
+
+namespace {
+
+    Vector3 Column(const Matrix3& matrix, int column) {
+        return Vector3(matrix.m[column * 3], matrix.m[column * 3 + 1], matrix.m[column * 3 + 2]);
+    }
+
+    enum class SeparatingAxis { None, Face, Edge };
+
+    struct ReferenceResult {
+        bool intersects;
+        SeparatingAxis axis;
+        float margin;       // Smallest relative distance of any axis from its tie point
+    };
+
+    // Scalar 15-axis SAT with explicit, normalized axes (the previous
+    // OBB::Intersects). Cross axes of near-parallel edges are skipped.
+    ReferenceResult ReferenceIntersects(const OBB& a, const OBB& b) {
+        const Vector3 translation = b.center - a.center;
+        const Vector3 axesA[3] = { Column(a.rotation, 0), Column(a.rotation, 1), Column(a.rotation, 2) };
+        const Vector3 axesB[3] = { Column(b.rotation, 0), Column(b.rotation, 1), Column(b.rotation, 2) };
+
+        ReferenceResult result{ true, SeparatingAxis::None, INFINITY_F };
+        auto testAxis = [&](const Vector3& axis, SeparatingAxis type) {
+            float radius = 0.0f;
+            for (int k = 0; k < 3; ++k) {
+                radius += a.extents[k] * std::fabs(Dot(axis, axesA[k])) + b.extents[k] * std::fabs(Dot(axis, axesB[k]));
+            }
+            const float distance = std::fabs(Dot(translation, axis));
+            result.margin = std::min(result.margin, std::fabs(distance - radius) / std::max(radius, 1.0f));
+            if (distance > radius && result.intersects) {
+                result.intersects = false;
+                result.axis = type;
+            }
+        };
+
+        for (int i = 0; i < 3; ++i) {
+            testAxis(axesA[i], SeparatingAxis::Face);
+            testAxis(axesB[i], SeparatingAxis::Face);
+        }
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                const Vector3 cross = Cross(axesA[i], axesB[j]);
+                if (LengthSquared(cross) >= EPSILON) {
+                    testAxis(Normalize(cross), SeparatingAxis::Edge);
+                }
+            }
+        }
+        return result;
+    }
+
+    class OBBIntersectionTests : public MathTestFixture {
+    protected:
+        OBB RandomOBB(float spread) {
+            const Quaternion rotation = FromAxisAngle(RandomNormalizedVector3(), RandomFloat(0.0f, TWO_PI));
+            return OBB(RandomVector3(-spread, spread),
+                Vector3(RandomFloat(0.2f, 3.0f), RandomFloat(0.2f, 3.0f), RandomFloat(0.2f, 3.0f)),
+                ToMatrix3(rotation));
+        }
+
+        static std::vector<Vector3> Corners(const OBB& box) {
+            std::vector<Vector3> corners;
+            for (int corner = 0; corner < 8; ++corner) {
+                const Vector3 local(
+                    (corner & 1) ? box.extents.x : -box.extents.x,
+                    (corner & 2) ? box.extents.y : -box.extents.y,
+                    (corner & 4) ? box.extents.z : -box.extents.z);
+                corners.push_back(box.center + box.rotation * local);
+            }
+            return corners;
+        }
+
+        // A frustum-shaped volume looking down +Z; planes face inward
+        static Frustum TestFrustum() {
+            Frustum frustum;
+            frustum.planes[0] = Plane(Normalize(Vector3(1.0f, 0.0f, 0.5f)), 0.0f);
+            frustum.planes[1] = Plane(Normalize(Vector3(-1.0f, 0.0f, 0.5f)), 0.0f);
+            frustum.planes[2] = Plane(Normalize(Vector3(0.0f, 1.0f, 0.6f)), 0.0f);
+            frustum.planes[3] = Plane(Normalize(Vector3(0.0f, -1.0f, 0.6f)), 0.0f);
+            frustum.planes[4] = Plane(Vector3::UNIT_Z, 1.0f);
+            frustum.planes[5] = Plane(-Vector3::UNIT_Z, -30.0f);
+            return frustum;
+        }
+    };
+
+    // ============================================================================
+    // OBB vs OBB
+    // ============================================================================
+
+    TEST_F(OBBIntersectionTests, Intersects_MatchesReferenceSAT) {
+        size_t overlaps = 0;
+        size_t edgeSeparations = 0;
+        size_t compared = 0;
+        for (int i = 0; i < 20000; ++i) {
+            const OBB a = RandomOBB(5.0f);
+            const OBB b = RandomOBB(5.0f);
+            const ReferenceResult expected = ReferenceIntersects(a, b);
+
+            // Near-touching pairs can round either way
+            if (expected.margin < 1e-4f) {
+                continue;
+            }
+
+            ++compared;
+            overlaps += expected.intersects ? 1 : 0;
+            edgeSeparations += expected.axis == SeparatingAxis::Edge ? 1 : 0;
+            ASSERT_EQ(a.Intersects(b), expected.intersects) << "Pair " << i;
+        }
+
+        // The sample must cover overlaps, face separations and the rarer edge-edge case
+        EXPECT_GT(compared, 19000u);
+        EXPECT_GT(overlaps, compared / 10);
+        EXPECT_LT(overlaps, compared * 9 / 10);
+        EXPECT_GT(edgeSeparations, 0u);
+    }
+
+    TEST_F(OBBIntersectionTests, Intersects_ParallelBoxes) {
+        // Shared orientation makes every cross axis degenerate
+        const Matrix3 rotation = ToMatrix3(FromAxisAngle(Normalize(Vector3(1.0f, 2.0f, 3.0f)), 0.7f));
+        const OBB a(Vector3::ZERO, Vector3(1.0f, 2.0f, 3.0f), rotation);
+
+        const Vector3 axisX = Column(rotation, 0);
+        EXPECT_TRUE(a.Intersects(OBB(axisX * 1.9f, Vector3(1.0f), rotation)));
+        EXPECT_FALSE(a.Intersects(OBB(axisX * 2.1f, Vector3(1.0f), rotation)));
+        EXPECT_TRUE(a.Intersects(a));
+
+        const OBB identity(Vector3(0.0f, 0.0f, 3.5f), Vector3(1.0f), Matrix3::IDENTITY);
+        const OBB aligned(Vector3::ZERO, Vector3(1.0f, 2.0f, 3.0f), Matrix3::IDENTITY);
+        EXPECT_TRUE(aligned.Intersects(identity));
+        EXPECT_FALSE(aligned.Intersects(OBB(Vector3(0.0f, 0.0f, 3.6f), Vector3(1.0f, 1.0f, 0.5f), Matrix3::IDENTITY)));
+    }
+
+    TEST_F(OBBIntersectionTests, Intersects_ContainedBox) {
+        const OBB outer(Vector3(1.0f, 2.0f, 3.0f), Vector3(5.0f), ToMatrix3(FromAxisAngle(Vector3::UNIT_Y, 0.4f)));
+        const OBB inner(Vector3(1.5f, 2.0f, 3.0f), Vector3(0.5f), ToMatrix3(FromAxisAngle(Vector3::UNIT_X, 1.1f)));
+        EXPECT_TRUE(outer.Intersects(inner));
+        EXPECT_TRUE(inner.Intersects(outer));
+    }
+
+    TEST_F(OBBIntersectionTests, IntersectOBBs_MatchesSingleTests) {
+        // An odd count exercises the scalar tail
+        constexpr size_t COUNT = 1003;
+        const OBB query = RandomOBB(2.0f);
+        std::vector<OBB> others(COUNT);
+        for (OBB& box : others) {
+            box = RandomOBB(8.0f);
+        }
+
+        std::array<bool, COUNT> results{};
+        const size_t hits = IntersectOBBs(query, others.data(), results.data(), COUNT);
+
+        size_t expectedHits = 0;
+        for (size_t i = 0; i < COUNT; ++i) {
+            const bool expected = query.Intersects(others[i]);
+            expectedHits += expected ? 1 : 0;
+            ASSERT_EQ(results[i], expected) << "Box " << i;
+        }
+        EXPECT_EQ(hits, expectedHits);
+        EXPECT_GT(hits, 0u);
+        EXPECT_LT(hits, COUNT);
+    }
+
+    // ============================================================================
+    // OBB vs Frustum
+    // ============================================================================
+
+    TEST_F(OBBIntersectionTests, FrustumIntersects_NeverRejectsVisibleBoxes) {
+        const Frustum frustum = TestFrustum();
+        size_t rejected = 0;
+        for (int i = 0; i < 5000; ++i) {
+            OBB box = RandomOBB(20.0f);
+            box.center.z += 15.0f;
+
+            const std::vector<Vector3> corners = Corners(box);
+            const bool anyCornerInside = std::any_of(corners.begin(), corners.end(),
+                [&](const Vector3& corner) { return frustum.Contains(corner); });
+            const bool centerInside = frustum.Contains(box.center);
+
+            const bool visible = frustum.Intersects(box);
+            if (anyCornerInside || centerInside) {
+                ASSERT_TRUE(visible) << "Box " << i;
+            }
+            rejected += visible ? 0 : 1;
+        }
+        EXPECT_GT(rejected, 0u);
+    }
+
+    TEST_F(OBBIntersectionTests, FrustumIntersects_MatchesAABBForAxisAlignedBoxes) {
+        const Frustum frustum = TestFrustum();
+        for (int i = 0; i < 2000; ++i) {
+            const Vector3 center = RandomVector3(-20.0f, 20.0f) + Vector3(0.0f, 0.0f, 15.0f);
+            const Vector3 extents(RandomFloat(0.2f, 3.0f), RandomFloat(0.2f, 3.0f), RandomFloat(0.2f, 3.0f));
+            const OBB box(center, extents, Matrix3::IDENTITY);
+            const AABB aabb(center - extents, center + extents);
+
+            // Both reject only when the whole box is behind a plane; ignore
+            // boxes that graze a plane and may round differently
+            bool grazing = false;
+            for (const Plane& plane : frustum.planes) {
+                const float radius = extents.x * std::fabs(plane.normal.x) + extents.y * std::fabs(plane.normal.y) +
+                    extents.z * std::fabs(plane.normal.z);
+                grazing = grazing || std::fabs(plane.DistanceToPoint(center) + radius) < 1e-3f;
+            }
+            if (!grazing) {
+                EXPECT_EQ(frustum.Intersects(box), frustum.Intersects(aabb)) << "Box " << i;
+            }
+        }
+    }
+
+    TEST_F(OBBIntersectionTests, CullOBBs_MatchesSingleTests) {
+        constexpr size_t COUNT = 1001;
+        const Frustum frustum = TestFrustum();
+        std::vector<OBB> boxes(COUNT);
+        for (OBB& box : boxes) {
+            box = RandomOBB(25.0f);
+            box.center.z += 15.0f;
+        }
+
+        std::array<bool, COUNT> visible{};
+        const size_t visibleCount = CullOBBs(frustum, boxes.data(), visible.data(), COUNT);
+
+        size_t expectedCount = 0;
+        for (size_t i = 0; i < COUNT; ++i) {
+            const bool expected = frustum.Intersects(boxes[i]);
+            expectedCount += expected ? 1 : 0;
+            ASSERT_EQ(visible[i], expected) << "Box " << i;
+        }
+        EXPECT_EQ(visibleCount, expectedCount);
+        EXPECT_GT(visibleCount, 0u);
+        EXPECT_LT(visibleCount, COUNT);
+    }
+
+}
@@ -0,0 +1,376 @@
+// Tests/Core.Math/Source/UnitTests/QuantizationTests.cpp
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+import Akhanda.Core.Math;
+#include "../Fixtures/MathTestFixtures.hpp"
+#include "../TestConstants.hpp"
+
+using namespace Akhanda::Tests::Math;
+using namespace Akhanda::Math;
+
+namespace {
+
+    class QuantizationTests : public MathTestFixture {
+    protected:
+        static constexpr size_t SAMPLE_COUNT = 100003; // Not a multiple of any batch width
+
+        // Angle between two directions in degrees, evaluated in double so the
+        // measurement does not swamp the quantization error
+        static double AngleBetween(const Vector3& a, const Vector3& b) {
+            const double cx = static_cast<double>(a.y) * b.z - static_cast<double>(a.z) * b.y;
+            const double cy = static_cast<double>(a.z) * b.x - static_cast<double>(a.x) * b.z;
+            const double cz = static_cast<double>(a.x) * b.y - static_cast<double>(a.y) * b.x;
+            const double dot = static_cast<double>(a.x) * b.x + static_cast<double>(a.y) * b.y + static_cast<double>(a.z) * b.z;
+            return std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz), dot) * 57.29577951308232;
+        }
+
+        static double AngleBetween(const Quaternion& a, const Quaternion& b) {
+            const double lengths = std::sqrt(
+                (static_cast<double>(a.x) * a.x + static_cast<double>(a.y) * a.y + static_cast<double>(a.z) * a.z + static_cast<double>(a.w) * a.w) *
+                (static_cast<double>(b.x) * b.x + static_cast<double>(b.y) * b.y + static_cast<double>(b.z) * b.z + static_cast<double>(b.w) * b.w));
+            const double dot = std::fabs((static_cast<double>(a.x) * b.x + static_cast<double>(a.y) * b.y +
+                static_cast<double>(a.z) * b.z + static_cast<double>(a.w) * b.w) / lengths);
+            const double clamped = dot > 1.0 ? 1.0 : dot;
+            return 2.0 * std::atan2(std::sqrt(1.0 - clamped * clamped), clamped) * 57.29577951308232;
+        }
+
+        static std::vector<Vector3> RandomNormals(size_t count, uint64_t seed) {
+            std::vector<Vector3> normals(count);
+            RandomStream(seed).FillUnitVector3(normals.data(), normals.size());
+            return normals;
+        }
+
+        static std::vector<Quaternion> RandomRotations(size_t count, uint64_t seed) {
+            std::vector<float> gaussian(count * 4);
+            RandomStream(seed).FillGaussian(gaussian.data(), gaussian.size());
+
+            std::vector<Quaternion> rotations(count);
+            for (size_t i = 0; i < count; ++i) {
+                rotations[i] = Normalize(Quaternion(gaussian[i * 4], gaussian[i * 4 + 1], gaussian[i * 4 + 2], gaussian[i * 4 + 3]));
+            }
+            return rotations;
+        }
+
+        static bool BitwiseEqual(const Quaternion& a, const Quaternion& b) {
+            return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
+        }
+    };
+
+    // ============================================================================
+    // Half Precision
+    // ============================================================================
+
+    TEST_F(QuantizationTests, FloatToHalf_KnownValues) {
+        EXPECT_EQ(FloatToHalf(0.0f), 0x0000);
+        EXPECT_EQ(FloatToHalf(-0.0f), 0x8000);
+        EXPECT_EQ(FloatToHalf(1.0f), 0x3C00);
+        EXPECT_EQ(FloatToHalf(-2.0f), 0xC000);
+        EXPECT_EQ(FloatToHalf(65504.0f), 0x7BFF);           // Largest finite half
+        EXPECT_EQ(FloatToHalf(65520.0f), 0x7C00);           // Rounds up to infinity
+        EXPECT_EQ(FloatToHalf(5.9604645e-8f), 0x0001);      // Smallest subnormal
+        EXPECT_EQ(FloatToHalf(INFINITY_F), 0x7C00);
+        EXPECT_EQ(FloatToHalf(1.0f + 1.0f / 4096.0f), 0x3C00); // Tie rounds to even
+    }
+
+    TEST_F(QuantizationTests, Half_EveryFiniteValueRoundTripsExactly) {
+        for (uint32_t bits = 0; bits <= 0xFFFF; ++bits) {
+            const uint16_t half = static_cast<uint16_t>(bits);
+            const float value = HalfToFloat(half);
+            if (std::isnan(value)) {
+                continue;
+            }
+            ASSERT_EQ(FloatToHalf(value), half) << "Half 0x" << std::hex << bits;
+        }
+    }
+
+    TEST_F(QuantizationTests, Half_RelativeErrorIsBounded) {
+        std::vector<float> values(SAMPLE_COUNT);
+        RandomStream(1).FillFloat(values.data(), values.size(), -60000.0f, 60000.0f);
+
+        for (const float value : values) {
+            if (std::fabs(value) < 6.1035156e-5f) {
+                continue; // Subnormal halves only carry absolute precision
+            }
+            const float decoded = HalfToFloat(FloatToHalf(value));
+            ASSERT_LE(std::fabs(decoded - value), std::fabs(value) * (1.0f / 2048.0f)) << value;
+        }
+    }
+
+    TEST_F(QuantizationTests, Half_BatchMatchesScalar) {
+        std::vector<float> values(1003);
+        RandomStream(2).FillFloat(values.data(), values.size(), -70000.0f, 70000.0f);
+        values[0] = 0.0f;
+        values[1] = -0.0f;
+        values[2] = 1e-6f;
+        values[3] = INFINITY_F;
+        values[4] = NEG_INFINITY_F;
+        values[5] = 3e-5f;
+
+        std::vector<uint16_t> halves(values.size());
+        FloatToHalf(values.data(), halves.data(), values.size());
+        std::vector<float> decoded(values.size());
+        HalfToFloat(halves.data(), decoded.data(), halves.size());
+
+        for (size_t i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(halves[i], FloatToHalf(values[i])) << "Index " << i;
+            ASSERT_EQ(decoded[i], HalfToFloat(halves[i])) << "Index " << i;
+        }
+    }
+
+    // ============================================================================
+    // Normalized Integers
+    // ============================================================================
+
+    TEST_F(QuantizationTests, Snorm_FollowsD3DConversionRules) {
+        EXPECT_EQ(FloatToSnorm16(1.0f), 32767);
+        EXPECT_EQ(FloatToSnorm16(-1.0f), -32767);
+        EXPECT_EQ(FloatToSnorm16(2.0f), 32767);
+        EXPECT_EQ(FloatToSnorm16(0.0f), 0);
+        EXPECT_EQ(FloatToSnorm8(-1.0f), -127);
+        EXPECT_FLOAT_EQ(Snorm16ToFloat(-32768), -1.0f);
+        EXPECT_FLOAT_EQ(Snorm8ToFloat(-128), -1.0f);
+        EXPECT_FLOAT_EQ(Snorm8ToFloat(127), 1.0f);
+    }
+
+    TEST_F(QuantizationTests, Unorm_FollowsD3DConversionRules) {
+        EXPECT_EQ(FloatToUnorm16(1.0f), 65535);
+        EXPECT_EQ(FloatToUnorm16(-0.5f), 0);
+        EXPECT_EQ(FloatToUnorm8(0.5f), 128);
+        EXPECT_FLOAT_EQ(Unorm8ToFloat(255), 1.0f);
+        EXPECT_FLOAT_EQ(Unorm16ToFloat(0), 0.0f);
+    }
+
+    TEST_F(QuantizationTests, Normalized_RoundTripErrorIsHalfAStep) {
+        std::vector<float> values(SAMPLE_COUNT);
+        RandomStream(3).FillFloat(values.data(), values.size(), -1.0f, 1.0f);
+
+        for (const float value : values) {
+            ASSERT_LE(std::fabs(Snorm8ToFloat(FloatToSnorm8(value)) - value), 0.5f / 127.0f + Constants::EPSILON);
+            ASSERT_LE(std::fabs(Snorm16ToFloat(FloatToSnorm16(value)) - value), 0.5f / 32767.0f + Constants::EPSILON);
+
+            const float unit = std::fabs(value);
+            ASSERT_LE(std::fabs(Unorm8ToFloat(FloatToUnorm8(unit)) - unit), 0.5f / 255.0f + Constants::EPSILON);
+            ASSERT_LE(std::fabs(Unorm16ToFloat(FloatToUnorm16(unit)) - unit), 0.5f / 65535.0f + Constants::EPSILON);
+        }
+    }
+
+    TEST_F(QuantizationTests, Normalized_BatchMatchesScalar) {
+        std::vector<float> values(1003);
+        RandomStream(4).FillFloat(values.data(), values.size(), -1.2f, 1.2f);
+        const size_t count = values.size();
+
+        std::vector<int8_t> snorm8(count);
+        std::vector<int16_t> snorm16(count);
+        std::vector<uint8_t> unorm8(count);
+        std::vector<uint16_t> unorm16(count);
+        FloatToSnorm8(values.data(), snorm8.data(), count);
+        FloatToSnorm16(values.data(), snorm16.data(), count);
+        FloatToUnorm8(values.data(), unorm8.data(), count);
+        FloatToUnorm16(values.data(), unorm16.data(), count);
+
+        std::vector<float> fromSnorm8(count), fromSnorm16(count), fromUnorm8(count), fromUnorm16(count);
+        Snorm8ToFloat(snorm8.data(), fromSnorm8.data(), count);
+        Snorm16ToFloat(snorm16.data(), fromSnorm16.data(), count);
+        Unorm8ToFloat(unorm8.data(), fromUnorm8.data(), count);
+        Unorm16ToFloat(unorm16.data(), fromUnorm16.data(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            ASSERT_EQ(snorm8[i], FloatToSnorm8(values[i])) << "Index " << i;
+            ASSERT_EQ(snorm16[i], FloatToSnorm16(values[i])) << "Index " << i;
+            ASSERT_EQ(unorm8[i], FloatToUnorm8(values[i])) << "Index " << i;
+            ASSERT_EQ(unorm16[i], FloatToUnorm16(values[i])) << "Index " << i;
+            ASSERT_EQ(fromSnorm8[i], Snorm8ToFloat(snorm8[i])) << "Index " << i;
+            ASSERT_EQ(fromSnorm16[i], Snorm16ToFloat(snorm16[i])) << "Index " << i;
+            ASSERT_EQ(fromUnorm8[i], Unorm8ToFloat(unorm8[i])) << "Index " << i;
+            ASSERT_EQ(fromUnorm16[i], Unorm16ToFloat(unorm16[i])) << "Index " << i;
+        }
+    }
+
+    // ============================================================================
+    // Octahedral Normals
+    // ============================================================================
+
+    TEST_F(QuantizationTests, Octahedral_AxesAreExact) {
+        const Vector3 axes[] = { Vector3::UNIT_X, Vector3::UNIT_Y, Vector3::UNIT_Z, -Vector3::UNIT_X, -Vector3::UNIT_Y, -Vector3::UNIT_Z };
+        for (const Vector3& axis : axes) {
+            EXPECT_TRUE(DecodeOctahedral32(EncodeOctahedral32(axis)).IsNearlyEqual(axis, Constants::EPSILON));
+            EXPECT_TRUE(DecodeOctahedral16(EncodeOctahedral16(axis)).IsNearlyEqual(axis, Constants::LOOSE_EPSILON));
+        }
+    }
+
+    TEST_F(QuantizationTests, Octahedral_AngularErrorIsBounded) {
+        const std::vector<Vector3> normals = RandomNormals(SAMPLE_COUNT, 5);
+
+        double maxError16 = 0.0;
+        double maxError32 = 0.0;
+        for (const Vector3& normal : normals) {
+            const Vector3 decoded16 = DecodeOctahedral16(EncodeOctahedral16(normal));
+            const Vector3 decoded32 = DecodeOctahedral32(EncodeOctahedral32(normal));
+            ASSERT_NEAR(Length(decoded16), 1.0f, Constants::EPSILON);
+            ASSERT_NEAR(Length(decoded32), 1.0f, Constants::EPSILON);
+
+            maxError16 = std::max(maxError16, AngleBetween(normal, decoded16));
+            maxError32 = std::max(maxError32, AngleBetween(normal, decoded32));
+        }
+
+        EXPECT_LT(maxError16, 1.1);    // 8 bits per axis
+        EXPECT_LT(maxError32, 0.005);  // 16 bits per axis
+    }
+
+    TEST_F(QuantizationTests, Octahedral_BatchMatchesScalar) {
+        const std::vector<Vector3> normals = RandomNormals(1003, 6);
+        const size_t count = normals.size();
+
+        std::vector<uint16_t> packed16(count);
+        std::vector<uint32_t> packed32(count);
+        EncodeOctahedral16(normals.data(), packed16.data(), count);
+        EncodeOctahedral32(normals.data(), packed32.data(), count);
+
+        std::vector<Vector3> decoded16(count), decoded32(count);
+        DecodeOctahedral16(packed16.data(), decoded16.data(), count);
+        DecodeOctahedral32(packed32.data(), decoded32.data(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            ASSERT_EQ(packed16[i], EncodeOctahedral16(normals[i])) << "Index " << i;
+            ASSERT_EQ(packed32[i], EncodeOctahedral32(normals[i])) << "Index " << i;
+            ASSERT_EQ(decoded16[i], DecodeOctahedral16(packed16[i])) << "Index " << i;
+            ASSERT_EQ(decoded32[i], DecodeOctahedral32(packed32[i])) << "Index " << i;
+        }
+    }
+
+    TEST_F(QuantizationTests, PackNormal_RoundTripsThroughUnpackNormal) {
+        const Vector3 normal = Normalize(Vector3(0.3f, -0.5f, -0.8f));
+        EXPECT_EQ(PackNormal(normal), EncodeOctahedral32(normal));
+        EXPECT_LT(AngleBetween(normal, UnpackNormal(PackNormal(normal))), 0.005);
+    }
+
+    // ============================================================================
+    // Smallest-Three Quaternions
+    // ============================================================================
+
+    TEST_F(QuantizationTests, Quaternion_AngularErrorIsBounded) {
+        const std::vector<Quaternion> rotations = RandomRotations(SAMPLE_COUNT, 7);
+
+        double maxError32 = 0.0;
+        double maxError48 = 0.0;
+        double maxError64 = 0.0;
+        for (const Quaternion& rotation : rotations) {
+            maxError32 = std::max(maxError32, AngleBetween(rotation, UnpackQuaternion32(PackQuaternion32(rotation))));
+            maxError48 = std::max(maxError48, AngleBetween(rotation, UnpackQuaternion48(PackQuaternion48(rotation))));
+            maxError64 = std::max(maxError64, AngleBetween(rotation, UnpackQuaternion64(PackQuaternion64(rotation))));
+        }
+
+        EXPECT_LT(maxError32, 0.3);     // 10 bits per component
+        EXPECT_LT(maxError48, 0.01);    // 15 bits per component
+        EXPECT_LT(maxError64, 0.0005);  // 20 bits per component
+    }
+
+    TEST_F(QuantizationTests, Quaternion_NegatedRotationPacksIdentically) {
+        const Quaternion rotation = Normalize(Quaternion(0.2f, -0.7f, 0.1f, -0.6f));
+        const Quaternion negated(-rotation.x, -rotation.y, -rotation.z, -rotation.w);
+
+        EXPECT_EQ(PackQuaternion32(rotation), PackQuaternion32(negated));
+        EXPECT_EQ(PackQuaternion64(rotation), PackQuaternion64(negated));
+
+        EXPECT_LT(AngleBetween(rotation, UnpackQuaternion64(PackQuaternion64(negated))), 0.0005);
+    }
+
+    TEST_F(QuantizationTests, Quaternion_IdentityIsExact) {
+        EXPECT_TRUE(BitwiseEqual(UnpackQuaternion32(PackQuaternion32(Quaternion::IDENTITY)), Quaternion::IDENTITY));
+        EXPECT_TRUE(BitwiseEqual(UnpackQuaternion64(PackQuaternion64(Quaternion::IDENTITY)), Quaternion::IDENTITY));
+    }
+
+    TEST_F(QuantizationTests, Quaternion_BatchMatchesScalar) {
+        const std::vector<Quaternion> rotations = RandomRotations(1003, 8);
+        const size_t count = rotations.size();
+
+        std::vector<uint32_t> packed32(count);
+        std::vector<PackedQuaternion48> packed48(count);
+        std::vector<uint64_t> packed64(count);
+        PackQuaternion32(rotations.data(), packed32.data(), count);
+        PackQuaternion48(rotations.data(), packed48.data(), count);
+        PackQuaternion64(rotations.data(), packed64.data(), count);
+
+        std::vector<Quaternion> decoded32(count), decoded48(count), decoded64(count);
+        UnpackQuaternion32(packed32.data(), decoded32.data(), count);
+        UnpackQuaternion48(packed48.data(), decoded48.data(), count);
+        UnpackQuaternion64(packed64.data(), decoded64.data(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            const PackedQuaternion48 scalar48 = PackQuaternion48(rotations[i]);
+            ASSERT_EQ(packed32[i], PackQuaternion32(rotations[i])) << "Index " << i;
+            ASSERT_EQ(packed64[i], PackQuaternion64(rotations[i])) << "Index " << i;
+            for (int w = 0; w < 3; ++w) {
+                ASSERT_EQ(packed48[i].words[w], scalar48.words[w]) << "Index " << i;
+            }
+            ASSERT_TRUE(BitwiseEqual(decoded32[i], UnpackQuaternion32(packed32[i]))) << "Index " << i;
+            ASSERT_TRUE(BitwiseEqual(decoded48[i], UnpackQuaternion48(packed48[i]))) << "Index " << i;
+            ASSERT_TRUE(BitwiseEqual(decoded64[i], UnpackQuaternion64(packed64[i]))) << "Index " << i;
+        }
+    }
+
+    // ============================================================================
+    // Range-Quantized Positions
+    // ============================================================================
+
+    TEST_F(QuantizationTests, PositionQuantizer_ErrorWithinHalfAStep) {
+        const PositionQuantizer quantizer(AABB(Vector3(-100.0f, -5.0f, 0.0f), Vector3(100.0f, 5.0f, 1000.0f)));
+        const Vector3 maxError = quantizer.GetMaxError();
+
+        std::vector<float> coordinates(SAMPLE_COUNT * 3);
+        RandomStream(9).FillFloat(coordinates.data(), coordinates.size());
+
+        for (size_t i = 0; i < SAMPLE_COUNT; ++i) {
+            const Vector3 position(
+                -100.0f + coordinates[i * 3] * 200.0f,
+                -5.0f + coordinates[i * 3 + 1] * 10.0f,
+                coordinates[i * 3 + 2] * 1000.0f);
+            const Vector3 decoded = quantizer.Decode(quantizer.Encode(position));
+
+            // Half a step plus float rounding of the reconstruction
+            ASSERT_LE(std::fabs(decoded.x - position.x), maxError.x * 1.01f);
+            ASSERT_LE(std::fabs(decoded.y - position.y), maxError.y * 1.01f);
+            ASSERT_LE(std::fabs(decoded.z - position.z), maxError.z * 1.01f);
+        }
+    }
+
+    TEST_F(QuantizationTests, PositionQuantizer_ClampsOutsideBounds) {
+        const PositionQuantizer quantizer(AABB(Vector3::ZERO, Vector3(10.0f, 10.0f, 10.0f)));
+
+        const QuantizedPosition below = quantizer.Encode(Vector3(-5.0f, -5.0f, -5.0f));
+        const QuantizedPosition above = quantizer.Encode(Vector3(50.0f, 50.0f, 50.0f));
+        EXPECT_EQ(below.x, 0);
+        EXPECT_EQ(above.z, 65535);
+        EXPECT_TRUE(quantizer.Decode(above).IsNearlyEqual(Vector3(10.0f, 10.0f, 10.0f), Constants::LOOSE_EPSILON));
+    }
+
+    TEST_F(QuantizationTests, PositionQuantizer_FlatAxisDecodesToMin) {
+        const PositionQuantizer quantizer(AABB(Vector3(0.0f, 2.0f, 0.0f), Vector3(1.0f, 2.0f, 1.0f)));
+        const Vector3 decoded = quantizer.Decode(quantizer.Encode(Vector3(0.5f, 7.0f, 0.5f)));
+        EXPECT_FLOAT_EQ(decoded.y, 2.0f);
+    }
+
+    TEST_F(QuantizationTests, PositionQuantizer_BatchMatchesScalar) {
+        const PositionQuantizer quantizer(AABB(Vector3(-50.0f, -50.0f, -50.0f), Vector3(50.0f, 50.0f, 50.0f)));
+
+        std::vector<Vector3> positions(1003);
+        RandomStream(10).FillPointInSphere(positions.data(), positions.size(), 60.0f);
+
+        std::vector<QuantizedPosition> quantized(positions.size());
+        quantizer.Encode(positions.data(), quantized.data(), positions.size());
+        std::vector<Vector3> decoded(positions.size());
+        quantizer.Decode(quantized.data(), decoded.data(), quantized.size());
+
+        for (size_t i = 0; i < positions.size(); ++i) {
+            const QuantizedPosition scalar = quantizer.Encode(positions[i]);
+            ASSERT_EQ(quantized[i].x, scalar.x) << "Index " << i;
+            ASSERT_EQ(quantized[i].y, scalar.y) << "Index " << i;
+            ASSERT_EQ(quantized[i].z, scalar.z) << "Index " << i;
+            ASSERT_EQ(decoded[i], quantizer.Decode(quantized[i])) << "Index " << i;
+        }
+    }
+
+}
@@ -0,0 +1,199 @@
+// Tests/Core.Math/Source/UnitTests/RandomStreamTests.cpp
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+import Akhanda.Core.Math;
+#include "../Fixtures/MathTestFixtures.hpp"
+#include "../TestConstants.hpp"
+
+using namespace Akhanda::Tests::Math;
+using namespace Akhanda::Math;
+
+namespace {
+
+    class RandomStreamTests : public MathTestFixture {
+    protected:
+        static constexpr size_t SAMPLE_COUNT = 100003; // Deliberately not a multiple of the block size
+    };
+
+    // ============================================================================
+    // Reproducibility
+    // ============================================================================
+
+    TEST_F(RandomStreamTests, KnownAnswer_MatchesReferenceXoshiro256PlusPlus) {
+        // Lane 0 is xoshiro256++ seeded with SplitMix64(42); lane 1 is lane 0 after one jump.
+        // These values must be identical on every platform and ISA level.
+        RandomStream stream(42);
+        EXPECT_EQ(stream.NextUInt64(), 0xD0764D4F4476689FULL);
+
+        RandomStream bulk(42);
+        uint32_t block[8];
+        bulk.FillUInt(block, 8);
+
+        constexpr uint32_t expected[8] = {
+            0x4476689Fu, 0xD0764D4Fu, 0x293B1AE5u, 0xC0B6F4BEu,
+            0x54FF844Bu, 0xBD1A8014u, 0x2E1DAA5Cu, 0x6CE8C5B3u
+        };
+        for (size_t i = 0; i < 8; ++i) {
+            EXPECT_EQ(block[i], expected[i]) << "Index " << i;
+        }
+    }
+
+    TEST_F(RandomStreamTests, SameSeed_ProducesIdenticalSequences) {
+        RandomStream a(1234, 3);
+        RandomStream b(1234, 3);
+
+        std::vector<float> floatsA(SAMPLE_COUNT), floatsB(SAMPLE_COUNT);
+        a.FillGaussian(floatsA.data(), floatsA.size());
+        b.FillGaussian(floatsB.data(), floatsB.size());
+        EXPECT_EQ(floatsA, floatsB);
+
+        std::vector<Vector3> pointsA(1001), pointsB(1001);
+        a.FillPointInSphere(pointsA.data(), pointsA.size());
+        b.FillPointInSphere(pointsB.data(), pointsB.size());
+        for (size_t i = 0; i < pointsA.size(); ++i) {
+            EXPECT_EQ(pointsA[i], pointsB[i]) << "Index " << i;
+        }
+
+        EXPECT_EQ(a.NextUInt64(), b.NextUInt64());
+    }
+
+    TEST_F(RandomStreamTests, StreamIndex_MatchesExplicitJump) {
+        RandomStream indexed(99, 2);
+        RandomStream jumped(99);
+        jumped.Jump(2);
+
+        for (int i = 0; i < 64; ++i) {
+            EXPECT_EQ(indexed.NextUInt64(), jumped.NextUInt64());
+        }
+    }
+
+    TEST_F(RandomStreamTests, DifferentStreams_DoNotCorrelate) {
+        RandomStream stream0(7, 0);
+        RandomStream stream1(7, 1);
+
+        std::vector<uint32_t> a(4096), b(4096);
+        stream0.FillUInt(a.data(), a.size());
+        stream1.FillUInt(b.data(), b.size());
+
+        size_t equal = 0;
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (a[i] == b[i]) ++equal;
+        }
+        EXPECT_EQ(equal, 0u);
+    }
+
+    // ============================================================================
+    // Distributions
+    // ============================================================================
+
+    TEST_F(RandomStreamTests, FillFloat_StaysInHalfOpenRange) {
+        RandomStream stream(5);
+        std::vector<float> values(SAMPLE_COUNT);
+        stream.FillFloat(values.data(), values.size(), -2.0f, 5.0f);
+
+        double sum = 0.0;
+        for (const float v : values) {
+            EXPECT_GE(v, -2.0f);
+            EXPECT_LT(v, 5.0f);
+            sum += v;
+        }
+        EXPECT_NEAR(sum / values.size(), 1.5, 0.05);
+    }
+
+    TEST_F(RandomStreamTests, FillInt_CoversRangeUniformly) {
+        RandomStream stream(6);
+        std::vector<int32_t> values(SAMPLE_COUNT);
+        stream.FillInt(values.data(), values.size(), -10, 10);
+
+        std::vector<size_t> histogram(20, 0);
+        for (const int32_t v : values) {
+            ASSERT_GE(v, -10);
+            ASSERT_LT(v, 10);
+            ++histogram[static_cast<size_t>(v + 10)];
+        }
+
+        const double expected = static_cast<double>(values.size()) / histogram.size();
+        for (const size_t bucket : histogram) {
+            EXPECT_NEAR(static_cast<double>(bucket), expected, expected * 0.05);
+        }
+    }
+
+    TEST_F(RandomStreamTests, FillInt_EmptyRangeReturnsMin) {
+        RandomStream stream(6);
+        std::vector<int32_t> values(13, 0);
+        stream.FillInt(values.data(), values.size(), 4, 4);
+        for (const int32_t v : values) {
+            EXPECT_EQ(v, 4);
+        }
+    }
+
+    TEST_F(RandomStreamTests, FillGaussian_HasRequestedMoments) {
+        RandomStream stream(8);
+        std::vector<float> values(SAMPLE_COUNT);
+        stream.FillGaussian(values.data(), values.size(), 1.0f, 2.0f);
+
+        double mean = 0.0;
+        for (const float v : values) mean += v;
+        mean /= values.size();
+
+        double variance = 0.0;
+        for (const float v : values) variance += (v - mean) * (v - mean);
+        variance /= values.size();
+
+        EXPECT_NEAR(mean, 1.0, 0.03);
+        EXPECT_NEAR(variance, 4.0, 0.1);
+    }
+
+    TEST_F(RandomStreamTests, FillUnitVector3_ProducesUnitLengthWithZeroMean) {
+        RandomStream stream(9);
+        std::vector<Vector3> values(SAMPLE_COUNT);
+        stream.FillUnitVector3(values.data(), values.size());
+
+        Vector3 sum = Vector3::ZERO;
+        for (const Vector3& v : values) {
+            EXPECT_NEAR(Length(v), 1.0f, Constants::LOOSE_EPSILON);
+            sum += v;
+        }
+        sum /= static_cast<float>(values.size());
+        EXPECT_NEAR(sum.x, 0.0f, 0.01f);
+        EXPECT_NEAR(sum.y, 0.0f, 0.01f);
+        EXPECT_NEAR(sum.z, 0.0f, 0.01f);
+    }
+
+    TEST_F(RandomStreamTests, FillPointInSphere_IsUniformInVolume) {
+        RandomStream stream(10);
+        std::vector<Vector3> values(SAMPLE_COUNT);
+        stream.FillPointInSphere(values.data(), values.size(), 3.0f);
+
+        size_t innerHalf = 0;
+        for (const Vector3& v : values) {
+            const float length = Length(v);
+            EXPECT_LE(length, 3.0f + Constants::LOOSE_EPSILON);
+            if (length < 1.5f) ++innerHalf;
+        }
+
+        // A ball of half the radius holds 1/8 of the volume
+        EXPECT_NEAR(static_cast<double>(innerHalf) / values.size(), 0.125, 0.005);
+    }
+
+    TEST_F(RandomStreamTests, PartialFills_ContinueTheSameStream) {
+        RandomStream stream(11);
+        std::vector<float> values(5);
+        stream.FillFloat(values.data(), values.size());
+
+        // A partial block discards its tail, so the next fill starts on a fresh block
+        RandomStream reference(11);
+        std::vector<float> expected(16);
+        reference.FillFloat(expected.data(), expected.size());
+
+        std::vector<float> next(8);
+        stream.FillFloat(next.data(), next.size());
+        for (size_t i = 0; i < 8; ++i) {
+            EXPECT_EQ(next[i], expected[8 + i]);
+        }
+    }
+
+}
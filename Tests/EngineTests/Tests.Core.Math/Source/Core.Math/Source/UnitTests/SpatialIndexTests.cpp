@@ -0,0 +1,320 @@
+// Tests/Core.Math/Source/UnitTests/SpatialIndexTests.cpp
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+
+import Akhanda.Core.Math;
+#include "../Fixtures/MathTestFixtures.hpp"
+#include "../TestConstants.hpp"
+
+using namespace Akhanda::Tests::Math;
+using namespace Akhanda::Math;
+
+namespace {
+
+    // Stand-in for JobSystem::ParallelFor so these tests do not need the scheduler
+    template<typename Task>
+    void ThreadParallelFor(uint32_t taskCount, const Task& task) {
+        std::vector<std::thread> threads;
+        for (uint32_t i = 1; i < taskCount; ++i) {
+            threads.emplace_back([&task, i]() { task(i); });
+        }
+        task(0);
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    bool Overlaps(const AABB& a, const AABB& b) {
+        return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+            a.min.y <= b.max.y && a.max.y >= b.min.y &&
+            a.min.z <= b.max.z && a.max.z >= b.min.z;
+    }
+
+    bool Overlaps(const AABB& box, const Sphere& sphere) {
+        const float dx = std::max(std::max(box.min.x - sphere.center.x, sphere.center.x - box.max.x), 0.0f);
+        const float dy = std::max(std::max(box.min.y - sphere.center.y, sphere.center.y - box.max.y), 0.0f);
+        const float dz = std::max(std::max(box.min.z - sphere.center.z, sphere.center.z - box.max.z), 0.0f);
+        return dx * dx + dy * dy + dz * dz <= sphere.radius * sphere.radius;
+    }
+
+    std::vector<uint32_t> Sorted(std::span<const uint32_t> values) {
+        std::vector<uint32_t> result(values.begin(), values.end());
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    class SpatialIndexTests : public MathTestFixture {
+    protected:
+        static constexpr size_t POINT_COUNT = 4000;
+
+        void SetUp() override {
+            MathTestFixture::SetUp();
+
+            RandomStream random(0xC0FFEEu);
+            uniformPoints.resize(POINT_COUNT);
+            for (Vector3& p : uniformPoints) {
+                p = Vector3(random.NextFloat(-50.0f, 50.0f), random.NextFloat(-50.0f, 50.0f), random.NextFloat(-50.0f, 50.0f));
+            }
+
+            // A few tight Gaussian clusters; most cells are empty and a few are crowded
+            std::vector<float> offsets(POINT_COUNT * 3);
+            random.FillGaussian(offsets.data(), offsets.size(), 0.0f, 2.0f);
+            const Vector3 clusterCenters[4] = {
+                Vector3(-30.0f, 5.0f, 12.0f), Vector3(20.0f, -18.0f, -4.0f),
+                Vector3(0.0f, 0.0f, 0.0f), Vector3(41.0f, 40.0f, -37.0f) };
+            clusteredPoints.resize(POINT_COUNT);
+            for (size_t i = 0; i < POINT_COUNT; ++i) {
+                clusteredPoints[i] = clusterCenters[i % 4] + Vector3(offsets[i * 3], offsets[i * 3 + 1], offsets[i * 3 + 2]);
+            }
+
+            objects.resize(POINT_COUNT);
+            for (size_t i = 0; i < POINT_COUNT; ++i) {
+                // Mostly small objects with the occasional large one
+                const float size = (i % 50 == 0) ? random.NextFloat(5.0f, 30.0f) : random.NextFloat(0.05f, 1.5f);
+                const Vector3 half(size * random.NextFloat(0.5f, 1.0f), size * random.NextFloat(0.5f, 1.0f), size * random.NextFloat(0.5f, 1.0f));
+                objects[i] = AABB(uniformPoints[i] - half, uniformPoints[i] + half);
+            }
+        }
+
+        static std::vector<uint32_t> BruteForceRadius(const std::vector<Vector3>& points, const Vector3& center, float radius) {
+            std::vector<uint32_t> result;
+            for (uint32_t i = 0; i < points.size(); ++i) {
+                const Vector3 d = points[i] - center;
+                if (d.x * d.x + d.y * d.y + d.z * d.z <= radius * radius) {
+                    result.push_back(i);
+                }
+            }
+            return result;
+        }
+
+        std::vector<Vector3> uniformPoints;
+        std::vector<Vector3> clusteredPoints;
+        std::vector<AABB> objects;
+        std::vector<uint32_t> buffer = std::vector<uint32_t>(POINT_COUNT);
+    };
+
+    // ============================================================================
+    // SpatialHashGrid
+    // ============================================================================
+
+    TEST_F(SpatialIndexTests, HashGrid_RadiusQuery_MatchesBruteForce) {
+        SpatialHashGrid grid(4.0f);
+        grid.Build(uniformPoints);
+        EXPECT_EQ(grid.GetPointCount(), POINT_COUNT);
+
+        for (int i = 0; i < 100; ++i) {
+            const Vector3 center = RandomVector3(-55.0f, 55.0f);
+            const float radius = RandomFloat(0.5f, 12.0f);
+            EXPECT_EQ(Sorted(grid.QueryRadius(center, radius, buffer)), BruteForceRadius(uniformPoints, center, radius)) << "Query " << i;
+        }
+    }
+
+    TEST_F(SpatialIndexTests, HashGrid_RadiusQuery_ClusteredMatchesBruteForce) {
+        SpatialHashGrid grid(1.0f);
+        grid.Build(clusteredPoints);
+        EXPECT_LT(grid.GetCellCount(), POINT_COUNT / 2);
+
+        for (int i = 0; i < 100; ++i) {
+            const Vector3 center = clusteredPoints[static_cast<size_t>(RandomInt(0, static_cast<int>(POINT_COUNT) - 1))];
+            const float radius = RandomFloat(0.2f, 4.0f);
+            EXPECT_EQ(Sorted(grid.QueryRadius(center, radius, buffer)), BruteForceRadius(clusteredPoints, center, radius)) << "Query " << i;
+        }
+    }
+
+    TEST_F(SpatialIndexTests, HashGrid_AABBQuery_MatchesBruteForce) {
+        SpatialHashGrid grid(4.0f);
+        grid.Build(uniformPoints);
+
+        for (int i = 0; i < 100; ++i) {
+            const Vector3 a = RandomVector3(-55.0f, 55.0f);
+            const Vector3 b = a + Vector3(RandomFloat(0.0f, 15.0f), RandomFloat(0.0f, 15.0f), RandomFloat(0.0f, 15.0f));
+            const AABB bounds(a, b);
+
+            std::vector<uint32_t> expected;
+            for (uint32_t j = 0; j < POINT_COUNT; ++j) {
+                if (bounds.Contains(uniformPoints[j])) {
+                    expected.push_back(j);
+                }
+            }
+            EXPECT_EQ(Sorted(grid.QueryAABB(bounds, buffer)), expected) << "Query " << i;
+        }
+    }
+
+    TEST_F(SpatialIndexTests, HashGrid_HugeRadius_ScansOccupiedCells) {
+        SpatialHashGrid grid(0.5f);
+        grid.Build(uniformPoints);
+
+        // Far more cells in range than are occupied, so the table is scanned instead
+        EXPECT_EQ(grid.QueryRadius(Vector3::ZERO, 1000.0f, buffer).size(), POINT_COUNT);
+    }
+
+    TEST_F(SpatialIndexTests, HashGrid_GetCell_ReturnsPointsSharingCell) {
+        const float cellSize = 5.0f;
+        SpatialHashGrid grid(cellSize);
+        grid.Build(uniformPoints);
+
+        const Vector3 probe = uniformPoints[17];
+        const auto cellOf = [&](const Vector3& p) {
+            return std::array<float, 3>{ std::floor(p.x / cellSize), std::floor(p.y / cellSize), std::floor(p.z / cellSize) };
+        };
+
+        std::vector<uint32_t> expected;
+        for (uint32_t i = 0; i < POINT_COUNT; ++i) {
+            if (cellOf(uniformPoints[i]) == cellOf(probe)) {
+                expected.push_back(i);
+            }
+        }
+        EXPECT_EQ(Sorted(grid.GetCell(probe)), expected);
+        EXPECT_TRUE(grid.GetCell(Vector3(1000.0f)).empty());
+    }
+
+    TEST_F(SpatialIndexTests, HashGrid_QueryOutput_TruncatedToCapacity) {
+        SpatialHashGrid grid(4.0f);
+        grid.Build(uniformPoints);
+
+        const std::vector<uint32_t> all = BruteForceRadius(uniformPoints, Vector3::ZERO, 20.0f);
+        ASSERT_GT(all.size(), 5u);
+
+        uint32_t small[5];
+        const std::span<uint32_t> result = grid.QueryRadius(Vector3::ZERO, 20.0f, small);
+        EXPECT_EQ(result.size(), 5u);
+        EXPECT_EQ(result.data(), small);
+        for (uint32_t index : result) {
+            EXPECT_TRUE(std::binary_search(all.begin(), all.end(), index));
+        }
+
+        EXPECT_TRUE(grid.QueryRadius(Vector3::ZERO, 20.0f, std::span<uint32_t>()).empty());
+    }
+
+    TEST_F(SpatialIndexTests, HashGrid_ParallelBuild_MatchesSerial) {
+        SpatialHashGrid serial(2.0f);
+        serial.Build(clusteredPoints);
+
+        SpatialHashGrid parallel(2.0f);
+        parallel.Build(clusteredPoints, 4, [](uint32_t taskCount, const auto& task) { ThreadParallelFor(taskCount, task); });
+
+        EXPECT_EQ(parallel.GetPointCount(), serial.GetPointCount());
+        EXPECT_EQ(parallel.GetCellCount(), serial.GetCellCount());
+
+        std::vector<uint32_t> other(POINT_COUNT);
+        for (int i = 0; i < 50; ++i) {
+            const Vector3 center = RandomVector3(-40.0f, 40.0f);
+            EXPECT_EQ(Sorted(parallel.QueryRadius(center, 6.0f, buffer)), Sorted(serial.QueryRadius(center, 6.0f, other)));
+        }
+    }
+
+    TEST_F(SpatialIndexTests, HashGrid_EmptyAndCleared) {
+        SpatialHashGrid grid(1.0f);
+        EXPECT_TRUE(grid.QueryRadius(Vector3::ZERO, 10.0f, buffer).empty());
+
+        grid.Build(std::span<const Vector3>());
+        EXPECT_EQ(grid.GetCellCount(), 0u);
+        EXPECT_TRUE(grid.QueryRadius(Vector3::ZERO, 10.0f, buffer).empty());
+
+        grid.Build(uniformPoints);
+        grid.Clear();
+        EXPECT_EQ(grid.GetPointCount(), 0u);
+        EXPECT_TRUE(grid.QueryRadius(Vector3::ZERO, 100.0f, buffer).empty());
+    }
+
+    // ============================================================================
+    // LooseOctree
+    // ============================================================================
+
+    TEST_F(SpatialIndexTests, LooseOctree_AABBQuery_MatchesBruteForce) {
+        LooseOctree octree(AABB(Vector3(-64.0f), Vector3(64.0f)), 7);
+        octree.Build(objects);
+        EXPECT_EQ(octree.GetObjectCount(), POINT_COUNT);
+        EXPECT_GT(octree.GetNodeCount(), 1u);
+
+        for (int i = 0; i < 100; ++i) {
+            const Vector3 a = RandomVector3(-60.0f, 60.0f);
+            const AABB bounds(a, a + Vector3(RandomFloat(0.0f, 10.0f), RandomFloat(0.0f, 10.0f), RandomFloat(0.0f, 10.0f)));
+
+            std::vector<uint32_t> expected;
+            for (uint32_t j = 0; j < POINT_COUNT; ++j) {
+                if (Overlaps(objects[j], bounds)) {
+                    expected.push_back(j);
+                }
+            }
+            EXPECT_EQ(Sorted(octree.QueryAABB(bounds, buffer)), expected) << "Query " << i;
+        }
+    }
+
+    TEST_F(SpatialIndexTests, LooseOctree_SphereQuery_MatchesBruteForce) {
+        LooseOctree octree(AABB(Vector3(-64.0f), Vector3(64.0f)), 7);
+        octree.Build(objects);
+
+        for (int i = 0; i < 100; ++i) {
+            const Sphere sphere(RandomVector3(-60.0f, 60.0f), RandomFloat(0.5f, 10.0f));
+
+            std::vector<uint32_t> expected;
+            for (uint32_t j = 0; j < POINT_COUNT; ++j) {
+                if (Overlaps(objects[j], sphere)) {
+                    expected.push_back(j);
+                }
+            }
+            EXPECT_EQ(Sorted(octree.QuerySphere(sphere, buffer)), expected) << "Query " << i;
+        }
+    }
+
+    TEST_F(SpatialIndexTests, LooseOctree_ObjectsOutsideWorld_AreFound) {
+        // World deliberately smaller than the data; overflow lives at the root
+        LooseOctree octree(AABB(Vector3(-20.0f), Vector3(20.0f)), 6);
+        octree.Build(objects);
+
+        const Sphere sphere(Vector3(45.0f, -45.0f, 30.0f), 12.0f);
+        std::vector<uint32_t> expected;
+        for (uint32_t j = 0; j < POINT_COUNT; ++j) {
+            if (Overlaps(objects[j], sphere)) {
+                expected.push_back(j);
+            }
+        }
+        EXPECT_FALSE(expected.empty());
+        EXPECT_EQ(Sorted(octree.QuerySphere(sphere, buffer)), expected);
+    }
+
+    TEST_F(SpatialIndexTests, LooseOctree_ParallelBuild_MatchesSerial) {
+        // Tiny objects at maximum depth give many more nodes than objects, so
+        // the node table has to grow during the build
+        std::vector<AABB> tiny(POINT_COUNT);
+        for (size_t i = 0; i < POINT_COUNT; ++i) {
+            tiny[i] = AABB(uniformPoints[i] - Vector3(0.01f), uniformPoints[i] + Vector3(0.01f));
+        }
+
+        LooseOctree serial(AABB(Vector3(-64.0f), Vector3(64.0f)), LooseOctree::MAX_DEPTH);
+        serial.Build(tiny);
+        EXPECT_GT(serial.GetNodeCount(), POINT_COUNT * 2);
+
+        LooseOctree parallel(AABB(Vector3(-64.0f), Vector3(64.0f)), LooseOctree::MAX_DEPTH);
+        parallel.Build(tiny, 4, [](uint32_t taskCount, const auto& task) { ThreadParallelFor(taskCount, task); });
+        EXPECT_EQ(parallel.GetNodeCount(), serial.GetNodeCount());
+
+        std::vector<uint32_t> other(POINT_COUNT);
+        for (int i = 0; i < 50; ++i) {
+            const Sphere sphere(RandomVector3(-50.0f, 50.0f), 8.0f);
+            const std::vector<uint32_t> expected = BruteForceRadius(uniformPoints, sphere.center, sphere.radius + 0.02f);
+            const std::vector<uint32_t> fromSerial = Sorted(serial.QuerySphere(sphere, other));
+            EXPECT_EQ(Sorted(parallel.QuerySphere(sphere, buffer)), fromSerial);
+            EXPECT_LE(fromSerial.size(), expected.size());
+        }
+    }
+
+    TEST_F(SpatialIndexTests, LooseOctree_EmptyAndCleared) {
+        LooseOctree octree;
+        EXPECT_TRUE(octree.QueryAABB(AABB(Vector3(-10.0f), Vector3(10.0f)), buffer).empty());
+
+        octree.Build(objects);
+        octree.Clear();
+        EXPECT_EQ(octree.GetObjectCount(), 0u);
+        EXPECT_EQ(octree.GetNodeCount(), 0u);
+        EXPECT_TRUE(octree.QuerySphere(Sphere(Vector3::ZERO, 100.0f), buffer).empty());
+    }
+
+}
@@ -0,0 +1,319 @@
+// Tests/Core.Math/Source/Utils/PerformanceTestUtils.cpp
+#include "PerformanceTestUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <nlohmann/json.hpp>
+
+#ifdef _WIN32
+#include <Windows.h>
+#undef min
+#undef max
+#else
+#include <time.h>
+#endif
+
+namespace Akhanda::Tests::Math {
+
+    namespace {
+
+        constexpr int BASELINE_FORMAT = 1;
+
+        double Median(std::vector<double>& values) {
+            std::sort(values.begin(), values.end());
+            const size_t middle = values.size() / 2;
+            return (values.size() % 2 != 0) ? values[middle] : (values[middle - 1] + values[middle]) * 0.5;
+        }
+
+        // Three significant decimals keep the baseline file readable
+        double Round(double value) {
+            return std::round(value * 1000.0) / 1000.0;
+        }
+
+        bool StartsWith(std::string_view text, std::string_view prefix) {
+            return text.substr(0, prefix.size()) == prefix;
+        }
+
+    }
+
+    // ============================================================================
+    // Benchmark Settings
+    // ============================================================================
+
+    BenchmarkSettings& BenchmarkSettings::Get() {
+        static BenchmarkSettings settings;
+        return settings;
+    }
+
+    void BenchmarkSettings::ParseCommandLine(int argc, char** argv) {
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view argument = argv[i];
+            if (argument == "--benchmark=report") {
+                mode = BenchmarkMode::Report;
+            }
+            else if (argument == "--benchmark=record") {
+                mode = BenchmarkMode::Record;
+            }
+            else if (argument == "--benchmark=compare") {
+                mode = BenchmarkMode::Compare;
+            }
+            else if (StartsWith(argument, "--benchmark-threshold=")) {
+                regressionThreshold = std::atof(argv[i] + std::string_view("--benchmark-threshold=").size()) / 100.0;
+            }
+            else if (StartsWith(argument, "--benchmark-baseline=")) {
+                baselinePath = std::string(argument.substr(std::string_view("--benchmark-baseline=").size()));
+            }
+            else if (StartsWith(argument, "--benchmark-samples=")) {
+                samples = std::max<size_t>(1, std::strtoull(argv[i] + std::string_view("--benchmark-samples=").size(), nullptr, 10));
+            }
+        }
+    }
+
+    // ============================================================================
+    // Measurement
+    // ============================================================================
+
+    BenchmarkResult SummarizeSamples(std::string name, size_t elements, size_t callsPerSample,
+        std::vector<double> sampleNs, std::vector<double> sampleTicks) {
+        BenchmarkResult result;
+        result.name = std::move(name);
+        result.elements = std::max<size_t>(elements, 1);
+        result.callsPerSample = callsPerSample;
+        result.samples = sampleNs.size();
+        if (sampleNs.empty()) {
+            return result;
+        }
+
+        result.medianNs = Median(sampleNs);
+        const size_t p95Rank = static_cast<size_t>(std::ceil(0.95 * static_cast<double>(sampleNs.size())));
+        result.p95Ns = sampleNs[std::max<size_t>(p95Rank, 1) - 1];
+        result.minNs = sampleNs.front();
+        result.nsPerElement = result.medianNs / static_cast<double>(result.elements);
+        result.cyclesPerElement = sampleTicks.empty() ? 0.0 : Median(sampleTicks) / static_cast<double>(result.elements);
+        return result;
+    }
+
+#ifdef _WIN32
+    namespace {
+        double CpuTimeNs(const FILETIME& kernel, const FILETIME& user) noexcept {
+            const auto ticks = [](const FILETIME& time) {
+                return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+            };
+            return static_cast<double>(ticks(kernel) + ticks(user)) * 100.0;     // 100 ns units
+        }
+    }
+#else
+    namespace {
+        double CpuTimeNs(clockid_t clock) noexcept {
+            timespec time{};
+            clock_gettime(clock, &time);
+            return static_cast<double>(time.tv_sec) * 1e9 + static_cast<double>(time.tv_nsec);
+        }
+    }
+#endif
+
+    double ThreadCpuTimeNs() noexcept {
+#ifdef _WIN32
+        FILETIME creation, exit, kernel, user;
+        if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) {
+            return 0.0;
+        }
+        return CpuTimeNs(kernel, user);
+#else
+        return CpuTimeNs(CLOCK_THREAD_CPUTIME_ID);
+#endif
+    }
+
+    double ProcessCpuTimeNs() noexcept {
+#ifdef _WIN32
+        FILETIME creation, exit, kernel, user;
+        if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user)) {
+            return 0.0;
+        }
+        return CpuTimeNs(kernel, user);
+#else
+        return CpuTimeNs(CLOCK_PROCESS_CPUTIME_ID);
+#endif
+    }
+
+    // ============================================================================
+    // Baselines
+    // ============================================================================
+
+    bool BenchmarkBaseline::Load(const std::filesystem::path& path) {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        const nlohmann::json data = nlohmann::json::parse(file, nullptr, false);
+        if (data.is_discarded() || !data.is_object()) {
+            return false;
+        }
+
+        results_.clear();
+        environment_ = data.value("environment", std::string());
+        if (!data.contains("benchmarks")) {
+            return true;    // An empty baseline ({}) is valid
+        }
+
+        for (const auto& [name, entry] : data["benchmarks"].items()) {
+            BenchmarkResult result;
+            result.name = name;
+            result.elements = entry.value("elements", size_t(1));
+            result.samples = entry.value("samples", size_t(0));
+            result.medianNs = entry.value("median_ns", 0.0);
+            result.p95Ns = entry.value("p95_ns", 0.0);
+            result.minNs = entry.value("min_ns", 0.0);
+            result.nsPerElement = entry.value("ns_per_element", 0.0);
+            result.cyclesPerElement = entry.value("cycles_per_element", 0.0);
+            results_[name] = std::move(result);
+        }
+        return true;
+    }
+
+    bool BenchmarkBaseline::Save(const std::filesystem::path& path) const {
+        nlohmann::json benchmarks = nlohmann::json::object();
+        for (const auto& [name, result] : results_) {
+            benchmarks[name] = {
+                { "elements", result.elements },
+                { "samples", result.samples },
+                { "median_ns", Round(result.medianNs) },
+                { "p95_ns", Round(result.p95Ns) },
+                { "min_ns", Round(result.minNs) },
+                { "ns_per_element", Round(result.nsPerElement) },
+                { "cycles_per_element", Round(result.cyclesPerElement) }
+            };
+        }
+
+        const nlohmann::json data = {
+            { "format", BASELINE_FORMAT },
+            { "environment", environment_ },
+            { "benchmarks", benchmarks }
+        };
+
+        std::ofstream file(path, std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        file << data.dump(2) << "\n";
+        return file.good();
+    }
+
+    void BenchmarkBaseline::Record(const BenchmarkResult& result) {
+        results_[result.name] = result;
+    }
+
+    const BenchmarkResult* BenchmarkBaseline::Find(std::string_view name) const {
+        const auto it = results_.find(name);
+        return it != results_.end() ? &it->second : nullptr;
+    }
+
+    std::vector<BenchmarkRegression> BenchmarkBaseline::Compare(const std::vector<BenchmarkResult>& results, double threshold) const {
+        std::vector<BenchmarkRegression> regressions;
+        for (const BenchmarkResult& result : results) {
+            const BenchmarkResult* baseline = Find(result.name);
+            if (baseline == nullptr || baseline->medianNs <= 0.0) {
+                continue;
+            }
+
+            const double change = (result.medianNs - baseline->medianNs) / baseline->medianNs;
+            if (change > threshold) {
+                regressions.push_back({ result.name, baseline->medianNs, result.medianNs, change });
+            }
+        }
+        return regressions;
+    }
+
+    std::string DescribeBenchmarkEnvironment() {
+        std::ostringstream description;
+#if defined(_MSC_VER)
+        description << "MSVC " << _MSC_VER;
+#elif defined(__clang__)
+        description << "Clang " << __clang_major__ << "." << __clang_minor__;
+#elif defined(__GNUC__)
+        description << "GCC " << __GNUC__ << "." << __GNUC_MINOR__;
+#else
+        description << "Unknown compiler";
+#endif
+
+#if defined(__AVX2__)
+        description << ", AVX2";
+#elif defined(__AVX__)
+        description << ", AVX";
+#else
+        description << ", SSE2";
+#endif
+
+#if defined(NDEBUG)
+        description << ", Release";
+#else
+        description << ", Debug";
+#endif
+        return description.str();
+    }
+
+    std::vector<std::string> ProcessBenchmarkResults(const std::vector<BenchmarkResult>& results) {
+        const BenchmarkSettings& settings = BenchmarkSettings::Get();
+
+        for (const BenchmarkResult& result : results) {
+            std::cout << "[BENCH] " << std::left << std::setw(36) << result.name << std::right << std::fixed << std::setprecision(2)
+                << " median " << std::setw(10) << result.medianNs << " ns"
+                << "  p95 " << std::setw(10) << result.p95Ns << " ns"
+                << "  " << std::setw(8) << result.nsPerElement << " ns/elem"
+                << "  " << std::setw(8) << result.cyclesPerElement << " cyc/elem"
+                << "  (" << result.samples << " x " << result.callsPerSample << ")" << std::defaultfloat << std::endl;
+        }
+
+        std::vector<std::string> failures;
+        if (settings.mode == BenchmarkMode::Report) {
+            return failures;
+        }
+
+        BenchmarkBaseline baseline;
+        const bool loaded = baseline.Load(settings.baselinePath);
+        const std::string environment = DescribeBenchmarkEnvironment();
+
+        if (settings.mode == BenchmarkMode::Record) {
+            // Other suites' entries are kept, so filtered runs update only what they measured
+            baseline.SetEnvironment(environment);
+            for (const BenchmarkResult& result : results) {
+                baseline.Record(result);
+            }
+            if (!baseline.Save(settings.baselinePath)) {
+                failures.push_back("Could not write benchmark baseline " + settings.baselinePath.string());
+            }
+            return failures;
+        }
+
+        if (!loaded) {
+            failures.push_back("Could not read benchmark baseline " + settings.baselinePath.string());
+            return failures;
+        }
+        if (!baseline.GetEnvironment().empty() && baseline.GetEnvironment() != environment) {
+            std::cout << "[BENCH] Note: baseline was recorded with \"" << baseline.GetEnvironment()
+                << "\", this build is \"" << environment << "\"" << std::endl;
+        }
+
+        for (const BenchmarkResult& result : results) {
+            if (baseline.Find(result.name) == nullptr) {
+                std::cout << "[BENCH] No baseline for " << result.name << std::endl;
+            }
+        }
+
+        for (const BenchmarkRegression& regression : baseline.Compare(results, settings.regressionThreshold)) {
+            std::ostringstream message;
+            message << std::fixed << std::setprecision(1) << regression.name << " regressed by " << regression.change * 100.0
+                << "% (median " << regression.currentNs << " ns, baseline " << regression.baselineNs << " ns, threshold "
+                << settings.regressionThreshold * 100.0 << "%)";
+            failures.push_back(message.str());
+        }
+        return failures;
+    }
+
+}
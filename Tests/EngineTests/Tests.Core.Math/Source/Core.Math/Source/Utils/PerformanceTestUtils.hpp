@@ -0,0 +1,172 @@
+// Tests/Core.Math/Source/Utils/PerformanceTestUtils.hpp
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+namespace Akhanda::Tests::Math {
+
+    // ============================================================================
+    // Benchmark Settings
+    // ============================================================================
+
+    enum class BenchmarkMode {
+        Report,     // Print results only
+        Record,     // Store results in the baseline file
+        Compare     // Fail benchmarks whose median regressed past the threshold
+    };
+
+    struct BenchmarkSettings {
+        BenchmarkMode mode = BenchmarkMode::Report;
+        double regressionThreshold = 0.10;      // Allowed slowdown, as a fraction of the baseline median
+        std::filesystem::path baselinePath = "Data/BenchmarkData.json";
+        size_t warmupSamples = 3;
+        size_t samples = 21;
+        double minSampleNs = 200000.0;          // Each sample repeats the body until it takes at least this long
+
+        // Reads --benchmark=report|record|compare, --benchmark-threshold=<percent>,
+        // --benchmark-baseline=<path> and --benchmark-samples=<count>. Call after
+        // InitGoogleTest so gtest flags are already removed; unknown arguments are ignored.
+        void ParseCommandLine(int argc, char** argv);
+
+        static BenchmarkSettings& Get();
+    };
+
+    // ============================================================================
+    // Measurement
+    // ============================================================================
+
+    struct BenchmarkResult {
+        std::string name;
+        size_t elements = 1;            // Elements processed by one call of the body
+        size_t callsPerSample = 1;
+        size_t samples = 0;
+        double medianNs = 0.0;          // Per call
+        double p95Ns = 0.0;
+        double minNs = 0.0;
+        double nsPerElement = 0.0;      // From the median
+        double cyclesPerElement = 0.0;  // Time-stamp counter ticks (reference cycles), from the median
+    };
+
+    // Median, 95th percentile (nearest rank) and minimum of per-call samples
+    BenchmarkResult SummarizeSamples(std::string name, size_t elements, size_t callsPerSample,
+        std::vector<double> sampleNs, std::vector<double> sampleTicks);
+
+    // Keeps a value alive so the optimizer cannot drop the work that produced it
+    template<typename T>
+    inline void DoNotOptimize(const T& value) noexcept {
+        static volatile const void* sink;
+        sink = &value;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+
+    inline uint64_t ReadTimestampCounter() noexcept {
+        return __rdtsc();
+    }
+
+    // CPU time consumed by the calling thread, or by every thread of the
+    // process, in nanoseconds
+    double ThreadCpuTimeNs() noexcept;
+    double ProcessCpuTimeNs() noexcept;
+
+    // Times func(), which processes `elements` items per call. The call count
+    // per sample is calibrated so that timer resolution is negligible, then
+    // warmup samples run before the measured ones.
+    template<typename Func>
+    BenchmarkResult RunBenchmark(std::string name, size_t elements, Func&& func) {
+        using Clock = std::chrono::steady_clock;
+        const BenchmarkSettings& settings = BenchmarkSettings::Get();
+
+        auto runCalls = [&](size_t calls) {
+            for (size_t i = 0; i < calls; ++i) {
+                func();
+            }
+        };
+
+        size_t calls = 1;
+        for (;;) {
+            const auto start = Clock::now();
+            runCalls(calls);
+            const double elapsedNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            if (elapsedNs >= settings.minSampleNs || calls >= (size_t(1) << 24)) {
+                break;
+            }
+            calls *= 2;
+        }
+
+        for (size_t i = 0; i < settings.warmupSamples; ++i) {
+            runCalls(calls);
+        }
+
+        std::vector<double> sampleNs;
+        std::vector<double> sampleTicks;
+        sampleNs.reserve(settings.samples);
+        sampleTicks.reserve(settings.samples);
+        for (size_t i = 0; i < settings.samples; ++i) {
+            const auto start = Clock::now();
+            const uint64_t startTicks = ReadTimestampCounter();
+            runCalls(calls);
+            const uint64_t endTicks = ReadTimestampCounter();
+            const double elapsedNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+            sampleNs.push_back(elapsedNs / static_cast<double>(calls));
+            sampleTicks.push_back(static_cast<double>(endTicks - startTicks) / static_cast<double>(calls));
+        }
+
+        return SummarizeSamples(std::move(name), elements, calls, std::move(sampleNs), std::move(sampleTicks));
+    }
+
+    // ============================================================================
+    // Baselines
+    // ============================================================================
+
+    struct BenchmarkRegression {
+        std::string name;
+        double baselineNs;
+        double currentNs;
+        double change;                  // (current - baseline) / baseline
+    };
+
+    // Results keyed by benchmark name, stored as JSON:
+    // { "format": 1, "environment": "...", "benchmarks": { "<name>": { "median_ns": ..., ... } } }
+    class BenchmarkBaseline {
+    public:
+        bool Load(const std::filesystem::path& path);
+        bool Save(const std::filesystem::path& path) const;
+
+        void Record(const BenchmarkResult& result);
+        const BenchmarkResult* Find(std::string_view name) const;
+
+        // Results whose median is slower than the baseline median by more than threshold
+        std::vector<BenchmarkRegression> Compare(const std::vector<BenchmarkResult>& results, double threshold) const;
+
+        const std::string& GetEnvironment() const { return environment_; }
+        void SetEnvironment(std::string environment) { environment_ = std::move(environment); }
+        size_t GetCount() const { return results_.size(); }
+
+    private:
+        std::map<std::string, BenchmarkResult, std::less<>> results_;
+        std::string environment_;
+    };
+
+    // Compiler, architecture and SIMD level the tests were built for
+    std::string DescribeBenchmarkEnvironment();
+
+    // Prints the results and, depending on the mode, records them in or checks
+    // them against the baseline file. Returns one message per failure.
+    std::vector<std::string> ProcessBenchmarkResults(const std::vector<BenchmarkResult>& results);
+
+}
@@ -5,6 +5,8 @@
 #include <iostream>
 #include <filesystem>
 
+#include "Core.Math/Source/Utils/PerformanceTestUtils.hpp"
+
 // Test environment setup
 class MathTestEnvironment : public ::testing::Environment {
 public:
@@ -107,6 +109,9 @@ int main(int argc, char** argv) {
     // Initialize Google Test
     ::testing::InitGoogleTest(&argc, argv);
 
+    // Benchmark options (--benchmark=record|compare, ...) are left over after gtest's own flags
+    Akhanda::Tests::Math::BenchmarkSettings::Get().ParseCommandLine(argc, argv);
+
     // Add our custom environment
     ::testing::AddGlobalTestEnvironment(new MathTestEnvironment);
     ::testing::AddGlobalTestEnvironment(new ShaderTestEnvironment);
@@ -0,0 +1,235 @@
+// Tests/Renderer/Source/PerformanceTests/ShaderCacheBenchmarks.cpp
+// Benchmarks for shader cache lookups: building the key for a compile
+// request and finding its entry, with the string key and single
+// std::shared_mutex the cache used to have against ShaderKey and the
+// lock-striped ShaderKeyMap, alone and with other threads looking up
+// shaders at the same time. Results are printed and, with
+// --benchmark=record|compare, stored in or checked against
+// Data/BenchmarkData.json like the math benchmarks. Contended lookups are
+// only printed: they depend on the core count of the machine.
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+import Akhanda.Engine.Shaders;
+import Akhanda.Engine.Shaders.Key;
+import Akhanda.Core.Configuration.Rendering;
+#include "../../../Core.Math/Source/Utils/PerformanceTestUtils.hpp"
+
+using namespace Akhanda::Tests::Math;
+using namespace Akhanda::Shaders;
+using Akhanda::Configuration::ShaderModel;
+using Akhanda::Configuration::ShaderOptimization;
+
+namespace {
+
+    constexpr int FILES = 64;
+    constexpr int FEATURES = 4;
+    constexpr int READER_THREADS = 3;
+
+    struct Request {
+        std::filesystem::path sourcePath;
+        std::string entryPoint;
+        ShaderStage stage;
+        ShaderVariant variant;
+        ShaderOptimization optimization;
+        ShaderModel shaderModel;
+    };
+
+    struct Entry {
+        std::uint64_t sourceHash = 0;
+        std::vector<std::uint8_t> bytecode;
+    };
+
+    // Every permutation of FILES materials: vertex and pixel entry points,
+    // and each combination of FEATURES on/off defines
+    std::vector<Request> MakeRequests() {
+        std::vector<Request> requests;
+        for (int file = 0; file < FILES; ++file) {
+            for (int stage = 0; stage < 2; ++stage) {
+                for (int variant = 0; variant < (1 << FEATURES); ++variant) {
+                    Request request;
+                    request.sourcePath = "Content/Shaders/Materials/Material" + std::to_string(file) + ".hlsl";
+                    request.entryPoint = stage ? "PSMain" : "VSMain";
+                    request.stage = stage ? ShaderStage::Pixel : ShaderStage::Vertex;
+                    for (int feature = 0; feature < FEATURES; ++feature) {
+                        request.variant.defines.emplace_back("FEATURE_" + std::to_string(feature),
+                            std::string((variant >> feature) & 1 ? "1" : "0"));
+                    }
+                    request.optimization = ShaderOptimization::Release;
+                    request.shaderModel = ShaderModel::SM_6_0;
+                    requests.push_back(std::move(request));
+                }
+            }
+        }
+        return requests;
+    }
+
+    // The key ShaderCache built for every lookup before it used ShaderKey
+    std::string MakeStringKey(const Request& request) {
+        std::string key = request.sourcePath.string() + "|" + request.entryPoint + "|" +
+            std::to_string(static_cast<int>(request.stage)) + "|" + std::to_string(static_cast<int>(request.optimization));
+        for (const auto& define : request.variant.defines) {
+            key += "|" + define.name + "=" + define.value;
+        }
+        return key;
+    }
+
+    ShaderKey MakeShaderKey(const Request& request) {
+        return ShaderKey::Make(request.sourcePath, request.entryPoint, request.stage, request.variant,
+            request.optimization, request.shaderModel);
+    }
+
+    class StringKeyCache {
+    public:
+        void Insert(const Request& request, Entry entry) {
+            std::unique_lock<std::shared_mutex> lock(mutex_);
+            entries_.emplace(MakeStringKey(request), std::move(entry));
+        }
+
+        std::uint64_t Find(const Request& request) const {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            const auto it = entries_.find(MakeStringKey(request));
+            return it == entries_.end() ? 0 : it->second.sourceHash;
+        }
+
+    private:
+        std::unordered_map<std::string, Entry> entries_;
+        mutable std::shared_mutex mutex_;
+    };
+
+    class ShaderKeyCache {
+    public:
+        void Insert(const Request& request, Entry entry) {
+            entries_.InsertOrAssign(MakeShaderKey(request), std::move(entry));
+        }
+
+        std::uint64_t Find(const Request& request) const {
+            std::uint64_t sourceHash = 0;
+            entries_.Read(MakeShaderKey(request), [&sourceHash](const Entry& entry) { sourceHash = entry.sourceHash; });
+            return sourceHash;
+        }
+
+    private:
+        ShaderKeyMap<Entry> entries_;
+    };
+
+    template<typename Cache>
+    void Fill(Cache& cache, const std::vector<Request>& requests) {
+        for (size_t i = 0; i < requests.size(); ++i) {
+            cache.Insert(requests[i], Entry{ i + 1, std::vector<std::uint8_t>(256) });
+        }
+    }
+
+    // Median ns of one lookup while READER_THREADS other threads look up
+    // shaders in the same cache, as worker threads compiling a level's
+    // materials do
+    template<typename Cache>
+    double RunWithReaders(std::string name, const Cache& cache, const std::vector<Request>& requests) {
+        std::atomic<bool> done{ false };
+        std::vector<std::thread> readers;
+        for (int r = 0; r < READER_THREADS; ++r) {
+            readers.emplace_back([&, r] {
+                size_t next = static_cast<size_t>(r) * 97;
+                while (!done.load(std::memory_order_relaxed)) {
+                    DoNotOptimize(cache.Find(requests[next++ % requests.size()]));
+                }
+            });
+        }
+
+        size_t next = 0;
+        BenchmarkResult result = RunBenchmark(std::move(name), 1, [&] {
+            DoNotOptimize(cache.Find(requests[next++ % requests.size()]));
+        });
+
+        done = true;
+        for (auto& reader : readers) {
+            reader.join();
+        }
+        return result.medianNs;
+    }
+
+    class ShaderCacheBenchmarks : public ::testing::Test {
+    protected:
+        static void Report(const std::vector<BenchmarkResult>& results) {
+            for (const std::string& failure : ProcessBenchmarkResults(results)) {
+                ADD_FAILURE() << failure;
+            }
+        }
+    };
+
+    // ============================================================================
+    // Keys
+    // ============================================================================
+
+    TEST_F(ShaderCacheBenchmarks, Key) {
+        const std::vector<Request> requests = MakeRequests();
+        size_t next = 0;
+
+        std::vector<BenchmarkResult> results;
+        results.push_back(RunBenchmark("Shaders/Key/String", 1, [&] {
+            DoNotOptimize(MakeStringKey(requests[next++ % requests.size()]));
+        }));
+        results.push_back(RunBenchmark("Shaders/Key/ShaderKey", 1, [&] {
+            DoNotOptimize(MakeShaderKey(requests[next++ % requests.size()]));
+        }));
+
+        std::cout << "[PERF] Permutations: " << requests.size() << ", string key: "
+            << MakeStringKey(requests.front()).size() << " bytes, ShaderKey: " << sizeof(ShaderKey) << " bytes" << std::endl;
+        Report(results);
+    }
+
+    // ============================================================================
+    // Lookups
+    // ============================================================================
+
+    TEST_F(ShaderCacheBenchmarks, Lookup) {
+        const std::vector<Request> requests = MakeRequests();
+        StringKeyCache stringCache;
+        ShaderKeyCache keyCache;
+        Fill(stringCache, requests);
+        Fill(keyCache, requests);
+        size_t next = 0;
+
+        std::vector<BenchmarkResult> results;
+        results.push_back(RunBenchmark("Shaders/Lookup/StringKey", 1, [&] {
+            DoNotOptimize(stringCache.Find(requests[next++ % requests.size()]));
+        }));
+        results.push_back(RunBenchmark("Shaders/Lookup/ShaderKeyMap", 1, [&] {
+            DoNotOptimize(keyCache.Find(requests[next++ % requests.size()]));
+        }));
+
+        for (size_t i = 0; i < requests.size(); ++i) {
+            ASSERT_EQ(stringCache.Find(requests[i]), i + 1);
+            ASSERT_EQ(keyCache.Find(requests[i]), i + 1);
+        }
+        Report(results);
+    }
+
+    // Not part of the baseline: with fewer cores than threads the readers
+    // time-slice with the measured thread instead of contending with it
+    TEST_F(ShaderCacheBenchmarks, LookupWithReaders) {
+        if (std::thread::hardware_concurrency() < static_cast<unsigned>(READER_THREADS + 1)) {
+            GTEST_SKIP() << "Needs " << READER_THREADS + 1 << " cores";
+        }
+
+        const std::vector<Request> requests = MakeRequests();
+        StringKeyCache stringCache;
+        ShaderKeyCache keyCache;
+        Fill(stringCache, requests);
+        Fill(keyCache, requests);
+
+        std::cout << "[PERF] Shader lookup with " << READER_THREADS << " readers: StringKey "
+            << RunWithReaders("Shaders/Lookup/StringKeyWithReaders", stringCache, requests) << " ns, ShaderKeyMap "
+            << RunWithReaders("Shaders/Lookup/ShaderKeyMapWithReaders", keyCache, requests) << " ns" << std::endl;
+    }
+
+} // namespace
@@ -0,0 +1,163 @@
+// Tests/Renderer/Source/UnitTests/ShaderKeyTests.cpp
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+import Akhanda.Engine.Shaders;
+import Akhanda.Engine.Shaders.Key;
+import Akhanda.Core.Configuration.Rendering;
+
+using namespace Akhanda::Shaders;
+using Akhanda::Configuration::ShaderModel;
+using Akhanda::Configuration::ShaderOptimization;
+
+namespace {
+
+    ShaderVariant MakeVariant(std::initializer_list<std::pair<const char*, const char*>> defines) {
+        ShaderVariant variant;
+        for (const auto& [name, value] : defines) {
+            variant.defines.emplace_back(std::string(name), std::string(value));
+        }
+        return variant;
+    }
+
+    ShaderKey MakeKey(const std::filesystem::path& path, const ShaderVariant& variant = {},
+        const char* entryPoint = "VSMain", ShaderStage stage = ShaderStage::Vertex,
+        ShaderOptimization optimization = ShaderOptimization::Release, ShaderModel shaderModel = ShaderModel::SM_6_0) {
+        return ShaderKey::Make(path, entryPoint, stage, variant, optimization, shaderModel);
+    }
+
+} // namespace
+
+TEST(ShaderKeyTests, FromString_IsStableAndDistinguishesKeys) {
+    EXPECT_EQ(ShaderKey::FromString("Shaders/Basic.hlsl|VSMain|0|2"), ShaderKey::FromString("Shaders/Basic.hlsl|VSMain|0|2"));
+    EXPECT_NE(ShaderKey::FromString("Shaders/Basic.hlsl|VSMain|0|2"), ShaderKey::FromString("Shaders/Basic.hlsl|PSMain|0|2"));
+    EXPECT_NE(ShaderKey::FromString(""), ShaderKey::FromString(std::string(1, '\0')));
+
+    const ShaderKey key = ShaderKey::FromString("Shaders/Basic.hlsl|VSMain|0|2|USE_FOG=1");
+    EXPECT_NE(key.low, key.high);
+}
+
+TEST(ShaderKeyTests, Make_DependsOnEveryInput) {
+    const ShaderVariant fog = MakeVariant({ { "USE_FOG", "1" } });
+    const ShaderKey base = MakeKey("Shaders/Basic.hlsl", fog);
+
+    std::set<std::pair<std::uint64_t, std::uint64_t>> keys = { { base.low, base.high } };
+    const auto add = [&keys](const ShaderKey& key) { return keys.insert({ key.low, key.high }).second; };
+
+    EXPECT_EQ(MakeKey("Shaders/Basic.hlsl", fog), base);
+    EXPECT_TRUE(add(MakeKey("Shaders/Other.hlsl", fog)));
+    EXPECT_TRUE(add(MakeKey("Shaders/Basic.hlsl", fog, "PSMain")));
+    EXPECT_TRUE(add(MakeKey("Shaders/Basic.hlsl", fog, "VSMain", ShaderStage::Pixel)));
+    EXPECT_TRUE(add(MakeKey("Shaders/Basic.hlsl", fog, "VSMain", ShaderStage::Vertex, ShaderOptimization::Debug)));
+    EXPECT_TRUE(add(MakeKey("Shaders/Basic.hlsl", fog, "VSMain", ShaderStage::Vertex, ShaderOptimization::Release, ShaderModel::SM_6_6)));
+    EXPECT_TRUE(add(MakeKey("Shaders/Basic.hlsl")));
+    EXPECT_TRUE(add(MakeKey("Shaders/Basic.hlsl", MakeVariant({ { "USE_FOG", "0" } }))));
+    EXPECT_TRUE(add(MakeKey("Shaders/Basic.hlsl", MakeVariant({ { "USE_FO", "G1" } }))));
+}
+
+TEST(ShaderKeyTests, Make_IgnoresDefineOrderAndSeparatorSpelling) {
+    const ShaderVariant ordered = MakeVariant({ { "USE_FOG", "1" }, { "SHADOWS", "PCF" }, { "LIGHTS", "4" } });
+    const ShaderVariant shuffled = MakeVariant({ { "LIGHTS", "4" }, { "USE_FOG", "1" }, { "SHADOWS", "PCF" } });
+
+    EXPECT_EQ(ShaderKey::HashVariant(ordered), ShaderKey::HashVariant(shuffled));
+    EXPECT_EQ(MakeKey("Shaders/Lighting/Basic.hlsl", ordered), MakeKey("Shaders\\Lighting\\Basic.hlsl", shuffled));
+    EXPECT_NE(ShaderKey::HashVariant(ordered), ShaderKey::HashVariant(MakeVariant({ { "USE_FOG", "1" }, { "SHADOWS", "PCF" } })));
+}
+
+TEST(ShaderKeyTests, Make_SpreadsPermutationsAcrossStripesAndBuckets) {
+    // Every permutation of a mid-sized project, all distinct
+    std::set<std::pair<std::uint64_t, std::uint64_t>> keys;
+    std::vector<size_t> stripes(16);
+    const char* entryPoints[] = { "VSMain", "PSMain", "CSMain", "GSMain" };
+    for (int file = 0; file < 64; ++file) {
+        for (const char* entryPoint : entryPoints) {
+            for (int variant = 0; variant < 16; ++variant) {
+                ShaderVariant defines;
+                for (int bit = 0; bit < 4; ++bit) {
+                    defines.defines.emplace_back("FEATURE_" + std::to_string(bit), std::string((variant >> bit) & 1 ? "1" : "0"));
+                }
+                const ShaderKey key = MakeKey("Shaders/Material" + std::to_string(file) + ".hlsl", defines, entryPoint);
+                keys.insert({ key.low, key.high });
+                ++stripes[key.high & 15];
+            }
+        }
+    }
+
+    EXPECT_EQ(keys.size(), 64u * 4u * 16u);
+    for (const size_t count : stripes) {
+        EXPECT_GT(count, 4096u / 16u / 2u);
+    }
+}
+
+TEST(ShaderKeyMapTests, InsertReadEraseAndClear) {
+    ShaderKeyMap<std::string> map;
+    const ShaderKey a = ShaderKey::FromString("a");
+    const ShaderKey b = ShaderKey::FromString("b");
+
+    map.InsertOrAssign(a, "first");
+    map.InsertOrAssign(b, "keep");
+    map.InsertOrAssign(a, "second");
+    EXPECT_EQ(map.Size(), 2u);
+
+    std::string value;
+    EXPECT_TRUE(map.Read(a, [&value](const std::string& found) { value = found; }));
+    EXPECT_EQ(value, "second");
+    EXPECT_FALSE(map.Read(ShaderKey::FromString("c"), [](const std::string&) { FAIL(); }));
+
+    EXPECT_EQ(map.EraseIf([](const std::string& found) { return found == "second"; }), 1u);
+    EXPECT_FALSE(map.Read(a, [](const std::string&) {}));
+
+    size_t visited = 0;
+    map.ForEach([&visited, &b](const ShaderKey& key, const std::string& found) {
+        EXPECT_EQ(key, b);
+        EXPECT_EQ(found, "keep");
+        ++visited;
+    });
+    EXPECT_EQ(visited, 1u);
+
+    map.Clear();
+    EXPECT_EQ(map.Size(), 0u);
+}
+
+TEST(ShaderKeyMapTests, ConcurrentReadersAndWriter_SeeWholeValues) {
+    ShaderKeyMap<std::vector<int>> map;
+    std::vector<ShaderKey> keys;
+    for (int i = 0; i < 256; ++i) {
+        keys.push_back(ShaderKey::FromString("shader" + std::to_string(i)));
+    }
+
+    std::atomic<bool> done = false;
+    std::atomic<int> mismatches = 0;
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                for (int i = 0; i < 256; ++i) {
+                    map.Read(keys[i], [&](const std::vector<int>& value) {
+                        if (value.size() != 8 || value.front() != value.back()) {
+                            ++mismatches;
+                        }
+                    });
+                }
+            }
+        });
+    }
+    for (int round = 0; round < 20; ++round) {
+        for (int i = 0; i < 256; ++i) {
+            map.InsertOrAssign(keys[i], std::vector<int>(8, round));
+        }
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0);
+    EXPECT_EQ(map.Size(), 256u);
+}
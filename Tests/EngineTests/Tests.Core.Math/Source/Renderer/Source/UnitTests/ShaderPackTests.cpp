@@ -0,0 +1,562 @@
+// Tests/Renderer/Source/UnitTests/ShaderPackTests.cpp
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+import Akhanda.Engine.Shaders;
+import Akhanda.Engine.Shaders.Pack;
+
+using namespace Akhanda::Shaders;
+
+namespace {
+
+    constexpr std::uint64_t COMPILER_REVISION = 0x10;
+    constexpr std::uint64_t ENGINE_REVISION = 1;
+
+    // Stands in for the HLSL compiler: bytecode derived from the source,
+    // and a count of how often it ran
+    struct StubCompiler {
+        int compileCount = 0;
+
+        std::vector<std::uint8_t> Compile(const std::string& source) {
+            ++compileCount;
+            std::vector<std::uint8_t> bytecode(source.size() * 3 + 5);
+            for (size_t i = 0; i < bytecode.size(); ++i) {
+                bytecode[i] = static_cast<std::uint8_t>(source[i % source.size()] + i);
+            }
+            return bytecode;
+        }
+    };
+
+    std::uint64_t SourceHash(const std::string& source) {
+        return ShaderKey::FromString(source).low;
+    }
+
+    // What the shader manager does: use the cached bytecode when its source
+    // still matches, compile and cache it otherwise
+    std::vector<std::uint8_t> GetOrCompile(ShaderPack& pack, StubCompiler& compiler,
+        const std::string& name, const std::string& source) {
+        const ShaderKey key = ShaderKey::FromString(name);
+        if (const ShaderPackEntry entry = pack.Find(key); entry && entry.GetSourceHash() == SourceHash(source)) {
+            return { entry.GetBytecode().begin(), entry.GetBytecode().end() };
+        }
+        std::vector<std::uint8_t> bytecode = compiler.Compile(source);
+        pack.Add(key, SourceHash(source), bytecode);
+        return bytecode;
+    }
+
+    std::vector<std::uint8_t> Bytes(std::span<const std::uint8_t> span) {
+        return { span.begin(), span.end() };
+    }
+
+    void WriteFile(const std::filesystem::path& path, const std::string& text) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << text;
+    }
+
+    class ShaderPackTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            directory_ = std::filesystem::temp_directory_path() /
+                ("akhanda_shader_pack_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+            std::filesystem::remove_all(directory_);
+        }
+
+        void TearDown() override {
+            std::error_code error;
+            std::filesystem::remove_all(directory_, error);
+        }
+
+        ShaderPack::Options MakeOptions(std::uint32_t compactAfter = 0) const {
+            ShaderPack::Options options;
+            options.path = directory_ / "shaders.pack";
+            options.compilerRevision = COMPILER_REVISION;
+            options.engineRevision = ENGINE_REVISION;
+            options.compactAfter = compactAfter;
+            return options;
+        }
+
+        std::filesystem::path directory_;
+    };
+
+} // namespace
+
+TEST_F(ShaderPackTest, SecondInstance_FindsShadersWithoutCompiling) {
+    StubCompiler compiler;
+    std::vector<std::vector<std::uint8_t>> compiled;
+    {
+        ShaderPack pack(MakeOptions());
+        for (int i = 0; i < 3; ++i) {
+            compiled.push_back(GetOrCompile(pack, compiler, "shader" + std::to_string(i), "source" + std::to_string(i)));
+        }
+    }
+    ASSERT_EQ(compiler.compileCount, 3);
+
+    ShaderPack pack(MakeOptions());
+    EXPECT_EQ(pack.GetEntryCount(), 3u);
+    EXPECT_EQ(pack.GetJournalEntryCount(), 3u);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(GetOrCompile(pack, compiler, "shader" + std::to_string(i), "source" + std::to_string(i)), compiled[i]);
+    }
+    EXPECT_EQ(compiler.compileCount, 3);
+}
+
+TEST_F(ShaderPackTest, ChangedSource_IsCompiledAgain) {
+    StubCompiler compiler;
+    {
+        ShaderPack pack(MakeOptions());
+        GetOrCompile(pack, compiler, "shader", "old source");
+    }
+
+    ShaderPack pack(MakeOptions());
+    const auto bytecode = GetOrCompile(pack, compiler, "shader", "new source");
+    EXPECT_EQ(compiler.compileCount, 2);
+    EXPECT_EQ(Bytes(pack.Find(ShaderKey::FromString("shader")).GetBytecode()), bytecode);
+}
+
+TEST_F(ShaderPackTest, EditedInclude_InvalidatesTheEntry) {
+    std::filesystem::create_directories(directory_);
+    const auto sourcePath = directory_ / "Lit.hlsl";
+    const auto includePath = directory_ / "Lighting.hlsli";
+    WriteFile(sourcePath, "#include \"Lighting.hlsli\"\nfloat4 PSMain() : SV_Target { return Shade(); }");
+    WriteFile(includePath, "float4 Shade() { return 1; }");
+
+    // What the shader cache stores: the hash over the source and its includes,
+    // and the include list in the reflection
+    ShaderReflectionData reflection;
+    reflection.includedFiles = { includePath.string() };
+    const ShaderKey key = ShaderKey::FromString("Lit");
+    {
+        ShaderPack pack(MakeOptions());
+        pack.Add(key, HashShaderSources(sourcePath, reflection.includedFiles), std::vector<std::uint8_t>(8, 1), &reflection);
+    }
+
+    ShaderPack pack(MakeOptions());
+    const ShaderPackEntry entry = pack.Find(key);
+    ASSERT_TRUE(entry);
+    const auto stored = entry.ReadReflection();
+    ASSERT_TRUE(stored);
+    EXPECT_EQ(entry.GetSourceHash(), HashShaderSources(sourcePath, stored->includedFiles));
+
+    // Only the include changes; the source file alone still matches
+    const std::uint64_t sourceOnly = HashShaderSources(sourcePath, {});
+    WriteFile(includePath, "float4 Shade() { return 0.5; }");
+    EXPECT_NE(entry.GetSourceHash(), HashShaderSources(sourcePath, stored->includedFiles));
+    EXPECT_EQ(HashShaderSources(sourcePath, {}), sourceOnly);
+
+    std::filesystem::remove(includePath);
+    EXPECT_NE(entry.GetSourceHash(), HashShaderSources(sourcePath, stored->includedFiles));
+    EXPECT_EQ(HashShaderSources(directory_ / "Missing.hlsl", stored->includedFiles), 0u);
+}
+
+TEST_F(ShaderPackTest, Compact_MapsPackAndEmptiesJournal) {
+    StubCompiler compiler;
+    std::vector<std::vector<std::uint8_t>> compiled;
+    {
+        ShaderPack pack(MakeOptions());
+        for (int i = 0; i < 20; ++i) {
+            compiled.push_back(GetOrCompile(pack, compiler, "shader" + std::to_string(i), std::string(i + 1, 'a' + i % 26)));
+        }
+        EXPECT_FALSE(pack.IsMapped());
+        ASSERT_TRUE(pack.Compact());
+        EXPECT_TRUE(pack.IsMapped());
+        EXPECT_EQ(pack.GetJournalEntryCount(), 0u);
+        EXPECT_EQ(pack.GetEntryCount(), 20u);
+        EXPECT_FALSE(std::filesystem::exists(pack.GetJournalPath()));
+    }
+
+    ShaderPack pack(MakeOptions());
+    EXPECT_TRUE(pack.IsMapped());
+    EXPECT_EQ(pack.GetEntryCount(), 20u);
+    std::uint64_t bytecodeSize = 0;
+    for (int i = 0; i < 20; ++i) {
+        const ShaderPackEntry entry = pack.Find(ShaderKey::FromString("shader" + std::to_string(i)));
+        ASSERT_TRUE(entry);
+        EXPECT_EQ(Bytes(entry.GetBytecode()), compiled[i]);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(entry.GetBytecode().data()) % 16, 0u);
+        bytecodeSize += compiled[i].size();
+    }
+    EXPECT_EQ(pack.GetBytecodeSize(), bytecodeSize);
+    EXPECT_FALSE(pack.Find(ShaderKey::FromString("missing")));
+}
+
+TEST_F(ShaderPackTest, CompactAfter_CompactsOnceJournalIsFull) {
+    ShaderPack pack(MakeOptions(4));
+    const std::vector<std::uint8_t> bytecode = { 1, 2, 3 };
+    for (int i = 0; i < 3; ++i) {
+        pack.Add(ShaderKey::FromString(std::to_string(i)), i, bytecode);
+    }
+    EXPECT_EQ(pack.GetJournalEntryCount(), 3u);
+    EXPECT_FALSE(pack.IsMapped());
+
+    pack.Add(ShaderKey::FromString("3"), 3, bytecode);
+    EXPECT_EQ(pack.GetJournalEntryCount(), 0u);
+    EXPECT_TRUE(pack.IsMapped());
+    EXPECT_EQ(pack.GetEntryCount(), 4u);
+}
+
+TEST_F(ShaderPackTest, FailedCompaction_WaitsForAnotherCompactAfterEntries) {
+    // A directory where the pack belongs makes every compaction fail
+    const ShaderPack::Options options = MakeOptions(4);
+    std::filesystem::create_directories(options.path / "blocker");
+    ShaderPack pack(options);
+    const std::vector<std::uint8_t> bytecode = { 1, 2, 3 };
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(pack.Add(ShaderKey::FromString(std::to_string(i)), i, bytecode));
+    }
+    EXPECT_EQ(pack.GetJournalEntryCount(), 4u);
+
+    // Compaction would succeed now, but Add does not try until four more
+    std::filesystem::remove_all(options.path);
+    for (int i = 4; i < 7; ++i) {
+        pack.Add(ShaderKey::FromString(std::to_string(i)), i, bytecode);
+    }
+    EXPECT_EQ(pack.GetJournalEntryCount(), 7u);
+    EXPECT_FALSE(pack.IsMapped());
+
+    pack.Add(ShaderKey::FromString("7"), 7, bytecode);
+    EXPECT_EQ(pack.GetJournalEntryCount(), 0u);
+    EXPECT_TRUE(pack.IsMapped());
+    EXPECT_EQ(pack.GetEntryCount(), 8u);
+}
+
+TEST_F(ShaderPackTest, JournalEntry_ReplacesPackedEntry) {
+    const ShaderKey key = ShaderKey::FromString("shader");
+    const std::vector<std::uint8_t> first = { 1, 1, 1 };
+    const std::vector<std::uint8_t> second = { 2, 2, 2, 2 };
+    {
+        ShaderPack pack(MakeOptions());
+        pack.Add(key, 1, first);
+        pack.Add(ShaderKey::FromString("other"), 7, first);
+        ASSERT_TRUE(pack.Compact());
+        pack.Add(key, 2, second);
+
+        EXPECT_EQ(pack.GetEntryCount(), 2u);
+        EXPECT_EQ(pack.GetBytecodeSize(), second.size() + first.size());
+        EXPECT_EQ(Bytes(pack.Find(key).GetBytecode()), second);
+    }
+
+    ShaderPack pack(MakeOptions());
+    EXPECT_EQ(pack.Find(key).GetSourceHash(), 2u);
+    EXPECT_EQ(Bytes(pack.Find(key).GetBytecode()), second);
+    ASSERT_TRUE(pack.Compact());
+    EXPECT_EQ(pack.GetEntryCount(), 2u);
+    EXPECT_EQ(Bytes(pack.Find(key).GetBytecode()), second);
+}
+
+TEST_F(ShaderPackTest, RevisionChange_DiscardsEveryEntry) {
+    {
+        ShaderPack pack(MakeOptions());
+        pack.Add(ShaderKey::FromString("packed"), 1, std::vector<std::uint8_t>{ 1 });
+        ASSERT_TRUE(pack.Compact());
+        pack.Add(ShaderKey::FromString("journaled"), 1, std::vector<std::uint8_t>{ 2 });
+    }
+
+    ShaderPack::Options newCompiler = MakeOptions();
+    newCompiler.compilerRevision = COMPILER_REVISION + 1;
+    {
+        ShaderPack pack(newCompiler);
+        EXPECT_FALSE(pack.IsMapped());
+        EXPECT_EQ(pack.GetEntryCount(), 0u);
+        EXPECT_FALSE(pack.Find(ShaderKey::FromString("packed")));
+        EXPECT_FALSE(pack.Find(ShaderKey::FromString("journaled")));
+        EXPECT_FALSE(std::filesystem::exists(pack.GetJournalPath()));
+
+        pack.Add(ShaderKey::FromString("journaled"), 1, std::vector<std::uint8_t>{ 3 });
+        ASSERT_TRUE(pack.Compact());
+    }
+
+    ShaderPack::Options newEngine = newCompiler;
+    newEngine.engineRevision = ENGINE_REVISION + 1;
+    ShaderPack pack(newEngine);
+    EXPECT_EQ(pack.GetEntryCount(), 0u);
+
+    ShaderPack current(newCompiler);
+    EXPECT_EQ(Bytes(current.Find(ShaderKey::FromString("journaled")).GetBytecode()), std::vector<std::uint8_t>{ 3 });
+}
+
+TEST_F(ShaderPackTest, TornJournalRecord_IsDroppedAndCutOff) {
+    std::filesystem::path journalPath;
+    {
+        ShaderPack pack(MakeOptions());
+        pack.Add(ShaderKey::FromString("whole"), 1, std::vector<std::uint8_t>(100, 7));
+        pack.Add(ShaderKey::FromString("torn"), 2, std::vector<std::uint8_t>(100, 9));
+        journalPath = pack.GetJournalPath();
+    }
+    // As if the process died partway through writing the second record
+    const auto fullSize = std::filesystem::file_size(journalPath);
+    std::filesystem::resize_file(journalPath, fullSize - 30);
+
+    {
+        ShaderPack pack(MakeOptions());
+        EXPECT_TRUE(pack.Find(ShaderKey::FromString("whole")));
+        EXPECT_FALSE(pack.Find(ShaderKey::FromString("torn")));
+        EXPECT_LT(std::filesystem::file_size(journalPath), fullSize - 100);
+
+        pack.Add(ShaderKey::FromString("after"), 3, std::vector<std::uint8_t>(10, 1));
+    }
+
+    ShaderPack pack(MakeOptions());
+    EXPECT_EQ(pack.GetEntryCount(), 2u);
+    EXPECT_TRUE(pack.Find(ShaderKey::FromString("whole")));
+    EXPECT_TRUE(pack.Find(ShaderKey::FromString("after")));
+}
+
+TEST_F(ShaderPackTest, TornJournalPadding_IsCutOffToAWholeRecord) {
+    std::filesystem::path journalPath;
+    std::uintmax_t wholeSize = 0;
+    {
+        ShaderPack pack(MakeOptions());
+        pack.Add(ShaderKey::FromString("whole"), 1, std::vector<std::uint8_t>(100, 7));
+        journalPath = pack.GetJournalPath();
+        wholeSize = std::filesystem::file_size(journalPath);
+        pack.Add(ShaderKey::FromString("padded"), 2, std::vector<std::uint8_t>(100, 9));
+    }
+    // The record and its payload are whole; only its padding is missing
+    const auto fullSize = std::filesystem::file_size(journalPath);
+    ASSERT_EQ(fullSize % 8, 0u);
+    std::filesystem::resize_file(journalPath, fullSize - 2);
+
+    {
+        ShaderPack pack(MakeOptions());
+        EXPECT_TRUE(pack.Find(ShaderKey::FromString("whole")));
+        EXPECT_FALSE(pack.Find(ShaderKey::FromString("padded")));
+        EXPECT_EQ(std::filesystem::file_size(journalPath), wholeSize);
+
+        pack.Add(ShaderKey::FromString("after"), 3, std::vector<std::uint8_t>(10, 1));
+    }
+
+    ShaderPack pack(MakeOptions());
+    EXPECT_EQ(pack.GetEntryCount(), 2u);
+    EXPECT_TRUE(pack.Find(ShaderKey::FromString("after")));
+    EXPECT_EQ(std::filesystem::file_size(journalPath) % 8, 0u);
+}
+
+TEST_F(ShaderPackTest, CorruptJournalRecord_EndsReplay) {
+    std::filesystem::path journalPath;
+    {
+        ShaderPack pack(MakeOptions());
+        pack.Add(ShaderKey::FromString("first"), 1, std::vector<std::uint8_t>(16, 1));
+        pack.Add(ShaderKey::FromString("second"), 2, std::vector<std::uint8_t>(16, 2));
+        journalPath = pack.GetJournalPath();
+    }
+    {
+        std::fstream file(journalPath, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-10, std::ios::end);
+        file.put('\x55');
+    }
+
+    ShaderPack pack(MakeOptions());
+    EXPECT_TRUE(pack.Find(ShaderKey::FromString("first")));
+    EXPECT_FALSE(pack.Find(ShaderKey::FromString("second")));
+}
+
+TEST_F(ShaderPackTest, CorruptPack_IsIgnored) {
+    std::filesystem::path packPath;
+    {
+        ShaderPack pack(MakeOptions());
+        pack.Add(ShaderKey::FromString("shader"), 1, std::vector<std::uint8_t>(32, 1));
+        ASSERT_TRUE(pack.Compact());
+        packPath = pack.GetPath();
+    }
+    {
+        // Inside the index, which follows the 64-byte header
+        std::fstream file(packPath, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(64 + 20);
+        file.put('\x7F');
+    }
+
+    ShaderPack pack(MakeOptions());
+    EXPECT_FALSE(pack.IsMapped());
+    EXPECT_FALSE(pack.Find(ShaderKey::FromString("shader")));
+
+    pack.Add(ShaderKey::FromString("shader"), 1, std::vector<std::uint8_t>(32, 1));
+    ASSERT_TRUE(pack.Compact());
+    EXPECT_TRUE(pack.IsMapped());
+}
+
+TEST_F(ShaderPackTest, LeftoverTemporaryFile_IsRemoved) {
+    std::filesystem::create_directories(directory_);
+    const std::filesystem::path temporaryPath = directory_ / "shaders.pack.tmp";
+    std::ofstream(temporaryPath, std::ios::binary) << "half-written pack";
+
+    ShaderPack pack(MakeOptions());
+    EXPECT_FALSE(std::filesystem::exists(temporaryPath));
+    EXPECT_EQ(pack.GetEntryCount(), 0u);
+}
+
+TEST_F(ShaderPackTest, HeldEntry_OutlivesCompaction) {
+    ShaderPack pack(MakeOptions());
+    const std::vector<std::uint8_t> bytecode(64, 5);
+    pack.Add(ShaderKey::FromString("held"), 1, bytecode);
+    ASSERT_TRUE(pack.Compact());
+
+    const ShaderPackEntry held = pack.Find(ShaderKey::FromString("held"));
+    pack.Add(ShaderKey::FromString("new"), 2, std::vector<std::uint8_t>(8, 6));
+
+    // Windows cannot replace a file that is still mapped; the journal then
+    // keeps the new shader until a later compaction succeeds
+    if (!pack.Compact()) {
+        EXPECT_EQ(pack.GetJournalEntryCount(), 1u);
+    }
+    EXPECT_EQ(Bytes(held.GetBytecode()), bytecode);
+    EXPECT_TRUE(pack.Find(ShaderKey::FromString("held")));
+    EXPECT_TRUE(pack.Find(ShaderKey::FromString("new")));
+}
+
+TEST_F(ShaderPackTest, Clear_DeletesBothFiles) {
+    ShaderPack pack(MakeOptions());
+    pack.Add(ShaderKey::FromString("packed"), 1, std::vector<std::uint8_t>{ 1 });
+    ASSERT_TRUE(pack.Compact());
+    pack.Add(ShaderKey::FromString("journaled"), 1, std::vector<std::uint8_t>{ 2 });
+
+    pack.Clear();
+    EXPECT_EQ(pack.GetEntryCount(), 0u);
+    EXPECT_FALSE(std::filesystem::exists(pack.GetPath()));
+    EXPECT_FALSE(std::filesystem::exists(pack.GetJournalPath()));
+
+    pack.Add(ShaderKey::FromString("fresh"), 1, std::vector<std::uint8_t>{ 3 });
+    ShaderPack reopened(MakeOptions());
+    EXPECT_EQ(reopened.GetEntryCount(), 1u);
+}
+
+TEST_F(ShaderPackTest, ConcurrentFindAndAdd_SeeWholeEntries) {
+    ShaderPack pack(MakeOptions(16));
+    std::atomic<bool> done = false;
+    std::atomic<int> mismatches = 0;
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                for (int i = 0; i < 64; ++i) {
+                    const ShaderPackEntry entry = pack.Find(ShaderKey::FromString(std::to_string(i)));
+                    if (entry && (entry.GetBytecode().size() != static_cast<size_t>(i + 1) ||
+                        entry.GetBytecode()[i] != static_cast<std::uint8_t>(i))) {
+                        ++mismatches;
+                    }
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 64; ++i) {
+        pack.Add(ShaderKey::FromString(std::to_string(i)), i, std::vector<std::uint8_t>(i + 1, static_cast<std::uint8_t>(i)));
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0);
+    EXPECT_EQ(pack.GetEntryCount(), 64u);
+}
+
+TEST_F(ShaderPackTest, Reflection_RoundTripsThroughPack) {
+    ShaderReflectionData reflection;
+    reflection.shaderName = "Basic";
+    reflection.stage = ShaderStage::Pixel;
+    reflection.entryPoint = "PSMain";
+    reflection.shaderModel = "6_0";
+    reflection.targetProfile = "ps_6_0";
+    reflection.threadGroupSizeX = 8;
+    reflection.instructionCount = 42;
+    reflection.rootSignatureHash = 0x1234;
+    reflection.sourceCodeHash = 0xABCD;
+    reflection.includedFiles = { "Common.hlsli", "Lighting.hlsli" };
+    reflection.detectedFeatures = { "RAYTRACING" };
+    reflection.estimatedGPUCost = 1.5f;
+    reflection.compilerVersion = "dxc";
+    reflection.compilationDuration = std::chrono::milliseconds(17);
+
+    ShaderResource constants;
+    constants.name = "PerFrame";
+    constants.resourceType = ShaderResourceType::ConstantBuffer;
+    constants.bindPoint = 0;
+    constants.bindCount = 1;
+    constants.space = 0;
+    constants.visibleStages = ShaderStage::Pixel;
+    constants.size = 64;
+    ShaderParameter parameter{};
+    parameter.name = "viewProjection";
+    parameter.size = 64;
+    parameter.rows = 4;
+    parameter.columns = 4;
+    parameter.isMatrix = true;
+    parameter.defaultValue = { 1, 2, 3 };
+    parameter.hasDefaultValue = true;
+    constants.parameters.push_back(parameter);
+    reflection.constantBuffers.push_back(constants);
+
+    ShaderReflectionData::IncludeDependency dependency;
+    dependency.filePath = "Shaders/Common.hlsli";
+    dependency.fileHash = 99;
+    dependency.modificationTime = std::filesystem::file_time_type(std::filesystem::file_time_type::duration(123456));
+    dependency.isSystemInclude = false;
+    reflection.dependencies.push_back(dependency);
+
+    ShaderReflectionData::PerformanceHint hint;
+    hint.message = "Dynamic branch";
+    hint.line = 12;
+    reflection.performanceHints.push_back(hint);
+
+    {
+        ShaderPack pack(MakeOptions());
+        pack.Add(ShaderKey::FromString("basic"), 1, std::vector<std::uint8_t>{ 1, 2 }, &reflection);
+        ASSERT_TRUE(pack.Compact());
+    }
+
+    ShaderPack pack(MakeOptions());
+    const auto read = pack.Find(ShaderKey::FromString("basic")).ReadReflection();
+    ASSERT_NE(read, nullptr);
+    EXPECT_EQ(read->shaderName, "Basic");
+    EXPECT_EQ(read->stage, ShaderStage::Pixel);
+    EXPECT_EQ(read->targetProfile, "ps_6_0");
+    EXPECT_EQ(read->threadGroupSizeX, 8u);
+    EXPECT_EQ(read->instructionCount, 42u);
+    EXPECT_EQ(read->rootSignatureHash, 0x1234u);
+    EXPECT_EQ(read->sourceCodeHash, 0xABCDu);
+    EXPECT_EQ(read->includedFiles, reflection.includedFiles);
+    EXPECT_EQ(read->detectedFeatures, reflection.detectedFeatures);
+    EXPECT_FLOAT_EQ(read->estimatedGPUCost, 1.5f);
+    EXPECT_EQ(read->compilerVersion, "dxc");
+    EXPECT_EQ(read->compilationDuration, std::chrono::milliseconds(17));
+
+    ASSERT_EQ(read->constantBuffers.size(), 1u);
+    EXPECT_EQ(read->constantBuffers[0].name, "PerFrame");
+    EXPECT_EQ(read->constantBuffers[0].size, 64u);
+    ASSERT_EQ(read->constantBuffers[0].parameters.size(), 1u);
+    EXPECT_EQ(read->constantBuffers[0].parameters[0].name, "viewProjection");
+    EXPECT_TRUE(read->constantBuffers[0].parameters[0].isMatrix);
+    EXPECT_EQ(read->constantBuffers[0].parameters[0].defaultValue, parameter.defaultValue);
+
+    ASSERT_EQ(read->dependencies.size(), 1u);
+    EXPECT_EQ(read->dependencies[0].filePath, dependency.filePath);
+    EXPECT_EQ(read->dependencies[0].modificationTime, dependency.modificationTime);
+    ASSERT_EQ(read->performanceHints.size(), 1u);
+    EXPECT_EQ(read->performanceHints[0].message, "Dynamic branch");
+    EXPECT_EQ(read->performanceHints[0].line, 12u);
+}
+
+TEST(ShaderPackReflectionTests, TruncatedOrOversizedData_ReadsAsNull) {
+    ShaderReflectionData reflection;
+    reflection.shaderName = "Basic";
+    reflection.includedFiles = { "Common.hlsli" };
+    const std::vector<std::uint8_t> data = ShaderPack::SerializeReflection(reflection);
+    ASSERT_NE(ShaderPack::DeserializeReflection(data), nullptr);
+
+    for (size_t size = 0; size < data.size(); ++size) {
+        EXPECT_EQ(ShaderPack::DeserializeReflection(std::span(data).first(size)), nullptr) << size;
+    }
+
+    // A list count far beyond what the data holds must not be allocated
+    std::vector<std::uint8_t> oversized = data;
+    const size_t countOffset = sizeof(std::uint32_t) + reflection.shaderName.size() + sizeof(ShaderStage) + 3 * sizeof(std::uint32_t);
+    oversized[countOffset + 3] = 0x7F;
+    EXPECT_EQ(ShaderPack::DeserializeReflection(oversized), nullptr);
+}
@@ -0,0 +1,125 @@
+// Main.cpp - Renders binary log files written by BinaryLogSink as text
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+
+import Akhanda.Core.Logging;
+
+using namespace Akhanda::Logging;
+
+namespace {
+
+    void PrintUsage() {
+        std::cerr <<
+            "Usage: LogDecoder <file> [options]\n"
+            "  --channel <name>   Only this channel; repeat for several\n"
+            "  --level <level>    Minimum level: trace, debug, info, warning, error, fatal\n"
+            "  --from <seconds>   Skip records before this many seconds after the log started\n"
+            "  --to <seconds>     Skip records after this many seconds after the log started\n";
+    }
+
+    std::optional<LogLevel> ParseLevel(std::string_view text) {
+        std::string lower(text);
+        std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+        if (lower == "trace") return LogLevel::Trace;
+        if (lower == "debug") return LogLevel::Debug;
+        if (lower == "info") return LogLevel::Info;
+        if (lower == "warning" || lower == "warn") return LogLevel::Warning;
+        if (lower == "error") return LogLevel::Error;
+        if (lower == "fatal") return LogLevel::Fatal;
+        return std::nullopt;
+    }
+
+    std::optional<double> ParseSeconds(std::string_view text) {
+        double seconds = 0.0;
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), seconds);
+        if (error != std::errc() || end != text.data() + text.size()) return std::nullopt;
+        return seconds;
+    }
+}
+
+// ============================================================================
+// Application Entry Point
+// ============================================================================
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        PrintUsage();
+        return 2;
+    }
+
+    const std::string path = argv[1];
+    BinaryLogFilter filter;
+    std::optional<double> fromSeconds;
+    std::optional<double> toSeconds;
+
+    for (int i = 2; i < argc; ++i) {
+        const std::string_view option = argv[i];
+        if (i + 1 >= argc) {
+            PrintUsage();
+            return 2;
+        }
+        const std::string_view value = argv[++i];
+
+        if (option == "--channel") {
+            filter.channels.emplace_back(value);
+        }
+        else if (option == "--level") {
+            const std::optional<LogLevel> level = ParseLevel(value);
+            if (!level) {
+                std::cerr << "Unknown level: " << value << "\n";
+                return 2;
+            }
+            filter.minimumLevel = *level;
+        }
+        else if (option == "--from" || option == "--to") {
+            const std::optional<double> seconds = ParseSeconds(value);
+            if (!seconds) {
+                std::cerr << "Invalid time: " << value << "\n";
+                return 2;
+            }
+            (option == "--from" ? fromSeconds : toSeconds) = seconds;
+        }
+        else {
+            PrintUsage();
+            return 2;
+        }
+    }
+
+    // Times on the command line are relative to when the log was opened
+    if (fromSeconds || toSeconds) {
+        const BinaryLogReader header(path);
+        const auto start = header.GetStartTime();
+        const auto offset = [start](double seconds) {
+            return start + std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::duration<double>(seconds));
+        };
+        if (fromSeconds) filter.from = offset(*fromSeconds);
+        if (toSeconds) filter.to = offset(*toSeconds);
+    }
+
+    BinaryLogReader reader(path, filter);
+    if (!reader.IsOpen()) {
+        std::cerr << path << ": " << reader.GetError() << "\n";
+        return 1;
+    }
+
+    BinaryLogRecord record;
+    while (reader.Next(record)) {
+        const std::string line = FormatBinaryLogRecord(record);
+        std::fwrite(line.data(), 1, line.size(), stdout);
+        std::fputc('\n', stdout);
+    }
+
+    if (!reader.GetError().empty()) {
+        std::cerr << path << ": " << reader.GetError() << "\n";
+        return 1;
+    }
+    return 0;
+}